@@ -78,7 +78,7 @@ AC_DEFUN([AX_LIBCPATH_CHECK_LOCAL],
   AC_CHECK_HEADERS([errno.h sys/stat.h sys/syslimits.h])
 
   dnl Path functions used in libcpath/libcpath_path.h
-  AC_CHECK_FUNCS([chdir getcwd])
+  AC_CHECK_FUNCS([chdir getcwd stat])
 
   AS_IF(
     [test "x$ac_cv_func_chdir" != xyes],
@@ -95,6 +95,45 @@ AC_DEFUN([AX_LIBCPATH_CHECK_LOCAL],
     ])
 
   AX_LIBCPATH_CHECK_FUNC_MKDIR
+
+  dnl Headers included in libcpath/libcpath_context.h
+  AC_CHECK_HEADERS([fcntl.h])
+
+  dnl Directory descriptor functions used in libcpath/libcpath_context.c and libcpath/libcpath_path.c
+  AC_CHECK_FUNCS([close fstatat mkdirat openat])
+
+  dnl Thread functions used in libcpath/libcpath_directory_plan.c
+  AC_CHECK_HEADERS([pthread.h])
+
+  AS_IF(
+    [test "x$ac_cv_header_pthread_h" = xyes],
+    [AC_CHECK_LIB(
+      pthread,
+      pthread_create,
+      [AC_DEFINE(
+        [HAVE_PTHREAD],
+        [1],
+        [Define to 1 if you have the pthread_create function.])
+      AC_SUBST(
+        [PTHREAD_LIBADD],
+        [-lpthread])
+      AC_SUBST(
+        [ax_pthread_pc_libs_private],
+        [-lpthread])
+      ])
+    ])
+
+  dnl Headers included in libcpath/libcpath_io_uring.h
+  AC_CHECK_HEADERS([linux/io_uring.h linux/stat.h sys/mman.h sys/syscall.h])
+
+  AS_IF(
+    [test "x$ac_cv_header_linux_io_uring_h" = xyes],
+    [AC_CHECK_DECLS(
+      [IORING_OP_MKDIRAT, IORING_OP_STATX],
+      [],
+      [],
+      [#include <linux/io_uring.h>])
+    ])
   ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,87 @@
+/*
+ * Path view type definitions for libcpath
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_PATH_VIEW_H )
+#define _LIBCPATH_PATH_VIEW_H
+
+#include <libcpath/features.h>
+#include <libcpath/types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The path view is allocated by the caller and refers to the path
+ * without copying it, hence the path must remain valid while the
+ * path view is used
+ */
+typedef struct libcpath_path_view libcpath_path_view_t;
+
+struct libcpath_path_view
+{
+	/* The path
+	 */
+	const char *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The index of the start of the segments that have not been iterated
+	 */
+	size_t front_index;
+
+	/* The index of the end of the segments that have not been iterated
+	 */
+	size_t back_index;
+};
+
+#if defined( LIBCPATH_HAVE_WIDE_CHARACTER_TYPE )
+
+typedef struct libcpath_path_view_wide libcpath_path_view_wide_t;
+
+struct libcpath_path_view_wide
+{
+	/* The path
+	 */
+	const wchar_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The index of the start of the segments that have not been iterated
+	 */
+	size_t front_index;
+
+	/* The index of the end of the segments that have not been iterated
+	 */
+	size_t back_index;
+};
+
+#endif /* defined( LIBCPATH_HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_PATH_VIEW_H ) */
+
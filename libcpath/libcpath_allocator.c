@@ -0,0 +1,367 @@
+/*
+ * Allocator functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcpath_allocator.h"
+#include "libcpath_libcerror.h"
+
+/* The allocator of the library, when not set the system allocator is used
+ */
+static libcpath_allocator_t libcpath_allocator = { NULL, NULL, NULL, NULL };
+
+#if defined( HAVE_LIBCPATH_THREAD_ALLOCATOR )
+
+/* The allocator of the thread, overrides the allocator of the library
+ */
+static LIBCPATH_ALLOCATOR_THREAD_LOCAL libcpath_allocator_t libcpath_thread_allocator = { NULL, NULL, NULL, NULL };
+
+#endif /* defined( HAVE_LIBCPATH_THREAD_ALLOCATOR ) */
+
+/* Checks the allocator functions
+ * Either all functions must be set or none
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_allocator_check_functions(
+     void *(*allocate_function)(
+              size_t size,
+              void *user_data ),
+     void *(*reallocate_function)(
+              void *data,
+              size_t size,
+              void *user_data ),
+     void (*free_function)(
+            void *data,
+            void *user_data ),
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_allocator_check_functions";
+
+	if( ( allocate_function == NULL )
+	 && ( reallocate_function == NULL )
+	 && ( free_function == NULL ) )
+	{
+		return( 1 );
+	}
+	if( allocate_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocate function.",
+		 function );
+
+		return( -1 );
+	}
+	if( reallocate_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reallocate function.",
+		 function );
+
+		return( -1 );
+	}
+	if( free_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free function.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the allocator of the library
+ * All functions must be set or none, in which case the system allocator is used
+ * This function is not thread-safe and should be called before other functions
+ * of the library are used. Strings and other data returned by the library must
+ * be freed using the free function of the allocator that was active, on the
+ * calling thread, when they were returned
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_set_allocator(
+     void *(*allocate_function)(
+              size_t size,
+              void *user_data ),
+     void *(*reallocate_function)(
+              void *data,
+              size_t size,
+              void *user_data ),
+     void (*free_function)(
+            void *data,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_set_allocator";
+
+	if( libcpath_allocator_check_functions(
+	     allocate_function,
+	     reallocate_function,
+	     free_function,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocator functions.",
+		 function );
+
+		return( -1 );
+	}
+	libcpath_allocator.allocate_function   = allocate_function;
+	libcpath_allocator.reallocate_function = reallocate_function;
+	libcpath_allocator.free_function       = free_function;
+	libcpath_allocator.user_data           = user_data;
+
+	return( 1 );
+}
+
+/* Sets the allocator of the calling thread, which overrides the allocator of the library
+ * All functions must be set or none, in which case the allocator of the library is used
+ * Objects, such as contexts, arenas, directory caches, directory plans and path
+ * builders, store the allocator that was active when they were created and use it
+ * for their own memory, hence these can be freed on any thread or after the
+ * allocator was changed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_set_thread_allocator(
+     void *(*allocate_function)(
+              size_t size,
+              void *user_data ),
+     void *(*reallocate_function)(
+              void *data,
+              size_t size,
+              void *user_data ),
+     void (*free_function)(
+            void *data,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_set_thread_allocator";
+
+	if( libcpath_allocator_check_functions(
+	     allocate_function,
+	     reallocate_function,
+	     free_function,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocator functions.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCPATH_THREAD_ALLOCATOR )
+	libcpath_thread_allocator.allocate_function   = allocate_function;
+	libcpath_thread_allocator.reallocate_function = reallocate_function;
+	libcpath_thread_allocator.free_function       = free_function;
+	libcpath_thread_allocator.user_data           = user_data;
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: thread allocator not supported.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Retrieves the current allocator, that of the thread, the library or the system
+ * The functions of the system allocator are not set
+ * Objects store the current allocator when created and use it for all their
+ * subsequent allocations, since the current allocator can differ between
+ * threads and change over time
+ */
+void libcpath_allocator_get_current(
+      libcpath_allocator_t *allocator )
+{
+	if( allocator == NULL )
+	{
+		return;
+	}
+#if defined( HAVE_LIBCPATH_THREAD_ALLOCATOR )
+	if( libcpath_thread_allocator.allocate_function != NULL )
+	{
+		*allocator = libcpath_thread_allocator;
+
+		return;
+	}
+#endif
+	*allocator = libcpath_allocator;
+}
+
+/* Allocates data using a specific allocator
+ * Returns a pointer to the data if successful or NULL on error
+ */
+void *libcpath_allocator_allocate_using(
+       const libcpath_allocator_t *allocator,
+       size_t size )
+{
+	if( ( allocator == NULL )
+	 || ( allocator->allocate_function == NULL ) )
+	{
+		return( memory_allocate(
+		         size ) );
+	}
+	return( allocator->allocate_function(
+	         size,
+	         allocator->user_data ) );
+}
+
+/* Reallocates data using a specific allocator
+ * Returns a pointer to the data if successful or NULL on error
+ */
+void *libcpath_allocator_reallocate_using(
+       const libcpath_allocator_t *allocator,
+       void *data,
+       size_t size )
+{
+	if( ( allocator == NULL )
+	 || ( allocator->reallocate_function == NULL ) )
+	{
+		return( memory_reallocate(
+		         data,
+		         size ) );
+	}
+	return( allocator->reallocate_function(
+	         data,
+	         size,
+	         allocator->user_data ) );
+}
+
+/* Frees data using a specific allocator
+ */
+void libcpath_allocator_free_using(
+      const libcpath_allocator_t *allocator,
+      void *data )
+{
+	if( ( allocator == NULL )
+	 || ( allocator->free_function == NULL ) )
+	{
+		memory_free(
+		 data );
+
+		return;
+	}
+	allocator->free_function(
+	 data,
+	 allocator->user_data );
+}
+
+/* Allocates data using the allocator of the thread, the library or the system
+ * Returns a pointer to the data if successful or NULL on error
+ */
+void *libcpath_allocator_allocate(
+       size_t size )
+{
+#if defined( HAVE_LIBCPATH_THREAD_ALLOCATOR )
+	if( libcpath_thread_allocator.allocate_function != NULL )
+	{
+		return( libcpath_thread_allocator.allocate_function(
+		         size,
+		         libcpath_thread_allocator.user_data ) );
+	}
+#endif
+	if( libcpath_allocator.allocate_function != NULL )
+	{
+		return( libcpath_allocator.allocate_function(
+		         size,
+		         libcpath_allocator.user_data ) );
+	}
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Reallocates data using the allocator of the thread, the library or the system
+ * Returns a pointer to the data if successful or NULL on error
+ */
+void *libcpath_allocator_reallocate(
+       void *data,
+       size_t size )
+{
+#if defined( HAVE_LIBCPATH_THREAD_ALLOCATOR )
+	if( libcpath_thread_allocator.reallocate_function != NULL )
+	{
+		return( libcpath_thread_allocator.reallocate_function(
+		         data,
+		         size,
+		         libcpath_thread_allocator.user_data ) );
+	}
+#endif
+	if( libcpath_allocator.reallocate_function != NULL )
+	{
+		return( libcpath_allocator.reallocate_function(
+		         data,
+		         size,
+		         libcpath_allocator.user_data ) );
+	}
+	return( memory_reallocate(
+	         data,
+	         size ) );
+}
+
+/* Frees data using the allocator of the thread, the library or the system
+ */
+void libcpath_allocator_free(
+      void *data )
+{
+#if defined( HAVE_LIBCPATH_THREAD_ALLOCATOR )
+	if( libcpath_thread_allocator.free_function != NULL )
+	{
+		libcpath_thread_allocator.free_function(
+		 data,
+		 libcpath_thread_allocator.user_data );
+
+		return;
+	}
+#endif
+	if( libcpath_allocator.free_function != NULL )
+	{
+		libcpath_allocator.free_function(
+		 data,
+		 libcpath_allocator.user_data );
+
+		return;
+	}
+	memory_free(
+	 data );
+}
+
@@ -0,0 +1,161 @@
+/*
+ * Allocator functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_ALLOCATOR_H )
+#define _LIBCPATH_ALLOCATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The thread allocator relies on compiler provided thread local storage
+ */
+#if defined( _MSC_VER )
+#define HAVE_LIBCPATH_THREAD_ALLOCATOR	1
+#define LIBCPATH_ALLOCATOR_THREAD_LOCAL	__declspec( thread )
+
+#elif defined( __GNUC__ )
+#define HAVE_LIBCPATH_THREAD_ALLOCATOR	1
+#define LIBCPATH_ALLOCATOR_THREAD_LOCAL	__thread
+
+#endif
+
+typedef struct libcpath_allocator libcpath_allocator_t;
+
+struct libcpath_allocator
+{
+	/* The allocate function
+	 */
+	void *(*allocate_function)(
+	         size_t size,
+	         void *user_data );
+
+	/* The reallocate function
+	 */
+	void *(*reallocate_function)(
+	         void *data,
+	         size_t size,
+	         void *user_data );
+
+	/* The free function
+	 */
+	void (*free_function)(
+	       void *data,
+	       void *user_data );
+
+	/* The user data
+	 */
+	void *user_data;
+};
+
+#define libcpath_allocator_allocate_structure( type ) \
+	(type *) libcpath_allocator_allocate( sizeof( type ) )
+
+#define libcpath_allocator_allocate_structure_using( allocator, type ) \
+	(type *) libcpath_allocator_allocate_using( allocator, sizeof( type ) )
+
+#define libcpath_allocator_allocate_narrow_string( size ) \
+	(char *) libcpath_allocator_allocate( sizeof( char ) * ( size ) )
+
+#define libcpath_allocator_allocate_wide_string( size ) \
+	(wchar_t *) libcpath_allocator_allocate( sizeof( wchar_t ) * ( size ) )
+
+LIBCPATH_EXTERN \
+int libcpath_set_allocator(
+     void *(*allocate_function)(
+              size_t size,
+              void *user_data ),
+     void *(*reallocate_function)(
+              void *data,
+              size_t size,
+              void *user_data ),
+     void (*free_function)(
+            void *data,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_set_thread_allocator(
+     void *(*allocate_function)(
+              size_t size,
+              void *user_data ),
+     void *(*reallocate_function)(
+              void *data,
+              size_t size,
+              void *user_data ),
+     void (*free_function)(
+            void *data,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libcpath_allocator_check_functions(
+     void *(*allocate_function)(
+              size_t size,
+              void *user_data ),
+     void *(*reallocate_function)(
+              void *data,
+              size_t size,
+              void *user_data ),
+     void (*free_function)(
+            void *data,
+            void *user_data ),
+     libcerror_error_t **error );
+
+void libcpath_allocator_get_current(
+      libcpath_allocator_t *allocator );
+
+void *libcpath_allocator_allocate_using(
+       const libcpath_allocator_t *allocator,
+       size_t size );
+
+void *libcpath_allocator_reallocate_using(
+       const libcpath_allocator_t *allocator,
+       void *data,
+       size_t size );
+
+void libcpath_allocator_free_using(
+      const libcpath_allocator_t *allocator,
+      void *data );
+
+void *libcpath_allocator_allocate(
+       size_t size );
+
+void *libcpath_allocator_reallocate(
+       void *data,
+       size_t size );
+
+void libcpath_allocator_free(
+      void *data );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_ALLOCATOR_H ) */
+
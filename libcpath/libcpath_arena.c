@@ -0,0 +1,548 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcpath_allocator.h"
+#include "libcpath_arena.h"
+#include "libcpath_definitions.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_types.h"
+
+/* Creates a chunk
+ * The chunk and its data are stored in a single allocation made using the allocator
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_arena_chunk_initialize(
+     libcpath_arena_chunk_t **chunk,
+     size_t data_size,
+     const libcpath_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_arena_chunk_initialize";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - sizeof( libcpath_arena_chunk_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk = (libcpath_arena_chunk_t *) libcpath_allocator_allocate_using(
+	                                     allocator,
+	                                     sizeof( libcpath_arena_chunk_t ) + data_size );
+
+	if( *chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk.",
+		 function );
+
+		return( -1 );
+	}
+	( *chunk )->next_chunk     = NULL;
+	( *chunk )->data           = &( ( (uint8_t *) *chunk )[ sizeof( libcpath_arena_chunk_t ) ] );
+	( *chunk )->data_size      = data_size;
+	( *chunk )->used_data_size = 0;
+
+	return( 1 );
+}
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * The chunk size is the size of the first chunk and the minimum size of additional chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_arena_initialize(
+     libcpath_arena_t **arena,
+     size_t chunk_size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libcpath_allocator_t allocator;
+
+	libcpath_internal_arena_t *internal_arena = NULL;
+	static char *function                     = "libcpath_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid chunk size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - sizeof( libcpath_arena_chunk_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBCPATH_ARENA_FLAG_ALLOW_GROWTH ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	libcpath_allocator_get_current(
+	 &allocator );
+
+	internal_arena = libcpath_allocator_allocate_structure_using(
+	                  &allocator,
+	                  libcpath_internal_arena_t );
+
+	if( internal_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_arena,
+	     0,
+	     sizeof( libcpath_internal_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_arena );
+
+		return( -1 );
+	}
+	internal_arena->allocator = allocator;
+
+	if( libcpath_arena_chunk_initialize(
+	     &( internal_arena->first_chunk ),
+	     chunk_size,
+	     &allocator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create first chunk.",
+		 function );
+
+		goto on_error;
+	}
+	internal_arena->current_chunk = internal_arena->first_chunk;
+	internal_arena->chunk_size    = chunk_size;
+	internal_arena->flags         = flags;
+
+	*arena = (libcpath_arena_t *) internal_arena;
+
+	return( 1 );
+
+on_error:
+	if( internal_arena != NULL )
+	{
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_arena );
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * All data allocated from the arena is freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_arena_free(
+     libcpath_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libcpath_allocator_t allocator;
+
+	libcpath_arena_chunk_t *chunk             = NULL;
+	libcpath_arena_chunk_t *next_chunk        = NULL;
+	libcpath_internal_arena_t *internal_arena = NULL;
+	static char *function                     = "libcpath_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		internal_arena = (libcpath_internal_arena_t *) *arena;
+		*arena         = NULL;
+
+		chunk = internal_arena->first_chunk;
+
+		while( chunk != NULL )
+		{
+			next_chunk = chunk->next_chunk;
+
+			libcpath_allocator_free_using(
+			 &( internal_arena->allocator ),
+			 chunk );
+
+			chunk = next_chunk;
+		}
+		allocator = internal_arena->allocator;
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_arena );
+	}
+	return( 1 );
+}
+
+/* Resets an arena
+ * All data allocated from the arena is released at once, the chunks
+ * are retained and reused by subsequent allocations
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_arena_reset(
+     libcpath_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libcpath_arena_chunk_t *chunk             = NULL;
+	libcpath_internal_arena_t *internal_arena = NULL;
+	static char *function                     = "libcpath_arena_reset";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = (libcpath_internal_arena_t *) arena;
+
+	for( chunk = internal_arena->first_chunk;
+	     chunk != NULL;
+	     chunk = chunk->next_chunk )
+	{
+		chunk->used_data_size = 0;
+	}
+	internal_arena->current_chunk = internal_arena->first_chunk;
+
+	return( 1 );
+}
+
+/* Allocates data from an arena
+ * The data remains valid until the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_arena_allocate(
+     libcpath_arena_t *arena,
+     size_t size,
+     void **data,
+     libcerror_error_t **error )
+{
+	libcpath_arena_chunk_t *chunk             = NULL;
+	libcpath_internal_arena_t *internal_arena = NULL;
+	static char *function                     = "libcpath_arena_allocate";
+	size_t chunk_size                         = 0;
+	size_t data_offset                        = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = (libcpath_internal_arena_t *) arena;
+
+	if( internal_arena->current_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid arena - missing current chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - sizeof( libcpath_arena_chunk_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	chunk = internal_arena->current_chunk;
+
+	data_offset = ( chunk->used_data_size + ( LIBCPATH_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBCPATH_ARENA_ALIGNMENT - 1 );
+
+	if( ( data_offset > chunk->data_size )
+	 || ( size > ( chunk->data_size - data_offset ) ) )
+	{
+		if( ( internal_arena->flags & LIBCPATH_ARENA_FLAG_ALLOW_GROWTH ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: insufficient space in arena.",
+			 function );
+
+			return( -1 );
+		}
+		/* Chunks after the current chunk are unused and are reused if large enough
+		 */
+		if( ( chunk->next_chunk != NULL )
+		 && ( chunk->next_chunk->data_size >= size ) )
+		{
+			chunk = chunk->next_chunk;
+		}
+		else
+		{
+			chunk_size = internal_arena->chunk_size;
+
+			if( chunk_size < size )
+			{
+				chunk_size = size;
+			}
+			chunk = NULL;
+
+			if( libcpath_arena_chunk_initialize(
+			     &chunk,
+			     chunk_size,
+			     &( internal_arena->allocator ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create chunk.",
+				 function );
+
+				return( -1 );
+			}
+			chunk->next_chunk                         = internal_arena->current_chunk->next_chunk;
+			internal_arena->current_chunk->next_chunk = chunk;
+		}
+		internal_arena->current_chunk = chunk;
+
+		data_offset = 0;
+	}
+	*data = (void *) &( chunk->data[ data_offset ] );
+
+	chunk->used_data_size = data_offset + size;
+
+	return( 1 );
+}
+
+/* Retrieves the data that is available in the current chunk of an arena
+ * The data is not allocated, a subsequent allocation of at most the
+ * available data size returns the same data
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_arena_get_available_data(
+     libcpath_arena_t *arena,
+     void **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libcpath_arena_chunk_t *chunk             = NULL;
+	libcpath_internal_arena_t *internal_arena = NULL;
+	static char *function                     = "libcpath_arena_get_available_data";
+	size_t data_offset                        = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = (libcpath_internal_arena_t *) arena;
+
+	if( internal_arena->current_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid arena - missing current chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	chunk = internal_arena->current_chunk;
+
+	data_offset = ( chunk->used_data_size + ( LIBCPATH_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBCPATH_ARENA_ALIGNMENT - 1 );
+
+	if( data_offset >= chunk->data_size )
+	{
+		*data      = NULL;
+		*data_size = 0;
+	}
+	else
+	{
+		*data      = (void *) &( chunk->data[ data_offset ] );
+		*data_size = chunk->data_size - data_offset;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,128 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_ARENA_H )
+#define _LIBCPATH_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_allocator.h"
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The alignment of the allocations in an arena
+ */
+#define LIBCPATH_ARENA_ALIGNMENT	8
+
+typedef struct libcpath_arena_chunk libcpath_arena_chunk_t;
+
+struct libcpath_arena_chunk
+{
+	/* The next chunk
+	 */
+	libcpath_arena_chunk_t *next_chunk;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The used data size
+	 */
+	size_t used_data_size;
+};
+
+typedef struct libcpath_internal_arena libcpath_internal_arena_t;
+
+struct libcpath_internal_arena
+{
+	/* The first chunk
+	 */
+	libcpath_arena_chunk_t *first_chunk;
+
+	/* The current chunk
+	 */
+	libcpath_arena_chunk_t *current_chunk;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The allocator the arena was created with
+	 */
+	libcpath_allocator_t allocator;
+};
+
+int libcpath_arena_chunk_initialize(
+     libcpath_arena_chunk_t **chunk,
+     size_t data_size,
+     const libcpath_allocator_t *allocator,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_arena_initialize(
+     libcpath_arena_t **arena,
+     size_t chunk_size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_arena_free(
+     libcpath_arena_t **arena,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_arena_reset(
+     libcpath_arena_t *arena,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_arena_allocate(
+     libcpath_arena_t *arena,
+     size_t size,
+     void **data,
+     libcerror_error_t **error );
+
+int libcpath_arena_get_available_data(
+     libcpath_arena_t *arena,
+     void **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_ARENA_H ) */
+
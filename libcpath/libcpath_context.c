@@ -0,0 +1,872 @@
+/*
+ * Context functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libcpath_allocator.h"
+#include "libcpath_codepage.h"
+#include "libcpath_context.h"
+#include "libcpath_definitions.h"
+#include "libcpath_io_uring.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_libclocale.h"
+#include "libcpath_path.h"
+#include "libcpath_types.h"
+#include "libcpath_unused.h"
+
+#if defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR )
+
+/* The flags the working directory descriptor is opened with, O_PATH is used
+ * where available since the descriptor is only used to resolve paths
+ */
+#if defined( O_PATH )
+#define LIBCPATH_CONTEXT_OPEN_FLAGS_BASE	( O_PATH | O_DIRECTORY )
+#else
+#define LIBCPATH_CONTEXT_OPEN_FLAGS_BASE	( O_RDONLY | O_DIRECTORY )
+#endif
+
+#if defined( O_CLOEXEC )
+#define LIBCPATH_CONTEXT_OPEN_FLAGS		( LIBCPATH_CONTEXT_OPEN_FLAGS_BASE | O_CLOEXEC )
+#else
+#define LIBCPATH_CONTEXT_OPEN_FLAGS		LIBCPATH_CONTEXT_OPEN_FLAGS_BASE
+#endif
+
+#endif /* defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR ) */
+
+/* Creates a context
+ * Make sure the value context is referencing, is set to NULL
+ * The codepage of the context is initialized with the codepage of the library
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_context_initialize(
+     libcpath_context_t **context,
+     libcerror_error_t **error )
+{
+	libcpath_allocator_t allocator;
+
+	libcpath_internal_context_t *internal_context = NULL;
+	static char *function                         = "libcpath_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	libcpath_allocator_get_current(
+	 &allocator );
+
+	internal_context = libcpath_allocator_allocate_structure_using(
+	                    &allocator,
+	                    libcpath_internal_context_t );
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_context,
+	     0,
+	     sizeof( libcpath_internal_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_context );
+
+		return( -1 );
+	}
+	internal_context->allocator = allocator;
+
+#if defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR )
+	internal_context->working_directory_descriptor = -1;
+#endif
+
+	if( libclocale_codepage_get(
+	     &( internal_context->codepage ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve codepage.",
+		 function );
+
+		goto on_error;
+	}
+	*context = (libcpath_context_t *) internal_context;
+
+	return( 1 );
+
+on_error:
+	if( internal_context != NULL )
+	{
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_context );
+	}
+	return( -1 );
+}
+
+/* Frees a context
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_context_free(
+     libcpath_context_t **context,
+     libcerror_error_t **error )
+{
+	libcpath_allocator_t allocator;
+
+	libcpath_internal_context_t *internal_context = NULL;
+	static char *function                         = "libcpath_context_free";
+	int result                                    = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		internal_context = (libcpath_internal_context_t *) *context;
+
+		if( libcpath_context_reset_working_directory(
+		     *context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to reset working directory.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBCPATH_IO_URING )
+		if( libcpath_context_free_io_uring(
+		     *context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free io_uring.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		*context = NULL;
+
+		allocator = internal_context->allocator;
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_context );
+	}
+	return( result );
+}
+
+/* Retrieves the narrow string codepage of a context
+ * A value of 0 represents no codepage, UTF-8 encoding is used instead
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_context_get_codepage(
+     libcpath_context_t *context,
+     int *codepage,
+     libcerror_error_t **error )
+{
+	libcpath_internal_context_t *internal_context = NULL;
+	static char *function                         = "libcpath_context_get_codepage";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libcpath_internal_context_t *) context;
+
+	if( codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codepage.",
+		 function );
+
+		return( -1 );
+	}
+	*codepage = internal_context->codepage;
+
+	return( 1 );
+}
+
+/* Sets the narrow string codepage of a context
+ * A value of 0 represents no codepage, UTF-8 encoding is used instead
+ * The codepage only applies to the context, the codepage of the library is not changed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_context_set_codepage(
+     libcpath_context_t *context,
+     int codepage,
+     libcerror_error_t **error )
+{
+	libcpath_internal_context_t *internal_context = NULL;
+	static char *function                         = "libcpath_context_set_codepage";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libcpath_internal_context_t *) context;
+
+	if( ( codepage != 0 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ASCII )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_1 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_2 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_3 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_4 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_5 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_6 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_7 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_8 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_9 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_10 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_11 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_13 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_14 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_15 )
+	 && ( codepage != LIBCPATH_CODEPAGE_ISO_8859_16 )
+	 && ( codepage != LIBCPATH_CODEPAGE_KOI8_R )
+	 && ( codepage != LIBCPATH_CODEPAGE_KOI8_U )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_874 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_932 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_936 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_949 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_950 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_1250 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_1251 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_1252 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_1253 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_1254 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_1255 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_1256 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_1257 )
+	 && ( codepage != LIBCPATH_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported codepage: %d.",
+		 function,
+		 codepage );
+
+		return( -1 );
+	}
+	internal_context->codepage = codepage;
+
+	return( 1 );
+}
+
+/* Sets the working directory of a context
+ * The working directory is used instead of the current working directory of
+ * the process to resolve relative paths with the context functions, hence
+ * different threads can use different working directories
+ * A relative directory name is resolved against the current working directory
+ * of the context. The working directory is not required to exist unless
+ * LIBCPATH_WORKING_DIRECTORY_FLAG_OPEN is set, in which case it is opened and
+ * kept open as a directory descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_context_set_working_directory(
+     libcpath_context_t *context,
+     const char *directory_name,
+     size_t directory_name_length,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libcpath_internal_context_t *internal_context = NULL;
+	static char *function                         = "libcpath_context_set_working_directory";
+
+#if !defined( WINAPI )
+	char *full_path                               = NULL;
+	char *working_directory                       = NULL;
+	size_t full_path_size                         = 0;
+	size_t working_directory_length               = 0;
+	size_t working_directory_size                 = 0;
+#endif
+#if defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR )
+	int working_directory_descriptor              = -1;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libcpath_internal_context_t *) context;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBCPATH_WORKING_DIRECTORY_FLAG_OPEN ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	LIBCPATH_UNREFERENCED_PARAMETER( internal_context )
+	LIBCPATH_UNREFERENCED_PARAMETER( directory_name_length )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: working directory not supported.",
+	 function );
+
+	return( -1 );
+#else
+	if( internal_context->working_directory != NULL )
+	{
+		working_directory_length = internal_context->working_directory_size - 1;
+	}
+	if( libcpath_path_get_full_path_with_working_directory(
+	     internal_context->working_directory,
+	     working_directory_length,
+	     directory_name,
+	     directory_name_length,
+	     &full_path,
+	     &full_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path of working directory.",
+		 function );
+
+		goto on_error;
+	}
+	/* The working directory is owned by the context, hence it is allocated
+	 * using the allocator of the context
+	 */
+	working_directory = (char *) libcpath_allocator_allocate_using(
+	                              &( internal_context->allocator ),
+	                              sizeof( char ) * full_path_size );
+
+	if( working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create working directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     working_directory,
+	     full_path,
+	     sizeof( char ) * full_path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy working directory.",
+		 function );
+
+		goto on_error;
+	}
+	working_directory_size = full_path_size;
+
+	libcpath_allocator_free(
+	 full_path );
+
+	full_path = NULL;
+	if( ( flags & LIBCPATH_WORKING_DIRECTORY_FLAG_OPEN ) != 0 )
+	{
+#if defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR )
+		working_directory_descriptor = open(
+		                                working_directory,
+		                                LIBCPATH_CONTEXT_OPEN_FLAGS );
+
+		if( working_directory_descriptor == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open working directory.",
+			 function );
+
+			goto on_error;
+		}
+#else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: working directory descriptor not supported.",
+		 function );
+
+		goto on_error;
+#endif
+	}
+	if( libcpath_context_reset_working_directory(
+	     context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to reset working directory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_context->working_directory      = working_directory;
+	internal_context->working_directory_size = working_directory_size;
+
+#if defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR )
+	internal_context->working_directory_descriptor = working_directory_descriptor;
+#endif
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR )
+	if( working_directory_descriptor != -1 )
+	{
+		close(
+		 working_directory_descriptor );
+	}
+#endif
+	if( working_directory != NULL )
+	{
+		libcpath_allocator_free_using(
+		 &( internal_context->allocator ),
+		 working_directory );
+	}
+	if( full_path != NULL )
+	{
+		libcpath_allocator_free(
+		 full_path );
+	}
+	return( -1 );
+
+#endif /* defined( WINAPI ) */
+}
+
+/* Resets the working directory of a context
+ * The context functions use the current working directory of the process again
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_context_reset_working_directory(
+     libcpath_context_t *context,
+     libcerror_error_t **error )
+{
+	libcpath_internal_context_t *internal_context = NULL;
+	static char *function                         = "libcpath_context_reset_working_directory";
+	int result                                    = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libcpath_internal_context_t *) context;
+
+#if defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR )
+	if( internal_context->working_directory_descriptor != -1 )
+	{
+		if( close(
+		     internal_context->working_directory_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close working directory descriptor.",
+			 function );
+
+			result = -1;
+		}
+		internal_context->working_directory_descriptor = -1;
+	}
+#endif
+#if !defined( WINAPI )
+	if( internal_context->working_directory != NULL )
+	{
+		libcpath_allocator_free_using(
+		 &( internal_context->allocator ),
+		 internal_context->working_directory );
+
+		internal_context->working_directory      = NULL;
+		internal_context->working_directory_size = 0;
+	}
+#else
+	LIBCPATH_UNREFERENCED_PARAMETER( internal_context )
+#endif
+	return( result );
+}
+
+/* Retrieves the working directory of a context
+ * The working directory is owned by the context and remains valid until
+ * the working directory of the context is changed or the context is freed
+ * Returns 1 if successful, 0 if no working directory is set or -1 on error
+ */
+int libcpath_context_get_working_directory(
+     libcpath_context_t *context,
+     const char **working_directory,
+     size_t *working_directory_length,
+     libcerror_error_t **error )
+{
+	libcpath_internal_context_t *internal_context = NULL;
+	static char *function                         = "libcpath_context_get_working_directory";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libcpath_internal_context_t *) context;
+
+	if( working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid working directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( working_directory_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid working directory length.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( WINAPI )
+	if( internal_context->working_directory != NULL )
+	{
+		*working_directory        = internal_context->working_directory;
+		*working_directory_length = internal_context->working_directory_size - 1;
+
+		return( 1 );
+	}
+#else
+	LIBCPATH_UNREFERENCED_PARAMETER( internal_context )
+#endif
+	return( 0 );
+}
+
+/* Retrieves the working directory descriptor of a context
+ * The descriptor is owned by the context and remains open until
+ * the working directory of the context is changed or the context is freed
+ * Returns 1 if successful, 0 if no working directory descriptor is set or -1 on error
+ */
+int libcpath_context_get_working_directory_descriptor(
+     libcpath_context_t *context,
+     int *descriptor,
+     libcerror_error_t **error )
+{
+	libcpath_internal_context_t *internal_context = NULL;
+	static char *function                         = "libcpath_context_get_working_directory_descriptor";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libcpath_internal_context_t *) context;
+
+	if( descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR )
+	if( internal_context->working_directory_descriptor != -1 )
+	{
+		*descriptor = internal_context->working_directory_descriptor;
+
+		return( 1 );
+	}
+#else
+	LIBCPATH_UNREFERENCED_PARAMETER( internal_context )
+#endif
+	return( 0 );
+}
+
+#if defined( HAVE_LIBCPATH_IO_URING )
+
+/* Retrieves the io_uring of a context
+ * The io_uring is created on first use and reused afterwards, it is recreated
+ * when it has less submission queue entries than the number of entries
+ * The io_uring is owned by the context and remains valid until it is freed
+ * with libcpath_context_free_io_uring or the context is freed
+ * Returns 1 if successful, 0 if io_uring is not supported by the kernel or -1 on error
+ */
+int libcpath_context_get_io_uring(
+     libcpath_context_t *context,
+     uint32_t number_of_entries,
+     libcpath_io_uring_t **io_uring,
+     libcerror_error_t **error )
+{
+	libcpath_internal_context_t *internal_context = NULL;
+	static char *function                         = "libcpath_context_get_io_uring";
+	int result                                    = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libcpath_internal_context_t *) context;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_context->io_uring != NULL )
+	 && ( internal_context->io_uring->number_of_entries < number_of_entries ) )
+	{
+		if( libcpath_context_free_io_uring(
+		     context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free io_uring.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_context->io_uring == NULL )
+	{
+		result = libcpath_io_uring_initialize(
+		          &( internal_context->io_uring ),
+		          number_of_entries,
+		          &( internal_context->allocator ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create io_uring.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	*io_uring = internal_context->io_uring;
+
+	return( 1 );
+}
+
+/* Frees the io_uring of a context
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_context_free_io_uring(
+     libcpath_context_t *context,
+     libcerror_error_t **error )
+{
+	libcpath_internal_context_t *internal_context = NULL;
+	static char *function                         = "libcpath_context_free_io_uring";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libcpath_internal_context_t *) context;
+
+	if( internal_context->io_uring != NULL )
+	{
+		if( libcpath_io_uring_free(
+		     &( internal_context->io_uring ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free io_uring.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBCPATH_IO_URING ) */
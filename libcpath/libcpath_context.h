@@ -0,0 +1,150 @@
+/*
+ * Context functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_CONTEXT_H )
+#define _LIBCPATH_CONTEXT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) && !defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#include "libcpath_allocator.h"
+#include "libcpath_extern.h"
+#include "libcpath_io_uring.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The working directory of a context can be backed by a directory descriptor
+ */
+#if !defined( WINAPI ) && defined( HAVE_FCNTL_H ) && defined( HAVE_CLOSE ) && defined( O_DIRECTORY )
+#define HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR	1
+#endif
+
+typedef struct libcpath_internal_context libcpath_internal_context_t;
+
+struct libcpath_internal_context
+{
+	/* The narrow string codepage
+	 */
+	int codepage;
+
+#if !defined( WINAPI )
+	/* The working directory
+	 */
+	char *working_directory;
+
+	/* The working directory size
+	 */
+	size_t working_directory_size;
+#endif
+
+#if defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR )
+	/* The working directory descriptor
+	 */
+	int working_directory_descriptor;
+#endif
+
+#if defined( HAVE_LIBCPATH_IO_URING )
+	/* The io_uring that is reused by the batch directory functions
+	 */
+	libcpath_io_uring_t *io_uring;
+#endif
+
+	/* The allocator the context was created with
+	 */
+	libcpath_allocator_t allocator;
+};
+
+LIBCPATH_EXTERN \
+int libcpath_context_initialize(
+     libcpath_context_t **context,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_context_free(
+     libcpath_context_t **context,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_context_get_codepage(
+     libcpath_context_t *context,
+     int *codepage,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_context_set_codepage(
+     libcpath_context_t *context,
+     int codepage,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_context_set_working_directory(
+     libcpath_context_t *context,
+     const char *directory_name,
+     size_t directory_name_length,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_context_reset_working_directory(
+     libcpath_context_t *context,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_context_get_working_directory(
+     libcpath_context_t *context,
+     const char **working_directory,
+     size_t *working_directory_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_context_get_working_directory_descriptor(
+     libcpath_context_t *context,
+     int *descriptor,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBCPATH_IO_URING )
+
+int libcpath_context_get_io_uring(
+     libcpath_context_t *context,
+     uint32_t number_of_entries,
+     libcpath_io_uring_t **io_uring,
+     libcerror_error_t **error );
+
+int libcpath_context_free_io_uring(
+     libcpath_context_t *context,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBCPATH_IO_URING ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_CONTEXT_H ) */
+
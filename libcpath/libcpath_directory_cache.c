@@ -0,0 +1,813 @@
+/*
+ * Directory cache functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libcpath_allocator.h"
+#include "libcpath_arena.h"
+#include "libcpath_definitions.h"
+#include "libcpath_directory_cache.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_path.h"
+#include "libcpath_types.h"
+
+/* Creates a directory cache
+ * Make sure the value directory_cache is referencing, is set to NULL
+ * The directory cache is initially empty
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_initialize(
+     libcpath_directory_cache_t **directory_cache,
+     libcerror_error_t **error )
+{
+	libcpath_allocator_t allocator;
+
+	libcpath_internal_directory_cache_t *internal_directory_cache = NULL;
+	static char *function                                         = "libcpath_directory_cache_initialize";
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	libcpath_allocator_get_current(
+	 &allocator );
+
+	internal_directory_cache = libcpath_allocator_allocate_structure_using(
+	                            &allocator,
+	                            libcpath_internal_directory_cache_t );
+
+	if( internal_directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_directory_cache,
+	     0,
+	     sizeof( libcpath_internal_directory_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory cache.",
+		 function );
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_directory_cache );
+
+		return( -1 );
+	}
+	internal_directory_cache->allocator = allocator;
+
+	if( libcpath_directory_cache_resize_entries(
+	     internal_directory_cache,
+	     LIBCPATH_DIRECTORY_CACHE_INITIAL_NUMBER_OF_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_arena_initialize(
+	     &( internal_directory_cache->arena ),
+	     LIBCPATH_DIRECTORY_CACHE_ARENA_CHUNK_SIZE,
+	     LIBCPATH_ARENA_FLAG_ALLOW_GROWTH,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	*directory_cache = (libcpath_directory_cache_t *) internal_directory_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_directory_cache != NULL )
+	{
+		if( internal_directory_cache->entries != NULL )
+		{
+			libcpath_allocator_free_using(
+			 &allocator,
+			 internal_directory_cache->entries );
+		}
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_directory_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a directory cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_free(
+     libcpath_directory_cache_t **directory_cache,
+     libcerror_error_t **error )
+{
+	libcpath_allocator_t allocator;
+
+	libcpath_internal_directory_cache_t *internal_directory_cache = NULL;
+	static char *function                                         = "libcpath_directory_cache_free";
+	int result                                                    = 1;
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_cache != NULL )
+	{
+		internal_directory_cache = (libcpath_internal_directory_cache_t *) *directory_cache;
+		*directory_cache         = NULL;
+
+		if( libcpath_arena_free(
+		     &( internal_directory_cache->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			result = -1;
+		}
+		allocator = internal_directory_cache->allocator;
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_directory_cache->entries );
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_directory_cache );
+	}
+	return( result );
+}
+
+/* Clears a directory cache
+ * All the paths are removed, the memory of the directory cache is retained
+ * and reused by subsequently added paths
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_clear(
+     libcpath_directory_cache_t *directory_cache,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_cache_t *internal_directory_cache = NULL;
+	static char *function                                         = "libcpath_directory_cache_clear";
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_cache = (libcpath_internal_directory_cache_t *) directory_cache;
+
+	if( memory_set(
+	     internal_directory_cache->entries,
+	     0,
+	     sizeof( libcpath_directory_cache_entry_t ) * internal_directory_cache->number_of_allocated_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_cache->number_of_entries = 0;
+
+	if( libcpath_arena_reset(
+	     internal_directory_cache->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset arena.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of paths in a directory cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_get_number_of_entries(
+     libcpath_directory_cache_t *directory_cache,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_cache_t *internal_directory_cache = NULL;
+	static char *function                                         = "libcpath_directory_cache_get_number_of_entries";
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_cache = (libcpath_internal_directory_cache_t *) directory_cache;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = internal_directory_cache->number_of_entries;
+
+	return( 1 );
+}
+
+/* Calculates the hash of a path
+ * The 32-bit FNV-1a hash is used
+ * Returns the hash
+ */
+uint32_t libcpath_directory_cache_calculate_hash(
+          const char *path,
+          size_t path_length )
+{
+	size_t path_index = 0;
+	uint32_t hash     = 0x811c9dc5UL;
+
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		hash ^= (uint8_t) path[ path_index ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Resizes the entries of a directory cache
+ * The number of entries must be a power of 2, the used entries are rehashed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_resize_entries(
+     libcpath_internal_directory_cache_t *internal_directory_cache,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	libcpath_directory_cache_entry_t *entries = NULL;
+	static char *function                     = "libcpath_directory_cache_resize_entries";
+	size_t entries_size                       = 0;
+	uint32_t entry_index                      = 0;
+	uint32_t entry_index_mask                 = 0;
+	int old_entry_index                       = 0;
+
+	if( internal_directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= internal_directory_cache->number_of_entries )
+	 || ( ( number_of_entries & ( number_of_entries - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_entries > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libcpath_directory_cache_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	entries_size = sizeof( libcpath_directory_cache_entry_t ) * number_of_entries;
+
+	entries = (libcpath_directory_cache_entry_t *) libcpath_allocator_allocate_using(
+	                                                &( internal_directory_cache->allocator ),
+	                                                entries_size );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		libcpath_allocator_free_using(
+		 &( internal_directory_cache->allocator ),
+		 entries );
+
+		return( -1 );
+	}
+	entry_index_mask = (uint32_t) number_of_entries - 1;
+
+	for( old_entry_index = 0;
+	     old_entry_index < internal_directory_cache->number_of_allocated_entries;
+	     old_entry_index++ )
+	{
+		if( internal_directory_cache->entries[ old_entry_index ].path == NULL )
+		{
+			continue;
+		}
+		entry_index = internal_directory_cache->entries[ old_entry_index ].hash & entry_index_mask;
+
+		while( entries[ entry_index ].path != NULL )
+		{
+			entry_index = ( entry_index + 1 ) & entry_index_mask;
+		}
+		entries[ entry_index ] = internal_directory_cache->entries[ old_entry_index ];
+	}
+	if( internal_directory_cache->entries != NULL )
+	{
+		libcpath_allocator_free_using(
+		 &( internal_directory_cache->allocator ),
+		 internal_directory_cache->entries );
+	}
+	internal_directory_cache->entries                     = entries;
+	internal_directory_cache->number_of_allocated_entries = number_of_entries;
+
+	return( 1 );
+}
+
+/* Determines if a directory cache contains a normalized path
+ * Returns 1 if the path is in the cache, 0 if not or -1 on error
+ */
+int libcpath_directory_cache_has_normalized_path(
+     libcpath_directory_cache_t *directory_cache,
+     const char *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	libcpath_directory_cache_entry_t *entry                       = NULL;
+	libcpath_internal_directory_cache_t *internal_directory_cache = NULL;
+	static char *function                                         = "libcpath_directory_cache_has_normalized_path";
+	uint32_t entry_index                                          = 0;
+	uint32_t entry_index_mask                                     = 0;
+	uint32_t hash                                                 = 0;
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_cache = (libcpath_internal_directory_cache_t *) directory_cache;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	hash             = libcpath_directory_cache_calculate_hash(
+	                    path,
+	                    path_length );
+	entry_index_mask = (uint32_t) internal_directory_cache->number_of_allocated_entries - 1;
+	entry_index      = hash & entry_index_mask;
+
+	/* The entries are never completely used, hence an unused entry ends the probe
+	 */
+	while( internal_directory_cache->entries[ entry_index ].path != NULL )
+	{
+		entry = &( internal_directory_cache->entries[ entry_index ] );
+
+		if( ( entry->hash == hash )
+		 && ( entry->path_length == path_length )
+		 && ( memory_compare(
+		       entry->path,
+		       path,
+		       path_length ) == 0 ) )
+		{
+			return( 1 );
+		}
+		entry_index = ( entry_index + 1 ) & entry_index_mask;
+	}
+	return( 0 );
+}
+
+/* Adds a normalized path to a directory cache
+ * If not NULL entry path is set to the copy of the path stored in the cache,
+ * which remains valid until the cache is cleared or freed
+ * Returns 1 if successful, 0 if the path already was in the cache or -1 on error
+ */
+int libcpath_directory_cache_add_normalized_path(
+     libcpath_directory_cache_t *directory_cache,
+     const char *path,
+     size_t path_length,
+     const char **entry_path,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_cache_t *internal_directory_cache = NULL;
+	char *safe_entry_path                                         = NULL;
+	static char *function                                         = "libcpath_directory_cache_add_normalized_path";
+	uint32_t entry_index                                          = 0;
+	uint32_t entry_index_mask                                     = 0;
+	uint32_t hash                                                 = 0;
+	int result                                                    = 0;
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_cache = (libcpath_internal_directory_cache_t *) directory_cache;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcpath_directory_cache_has_normalized_path(
+	          directory_cache,
+	          path,
+	          path_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if path is in cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 0 );
+	}
+	/* Keep at least half of the entries unused so that the probes remain short
+	 */
+	if( internal_directory_cache->number_of_entries >= ( internal_directory_cache->number_of_allocated_entries / 2 ) )
+	{
+		if( libcpath_directory_cache_resize_entries(
+		     internal_directory_cache,
+		     internal_directory_cache->number_of_allocated_entries * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcpath_arena_allocate(
+	     internal_directory_cache->arena,
+	     sizeof( char ) * ( path_length + 1 ),
+	     (void **) &safe_entry_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > 0 )
+	{
+		if( memory_copy(
+		     safe_entry_path,
+		     path,
+		     sizeof( char ) * path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	safe_entry_path[ path_length ] = 0;
+
+	hash             = libcpath_directory_cache_calculate_hash(
+	                    path,
+	                    path_length );
+	entry_index_mask = (uint32_t) internal_directory_cache->number_of_allocated_entries - 1;
+	entry_index      = hash & entry_index_mask;
+
+	while( internal_directory_cache->entries[ entry_index ].path != NULL )
+	{
+		entry_index = ( entry_index + 1 ) & entry_index_mask;
+	}
+	internal_directory_cache->entries[ entry_index ].path        = safe_entry_path;
+	internal_directory_cache->entries[ entry_index ].path_length = path_length;
+	internal_directory_cache->entries[ entry_index ].hash        = hash;
+
+	internal_directory_cache->number_of_entries += 1;
+
+	if( entry_path != NULL )
+	{
+		*entry_path = safe_entry_path;
+	}
+
+	return( 1 );
+}
+
+/* Determines if a directory cache contains a directory
+ * The directory is looked up by its full path, which is determined lexically,
+ * symbolic links are not resolved
+ * Returns 1 if the directory is in the cache, 0 if not or -1 on error
+ */
+int libcpath_directory_cache_has_directory(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error )
+{
+	char *full_path             = NULL;
+	static char *function       = "libcpath_directory_cache_has_directory";
+	size_t full_path_size       = 0;
+	int result                  = 0;
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_full_path(
+	     directory_name,
+	     directory_name_length,
+	     &full_path,
+	     &full_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path of directory name.",
+		 function );
+
+		goto on_error;
+	}
+	result = libcpath_directory_cache_has_normalized_path(
+	          directory_cache,
+	          full_path,
+	          full_path_size - 1,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if directory is in cache.",
+		 function );
+
+		goto on_error;
+	}
+	libcpath_allocator_free(
+	 full_path );
+
+	return( result );
+
+on_error:
+	if( full_path != NULL )
+	{
+		libcpath_allocator_free(
+		 full_path );
+	}
+	return( -1 );
+}
+
+/* Adds a directory to a directory cache
+ * The caller asserts that the directory exists
+ * The directory is added by its full path, which is determined lexically,
+ * symbolic links are not resolved
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_add_directory(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error )
+{
+	char *full_path             = NULL;
+	static char *function       = "libcpath_directory_cache_add_directory";
+	size_t full_path_size       = 0;
+	int result                  = 0;
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_full_path(
+	     directory_name,
+	     directory_name_length,
+	     &full_path,
+	     &full_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path of directory name.",
+		 function );
+
+		goto on_error;
+	}
+	result = libcpath_directory_cache_add_normalized_path(
+	          directory_cache,
+	          full_path,
+	          full_path_size - 1,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add directory to cache.",
+		 function );
+
+		goto on_error;
+	}
+	libcpath_allocator_free(
+	 full_path );
+
+	return( 1 );
+
+on_error:
+	if( full_path != NULL )
+	{
+		libcpath_allocator_free(
+		 full_path );
+	}
+	return( -1 );
+}
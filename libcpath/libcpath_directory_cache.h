@@ -0,0 +1,149 @@
+/*
+ * Directory cache functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_DIRECTORY_CACHE_H )
+#define _LIBCPATH_DIRECTORY_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_allocator.h"
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of entries of a directory cache, must be a power of 2
+ */
+#define LIBCPATH_DIRECTORY_CACHE_INITIAL_NUMBER_OF_ENTRIES	1024
+
+/* The chunk size of the arena that stores the paths of a directory cache
+ */
+#define LIBCPATH_DIRECTORY_CACHE_ARENA_CHUNK_SIZE		65536
+
+typedef struct libcpath_directory_cache_entry libcpath_directory_cache_entry_t;
+
+struct libcpath_directory_cache_entry
+{
+	/* The path, NULL if the entry is not used
+	 */
+	const char *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The hash of the path
+	 */
+	uint32_t hash;
+};
+
+typedef struct libcpath_internal_directory_cache libcpath_internal_directory_cache_t;
+
+struct libcpath_internal_directory_cache
+{
+	/* The entries
+	 */
+	libcpath_directory_cache_entry_t *entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The number of used entries
+	 */
+	int number_of_entries;
+
+	/* The arena that stores the paths
+	 */
+	libcpath_arena_t *arena;
+
+	/* The allocator the directory cache was created with
+	 */
+	libcpath_allocator_t allocator;
+};
+
+LIBCPATH_EXTERN \
+int libcpath_directory_cache_initialize(
+     libcpath_directory_cache_t **directory_cache,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_cache_free(
+     libcpath_directory_cache_t **directory_cache,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_cache_clear(
+     libcpath_directory_cache_t *directory_cache,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_cache_get_number_of_entries(
+     libcpath_directory_cache_t *directory_cache,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+uint32_t libcpath_directory_cache_calculate_hash(
+          const char *path,
+          size_t path_length );
+
+int libcpath_directory_cache_resize_entries(
+     libcpath_internal_directory_cache_t *internal_directory_cache,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libcpath_directory_cache_has_normalized_path(
+     libcpath_directory_cache_t *directory_cache,
+     const char *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int libcpath_directory_cache_add_normalized_path(
+     libcpath_directory_cache_t *directory_cache,
+     const char *path,
+     size_t path_length,
+     const char **entry_path,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_cache_has_directory(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_cache_add_directory(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_DIRECTORY_CACHE_H ) */
+
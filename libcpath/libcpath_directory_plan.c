@@ -0,0 +1,854 @@
+/*
+ * Directory plan functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#include "libcpath_allocator.h"
+#include "libcpath_definitions.h"
+#include "libcpath_directory_cache.h"
+#include "libcpath_directory_plan.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_path.h"
+#include "libcpath_types.h"
+
+/* Creates a directory plan
+ * Make sure the value directory_plan is referencing, is set to NULL
+ * The directory plan is initially empty
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_plan_initialize(
+     libcpath_directory_plan_t **directory_plan,
+     libcerror_error_t **error )
+{
+	libcpath_allocator_t allocator;
+
+	libcpath_internal_directory_plan_t *internal_directory_plan = NULL;
+	static char *function                                       = "libcpath_directory_plan_initialize";
+
+	if( directory_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_plan != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory plan value already set.",
+		 function );
+
+		return( -1 );
+	}
+	libcpath_allocator_get_current(
+	 &allocator );
+
+	internal_directory_plan = libcpath_allocator_allocate_structure_using(
+	                           &allocator,
+	                           libcpath_internal_directory_plan_t );
+
+	if( internal_directory_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory plan.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_directory_plan,
+	     0,
+	     sizeof( libcpath_internal_directory_plan_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory plan.",
+		 function );
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_directory_plan );
+
+		return( -1 );
+	}
+	internal_directory_plan->allocator = allocator;
+
+	if( libcpath_directory_cache_initialize(
+	     &( internal_directory_plan->directory_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory cache.",
+		 function );
+
+		goto on_error;
+	}
+	internal_directory_plan->entries = (libcpath_directory_plan_entry_t *) libcpath_allocator_allocate_using(
+	                                                                        &allocator,
+	                                                                        sizeof( libcpath_directory_plan_entry_t ) * LIBCPATH_DIRECTORY_PLAN_INITIAL_NUMBER_OF_ENTRIES );
+
+	if( internal_directory_plan->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	internal_directory_plan->number_of_allocated_entries = LIBCPATH_DIRECTORY_PLAN_INITIAL_NUMBER_OF_ENTRIES;
+
+	*directory_plan = (libcpath_directory_plan_t *) internal_directory_plan;
+
+	return( 1 );
+
+on_error:
+	if( internal_directory_plan != NULL )
+	{
+		if( internal_directory_plan->directory_cache != NULL )
+		{
+			libcpath_directory_cache_free(
+			 &( internal_directory_plan->directory_cache ),
+			 NULL );
+		}
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_directory_plan );
+	}
+	return( -1 );
+}
+
+/* Frees a directory plan
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_plan_free(
+     libcpath_directory_plan_t **directory_plan,
+     libcerror_error_t **error )
+{
+	libcpath_allocator_t allocator;
+
+	libcpath_internal_directory_plan_t *internal_directory_plan = NULL;
+	static char *function                                       = "libcpath_directory_plan_free";
+	int result                                                  = 1;
+
+	if( directory_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_plan != NULL )
+	{
+		internal_directory_plan = (libcpath_internal_directory_plan_t *) *directory_plan;
+		*directory_plan         = NULL;
+
+		if( libcpath_directory_cache_free(
+		     &( internal_directory_plan->directory_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory cache.",
+			 function );
+
+			result = -1;
+		}
+		allocator = internal_directory_plan->allocator;
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_directory_plan->entries );
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_directory_plan );
+	}
+	return( result );
+}
+
+/* Appends an entry to a directory plan
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_plan_append_entry(
+     libcpath_internal_directory_plan_t *internal_directory_plan,
+     const char *path,
+     int level,
+     libcerror_error_t **error )
+{
+	libcpath_directory_plan_entry_t *reallocation = NULL;
+	static char *function                         = "libcpath_directory_plan_append_entry";
+	int number_of_allocated_entries               = 0;
+
+	if( internal_directory_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory_plan->number_of_entries >= internal_directory_plan->number_of_allocated_entries )
+	{
+		number_of_allocated_entries = internal_directory_plan->number_of_allocated_entries;
+
+		if( (size_t) number_of_allocated_entries > ( (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libcpath_directory_plan_entry_t ) ) / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid directory plan - number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_allocated_entries *= 2;
+
+		reallocation = (libcpath_directory_plan_entry_t *) libcpath_allocator_reallocate_using(
+		                                                    &( internal_directory_plan->allocator ),
+		                                                    internal_directory_plan->entries,
+		                                                    sizeof( libcpath_directory_plan_entry_t ) * number_of_allocated_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_directory_plan->entries                     = reallocation;
+		internal_directory_plan->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	internal_directory_plan->entries[ internal_directory_plan->number_of_entries ].path  = path;
+	internal_directory_plan->entries[ internal_directory_plan->number_of_entries ].level = level;
+
+	internal_directory_plan->number_of_entries += 1;
+
+	if( level > internal_directory_plan->maximum_level )
+	{
+		internal_directory_plan->maximum_level = level;
+	}
+	return( 1 );
+}
+
+/* Adds the parent directories of a file path to a directory plan
+ * The file path is normalized lexically, symbolic links are not resolved.
+ * Directories that already are in the plan are added only once
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_plan_add_file_path(
+     libcpath_directory_plan_t *directory_plan,
+     const char *file_path,
+     size_t file_path_length,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_plan_t *internal_directory_plan = NULL;
+	const char *entry_path                                      = NULL;
+	char *normalized_path                                       = NULL;
+	static char *function                                       = "libcpath_directory_plan_add_file_path";
+	size_t directory_name_length                                = 0;
+	size_t normalized_path_size                                 = 0;
+	size_t path_index                                           = 0;
+	int level                                                   = 0;
+	int result                                                  = 0;
+
+	if( directory_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory plan.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_plan = (libcpath_internal_directory_plan_t *) directory_plan;
+
+	if( libcpath_path_normalize(
+	     file_path,
+	     file_path_length,
+	     &normalized_path,
+	     &normalized_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to normalize file path.",
+		 function );
+
+		goto on_error;
+	}
+	/* The directory name ends at the last separator, a file path without
+	 * a separator or in the root directory has no directories to make
+	 */
+	for( path_index = 0;
+	     path_index < ( normalized_path_size - 1 );
+	     path_index++ )
+	{
+		if( normalized_path[ path_index ] == (char) LIBCPATH_SEPARATOR )
+		{
+			directory_name_length = path_index;
+
+			level++;
+		}
+	}
+	/* Add the directory and its parent directories, from the deepest up,
+	 * until a directory is found that already is in the plan
+	 */
+	while( directory_name_length > 0 )
+	{
+		result = libcpath_directory_cache_add_normalized_path(
+		          internal_directory_plan->directory_cache,
+		          normalized_path,
+		          directory_name_length,
+		          &entry_path,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add directory to cache.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcpath_directory_plan_append_entry(
+		     internal_directory_plan,
+		     entry_path,
+		     level,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry.",
+			 function );
+
+			goto on_error;
+		}
+		do
+		{
+			directory_name_length--;
+		}
+		while( ( directory_name_length > 0 )
+		    && ( normalized_path[ directory_name_length ] != (char) LIBCPATH_SEPARATOR ) );
+
+		level--;
+	}
+	libcpath_allocator_free(
+	 normalized_path );
+
+	return( 1 );
+
+on_error:
+	if( normalized_path != NULL )
+	{
+		libcpath_allocator_free(
+		 normalized_path );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of directories in a directory plan
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_plan_get_number_of_directories(
+     libcpath_directory_plan_t *directory_plan,
+     int *number_of_directories,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_plan_t *internal_directory_plan = NULL;
+	static char *function                                       = "libcpath_directory_plan_get_number_of_directories";
+
+	if( directory_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory plan.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_plan = (libcpath_internal_directory_plan_t *) directory_plan;
+
+	if( number_of_directories == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of directories.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_directories = internal_directory_plan->number_of_entries;
+
+	return( 1 );
+}
+
+#if !defined( WINAPI )
+
+/* Makes a directory of a directory plan
+ * An existing directory is not considered an error
+ * Returns 0 if successful or the error code otherwise
+ */
+int libcpath_directory_plan_make_directory(
+     const char *path )
+{
+	struct stat file_statistics;
+
+	if( mkdir(
+	     path,
+	     0755 ) == 0 )
+	{
+		return( 0 );
+	}
+	if( errno != EEXIST )
+	{
+		return( errno );
+	}
+	if( ( stat(
+	       path,
+	       &file_statistics ) != 0 )
+	 || ( S_ISDIR( file_statistics.st_mode ) == 0 ) )
+	{
+		return( EEXIST );
+	}
+	return( 0 );
+}
+
+/* Makes the directories of a level of a directory plan
+ * This function is run by every thread that makes the level, the directories
+ * are claimed one at a time so that the threads remain evenly loaded
+ * Returns NULL
+ */
+void *libcpath_directory_plan_make_level(
+       void *parameters )
+{
+	libcpath_directory_plan_level_t *level = NULL;
+	const char *path                       = NULL;
+	int entry_index                        = 0;
+	int error_code                         = 0;
+	int sorted_index                       = 0;
+
+#if defined( HAVE_LIBCPATH_DIRECTORY_PLAN_THREADS )
+	int expected_error_code                = 0;
+#endif
+
+	level = (libcpath_directory_plan_level_t *) parameters;
+
+	while( level != NULL )
+	{
+#if defined( HAVE_LIBCPATH_DIRECTORY_PLAN_THREADS )
+		sorted_index = __atomic_fetch_add(
+		                &( level->next_index ),
+		                1,
+		                __ATOMIC_RELAXED );
+
+		if( __atomic_load_n(
+		     &( level->error_code ),
+		     __ATOMIC_RELAXED ) != 0 )
+		{
+			break;
+		}
+#else
+		sorted_index = level->next_index++;
+
+		if( level->error_code != 0 )
+		{
+			break;
+		}
+#endif
+		if( sorted_index >= level->end_index )
+		{
+			break;
+		}
+		entry_index = level->entry_indexes[ sorted_index ];
+		path        = level->internal_directory_plan->entries[ entry_index ].path;
+
+		error_code = libcpath_directory_plan_make_directory(
+		              path );
+
+		if( error_code != 0 )
+		{
+			/* Only the first error is reported
+			 */
+#if defined( HAVE_LIBCPATH_DIRECTORY_PLAN_THREADS )
+			expected_error_code = 0;
+
+			if( __atomic_compare_exchange_n(
+			     &( level->error_code ),
+			     &expected_error_code,
+			     error_code,
+			     0,
+			     __ATOMIC_RELAXED,
+			     __ATOMIC_RELAXED ) != 0 )
+			{
+				level->error_entry_index = entry_index;
+			}
+#else
+			level->error_code        = error_code;
+			level->error_entry_index = entry_index;
+#endif
+			break;
+		}
+	}
+	return( NULL );
+}
+
+#endif /* !defined( WINAPI ) */
+
+/* Makes the directories of a directory plan
+ * The directories are made level by level, hence a directory is always made
+ * after its parent directory. The directories of a level are divided among
+ * up to number of threads threads when threads are supported
+ * An existing directory is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_plan_make_directories(
+     libcpath_directory_plan_t *directory_plan,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_plan_t *internal_directory_plan = NULL;
+	static char *function                                       = "libcpath_directory_plan_make_directories";
+
+#if !defined( WINAPI )
+	libcpath_directory_plan_level_t level;
+
+	int *entry_indexes                                          = NULL;
+	int *level_offsets                                          = NULL;
+	int entry_index                                             = 0;
+	int level_index                                             = 0;
+#endif
+#if defined( HAVE_LIBCPATH_DIRECTORY_PLAN_THREADS )
+	pthread_t *threads                                          = NULL;
+	int number_of_level_threads                                 = 0;
+	int number_of_running_threads                               = 0;
+	int thread_index                                            = 0;
+#endif
+
+	if( directory_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LIBCPATH_DIRECTORY_PLAN_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: making the directories of a directory plan is not supported.",
+	 function );
+
+	return( -1 );
+#else
+	internal_directory_plan = (libcpath_internal_directory_plan_t *) directory_plan;
+
+	if( internal_directory_plan->number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	/* Sort the entries by level with a counting sort
+	 */
+	level_offsets = (int *) libcpath_allocator_allocate(
+	                         sizeof( int ) * ( internal_directory_plan->maximum_level + 1 ) );
+
+	if( level_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create level offsets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     level_offsets,
+	     0,
+	     sizeof( int ) * ( internal_directory_plan->maximum_level + 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear level offsets.",
+		 function );
+
+		goto on_error;
+	}
+	entry_indexes = (int *) libcpath_allocator_allocate(
+	                         sizeof( int ) * internal_directory_plan->number_of_entries );
+
+	if( entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	/* The level offsets are first used to count the entries of the level before
+	 * and then to determine the offset of the entries of each level
+	 */
+	for( entry_index = 0;
+	     entry_index < internal_directory_plan->number_of_entries;
+	     entry_index++ )
+	{
+		level_index = internal_directory_plan->entries[ entry_index ].level;
+
+		if( level_index < internal_directory_plan->maximum_level )
+		{
+			level_offsets[ level_index + 1 ] += 1;
+		}
+	}
+	for( level_index = 1;
+	     level_index <= internal_directory_plan->maximum_level;
+	     level_index++ )
+	{
+		level_offsets[ level_index ] += level_offsets[ level_index - 1 ];
+	}
+	/* Afterwards the level offset contains the offset of the entries of the next level
+	 */
+	for( entry_index = 0;
+	     entry_index < internal_directory_plan->number_of_entries;
+	     entry_index++ )
+	{
+		level_index = internal_directory_plan->entries[ entry_index ].level;
+
+		entry_indexes[ level_offsets[ level_index ] ] = entry_index;
+
+		level_offsets[ level_index ] += 1;
+	}
+#if defined( HAVE_LIBCPATH_DIRECTORY_PLAN_THREADS )
+	if( number_of_threads > 1 )
+	{
+		threads = (pthread_t *) libcpath_allocator_allocate(
+		                         sizeof( pthread_t ) * ( number_of_threads - 1 ) );
+
+		if( threads == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	level.internal_directory_plan = internal_directory_plan;
+	level.entry_indexes           = entry_indexes;
+	level.end_index               = 0;
+
+	for( level_index = 1;
+	     level_index <= internal_directory_plan->maximum_level;
+	     level_index++ )
+	{
+		level.next_index        = level.end_index;
+		level.end_index         = level_offsets[ level_index ];
+		level.error_code        = 0;
+		level.error_entry_index = 0;
+
+		if( level.next_index == level.end_index )
+		{
+			continue;
+		}
+#if defined( HAVE_LIBCPATH_DIRECTORY_PLAN_THREADS )
+		number_of_level_threads = ( level.end_index - level.next_index ) / LIBCPATH_DIRECTORY_PLAN_MINIMUM_ENTRIES_PER_THREAD;
+
+		if( number_of_level_threads > number_of_threads )
+		{
+			number_of_level_threads = number_of_threads;
+		}
+		/* The calling thread makes directories as well, if a thread cannot
+		 * be created the level is made by the threads that are running
+		 */
+		for( number_of_running_threads = 0;
+		     number_of_running_threads < ( number_of_level_threads - 1 );
+		     number_of_running_threads++ )
+		{
+			if( pthread_create(
+			     &( threads[ number_of_running_threads ] ),
+			     NULL,
+			     &libcpath_directory_plan_make_level,
+			     (void *) &level ) != 0 )
+			{
+				break;
+			}
+		}
+#endif
+		libcpath_directory_plan_make_level(
+		 (void *) &level );
+
+#if defined( HAVE_LIBCPATH_DIRECTORY_PLAN_THREADS )
+		for( thread_index = 0;
+		     thread_index < number_of_running_threads;
+		     thread_index++ )
+		{
+			pthread_join(
+			 threads[ thread_index ],
+			 NULL );
+		}
+#endif
+		if( level.error_code != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 level.error_code,
+			 "%s: unable to make directory: %s.",
+			 function,
+			 internal_directory_plan->entries[ level.error_entry_index ].path );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBCPATH_DIRECTORY_PLAN_THREADS )
+	if( threads != NULL )
+	{
+		libcpath_allocator_free(
+		 threads );
+	}
+#endif
+	libcpath_allocator_free(
+	 entry_indexes );
+
+	libcpath_allocator_free(
+	 level_offsets );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBCPATH_DIRECTORY_PLAN_THREADS )
+	if( threads != NULL )
+	{
+		libcpath_allocator_free(
+		 threads );
+	}
+#endif
+	if( entry_indexes != NULL )
+	{
+		libcpath_allocator_free(
+		 entry_indexes );
+	}
+	if( level_offsets != NULL )
+	{
+		libcpath_allocator_free(
+		 level_offsets );
+	}
+	return( -1 );
+
+#endif /* defined( WINAPI ) */
+}
@@ -0,0 +1,182 @@
+/*
+ * Directory plan functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_DIRECTORY_PLAN_H )
+#define _LIBCPATH_DIRECTORY_PLAN_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libcpath_allocator.h"
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The directories of a level are made by multiple threads, this relies
+ * on POSIX threads and the GNU C atomic builtins
+ */
+#if !defined( WINAPI ) && defined( HAVE_PTHREAD_H ) && defined( HAVE_PTHREAD ) && defined( __GNUC__ )
+#define HAVE_LIBCPATH_DIRECTORY_PLAN_THREADS	1
+#endif
+
+/* The initial number of entries of a directory plan
+ */
+#define LIBCPATH_DIRECTORY_PLAN_INITIAL_NUMBER_OF_ENTRIES	256
+
+/* The maximum number of threads a directory plan is executed with
+ */
+#define LIBCPATH_DIRECTORY_PLAN_MAXIMUM_NUMBER_OF_THREADS	256
+
+/* The minimum number of directories of a level per thread, levels with
+ * fewer directories are made by fewer threads
+ */
+#define LIBCPATH_DIRECTORY_PLAN_MINIMUM_ENTRIES_PER_THREAD	16
+
+typedef struct libcpath_directory_plan_entry libcpath_directory_plan_entry_t;
+
+struct libcpath_directory_plan_entry
+{
+	/* The path, stored in the directory cache
+	 */
+	const char *path;
+
+	/* The level, the number of segments of the path
+	 */
+	int level;
+};
+
+typedef struct libcpath_internal_directory_plan libcpath_internal_directory_plan_t;
+
+struct libcpath_internal_directory_plan
+{
+	/* The directory cache, used to deduplicate the directories
+	 */
+	libcpath_directory_cache_t *directory_cache;
+
+	/* The entries
+	 */
+	libcpath_directory_plan_entry_t *entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum level
+	 */
+	int maximum_level;
+
+	/* The allocator the directory plan was created with
+	 */
+	libcpath_allocator_t allocator;
+};
+
+typedef struct libcpath_directory_plan_level libcpath_directory_plan_level_t;
+
+struct libcpath_directory_plan_level
+{
+	/* The directory plan
+	 */
+	libcpath_internal_directory_plan_t *internal_directory_plan;
+
+	/* The entry indexes sorted by level
+	 */
+	int *entry_indexes;
+
+	/* The index of the next entry index to make
+	 */
+	int next_index;
+
+	/* The index of the entry index after the last of the level
+	 */
+	int end_index;
+
+	/* The error code of the first directory that could not be made
+	 */
+	int error_code;
+
+	/* The entry index of the first directory that could not be made
+	 */
+	int error_entry_index;
+};
+
+LIBCPATH_EXTERN \
+int libcpath_directory_plan_initialize(
+     libcpath_directory_plan_t **directory_plan,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_plan_free(
+     libcpath_directory_plan_t **directory_plan,
+     libcerror_error_t **error );
+
+int libcpath_directory_plan_append_entry(
+     libcpath_internal_directory_plan_t *internal_directory_plan,
+     const char *path,
+     int level,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_plan_add_file_path(
+     libcpath_directory_plan_t *directory_plan,
+     const char *file_path,
+     size_t file_path_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_plan_get_number_of_directories(
+     libcpath_directory_plan_t *directory_plan,
+     int *number_of_directories,
+     libcerror_error_t **error );
+
+#if !defined( WINAPI )
+
+int libcpath_directory_plan_make_directory(
+     const char *path );
+
+void *libcpath_directory_plan_make_level(
+       void *parameters );
+
+#endif /* !defined( WINAPI ) */
+
+LIBCPATH_EXTERN \
+int libcpath_directory_plan_make_directories(
+     libcpath_directory_plan_t *directory_plan,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_DIRECTORY_PLAN_H ) */
+
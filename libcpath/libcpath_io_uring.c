@@ -0,0 +1,839 @@
+/*
+ * io_uring functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcpath_allocator.h"
+#include "libcpath_io_uring.h"
+#include "libcpath_libcerror.h"
+
+#if defined( HAVE_LIBCPATH_IO_URING )
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+/* Maps an io_uring memory region
+ * Returns a pointer to the mapped region or NULL on error
+ */
+#define libcpath_io_uring_map( file_descriptor, size, offset ) \
+	mmap( NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, file_descriptor, offset )
+
+/* Value to indicate if the kernel supports io_uring with the required operations,
+ * -1 if not yet determined. Once determined the io_uring is not probed again
+ */
+static int libcpath_io_uring_is_supported = -1;
+
+/* Creates an io_uring
+ * Make sure the value io_uring is referencing, is set to NULL
+ * The io_uring and its buffers are allocated using the allocator
+ * Whether the kernel supports io_uring and the required operations is only
+ * determined once per process
+ * Returns 1 if successful, 0 if io_uring or the required operations are not supported by the kernel or -1 on error
+ */
+int libcpath_io_uring_initialize(
+     libcpath_io_uring_t **io_uring,
+     uint32_t number_of_entries,
+     const libcpath_allocator_t *allocator,
+     libcerror_error_t **error )
+{
+	struct io_uring_params parameters;
+
+	struct io_uring_probe *probe        = NULL;
+	libcpath_io_uring_t *safe_io_uring  = NULL;
+	uint8_t *submission_queue_ring      = NULL;
+	uint8_t *completion_queue_ring      = NULL;
+	void *mapping                       = NULL;
+	static char *function               = "libcpath_io_uring_initialize";
+	size_t probe_size                   = 0;
+	int file_descriptor                 = -1;
+	int result                          = 1;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_uring != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid io_uring value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries == 0 )
+	 || ( number_of_entries > LIBCPATH_IO_URING_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocator.",
+		 function );
+
+		return( -1 );
+	}
+	if( __atomic_load_n(
+	     &libcpath_io_uring_is_supported,
+	     __ATOMIC_RELAXED ) == 0 )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     &parameters,
+	     0,
+	     sizeof( struct io_uring_params ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parameters.",
+		 function );
+
+		return( -1 );
+	}
+	/* The kernel either does not provide io_uring or it was disabled
+	 */
+	file_descriptor = (int) syscall(
+	                         __NR_io_uring_setup,
+	                         number_of_entries,
+	                         &parameters );
+
+	if( file_descriptor == -1 )
+	{
+		/* Other errors, such as running out of file descriptors, are transient
+		 */
+		if( ( errno == ENOSYS )
+		 || ( errno == EPERM ) )
+		{
+			__atomic_store_n(
+			 &libcpath_io_uring_is_supported,
+			 0,
+			 __ATOMIC_RELAXED );
+		}
+		return( 0 );
+	}
+	safe_io_uring = libcpath_allocator_allocate_structure_using(
+	                 allocator,
+	                 libcpath_io_uring_t );
+
+	if( safe_io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create io_uring.",
+		 function );
+
+		close(
+		 file_descriptor );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     safe_io_uring,
+	     0,
+	     sizeof( libcpath_io_uring_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear io_uring.",
+		 function );
+
+		libcpath_allocator_free_using(
+		 allocator,
+		 safe_io_uring );
+
+		close(
+		 file_descriptor );
+
+		return( -1 );
+	}
+	safe_io_uring->allocator         = *allocator;
+	safe_io_uring->file_descriptor   = file_descriptor;
+	safe_io_uring->number_of_entries = parameters.sq_entries;
+
+	safe_io_uring->submission_queue_ring_size = parameters.sq_off.array
+	                                          + ( parameters.sq_entries * sizeof( uint32_t ) );
+
+	safe_io_uring->completion_queue_ring_size = parameters.cq_off.cqes
+	                                          + ( parameters.cq_entries * sizeof( struct io_uring_cqe ) );
+
+	if( ( parameters.features & IORING_FEAT_SINGLE_MMAP ) != 0 )
+	{
+		if( safe_io_uring->completion_queue_ring_size > safe_io_uring->submission_queue_ring_size )
+		{
+			safe_io_uring->submission_queue_ring_size = safe_io_uring->completion_queue_ring_size;
+		}
+	}
+	mapping = libcpath_io_uring_map(
+	           file_descriptor,
+	           safe_io_uring->submission_queue_ring_size,
+	           IORING_OFF_SQ_RING );
+
+	if( mapping == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 errno,
+		 "%s: unable to map submission queue ring.",
+		 function );
+
+		goto on_error;
+	}
+	safe_io_uring->submission_queue_ring = mapping;
+
+	if( ( parameters.features & IORING_FEAT_SINGLE_MMAP ) != 0 )
+	{
+		safe_io_uring->completion_queue_ring = safe_io_uring->submission_queue_ring;
+	}
+	else
+	{
+		mapping = libcpath_io_uring_map(
+		           file_descriptor,
+		           safe_io_uring->completion_queue_ring_size,
+		           IORING_OFF_CQ_RING );
+
+		if( mapping == MAP_FAILED )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 errno,
+			 "%s: unable to map completion queue ring.",
+			 function );
+
+			goto on_error;
+		}
+		safe_io_uring->completion_queue_ring = mapping;
+	}
+	safe_io_uring->submission_queue_entries_size = parameters.sq_entries * sizeof( struct io_uring_sqe );
+
+	mapping = libcpath_io_uring_map(
+	           file_descriptor,
+	           safe_io_uring->submission_queue_entries_size,
+	           IORING_OFF_SQES );
+
+	if( mapping == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 errno,
+		 "%s: unable to map submission queue entries.",
+		 function );
+
+		goto on_error;
+	}
+	safe_io_uring->submission_queue_entries = (struct io_uring_sqe *) mapping;
+
+	submission_queue_ring = (uint8_t *) safe_io_uring->submission_queue_ring;
+	completion_queue_ring = (uint8_t *) safe_io_uring->completion_queue_ring;
+
+	safe_io_uring->submission_queue_tail      = (uint32_t *) &( submission_queue_ring[ parameters.sq_off.tail ] );
+	safe_io_uring->submission_queue_ring_mask = *( (uint32_t *) &( submission_queue_ring[ parameters.sq_off.ring_mask ] ) );
+	safe_io_uring->submission_queue_array     = (uint32_t *) &( submission_queue_ring[ parameters.sq_off.array ] );
+
+	safe_io_uring->completion_queue_head      = (uint32_t *) &( completion_queue_ring[ parameters.cq_off.head ] );
+	safe_io_uring->completion_queue_tail      = (uint32_t *) &( completion_queue_ring[ parameters.cq_off.tail ] );
+	safe_io_uring->completion_queue_ring_mask = *( (uint32_t *) &( completion_queue_ring[ parameters.cq_off.ring_mask ] ) );
+	safe_io_uring->completion_queue_entries   = (struct io_uring_cqe *) &( completion_queue_ring[ parameters.cq_off.cqes ] );
+
+	/* Kernels before 5.15 do not provide mkdirat, and kernels before 5.6
+	 * cannot be probed at all. The probe is only needed once per process
+	 */
+	if( __atomic_load_n(
+	     &libcpath_io_uring_is_supported,
+	     __ATOMIC_RELAXED ) == -1 )
+	{
+		probe_size = sizeof( struct io_uring_probe )
+		           + ( IORING_OP_LAST * sizeof( struct io_uring_probe_op ) );
+
+		probe = (struct io_uring_probe *) libcpath_allocator_allocate_using(
+		                                   allocator,
+		                                   probe_size );
+
+		if( probe == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create probe.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     probe,
+		     0,
+		     probe_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear probe.",
+			 function );
+
+			goto on_error;
+		}
+		if( syscall(
+		     __NR_io_uring_register,
+		     file_descriptor,
+		     IORING_REGISTER_PROBE,
+		     probe,
+		     IORING_OP_LAST ) != 0 )
+		{
+			result = 0;
+		}
+		else if( ( probe->last_op < IORING_OP_MKDIRAT )
+		      || ( probe->last_op < IORING_OP_STATX )
+		      || ( ( probe->ops[ IORING_OP_MKDIRAT ].flags & IO_URING_OP_SUPPORTED ) == 0 )
+		      || ( ( probe->ops[ IORING_OP_STATX ].flags & IO_URING_OP_SUPPORTED ) == 0 ) )
+		{
+			result = 0;
+		}
+		libcpath_allocator_free_using(
+		 allocator,
+		 probe );
+
+		probe = NULL;
+
+		__atomic_store_n(
+		 &libcpath_io_uring_is_supported,
+		 result,
+		 __ATOMIC_RELAXED );
+	}
+	if( result == 0 )
+	{
+		if( libcpath_io_uring_free(
+		     &safe_io_uring,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free io_uring.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	safe_io_uring->statx_buffers = (struct statx *) libcpath_allocator_allocate_using(
+	                                                 allocator,
+	                                                 sizeof( struct statx ) * parameters.sq_entries );
+
+	if( safe_io_uring->statx_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create statx buffers.",
+		 function );
+
+		goto on_error;
+	}
+	*io_uring = safe_io_uring;
+
+	return( 1 );
+
+on_error:
+	if( probe != NULL )
+	{
+		libcpath_allocator_free_using(
+		 allocator,
+		 probe );
+	}
+	if( safe_io_uring != NULL )
+	{
+		libcpath_io_uring_free(
+		 &safe_io_uring,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an io_uring
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_io_uring_free(
+     libcpath_io_uring_t **io_uring,
+     libcerror_error_t **error )
+{
+	libcpath_allocator_t allocator;
+
+	libcpath_io_uring_t *safe_io_uring = NULL;
+	static char *function              = "libcpath_io_uring_free";
+	int result                         = 1;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_uring != NULL )
+	{
+		safe_io_uring = *io_uring;
+		*io_uring     = NULL;
+
+		if( safe_io_uring->submission_queue_entries != NULL )
+		{
+			munmap(
+			 safe_io_uring->submission_queue_entries,
+			 safe_io_uring->submission_queue_entries_size );
+		}
+		if( ( safe_io_uring->completion_queue_ring != NULL )
+		 && ( safe_io_uring->completion_queue_ring != safe_io_uring->submission_queue_ring ) )
+		{
+			munmap(
+			 safe_io_uring->completion_queue_ring,
+			 safe_io_uring->completion_queue_ring_size );
+		}
+		if( safe_io_uring->submission_queue_ring != NULL )
+		{
+			munmap(
+			 safe_io_uring->submission_queue_ring,
+			 safe_io_uring->submission_queue_ring_size );
+		}
+		if( close(
+		     safe_io_uring->file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close file descriptor.",
+			 function );
+
+			result = -1;
+		}
+		/* The statx buffers are intentionally leaked if the kernel can still write to them
+		 */
+		if( ( safe_io_uring->statx_buffers != NULL )
+		 && ( safe_io_uring->has_operations_in_flight == 0 ) )
+		{
+			libcpath_allocator_free_using(
+			 &( safe_io_uring->allocator ),
+			 safe_io_uring->statx_buffers );
+		}
+		allocator = safe_io_uring->allocator;
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 safe_io_uring );
+	}
+	return( result );
+}
+
+/* Submits a path operation for every path and waits for their completion
+ * The operations are submitted in batches of at most the number of submission queue entries
+ * The operations of a batch are performed concurrently, hence their order is not preserved
+ * and a path should not depend on another path of the same batch
+ * On error the operations that were submitted are waited for before returning
+ * Every error code is set to 0 if the operation succeeded or to the corresponding errno value otherwise,
+ * for IORING_OP_STATX an existing path that is not a directory is reported as ENOTDIR
+ * Relative paths are resolved against the directory descriptor, which can be AT_FDCWD
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_io_uring_submit_path_operations(
+     libcpath_io_uring_t *io_uring,
+     int directory_descriptor,
+     uint8_t operation_code,
+     const char **paths,
+     int number_of_paths,
+     int *error_codes,
+     libcerror_error_t **error )
+{
+	struct io_uring_cqe *completion_queue_entry   = NULL;
+	struct io_uring_sqe *submission_queue_entry   = NULL;
+	static char *function                         = "libcpath_io_uring_submit_path_operations";
+	long result                                   = 0;
+	uint32_t completion_queue_head                = 0;
+	uint32_t completion_queue_tail                = 0;
+	uint32_t ring_index                           = 0;
+	uint32_t submission_queue_tail                = 0;
+	int batch_index                               = 0;
+	int batch_size                                = 0;
+	int has_invalid_completion_queue_entry        = 0;
+	int number_of_completed_operations            = 0;
+	int number_of_operations                      = 0;
+	int number_of_submitted_operations            = 0;
+	int path_index                                = 0;
+	int submit_error_code                         = 0;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( operation_code != IORING_OP_MKDIRAT )
+	 && ( operation_code != IORING_OP_STATX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported operation code.",
+		 function );
+
+		return( -1 );
+	}
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of paths value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_codes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error codes.",
+		 function );
+
+		return( -1 );
+	}
+	while( path_index < number_of_paths )
+	{
+		batch_size = number_of_paths - path_index;
+
+		if( (uint32_t) batch_size > io_uring->number_of_entries )
+		{
+			batch_size = (int) io_uring->number_of_entries;
+		}
+		/* The submission queue tail is only written by this process
+		 */
+		submission_queue_tail = *( io_uring->submission_queue_tail );
+
+		for( batch_index = 0;
+		     batch_index < batch_size;
+		     batch_index++ )
+		{
+			ring_index             = submission_queue_tail & io_uring->submission_queue_ring_mask;
+			submission_queue_entry = &( io_uring->submission_queue_entries[ ring_index ] );
+
+			if( memory_set(
+			     submission_queue_entry,
+			     0,
+			     sizeof( struct io_uring_sqe ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear submission queue entry.",
+				 function );
+
+				return( -1 );
+			}
+			submission_queue_entry->opcode    = operation_code;
+			submission_queue_entry->fd        = directory_descriptor;
+			submission_queue_entry->addr      = (uint64_t) (uintptr_t) paths[ path_index + batch_index ];
+			submission_queue_entry->user_data = (uint64_t) batch_index;
+
+			if( operation_code == IORING_OP_MKDIRAT )
+			{
+				submission_queue_entry->len = 0755;
+			}
+			else
+			{
+				submission_queue_entry->len = STATX_TYPE;
+				submission_queue_entry->off = (uint64_t) (uintptr_t) &( io_uring->statx_buffers[ batch_index ] );
+			}
+			io_uring->submission_queue_array[ ring_index ] = ring_index;
+
+			submission_queue_tail++;
+		}
+		__atomic_store_n(
+		 io_uring->submission_queue_tail,
+		 submission_queue_tail,
+		 __ATOMIC_RELEASE );
+
+		number_of_completed_operations = 0;
+		number_of_operations           = batch_size;
+		number_of_submitted_operations = 0;
+
+		while( number_of_completed_operations < number_of_operations )
+		{
+			/* The kernel only waits for completions if all entries were submitted
+			 */
+			result = syscall(
+			          __NR_io_uring_enter,
+			          io_uring->file_descriptor,
+			          (unsigned int) ( number_of_operations - number_of_submitted_operations ),
+			          (unsigned int) ( number_of_operations - number_of_completed_operations ),
+			          IORING_ENTER_GETEVENTS,
+			          NULL,
+			          0 );
+
+			if( result >= 0 )
+			{
+				number_of_submitted_operations += (int) result;
+			}
+			else if( ( errno != EINTR )
+			      && ( errno != EAGAIN )
+			      && ( errno != EBUSY ) )
+			{
+				if( submit_error_code != 0 )
+				{
+					/* The submitted operations could not be waited for
+					 */
+					io_uring->has_operations_in_flight = 1;
+
+					break;
+				}
+				submit_error_code = errno;
+
+				/* The remaining operations are not submitted, but the kernel can
+				 * still write to the statx buffers of the submitted operations,
+				 * hence these are waited for before returning
+				 */
+				number_of_operations = number_of_submitted_operations;
+			}
+			completion_queue_head = *( io_uring->completion_queue_head );
+			completion_queue_tail = __atomic_load_n(
+			                         io_uring->completion_queue_tail,
+			                         __ATOMIC_ACQUIRE );
+
+			while( completion_queue_head != completion_queue_tail )
+			{
+				completion_queue_entry = &( io_uring->completion_queue_entries[ completion_queue_head & io_uring->completion_queue_ring_mask ] );
+
+				if( completion_queue_entry->user_data >= (uint64_t) batch_size )
+				{
+					/* The operation the entry belongs to is unknown, hence
+					 * operations could still be in flight
+					 */
+					has_invalid_completion_queue_entry = 1;
+
+					io_uring->has_operations_in_flight = 1;
+				}
+				else
+				{
+					batch_index = (int) completion_queue_entry->user_data;
+
+					if( completion_queue_entry->res < 0 )
+					{
+						error_codes[ path_index + batch_index ] = -( completion_queue_entry->res );
+					}
+					else if( ( operation_code == IORING_OP_STATX )
+					      && ( S_ISDIR( io_uring->statx_buffers[ batch_index ].stx_mode ) == 0 ) )
+					{
+						error_codes[ path_index + batch_index ] = ENOTDIR;
+					}
+					else
+					{
+						error_codes[ path_index + batch_index ] = 0;
+					}
+				}
+				completion_queue_head++;
+
+				number_of_completed_operations++;
+			}
+			__atomic_store_n(
+			 io_uring->completion_queue_head,
+			 completion_queue_head,
+			 __ATOMIC_RELEASE );
+		}
+		if( submit_error_code != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 submit_error_code,
+			 "%s: unable to submit operations.",
+			 function );
+
+			return( -1 );
+		}
+		if( has_invalid_completion_queue_entry != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid completion queue entry - user data value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		path_index += batch_size;
+	}
+	return( 1 );
+}
+
+/* Makes directories
+ * Every error code is set to 0 if the directory was made or to the corresponding errno value otherwise
+ * Relative directory names are resolved against the directory descriptor, which can be AT_FDCWD
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_io_uring_make_directories(
+     libcpath_io_uring_t *io_uring,
+     int directory_descriptor,
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_io_uring_make_directories";
+
+	if( libcpath_io_uring_submit_path_operations(
+	     io_uring,
+	     directory_descriptor,
+	     IORING_OP_MKDIRAT,
+	     directory_names,
+	     number_of_directories,
+	     error_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to make directories.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Probes directories
+ * Every error code is set to 0 if the directory exists, to ENOTDIR if the path exists
+ * but is not a directory or to the corresponding errno value otherwise
+ * Relative directory names are resolved against the directory descriptor, which can be AT_FDCWD
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_io_uring_probe_directories(
+     libcpath_io_uring_t *io_uring,
+     int directory_descriptor,
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_io_uring_probe_directories";
+
+	if( libcpath_io_uring_submit_path_operations(
+	     io_uring,
+	     directory_descriptor,
+	     IORING_OP_STATX,
+	     directory_names,
+	     number_of_directories,
+	     error_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to probe directories.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBCPATH_IO_URING ) */
+
@@ -0,0 +1,180 @@
+/*
+ * io_uring functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_IO_URING_H )
+#define _LIBCPATH_IO_URING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_allocator.h"
+#include "libcpath_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The batch operations are submitted to the kernel using the io_uring
+ * system calls directly, this relies on the GNU C atomic builtins
+ */
+#if !defined( WINAPI ) && defined( HAVE_LINUX_IO_URING_H ) && defined( HAVE_LINUX_STAT_H ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( __GNUC__ )
+#if defined( HAVE_DECL_IORING_OP_MKDIRAT ) && ( HAVE_DECL_IORING_OP_MKDIRAT == 1 ) && defined( HAVE_DECL_IORING_OP_STATX ) && ( HAVE_DECL_IORING_OP_STATX == 1 )
+#define HAVE_LIBCPATH_IO_URING	1
+#endif
+#endif
+
+#if defined( HAVE_LIBCPATH_IO_URING )
+
+#include <linux/io_uring.h>
+#include <linux/stat.h>
+
+/* The maximum number of submission queue entries of an io_uring
+ */
+#define LIBCPATH_IO_URING_MAXIMUM_NUMBER_OF_ENTRIES	256
+
+/* The minimum number of operations of a batch for which an io_uring is
+ * set up, smaller batches are cheaper to handle with synchronous calls
+ */
+#define LIBCPATH_IO_URING_MINIMUM_NUMBER_OF_OPERATIONS	16
+
+typedef struct libcpath_io_uring libcpath_io_uring_t;
+
+struct libcpath_io_uring
+{
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* The number of submission queue entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The submission queue ring mapping
+	 */
+	void *submission_queue_ring;
+
+	/* The submission queue ring mapping size
+	 */
+	size_t submission_queue_ring_size;
+
+	/* The completion queue ring mapping
+	 * Equals the submission queue ring mapping if the kernel maps both rings at once
+	 */
+	void *completion_queue_ring;
+
+	/* The completion queue ring mapping size
+	 */
+	size_t completion_queue_ring_size;
+
+	/* The submission queue entries mapping
+	 */
+	struct io_uring_sqe *submission_queue_entries;
+
+	/* The submission queue entries mapping size
+	 */
+	size_t submission_queue_entries_size;
+
+	/* The submission queue tail
+	 */
+	uint32_t *submission_queue_tail;
+
+	/* The submission queue ring mask
+	 */
+	uint32_t submission_queue_ring_mask;
+
+	/* The submission queue array
+	 */
+	uint32_t *submission_queue_array;
+
+	/* The completion queue head
+	 */
+	uint32_t *completion_queue_head;
+
+	/* The completion queue tail
+	 */
+	uint32_t *completion_queue_tail;
+
+	/* The completion queue ring mask
+	 */
+	uint32_t completion_queue_ring_mask;
+
+	/* The completion queue entries
+	 */
+	struct io_uring_cqe *completion_queue_entries;
+
+	/* The statx buffers, one per submission queue entry
+	 */
+	struct statx *statx_buffers;
+
+	/* Value to indicate operations could still be in flight after an error,
+	 * in which case the statx buffers are not freed since the kernel can
+	 * still write to them
+	 */
+	uint8_t has_operations_in_flight;
+
+	/* The allocator the io_uring was created with
+	 */
+	libcpath_allocator_t allocator;
+};
+
+int libcpath_io_uring_initialize(
+     libcpath_io_uring_t **io_uring,
+     uint32_t number_of_entries,
+     const libcpath_allocator_t *allocator,
+     libcerror_error_t **error );
+
+int libcpath_io_uring_free(
+     libcpath_io_uring_t **io_uring,
+     libcerror_error_t **error );
+
+int libcpath_io_uring_submit_path_operations(
+     libcpath_io_uring_t *io_uring,
+     int directory_descriptor,
+     uint8_t operation_code,
+     const char **paths,
+     int number_of_paths,
+     int *error_codes,
+     libcerror_error_t **error );
+
+int libcpath_io_uring_make_directories(
+     libcpath_io_uring_t *io_uring,
+     int directory_descriptor,
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error );
+
+int libcpath_io_uring_probe_directories(
+     libcpath_io_uring_t *io_uring,
+     int directory_descriptor,
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBCPATH_IO_URING ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_IO_URING_H ) */
+
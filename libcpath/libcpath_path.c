@@ -46,11 +46,61 @@
 #include <unistd.h>
 #endif
 
+#include "libcpath_allocator.h"
+#include "libcpath_arena.h"
+#include "libcpath_context.h"
 #include "libcpath_definitions.h"
+#include "libcpath_directory_cache.h"
+#include "libcpath_io_uring.h"
 #include "libcpath_libcerror.h"
+#include "libcpath_libclocale.h"
 #include "libcpath_libcsplit.h"
 #include "libcpath_path.h"
+#include "libcpath_sanitize.h"
+#include "libcpath_status.h"
 #include "libcpath_system_string.h"
+#include "libcpath_unused.h"
+
+/* The missing directories of a path can be made relative to a descriptor of their parent directory
+ */
+#if defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR ) && defined( HAVE_MKDIRAT ) && defined( HAVE_OPENAT ) && defined( HAVE_FSTATAT )
+#define HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR_FUNCTIONS	1
+#endif
+
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR_FUNCTIONS )
+
+/* The flags the directories are opened with when making directories recursively,
+ * O_PATH is used where available since the descriptor is only used to resolve paths
+ */
+#if defined( O_PATH )
+#define LIBCPATH_PATH_OPEN_DIRECTORY_FLAGS_BASE	( O_PATH | O_DIRECTORY )
+#else
+#define LIBCPATH_PATH_OPEN_DIRECTORY_FLAGS_BASE	( O_RDONLY | O_DIRECTORY )
+#endif
+
+#if defined( O_CLOEXEC )
+#define LIBCPATH_PATH_OPEN_DIRECTORY_FLAGS	( LIBCPATH_PATH_OPEN_DIRECTORY_FLAGS_BASE | O_CLOEXEC )
+#else
+#define LIBCPATH_PATH_OPEN_DIRECTORY_FLAGS	LIBCPATH_PATH_OPEN_DIRECTORY_FLAGS_BASE
+#endif
+
+#endif /* defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR_FUNCTIONS ) */
+
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+
+/* The current working directory cache mode
+ */
+static int libcpath_current_working_directory_cache_mode = LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_DISABLED;
+
+/* The change directory generation, incremented by every successful libcpath_path_change_directory
+ */
+static uint32_t libcpath_change_directory_generation = 0;
+
+/* The current working directory cache of the thread
+ */
+static __thread libcpath_current_working_directory_cache_t libcpath_current_working_directory_cache;
+
+#endif /* defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE ) */
 
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
@@ -229,6 +279,12 @@ int libcpath_path_change_directory(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+	__atomic_add_fetch(
+	 &libcpath_change_directory_generation,
+	 1,
+	 __ATOMIC_RELEASE );
+#endif
 	return( 1 );
 }
 
@@ -236,6 +292,138 @@ int libcpath_path_change_directory(
 #error Missing change directory function
 #endif
 
+/* Changes the working directory of a context
+ * The current working directory of the process is not changed, only the paths
+ * resolved using the context, hence contexts can be used concurrently by different threads
+ * Like libcpath_path_change_directory the directory must exist, unlike
+ * libcpath_context_set_working_directory which only resolves the directory name
+ * A working directory backed by a directory descriptor remains backed by one
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_change_directory_context(
+     libcpath_context_t *context,
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI )
+	struct stat file_statistics;
+#endif
+
+	static char *function = "libcpath_path_change_directory_context";
+	char *full_path       = NULL;
+	size_t full_path_size = 0;
+	uint8_t flags         = 0;
+	int descriptor        = 0;
+	int result            = 0;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcpath_context_get_working_directory_descriptor(
+	          context,
+	          &descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve working directory descriptor from context.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		flags = LIBCPATH_WORKING_DIRECTORY_FLAG_OPEN;
+	}
+	if( libcpath_path_get_full_path_context(
+	     context,
+	     directory_name,
+	     narrow_string_length(
+	      directory_name ),
+	     &full_path,
+	     &full_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path of directory.",
+		 function );
+
+		goto on_error;
+	}
+#if !defined( WINAPI )
+	if( stat(
+	     full_path,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics of directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( S_ISDIR( file_statistics.st_mode ) == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 ENOTDIR,
+		 "%s: unsupported directory name: not a directory.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* !defined( WINAPI ) */
+
+	if( libcpath_context_set_working_directory(
+	     context,
+	     full_path,
+	     full_path_size - 1,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set working directory of context.",
+		 function );
+
+		goto on_error;
+	}
+	libcpath_allocator_free(
+	 full_path );
+
+	return( 1 );
+
+on_error:
+	if( full_path != NULL )
+	{
+		libcpath_allocator_free(
+		 full_path );
+	}
+	return( -1 );
+}
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 /* Cross Windows safe version of GetCurrentDirectoryA
@@ -364,7 +552,7 @@ int libcpath_path_get_current_working_directory(
 	}
 	*current_working_directory_size = (size_t) safe_current_working_directory_size;
 
-	*current_working_directory = narrow_string_allocate(
+	*current_working_directory = libcpath_allocator_allocate_narrow_string(
 	                              *current_working_directory_size );
 
 	if( *current_working_directory == NULL )
@@ -419,7 +607,7 @@ int libcpath_path_get_current_working_directory(
 on_error:
 	if( *current_working_directory != NULL )
 	{
-		memory_free(
+		libcpath_allocator_free(
 		 *current_working_directory );
 
 		*current_working_directory = NULL;
@@ -431,8 +619,154 @@ on_error:
 
 #elif defined( HAVE_GETCWD )
 
+/* Retrieves the current working directory using getcwd
+ * getcwd is first called with the buffer provided by the caller, typically
+ * on the stack. When the directory does not fit (ERANGE) a buffer of twice
+ * the size is allocated until it does, hence the directory is not limited
+ * to PATH_MAX. The buffer is not cleared since getcwd terminates the string
+ * On return current_working_directory points to either buffer or an allocated
+ * buffer that must be freed with libcpath_allocator_free
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_getcwd(
+     char *buffer,
+     size_t buffer_size,
+     char **current_working_directory,
+     size_t *current_working_directory_length,
+     libcerror_error_t **error )
+{
+	char *allocated_buffer = NULL;
+	static char *function  = "libcpath_path_getcwd";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid buffer size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_working_directory_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory length.",
+		 function );
+
+		return( -1 );
+	}
+	*current_working_directory = buffer;
+
+	while( getcwd(
+	        *current_working_directory,
+	        buffer_size ) == NULL )
+	{
+		if( errno != ERANGE )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 errno,
+			 "%s: unable to retrieve current working directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( buffer_size > ( (size_t) SSIZE_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		buffer_size *= 2;
+
+		/* The previous buffer is freed rather than reallocated since
+		 * its contents are not needed
+		 */
+		if( allocated_buffer != NULL )
+		{
+			libcpath_allocator_free(
+			 allocated_buffer );
+		}
+		allocated_buffer = libcpath_allocator_allocate_narrow_string(
+		                    buffer_size );
+
+		if( allocated_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			goto on_error;
+		}
+		*current_working_directory = allocated_buffer;
+	}
+	*current_working_directory_length = narrow_string_length(
+	                                     *current_working_directory );
+
+	return( 1 );
+
+on_error:
+	if( allocated_buffer != NULL )
+	{
+		libcpath_allocator_free(
+		 allocated_buffer );
+	}
+	*current_working_directory = NULL;
+
+	return( -1 );
+}
+
 /* Retrieves the current working directory
  * This function uses the POSIX getcwd function or equivalent
+ * The current working directory is allocated with its exact size
  * Returns 1 if successful or -1 on error
  */
 int libcpath_path_get_current_working_directory(
@@ -440,7 +774,11 @@ int libcpath_path_get_current_working_directory(
      size_t *current_working_directory_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_get_current_working_directory";
+	char buffer[ LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE ];
+
+	char *safe_current_working_directory    = NULL;
+	static char *function                   = "libcpath_path_get_current_working_directory";
+	size_t current_working_directory_length = 0;
 
 	if( current_working_directory == NULL )
 	{
@@ -475,9 +813,25 @@ int libcpath_path_get_current_working_directory(
 
 		return( -1 );
 	}
-	*current_working_directory_size = (size_t) PATH_MAX;
+	if( libcpath_path_getcwd(
+	     buffer,
+	     LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE,
+	     &safe_current_working_directory,
+	     &current_working_directory_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	*current_working_directory_size = current_working_directory_length + 1;
 
-	*current_working_directory = narrow_string_allocate(
+	*current_working_directory = libcpath_allocator_allocate_narrow_string(
 	                              *current_working_directory_size );
 
 	if( *current_working_directory == NULL )
@@ -491,40 +845,37 @@ int libcpath_path_get_current_working_directory(
 
 		goto on_error;
 	}
-	if( memory_set(
+	if( memory_copy(
 	     *current_working_directory,
-	     0,
+	     safe_current_working_directory,
 	     sizeof( char ) * *current_working_directory_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear current working directory.",
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy current working directory.",
 		 function );
 
 		goto on_error;
 	}
-	if( getcwd(
-	     *current_working_directory,
-	     *current_working_directory_size ) == NULL )
+	if( safe_current_working_directory != buffer )
 	{
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 errno,
-		 "%s: unable to retrieve current working directory.",
-		 function );
-
-		goto on_error;
+		libcpath_allocator_free(
+		 safe_current_working_directory );
 	}
 	return( 1 );
 
 on_error:
+	if( ( safe_current_working_directory != NULL )
+	 && ( safe_current_working_directory != buffer ) )
+	{
+		libcpath_allocator_free(
+		 safe_current_working_directory );
+	}
 	if( *current_working_directory != NULL )
 	{
-		memory_free(
+		libcpath_allocator_free(
 		 *current_working_directory );
 
 		*current_working_directory = NULL;
@@ -538,582 +889,509 @@ on_error:
 #error Missing get current working directory function
 #endif
 
-#if defined( WINAPI )
-
-/* Determines the path type
- * Returns 1 if succesful or -1 on error
+/* Retrieves the current working directory of a context
+ * This is the working directory of the context or, if not set,
+ * the current working directory of the process
+ * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_path_type(
-     const char *path,
-     size_t path_length,
-     uint8_t *path_type,
+int libcpath_path_get_current_working_directory_context(
+     libcpath_context_t *context,
+     char **current_working_directory,
+     size_t *current_working_directory_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_get_path_type";
+	const char *working_directory   = NULL;
+	static char *function           = "libcpath_path_get_current_working_directory_context";
+	size_t working_directory_length = 0;
+	int result                      = 0;
 
-	if( path == NULL )
+	if( current_working_directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 "%s: invalid current working directory.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_length == 0 )
+	if( *current_working_directory != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid path length is zero.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid current working directory value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( current_working_directory_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory size.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_type == NULL )
+	result = libcpath_context_get_working_directory(
+	          context,
+	          &working_directory,
+	          &working_directory_length,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path type.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve working directory from context.",
 		 function );
 
 		return( -1 );
 	}
-	*path_type = LIBCPATH_TYPE_RELATIVE;
-
-	/* Determine if the path is a special path
-	 * device path prefix:          \\.\
-	 * extended-length path prefix: \\?\
-	 */
-	if( ( path_length >= 4 )
-	 && ( path[ 0 ] == '\\' )
-	 && ( path[ 1 ] == '\\' )
-	 && ( ( path[ 2 ] == '.' )
-	  ||  ( path[ 2 ] == '?' ) )
-	 && ( path[ 3 ] == '\\' ) )
-	{
-		if( path[ 2 ] == '.' )
-		{
-			*path_type = LIBCPATH_TYPE_DEVICE;
-		}
-		/* Determine if the path in an extended-length UNC path
-		 * \\?\UNC\server\share
-		 */
-		else if( ( path_length >= 8 )
-		      && ( path[ 4 ] == 'U' )
-		      && ( path[ 5 ] == 'N' )
-		      && ( path[ 6 ] == 'C' )
-		      && ( path[ 7 ] == '\\' ) )
-		{
-			*path_type = LIBCPATH_TYPE_EXTENDED_LENGTH_UNC;
-		}
-		else
-		{
-			*path_type = LIBCPATH_TYPE_EXTENDED_LENGTH;
-		}
-	}
-	/* Determine if the path is an UNC path
-	 * \\server\share
-	 */
-	else if( ( path_length >= 2 )
-	      && ( path[ 0 ] == '\\' )
-	      && ( path[ 1 ] == '\\' ) )
+	else if( result == 0 )
 	{
-		*path_type = LIBCPATH_TYPE_UNC;
+		return( libcpath_path_get_current_working_directory(
+		         current_working_directory,
+		         current_working_directory_size,
+		         error ) );
 	}
-	else if( path[ 0 ] == '\\' )
+	*current_working_directory = libcpath_allocator_allocate_narrow_string(
+	                              working_directory_length + 1 );
+
+	if( *current_working_directory == NULL )
 	{
-		*path_type = LIBCPATH_TYPE_ABSOLUTE;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create current working directory.",
+		 function );
+
+		return( -1 );
 	}
-	else if( ( path_length >= 3 )
-	      && ( path[ 1 ] == ':' )
-	      && ( path[ 2 ] == '\\' )
-	      && ( ( ( path[ 0 ] >= 'A' )
-	        &&   ( path[ 0 ] <= 'Z' ) )
-	       ||  ( ( path[ 0 ] >= 'a' )
-	        &&   ( path[ 0 ] <= 'z' ) ) ) )
+	if( narrow_string_copy(
+	     *current_working_directory,
+	     working_directory,
+	     working_directory_length ) == NULL )
 	{
-		*path_type = LIBCPATH_TYPE_ABSOLUTE;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy working directory.",
+		 function );
+
+		libcpath_allocator_free(
+		 *current_working_directory );
+
+		*current_working_directory = NULL;
+
+		return( -1 );
 	}
+	( *current_working_directory )[ working_directory_length ] = 0;
+
+	*current_working_directory_size = working_directory_length + 1;
+
 	return( 1 );
 }
 
-/* Determines the volume name
- * Returns 1 if succesful or -1 on error
+/* Retrieves the current working directory cache mode
+ * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_volume_name(
-     const char *path,
-     size_t path_length,
-     char **volume_name,
-     size_t *volume_name_length,
-     size_t *directory_name_index,
+int libcpath_path_get_current_working_directory_cache_mode(
+     int *mode,
      libcerror_error_t **error )
 {
-	static char *function    = "libcpath_path_get_volume_name";
-	size_t path_index        = 0;
-	size_t share_name_index  = 0;
-	size_t volume_name_index = 0;
+	static char *function = "libcpath_path_get_current_working_directory_cache_mode";
 
-	if( path == NULL )
+	if( mode == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 "%s: invalid mode.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_length == 0 )
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+	*mode = __atomic_load_n(
+	         &libcpath_current_working_directory_cache_mode,
+	         __ATOMIC_ACQUIRE );
+#else
+	*mode = LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_DISABLED;
+#endif
+	return( 1 );
+}
+
+/* Sets the current working directory cache mode
+ * The cache is opt-in and only supported on POSIX platforms
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_set_current_working_directory_cache_mode(
+     int mode,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_set_current_working_directory_cache_mode";
+
+	if( ( mode != LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_DISABLED )
+	 && ( mode != LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_VALIDATE )
+	 && ( mode != LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_TRUST ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid path length is zero.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+	__atomic_store_n(
+	 &libcpath_current_working_directory_cache_mode,
+	 mode,
+	 __ATOMIC_RELEASE );
+#else
+	if( mode != LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_DISABLED )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: current working directory cache not supported.",
 		 function );
 
 		return( -1 );
 	}
-	if( volume_name == NULL )
+#endif
+	return( 1 );
+}
+
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+
+/* Retrieves the cached current working directory of the calling thread
+ * The cache is (re)filled when it is empty, when the directory was changed
+ * by libcpath_path_change_directory or, in validate mode, when the device
+ * or inode number of "." no longer match
+ * The current working directory is owned by the cache and remains valid
+ * until the next call of this function by the same thread
+ * A current working directory that does not fit in the buffer of the cache
+ * is not cached, hence the caller falls back to retrieving it directly
+ * Returns 1 if successful, 0 if the cache is disabled or cannot be used or -1 on error
+ */
+int libcpath_path_get_cached_current_working_directory(
+     const char **current_working_directory,
+     size_t *current_working_directory_length,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	libcpath_current_working_directory_cache_t *cache = NULL;
+	static char *function                             = "libcpath_path_get_cached_current_working_directory";
+	uint32_t generation                               = 0;
+	int mode                                          = 0;
+
+	if( current_working_directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume name.",
+		 "%s: invalid current working directory.",
 		 function );
 
 		return( -1 );
 	}
-	if( volume_name_length == NULL )
+	if( current_working_directory_length == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume name length.",
+		 "%s: invalid current working directory length.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_name_index == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name index.",
-		 function );
+	mode = __atomic_load_n(
+	        &libcpath_current_working_directory_cache_mode,
+	        __ATOMIC_ACQUIRE );
 
-		return( -1 );
+	if( mode == LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_DISABLED )
+	{
+		return( 0 );
 	}
-	*volume_name          = NULL;
-	*volume_name_length   = 0;
-	*directory_name_index = 0;
+	cache = &libcpath_current_working_directory_cache;
 
-	/* Determine if the path is a special path
-	 * device path prefix:          \\.\
-	 * extended-length path prefix: \\?\
+	/* The generation is retrieved before the directory is, so that a concurrent
+	 * change of directory causes the cache to be refilled on the next call
 	 */
-	if( ( path_length >= 4 )
-	 && ( path[ 0 ] == '\\' )
-	 && ( path[ 1 ] == '\\' )
-	 && ( ( path[ 2 ] == '.' )
-	  ||  ( path[ 2 ] == '?' ) )
-	 && ( path[ 3 ] == '\\' ) )
+	generation = __atomic_load_n(
+	              &libcpath_change_directory_generation,
+	              __ATOMIC_ACQUIRE );
+
+	if( ( cache->is_set != 0 )
+	 && ( cache->generation == generation ) )
 	{
-		if( path[ 2 ] == '.' )
-		{
-			volume_name_index = 4;
-		}
-		/* Determine if the path in an extended-length UNC path
-		 * \\?\UNC\server\share
-		 */
-		else if( ( path_length >= 8 )
-		      && ( path[ 4 ] == 'U' )
-		      && ( path[ 5 ] == 'N' )
-		      && ( path[ 6 ] == 'C' )
-		      && ( path[ 7 ] == '\\' ) )
-		{
-			volume_name_index = 8;
-		}
-		else
+		if( mode == LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_TRUST )
 		{
-			volume_name_index = 4;
+			*current_working_directory        = cache->current_working_directory;
+			*current_working_directory_length = cache->current_working_directory_length;
+
+			return( 1 );
 		}
 	}
-	/* Determine if the path is an UNC path
-	 * \\server\share
-	 */
-	else if( ( path_length >= 2 )
-	      && ( path[ 0 ] == '\\' )
-	      && ( path[ 1 ] == '\\' ) )
-	{
-		volume_name_index = 2;
-	}
-	/* Check if the path contains a volume letter
+	cache->is_set = 0;
+
+	/* The directory is checked before its path is retrieved, a change of directory
+	 * in between results in a mismatch on the next call
 	 */
-	if( ( path_length >= 2 )
-	 && ( volume_name_index <= ( path_length - 2 ) )
-	 && ( path[ volume_name_index + 1 ] == ':' )
-	 && ( ( ( path[ volume_name_index ] >= 'A' )
-	   &&   ( path[ volume_name_index ] <= 'Z' ) )
-	  ||  ( ( path[ volume_name_index ] >= 'a' )
-	   &&   ( path[ volume_name_index ] <= 'z' ) ) ) )
+	if( stat(
+	     ".",
+	     &file_statistics ) != 0 )
 	{
-		path_index = volume_name_index + 2;
-
-		if( ( path_index < path_length )
-		 && ( path[ path_index ] == '\\' ) )
-		{
-			path_index++;
-		}
-		*volume_name        = (char *) &( path[ volume_name_index ] );
-		*volume_name_length = path_index - volume_name_index;
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve current working directory file statistics.",
+		 function );
 
-		if( path[ path_index - 1 ] == '\\' )
-		{
-			*volume_name_length -= 1;
-		}
-		*directory_name_index = path_index;
+		return( -1 );
 	}
-	else if( volume_name_index == 4 )
+	if( ( cache->generation == generation )
+	 && ( cache->current_working_directory_length > 0 )
+	 && ( cache->device_number == file_statistics.st_dev )
+	 && ( cache->inode_number == file_statistics.st_ino ) )
 	{
-		for( path_index = volume_name_index;
-		     path_index < path_length;
-		     path_index++ )
-		{
-			if( path[ path_index ] == '\\' )
-			{
-				path_index++;
-
-				break;
-			}
-		}
-		*volume_name        = (char *) &( path[ 4 ] );
-		*volume_name_length = path_index - 4;
-
-		if( path[ path_index - 1 ] == '\\' )
-		{
-			*volume_name_length -= 1;
-		}
-		*directory_name_index = path_index;
+		cache->is_set = 1;
 	}
-	else if( ( volume_name_index == 2 )
-	      || ( volume_name_index == 8 ) )
+	else
 	{
-		for( share_name_index = volume_name_index;
-		     share_name_index < path_length;
-		     share_name_index++ )
+		if( getcwd(
+		     cache->current_working_directory,
+		     LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_BUFFER_SIZE ) == NULL )
 		{
-			if( path[ share_name_index ] == '\\' )
-			{
-				share_name_index++;
+			cache->current_working_directory_length = 0;
 
-				break;
+			if( errno == ERANGE )
+			{
+				return( 0 );
 			}
-		}
-		if( share_name_index > path_length )
-		{
-			libcerror_error_set(
+			libcerror_system_set_error(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid path - missing share name.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 errno,
+			 "%s: unable to retrieve current working directory.",
 			 function );
 
 			return( -1 );
 		}
-		for( path_index = share_name_index;
-		     path_index < path_length;
-		     path_index++ )
-		{
-			if( path[ path_index ] == '\\' )
-			{
-				path_index++;
-
-				break;
-			}
-		}
-		*volume_name        = (char *) &( path[ volume_name_index ] );
-		*volume_name_length = path_index - volume_name_index;
-
-		if( path[ path_index - 1 ] == '\\' )
-		{
-			*volume_name_length -= 1;
-		}
-		*directory_name_index = path_index;
+		cache->current_working_directory_length = narrow_string_length(
+		                                           cache->current_working_directory );
+		cache->device_number                    = file_statistics.st_dev;
+		cache->inode_number                     = file_statistics.st_ino;
+		cache->generation                       = generation;
+		cache->is_set                           = 1;
 	}
+	*current_working_directory        = cache->current_working_directory;
+	*current_working_directory_length = cache->current_working_directory_length;
+
 	return( 1 );
 }
 
-/* Retrieves the current working directory of a specific volume
+#endif /* defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE ) */
+
+/* Normalizes the segments of a path
+ * The string is scanned backwards, in which a parent directory (..) segment
+ * increments the number of parent directories and a directory or file name
+ * segment decrements it or is kept otherwise. This way every segment is
+ * visited once and no segment stack or split string is needed, hence the cost
+ * is linear in the string length regardless of the number of parent directories
+ * Empty segments, caused by successive separators, and . segments are ignored
+ *
+ * If normalized_path is set the kept segments, each prefixed with a separator,
+ * are written right aligned in front of normalized_path_end_index
+ * normalized_path_length is incremented with the number of characters written
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_current_working_directory_by_volume(
-     char *volume_name,
-     size_t volume_name_length,
-     char **current_working_directory,
-     size_t *current_working_directory_size,
+int libcpath_path_normalize_segments(
+     const char *string,
+     size_t string_length,
+     char *normalized_path,
+     size_t normalized_path_end_index,
+     size_t *normalized_path_length,
+     size_t *number_of_parent_directories,
      libcerror_error_t **error )
 {
-	char *change_volume_name                     = NULL;
-	char *current_volume_working_directory       = NULL;
-	static char *function                        = "libcpath_path_get_current_working_directory_by_volume";
-	size_t current_volume_working_directory_size = 0;
-	int result                                   = 1;
+	static char *function                    = "libcpath_path_normalize_segments";
+	size_t safe_normalized_path_length       = 0;
+	size_t safe_number_of_parent_directories = 0;
+	size_t segment_end_index                 = 0;
+	size_t segment_length                    = 0;
+	size_t string_index                      = 0;
 
-	if( current_working_directory == NULL )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory.",
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	if( current_working_directory_size == NULL )
+	if( string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( normalized_path_length == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory size.",
+		 "%s: invalid normalized path length.",
 		 function );
 
 		return( -1 );
 	}
-	/* If the path contains a volume name switch to that
-	 * volume to determine the current directory
-	 */
-	if( volume_name != NULL )
+	if( number_of_parent_directories == NULL )
 	{
-		if( volume_name_length > (size_t) ( SSIZE_MAX - 1 ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid volume name length value exceeds maximum.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of parent directories.",
+		 function );
 
-			goto on_error;
-		}
-		if( libcpath_path_get_current_working_directory(
-		     &current_volume_working_directory,
-		     &current_volume_working_directory_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve current volume working directory.",
-			 function );
+		return( -1 );
+	}
+	safe_normalized_path_length       = *normalized_path_length;
+	safe_number_of_parent_directories = *number_of_parent_directories;
 
-			goto on_error;
-		}
-		change_volume_name = narrow_string_allocate(
-		                      volume_name_length + 1 );
+	string_index = string_length;
 
-		if( change_volume_name == NULL )
+	while( string_index > 0 )
+	{
+		segment_end_index = string_index;
+
+		while( ( string_index > 0 )
+		    && ( string[ string_index - 1 ] != (char) LIBCPATH_SEPARATOR ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create change volume name.",
-			 function );
+			string_index--;
+		}
+		segment_length = segment_end_index - string_index;
 
-			goto on_error;
+		/* Ignore empty and . segments
+		 */
+		if( ( segment_length == 0 )
+		 || ( ( segment_length == 1 )
+		  &&  ( string[ string_index ] == '.' ) ) )
+		{
 		}
-		if( narrow_string_copy(
-		     change_volume_name,
-		     volume_name,
-		     volume_name_length ) == NULL )
+		else if( ( segment_length == 2 )
+		      && ( string[ string_index ] == '.' )
+		      && ( string[ string_index + 1 ] == '.' ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to set change volume name.",
-			 function );
-
-			goto on_error;
+			safe_number_of_parent_directories++;
 		}
-		change_volume_name[ volume_name_length ] = 0;
-
-		if( libcpath_path_change_directory(
-		     change_volume_name,
-		     error ) != 1 )
+		else if( safe_number_of_parent_directories > 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to change current working directory.",
-			 function );
-
-			goto on_error;
+			safe_number_of_parent_directories--;
 		}
-		memory_free(
-		 change_volume_name );
-
-		change_volume_name = NULL;
-	}
-	if( libcpath_path_get_current_working_directory(
-	     current_working_directory,
-	     current_working_directory_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve current directory.",
-		 function );
-
-		/* Make sure the current working directory has been changed
-		 * back to its original value
-		 */
-		result = -1;
-	}
-	if( current_volume_working_directory != NULL )
-	{
-		if( libcpath_path_change_directory(
-		     current_volume_working_directory,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to change current working directory.",
-			 function );
+			safe_normalized_path_length += segment_length + 1;
 
-			goto on_error;
-		}
-		memory_free(
-		 current_volume_working_directory );
+			if( normalized_path != NULL )
+			{
+				if( safe_normalized_path_length > normalized_path_end_index )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: invalid normalized path end index value too small.",
+					 function );
 
-		current_volume_working_directory = NULL;
-	}
-	return( result );
+					return( -1 );
+				}
+				normalized_path[ normalized_path_end_index - safe_normalized_path_length ] = (char) LIBCPATH_SEPARATOR;
 
-on_error:
-	if( change_volume_name != NULL )
-	{
-		memory_free(
-		 change_volume_name );
-	}
-	if( current_volume_working_directory != NULL )
-	{
-		memory_free(
-		 current_volume_working_directory );
-	}
-	if( *current_working_directory != NULL )
-	{
-		memory_free(
-		 *current_working_directory );
+				if( narrow_string_copy(
+				     &( normalized_path[ normalized_path_end_index - safe_normalized_path_length + 1 ] ),
+				     &( string[ string_index ] ),
+				     segment_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy segment to normalized path.",
+					 function );
 
-		*current_working_directory = NULL;
+					return( -1 );
+				}
+			}
+		}
+		/* Skip the separator
+		 */
+		if( string_index > 0 )
+		{
+			string_index--;
+		}
 	}
-	*current_working_directory_size = 0;
+	*normalized_path_length       = safe_normalized_path_length;
+	*number_of_parent_directories = safe_number_of_parent_directories;
 
-	return( -1 );
+	return( 1 );
 }
 
-/* Determines the full path of the Windows path specified
- * The function uses the extended-length path format
- * (path with \\?\ prefix)
- *
- * Multiple successive \ not at the start of the path are combined into one
- *
- * Scenario's that are considered full paths:
- * Device path:			\\.\PhysicalDrive0
- * Extended-length path:	\\?\C:\directory\file.txt
- * Extended-length UNC path:	\\?\UNC\server\share\directory\file.txt
- *
- * Scenario's that are not considered full paths:
- * Local 'absolute' path:	\directory\file.txt
- *                       	\directory\\file.txt
- * Local 'relative' path:	..\directory\file.txt
- * Local 'relative' path:	.\directory\file.txt
- * Volume 'absolute' path:	C:\directory\file.txt
- *                              C:\..\directory\file.txt
- * Volume 'relative' path:	C:directory\file.txt
- * UNC path:			\\server\share\directory\file.txt
- *
- * TODO handle:
- * Volume device path:		\\.\C:
- * Volume file system path:	\\.\C:\
+/* Normalizes a path into an absolute path
+ * A relative path is appended to the base path, an absolute path replaces it
+ * A parent directory (..) segment of the root directory refers to the root directory
  *
- * Returns 1 if succesful or -1 on error
+ * The size of the normalized path, including the end of string character,
+ * is determined first. If normalized_path is set the normalized path is written
+ * after that, hence all the characters are only written once
+ * Returns 1 if successful, 0 if the normalized path size is too small or -1 on error
  */
-int libcpath_path_get_full_path(
+int libcpath_path_normalize_with_base(
+     const char *base_path,
+     size_t base_path_length,
      const char *path,
      size_t path_length,
-     char **full_path,
-     size_t *full_path_size,
+     char *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
      libcerror_error_t **error )
 {
-	libcsplit_narrow_split_string_t *current_directory_split_string = NULL;
-	libcsplit_narrow_split_string_t *path_split_string              = NULL;
-	char *current_directory                                         = NULL;
-	char *current_directory_string_segment                          = NULL;
-	char *full_path_prefix                                          = NULL;
-	char *last_used_path_string_segment                             = NULL;
-	char *path_string_segment                                       = NULL;
-	char *volume_name                                               = NULL;
-	static char *function                                           = "libcpath_path_get_full_path";
-	size_t current_directory_length                                 = 0;
-	size_t current_directory_name_index                             = 0;
-	size_t current_directory_size                                   = 0;
-	size_t current_directory_string_segment_size                    = 0;
-	size_t full_path_index                                          = 0;
-	size_t full_path_prefix_length                                  = 0;
-	size_t last_used_path_string_segment_size                       = 0;
-	size_t path_directory_name_index                                = 0;
-	size_t path_string_segment_size                                 = 0;
-	size_t safe_full_path_size                                      = 0;
-	size_t volume_name_length                                       = 0;
-	uint8_t path_type                                               = LIBCPATH_TYPE_RELATIVE;
-	int current_directory_number_of_segments                        = 0;
-	int current_directory_segment_index                             = 0;
-	int last_used_path_segment_index                                = -1;
-	int path_number_of_segments                                     = 0;
-	int path_segment_index                                          = 0;
+	static char *function               = "libcpath_path_normalize_with_base";
+	size_t normalized_path_length       = 0;
+	size_t number_of_parent_directories = 0;
+	size_t safe_normalized_path_size    = 0;
+	int pass                            = 0;
+	int use_base_path                   = 0;
 
 	if( path == NULL )
 	{
@@ -1126,851 +1404,469 @@ int libcpath_path_get_full_path(
 
 		return( -1 );
 	}
-	if( path_length == 0 )
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid path length is zero.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( ( base_path != NULL )
+	 && ( base_path_length > ( (size_t) ( SSIZE_MAX - 2 ) - path_length ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 "%s: invalid base path length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( full_path == NULL )
+	if( required_normalized_path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path.",
+		 "%s: invalid required normalized path size.",
 		 function );
 
 		return( -1 );
 	}
-	if( *full_path != NULL )
+	if( ( base_path != NULL )
+	 && ( ( path_length == 0 )
+	  ||  ( path[ 0 ] != (char) LIBCPATH_SEPARATOR ) ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid full path value already set.",
-		 function );
-
-		return( -1 );
+		use_base_path = 1;
 	}
-	if( full_path_size == NULL )
+	/* The first pass determines the size of the normalized path
+	 * the second pass writes the normalized path
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		if( pass == 1 )
+		{
+			if( normalized_path == NULL )
+			{
+				break;
+			}
+			if( normalized_path_size < safe_normalized_path_size )
+			{
+				*required_normalized_path_size = safe_normalized_path_size;
+
+				return( 0 );
+			}
+		}
+		normalized_path_length       = 0;
+		number_of_parent_directories = 0;
+
+		if( libcpath_path_normalize_segments(
+		     path,
+		     path_length,
+		     ( pass == 1 ) ? normalized_path : NULL,
+		     safe_normalized_path_size - 1,
+		     &normalized_path_length,
+		     &number_of_parent_directories,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to normalize path segments.",
+			 function );
+
+			return( -1 );
+		}
+		if( use_base_path != 0 )
+		{
+			if( libcpath_path_normalize_segments(
+			     base_path,
+			     base_path_length,
+			     ( pass == 1 ) ? normalized_path : NULL,
+			     safe_normalized_path_size - 1,
+			     &normalized_path_length,
+			     &number_of_parent_directories,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to normalize base path segments.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		/* The normalized path of the root directory consists of a single separator
+		 */
+		if( normalized_path_length == 0 )
+		{
+			normalized_path_length = 1;
+
+			if( pass == 1 )
+			{
+				normalized_path[ 0 ] = (char) LIBCPATH_SEPARATOR;
+			}
+		}
+		if( pass == 0 )
+		{
+			safe_normalized_path_size = normalized_path_length + 1;
+		}
+		else
+		{
+			normalized_path[ normalized_path_length ] = 0;
+		}
+	}
+	*required_normalized_path_size = safe_normalized_path_size;
+
+	return( 1 );
+}
+
+/* Normalizes a path into an absolute path using a normalized base path
+ * The base path must be normalized, for example by libcpath_path_normalize_with_base,
+ * and the root directory is represented by an empty base path. A parent
+ * directory (..) segment of the path removes the last segment of the base path
+ * hence the base path is not scanned again for every path it is combined with
+ * Returns 1 if successful, 0 if the normalized path size is too small or -1 on error
+ */
+int libcpath_path_normalize_with_normalized_base(
+     const char *base_path,
+     size_t base_path_length,
+     const char *path,
+     size_t path_length,
+     char *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcpath_path_normalize_with_normalized_base";
+	size_t normalized_path_length       = 0;
+	size_t number_of_parent_directories = 0;
+	size_t safe_normalized_path_size    = 0;
+
+	if( ( base_path == NULL )
+	 && ( base_path_length != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path size.",
+		 "%s: invalid base path.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcpath_path_get_path_type(
-	     path,
-	     path_length,
-	     &path_type,
-	     error ) != 1 )
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine path type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcpath_path_get_volume_name(
-	     path,
-	     path_length,
-	     &volume_name,
-	     &volume_name_length,
-	     &path_directory_name_index,
-	     error ) != 1 )
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine volume name.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	/* If the path is a device path, an extended-length path or an UNC
-	 * do not bother to lookup the current working directory
-	 */
-	if( ( path_type != LIBCPATH_TYPE_DEVICE )
-	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH )
-	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
-	 && ( path_type != LIBCPATH_TYPE_UNC ) )
+	if( base_path_length > ( (size_t) ( SSIZE_MAX - 2 ) - path_length ) )
 	{
-		if( libcpath_path_get_current_working_directory_by_volume(
-		     volume_name,
-		     volume_name_length,
-		     &current_directory,
-		     &current_directory_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve current working directory by volume.",
-			 function );
-
-			goto on_error;
-		}
-		/* Determine the volume name using the current working directory if necessary
-		 */
-		if( libcpath_path_get_volume_name(
-		     current_directory,
-		     current_directory_size - 1,
-		     &volume_name,
-		     &volume_name_length,
-		     &current_directory_name_index,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine volume name from current working directory.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base path length value exceeds maximum.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	if( ( current_directory != NULL )
-	 && ( current_directory_name_index < current_directory_size ) )
+	if( required_normalized_path_size == NULL )
 	{
-		current_directory_length = narrow_string_length(
-		                            &( current_directory[ current_directory_name_index ] ) );
-
-		if( libcsplit_narrow_string_split(
-		     &( current_directory[ current_directory_name_index ] ),
-		     current_directory_length + 1,
-		     '\\',
-		     &current_directory_split_string,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to split current working directory.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required normalized path size.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	if( libcsplit_narrow_string_split(
-	     &( path[ path_directory_name_index ] ),
-	     path_length - path_directory_name_index + 1,
-	     '\\',
-	     &path_split_string,
+	if( ( path_length > 0 )
+	 && ( path[ 0 ] == (char) LIBCPATH_SEPARATOR ) )
+	{
+		base_path_length = 0;
+	}
+	if( libcpath_path_normalize_segments(
+	     path,
+	     path_length,
+	     NULL,
+	     0,
+	     &normalized_path_length,
+	     &number_of_parent_directories,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split path.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of normalized path segments.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	/* The size of the full path consists of:
-	 * the size of the prefix (\\?\ or \\.\)
+	/* Every remaining parent directory (..) segment removes the last segment
+	 * of the base path
 	 */
-	safe_full_path_size = 4;
+	while( ( number_of_parent_directories > 0 )
+	    && ( base_path_length > 0 ) )
+	{
+		base_path_length--;
 
-	/* If the path contains a volume name
-	 * the length of the volume name
-	 * a directory separator
+		while( ( base_path_length > 0 )
+		    && ( base_path[ base_path_length ] != (char) LIBCPATH_SEPARATOR ) )
+		{
+			base_path_length--;
+		}
+		number_of_parent_directories--;
+	}
+	safe_normalized_path_size = base_path_length + normalized_path_length + 1;
+
+	/* The normalized path of the root directory consists of a single separator
 	 */
-	if( volume_name != NULL )
+	if( safe_normalized_path_size == 1 )
 	{
-		safe_full_path_size += volume_name_length + 1;
+		safe_normalized_path_size = 2;
 	}
-	/* If the path contains an UNC path
-	 * add the size of the UNC\ prefix
-	 */
-	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
-	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	*required_normalized_path_size = safe_normalized_path_size;
+
+	if( normalized_path == NULL )
 	{
-		safe_full_path_size += 4;
+		return( 1 );
 	}
-	/* If the path is relative
-	 * add the size of the current working directory
-	 * a directory separator, if necessary
-	 */
-	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
-	 && ( current_directory_name_index < current_directory_size ) )
+	if( normalized_path_size < safe_normalized_path_size )
 	{
-		safe_full_path_size += ( current_directory_size - ( current_directory_name_index + 1 ) );
-
-		if( ( current_directory_size >= 2 )
-		 && ( current_directory[ current_directory_size - 2 ] != '\\' ) )
-		{
-			safe_full_path_size += 1;
-		}
+		return( 0 );
 	}
-	if( current_directory_split_string != NULL )
+	if( base_path_length > 0 )
 	{
-		if( libcsplit_narrow_split_string_get_number_of_segments(
-		     current_directory_split_string,
-		     &current_directory_number_of_segments,
-		     error ) != 1 )
+		if( narrow_string_copy(
+		     normalized_path,
+		     base_path,
+		     base_path_length ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of current working directory string segments.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy base path to normalized path.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		current_directory_segment_index = current_directory_number_of_segments - 1;
 	}
-	if( libcsplit_narrow_split_string_get_number_of_segments(
-	     path_split_string,
-	     &path_number_of_segments,
+	normalized_path_length       = 0;
+	number_of_parent_directories = 0;
+
+	if( libcpath_path_normalize_segments(
+	     path,
+	     path_length,
+	     normalized_path,
+	     safe_normalized_path_size - 1,
+	     &normalized_path_length,
+	     &number_of_parent_directories,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of path string segments.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to normalize path segments.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( path_segment_index = 0;
-	     path_segment_index < path_number_of_segments;
-	     path_segment_index++ )
+	if( safe_normalized_path_size == 2 )
 	{
-		if( libcsplit_narrow_split_string_get_segment_by_index(
-		     path_split_string,
-		     path_segment_index,
-		     &path_string_segment,
-		     &path_string_segment_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve path string segment: %d.",
-			 function,
-			 path_segment_index );
+		normalized_path[ 0 ] = (char) LIBCPATH_SEPARATOR;
+	}
+	normalized_path[ safe_normalized_path_size - 1 ] = 0;
 
-			goto on_error;
-		}
-		if( path_string_segment == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing path string segment: %d.",
-			 function,
-			 path_segment_index );
-
-			goto on_error;
-		}
-		/* If the path is .. reverse the current path by one directory
-		 */
-		if( ( path_string_segment_size == 3 )
-		 && ( path_string_segment[ 0 ] == '.' )
-		 && ( path_string_segment[ 1 ] == '.' ) )
-		{
-			if( ( current_directory_split_string != NULL )
-			 && ( last_used_path_segment_index == -1 ) )
-			{
-				if( libcsplit_narrow_split_string_get_segment_by_index(
-				     current_directory_split_string,
-				     current_directory_segment_index,
-				     &current_directory_string_segment,
-				     &current_directory_string_segment_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				if( current_directory_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				/* Remove the size of the parent directory name and a directory separator
-				 * Note that the size includes the end of string character
-				 */
-				safe_full_path_size -= current_directory_string_segment_size;
-
-				if( libcsplit_narrow_split_string_set_segment_by_index(
-				     current_directory_split_string,
-				     current_directory_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				current_directory_segment_index--;
-			}
-			else if( last_used_path_segment_index >= 0 )
-			{
-				if( libcsplit_narrow_split_string_get_segment_by_index(
-				     path_split_string,
-				     last_used_path_segment_index,
-				     &last_used_path_string_segment,
-				     &last_used_path_string_segment_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve last used path string segment: %d.",
-					 function,
-					 last_used_path_segment_index );
-
-					goto on_error;
-				}
-				if( last_used_path_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing last used path string string segment: %d.",
-					 function,
-					 last_used_path_segment_index );
-
-					goto on_error;
-				}
-				/* Remove the size of the parent directory name and a directory separator
-				 * Note that the size includes the end of string character
-				 */
-				safe_full_path_size -= last_used_path_string_segment_size;
-
-				if( libcsplit_narrow_split_string_set_segment_by_index(
-				     path_split_string,
-				     last_used_path_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path string segment: %d.",
-					 function,
-					 last_used_path_segment_index );
-
-					goto on_error;
-				}
-				/* Find the previous path split value that contains a name
-				 */
-				while( last_used_path_segment_index > 0 )
-				{
-					last_used_path_segment_index--;
-
-					if( libcsplit_narrow_split_string_get_segment_by_index(
-					     path_split_string,
-					     last_used_path_segment_index,
-					     &last_used_path_string_segment,
-					     &last_used_path_string_segment_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve last used path string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					if( last_used_path_string_segment_size != 0 )
-					{
-						break;
-					}
-				}
-			}
-			if( libcsplit_narrow_split_string_set_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     NULL,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path string segment: %d.",
-				 function,
-				 path_segment_index );
+	return( 1 );
+}
 
-				goto on_error;
-			}
-		}
-		/* If the path is . ignore the entry
-		 */
-		else if( ( path_string_segment_size == 2 )
-		      && ( path_string_segment[ 0 ] == '.' ) )
-		{
-			if( libcsplit_narrow_split_string_set_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     NULL,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path string segment: %d.",
-				 function,
-				 path_segment_index );
+#if defined( WINAPI )
 
-				goto on_error;
-			}
-		}
-		/* If the path is empty ignore the entry
-		 */
-		else if( path_string_segment_size <= 1 )
-		{
-			if( libcsplit_narrow_split_string_set_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     NULL,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path string segment: %d.",
-				 function,
-				 path_segment_index );
+/* Determines the path type
+ * Returns 1 if succesful or -1 on error
+ */
+int libcpath_path_get_path_type(
+     const char *path,
+     size_t path_length,
+     uint8_t *path_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_get_path_type";
 
-				goto on_error;
-			}
-		}
-		else
-		{
-			/* Add the size of the directory or file name and a directory separator
-			 * Note that the size includes the end of string character
-			 */
-			safe_full_path_size += path_string_segment_size;
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
 
-			last_used_path_segment_index = path_segment_index;
-		}
+		return( -1 );
 	}
-	/* Note that the last path separator serves as the end of string
-	 */
-	full_path_index = 0;
-
-	*full_path = narrow_string_allocate(
-	              safe_full_path_size );
-
-	if( *full_path == NULL )
+	if( path_length == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     *full_path,
-	     0,
-	     sizeof( char ) * safe_full_path_size ) == NULL )
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	*full_path_size = safe_full_path_size;
-
-	if( path_type == LIBCPATH_TYPE_DEVICE )
-	{
-		full_path_prefix        = "\\\\.\\";
-		full_path_prefix_length = 4;
-	}
-	else
-	{
-		full_path_prefix        = "\\\\?\\";
-		full_path_prefix_length = 4;
-	}
-	if( narrow_string_copy(
-	     &( ( *full_path )[ full_path_index ] ),
-	     full_path_prefix,
-	     full_path_prefix_length ) == NULL )
+	if( path_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set prefix in full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path type.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	full_path_index += full_path_prefix_length;
+	*path_type = LIBCPATH_TYPE_RELATIVE;
 
-	/* If there is a share name the path is an UNC path
+	/* Determine if the path is a special path
+	 * device path prefix:          \\.\
+	 * extended-length path prefix: \\?\
 	 */
-	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
-	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	if( ( path_length >= 4 )
+	 && ( path[ 0 ] == '\\' )
+	 && ( path[ 1 ] == '\\' )
+	 && ( ( path[ 2 ] == '.' )
+	  ||  ( path[ 2 ] == '?' ) )
+	 && ( path[ 3 ] == '\\' ) )
 	{
-		if( narrow_string_copy(
-		     &( ( *full_path )[ full_path_index ] ),
-		     "UNC\\",
-		     4 ) == NULL )
+		if( path[ 2 ] == '.' )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set UNC\\ prefix in full path.",
-			 function );
-
-			goto on_error;
+			*path_type = LIBCPATH_TYPE_DEVICE;
 		}
-		full_path_index += 4;
-	}
-	if( volume_name != NULL )
-	{
-		if( narrow_string_copy(
-		     &( ( *full_path )[ full_path_index ] ),
-		     volume_name,
-		     volume_name_length ) == NULL )
+		/* Determine if the path in an extended-length UNC path
+		 * \\?\UNC\server\share
+		 */
+		else if( ( path_length >= 8 )
+		      && ( path[ 4 ] == 'U' )
+		      && ( path[ 5 ] == 'N' )
+		      && ( path[ 6 ] == 'C' )
+		      && ( path[ 7 ] == '\\' ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set volume name in full path.",
-			 function );
-
-			goto on_error;
+			*path_type = LIBCPATH_TYPE_EXTENDED_LENGTH_UNC;
+		}
+		else
+		{
+			*path_type = LIBCPATH_TYPE_EXTENDED_LENGTH;
 		}
-		full_path_index += volume_name_length;
-
-		( *full_path )[ full_path_index ] = '\\';
-
-		full_path_index += 1;
 	}
-	/* If the path is relative
-	 * add the current working directory elements
+	/* Determine if the path is an UNC path
+	 * \\server\share
 	 */
-	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
-	 && ( current_directory_split_string != NULL ) )
+	else if( ( path_length >= 2 )
+	      && ( path[ 0 ] == '\\' )
+	      && ( path[ 1 ] == '\\' ) )
 	{
-		for( current_directory_segment_index = 0;
-		     current_directory_segment_index < current_directory_number_of_segments;
-		     current_directory_segment_index++ )
-		{
-			if( libcsplit_narrow_split_string_get_segment_by_index(
-			     current_directory_split_string,
-			     current_directory_segment_index,
-			     &current_directory_string_segment,
-			     &current_directory_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve current working directory string segment: %d.",
-				 function,
-				 current_directory_segment_index );
-
-				goto on_error;
-			}
-			if( current_directory_string_segment_size != 0 )
-			{
-				if( current_directory_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				if( narrow_string_copy(
-				     &( ( *full_path )[ full_path_index ] ),
-				     current_directory_string_segment,
-				     current_directory_string_segment_size - 1 ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set current working directory split value: %d in full path.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				full_path_index += current_directory_string_segment_size - 1;
-
-				( *full_path )[ full_path_index ] = '\\';
-
-				full_path_index += 1;
-			}
-		}
+		*path_type = LIBCPATH_TYPE_UNC;
 	}
-	for( path_segment_index = 0;
-	     path_segment_index < path_number_of_segments;
-	     path_segment_index++ )
+	else if( path[ 0 ] == '\\' )
 	{
-		if( libcsplit_narrow_split_string_get_segment_by_index(
-		     path_split_string,
-		     path_segment_index,
-		     &path_string_segment,
-		     &path_string_segment_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve path string segment: %d.",
-			 function,
-			 path_segment_index );
-
-			goto on_error;
-		}
-		if( path_string_segment_size != 0 )
-		{
-			if( path_string_segment == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing path string segment: %d.",
-				 function,
-				 path_segment_index );
-
-				goto on_error;
-			}
-			if( narrow_string_copy(
-			     &( ( *full_path )[ full_path_index ] ),
-			     path_string_segment,
-			     path_string_segment_size - 1 ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path split value: %d in full path.",
-				 function,
-				 path_segment_index );
+		*path_type = LIBCPATH_TYPE_ABSOLUTE;
+	}
+	else if( ( path_length >= 3 )
+	      && ( path[ 1 ] == ':' )
+	      && ( path[ 2 ] == '\\' )
+	      && ( ( ( path[ 0 ] >= 'A' )
+	        &&   ( path[ 0 ] <= 'Z' ) )
+	       ||  ( ( path[ 0 ] >= 'a' )
+	        &&   ( path[ 0 ] <= 'z' ) ) ) )
+	{
+		*path_type = LIBCPATH_TYPE_ABSOLUTE;
+	}
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			full_path_index += path_string_segment_size - 1;
+/* Determines the volume name
+ * Returns 1 if succesful or -1 on error
+ */
+int libcpath_path_get_volume_name(
+     const char *path,
+     size_t path_length,
+     char **volume_name,
+     size_t *volume_name_length,
+     size_t *directory_name_index,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcpath_path_get_volume_name";
+	size_t path_index        = 0;
+	size_t share_name_index  = 0;
+	size_t volume_name_index = 0;
 
-			( *full_path )[ full_path_index ] = '\\';
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
 
-			full_path_index += 1;
-		}
+		return( -1 );
 	}
-	( *full_path )[ full_path_index - 1 ] = 0;
-
-	if( libcsplit_narrow_split_string_free(
-	     &path_split_string,
-	     error ) != 1 )
+	if( path_length == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free path split string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( current_directory_split_string != NULL )
-	{
-		if( libcsplit_narrow_split_string_free(
-		     &current_directory_split_string,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free current working directory split string.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( current_directory != NULL )
-	{
-		memory_free(
-		 current_directory );
-	}
-	return( 1 );
-
-on_error:
-	if( *full_path != NULL )
-	{
-		memory_free(
-		 *full_path );
-
-		*full_path = NULL;
-	}
-	*full_path_size = 0;
-
-	if( path_split_string != NULL )
-	{
-		libcsplit_narrow_split_string_free(
-		 &path_split_string,
-		 NULL );
-	}
-	if( current_directory_split_string != NULL )
-	{
-		libcsplit_narrow_split_string_free(
-		 &current_directory_split_string,
-		 NULL );
-	}
-	if( current_directory != NULL )
-	{
-		memory_free(
-		 current_directory );
-	}
-	return( -1 );
-}
-
-#else
-
-/* Determines the full path of the POSIX path specified
- * Multiple successive / are combined into one
- *
- * Scenarios:
- * /home/user/file.txt
- * /home/user//file.txt
- * /home/user/../user/file.txt
- * /../home/user/file.txt
- * user/../user/file.txt
- *
- * Returns 1 if succesful or -1 on error
- */
-int libcpath_path_get_full_path(
-     const char *path,
-     size_t path_length,
-     char **full_path,
-     size_t *full_path_size,
-     libcerror_error_t **error )
-{
-	libcsplit_narrow_split_string_t *current_directory_split_string = NULL;
-	libcsplit_narrow_split_string_t *path_split_string              = NULL;
-	char *current_directory                                         = NULL;
-	char *current_directory_string_segment                          = NULL;
-	char *last_used_path_string_segment                             = NULL;
-	char *path_string_segment                                       = NULL;
-	static char *function                                           = "libcpath_path_get_full_path";
-	size_t current_directory_length                                 = 0;
-	size_t current_directory_size                                   = 0;
-	size_t current_directory_string_segment_size                    = 0;
-	size_t full_path_index                                          = 0;
-	size_t last_used_path_string_segment_size                       = 0;
-	size_t path_string_segment_size                                 = 0;
-	size_t safe_full_path_size                                      = 0;
-	uint8_t path_type                                               = LIBCPATH_TYPE_RELATIVE;
-	int current_directory_number_of_segments                        = 0;
-	int current_directory_segment_index                             = 0;
-	int last_used_path_segment_index                                = -1;
-	int path_number_of_segments                                     = 0;
-	int path_segment_index                                          = 0;
-
-	if( path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
-		 function );
-
-		return( -1 );
-	}
-	if( path_length == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid path length is zero.",
-		 function );
-
-		return( -1 );
-	}
-	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1981,1042 +1877,1255 @@ int libcpath_path_get_full_path(
 
 		return( -1 );
 	}
-	if( full_path == NULL )
+	if( volume_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path.",
+		 "%s: invalid volume name.",
 		 function );
 
 		return( -1 );
 	}
-	if( *full_path != NULL )
+	if( volume_name_length == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid full path value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume name length.",
 		 function );
 
 		return( -1 );
 	}
-	if( full_path_size == NULL )
+	if( directory_name_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path size.",
+		 "%s: invalid directory name index.",
 		 function );
 
 		return( -1 );
 	}
-	if( path[ 0 ] == '/' )
-	{
-		path_type = LIBCPATH_TYPE_ABSOLUTE;
-	}
-	else
+	*volume_name          = NULL;
+	*volume_name_length   = 0;
+	*directory_name_index = 0;
+
+	/* Determine if the path is a special path
+	 * device path prefix:          \\.\
+	 * extended-length path prefix: \\?\
+	 */
+	if( ( path_length >= 4 )
+	 && ( path[ 0 ] == '\\' )
+	 && ( path[ 1 ] == '\\' )
+	 && ( ( path[ 2 ] == '.' )
+	  ||  ( path[ 2 ] == '?' ) )
+	 && ( path[ 3 ] == '\\' ) )
 	{
-		if( libcpath_path_get_current_working_directory(
-		     &current_directory,
-		     &current_directory_size,
-		     error ) != 1 )
+		if( path[ 2 ] == '.' )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve current working directory.",
-			 function );
-
-			goto on_error;
+			volume_name_index = 4;
 		}
-	}
-	if( current_directory != NULL )
-	{
-		current_directory_length = narrow_string_length(
-		                            current_directory );
-
-		if( libcsplit_narrow_string_split(
-		     current_directory,
-		     current_directory_length + 1,
-		     '/',
-		     &current_directory_split_string,
-		     error ) != 1 )
+		/* Determine if the path in an extended-length UNC path
+		 * \\?\UNC\server\share
+		 */
+		else if( ( path_length >= 8 )
+		      && ( path[ 4 ] == 'U' )
+		      && ( path[ 5 ] == 'N' )
+		      && ( path[ 6 ] == 'C' )
+		      && ( path[ 7 ] == '\\' ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to split current working directory.",
-			 function );
-
-			goto on_error;
+			volume_name_index = 8;
+		}
+		else
+		{
+			volume_name_index = 4;
 		}
 	}
-	if( libcsplit_narrow_string_split(
-	     path,
-	     path_length + 1,
-	     '/',
-	     &path_split_string,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split path.",
-		 function );
-
-		goto on_error;
-	}
-	/* Determine the full path size
-	 */
-	/* If the path is absolute
-	 * a directory separator
+	/* Determine if the path is an UNC path
+	 * \\server\share
 	 */
-	if( path_type == LIBCPATH_TYPE_ABSOLUTE )
+	else if( ( path_length >= 2 )
+	      && ( path[ 0 ] == '\\' )
+	      && ( path[ 1 ] == '\\' ) )
 	{
-		safe_full_path_size = 1;
+		volume_name_index = 2;
 	}
-	/* If the path is relative
-	 * add the size of the current working directory
-	 * a directory separator, if necessary
+	/* Check if the path contains a volume letter
 	 */
-	else if( path_type == LIBCPATH_TYPE_RELATIVE )
+	if( ( path_length >= 2 )
+	 && ( volume_name_index <= ( path_length - 2 ) )
+	 && ( path[ volume_name_index + 1 ] == ':' )
+	 && ( ( ( path[ volume_name_index ] >= 'A' )
+	   &&   ( path[ volume_name_index ] <= 'Z' ) )
+	  ||  ( ( path[ volume_name_index ] >= 'a' )
+	   &&   ( path[ volume_name_index ] <= 'z' ) ) ) )
 	{
-		if( current_directory == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing current working directory.",
-			 function );
+		path_index = volume_name_index + 2;
 
-			goto on_error;
+		if( ( path_index < path_length )
+		 && ( path[ path_index ] == '\\' ) )
+		{
+			path_index++;
 		}
-		/* We need to use the length here since current_directory_size will be PATH_MAX
-		 */
-		safe_full_path_size = current_directory_length;
+		*volume_name        = (char *) &( path[ volume_name_index ] );
+		*volume_name_length = path_index - volume_name_index;
 
-		if( ( current_directory_length >= 1 )
-		 && ( current_directory[ current_directory_length - 1 ] != '/' ) )
+		if( path[ path_index - 1 ] == '\\' )
 		{
-			safe_full_path_size++;
+			*volume_name_length -= 1;
 		}
+		*directory_name_index = path_index;
 	}
-	if( current_directory_split_string != NULL )
+	else if( volume_name_index == 4 )
 	{
-		if( libcsplit_narrow_split_string_get_number_of_segments(
-		     current_directory_split_string,
-		     &current_directory_number_of_segments,
-		     error ) != 1 )
+		for( path_index = volume_name_index;
+		     path_index < path_length;
+		     path_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of current working directory string segments.",
-			 function );
-
-			goto on_error;
+			if( path[ path_index ] == '\\' )
+			{
+				path_index++;
+
+				break;
+			}
 		}
-		current_directory_segment_index = current_directory_number_of_segments - 1;
+		*volume_name        = (char *) &( path[ 4 ] );
+		*volume_name_length = path_index - 4;
+
+		if( path[ path_index - 1 ] == '\\' )
+		{
+			*volume_name_length -= 1;
+		}
+		*directory_name_index = path_index;
 	}
-	if( libcsplit_narrow_split_string_get_number_of_segments(
-	     path_split_string,
-	     &path_number_of_segments,
-	     error ) != 1 )
+	else if( ( volume_name_index == 2 )
+	      || ( volume_name_index == 8 ) )
+	{
+		for( share_name_index = volume_name_index;
+		     share_name_index < path_length;
+		     share_name_index++ )
+		{
+			if( path[ share_name_index ] == '\\' )
+			{
+				share_name_index++;
+
+				break;
+			}
+		}
+		if( share_name_index > path_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid path - missing share name.",
+			 function );
+
+			return( -1 );
+		}
+		for( path_index = share_name_index;
+		     path_index < path_length;
+		     path_index++ )
+		{
+			if( path[ path_index ] == '\\' )
+			{
+				path_index++;
+
+				break;
+			}
+		}
+		*volume_name        = (char *) &( path[ volume_name_index ] );
+		*volume_name_length = path_index - volume_name_index;
+
+		if( path[ path_index - 1 ] == '\\' )
+		{
+			*volume_name_length -= 1;
+		}
+		*directory_name_index = path_index;
+	}
+	return( 1 );
+}
+
+/* Retrieves the current working directory of a specific volume
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_current_working_directory_by_volume(
+     char *volume_name,
+     size_t volume_name_length,
+     char **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error )
+{
+	char *change_volume_name                     = NULL;
+	char *current_volume_working_directory       = NULL;
+	static char *function                        = "libcpath_path_get_current_working_directory_by_volume";
+	size_t current_volume_working_directory_size = 0;
+	int result                                   = 1;
+
+	if( current_working_directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of path string segments.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( path_segment_index = 0;
-	     path_segment_index < path_number_of_segments;
-	     path_segment_index++ )
+	if( current_working_directory_size == NULL )
 	{
-		if( libcsplit_narrow_split_string_get_segment_by_index(
-		     path_split_string,
-		     path_segment_index,
-		     &path_string_segment,
-		     &path_string_segment_size,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory size.",
+		 function );
+
+		return( -1 );
+	}
+	/* If the path contains a volume name switch to that
+	 * volume to determine the current directory
+	 */
+	if( volume_name != NULL )
+	{
+		if( volume_name_length > (size_t) ( SSIZE_MAX - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid volume name length value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcpath_path_get_current_working_directory(
+		     &current_volume_working_directory,
+		     &current_volume_working_directory_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve path string segment: %d.",
-			 function,
-			 path_segment_index );
+			 "%s: unable to retrieve current volume working directory.",
+			 function );
 
 			goto on_error;
 		}
-		if( path_string_segment == NULL )
+		change_volume_name = libcpath_allocator_allocate_narrow_string(
+		                      volume_name_length + 1 );
+
+		if( change_volume_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create change volume name.",
+			 function );
+
+			goto on_error;
+		}
+		if( narrow_string_copy(
+		     change_volume_name,
+		     volume_name,
+		     volume_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to set change volume name.",
+			 function );
+
+			goto on_error;
+		}
+		change_volume_name[ volume_name_length ] = 0;
+
+		if( libcpath_path_change_directory(
+		     change_volume_name,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing path string segment: %d.",
-			 function,
-			 path_segment_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to change current working directory.",
+			 function );
 
 			goto on_error;
 		}
-		/* If the path is .. reverse the current path by one directory
+		libcpath_allocator_free(
+		 change_volume_name );
+
+		change_volume_name = NULL;
+	}
+	if( libcpath_path_get_current_working_directory(
+	     current_working_directory,
+	     current_working_directory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current directory.",
+		 function );
+
+		/* Make sure the current working directory has been changed
+		 * back to its original value
 		 */
-		if( ( path_string_segment_size == 3 )
-		 && ( path_string_segment[ 0 ] == '.' )
-		 && ( path_string_segment[ 1 ] == '.' ) )
+		result = -1;
+	}
+	if( current_volume_working_directory != NULL )
+	{
+		if( libcpath_path_change_directory(
+		     current_volume_working_directory,
+		     error ) != 1 )
 		{
-			if( ( current_directory_split_string != NULL )
-			 && ( last_used_path_segment_index == -1 ) )
-			{
-				if( libcsplit_narrow_split_string_get_segment_by_index(
-				     current_directory_split_string,
-				     current_directory_segment_index,
-				     &current_directory_string_segment,
-				     &current_directory_string_segment_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to change current working directory.",
+			 function );
 
-					goto on_error;
-				}
-				if( current_directory_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
+			goto on_error;
+		}
+		libcpath_allocator_free(
+		 current_volume_working_directory );
 
-					goto on_error;
-				}
-				/* Remove the size of the parent directory name and a directory separator
-				 * Note that the size includes the end of string character
-				 */
-				safe_full_path_size -= current_directory_string_segment_size;
+		current_volume_working_directory = NULL;
+	}
+	return( result );
 
-				if( libcsplit_narrow_split_string_set_segment_by_index(
-				     current_directory_split_string,
-				     current_directory_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				current_directory_segment_index--;
-			}
-			else if( last_used_path_segment_index >= 0 )
-			{
-				if( libcsplit_narrow_split_string_get_segment_by_index(
-				     path_split_string,
-				     last_used_path_segment_index,
-				     &last_used_path_string_segment,
-				     &last_used_path_string_segment_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve last used path string segment: %d.",
-					 function,
-					 last_used_path_segment_index );
-
-					goto on_error;
-				}
-				if( last_used_path_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing last used path string string segment: %d.",
-					 function,
-					 last_used_path_segment_index );
-
-					goto on_error;
-				}
-				/* Remove the size of the parent directory name and a directory separator
-				 * Note that the size includes the end of string character
-				 */
-				safe_full_path_size -= last_used_path_string_segment_size;
-
-				if( libcsplit_narrow_split_string_set_segment_by_index(
-				     path_split_string,
-				     last_used_path_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path string segment: %d.",
-					 function,
-					 last_used_path_segment_index );
-
-					goto on_error;
-				}
-				/* Find the previous path split value that contains a name
-				 */
-				while( last_used_path_segment_index > 0 )
-				{
-					last_used_path_segment_index--;
-
-					if( libcsplit_narrow_split_string_get_segment_by_index(
-					     path_split_string,
-					     last_used_path_segment_index,
-					     &last_used_path_string_segment,
-					     &last_used_path_string_segment_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve last used path string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					if( last_used_path_string_segment_size != 0 )
-					{
-						break;
-					}
-				}
-			}
-			if( libcsplit_narrow_split_string_set_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     NULL,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path string segment: %d.",
-				 function,
-				 path_segment_index );
-
-				goto on_error;
-			}
-		}
-		/* If the path is . ignore the entry
-		 */
-		else if( ( path_string_segment_size == 2 )
-		      && ( path_string_segment[ 0 ] == '.' ) )
-		{
-			if( libcsplit_narrow_split_string_set_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     NULL,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path string segment: %d.",
-				 function,
-				 path_segment_index );
-
-				goto on_error;
-			}
-		}
-		/* If the path is empty ignore the entry
-		 */
-		else if( path_string_segment_size <= 1 )
-		{
-			if( libcsplit_narrow_split_string_set_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     NULL,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path string segment: %d.",
-				 function,
-				 path_segment_index );
-
-				goto on_error;
-			}
-		}
-		else
-		{
-			/* Add the size of the directory or file name and a directory separator
-			 * Note that the size includes the end of string character
-			 */
-			safe_full_path_size += path_string_segment_size;
+on_error:
+	if( change_volume_name != NULL )
+	{
+		libcpath_allocator_free(
+		 change_volume_name );
+	}
+	if( current_volume_working_directory != NULL )
+	{
+		libcpath_allocator_free(
+		 current_volume_working_directory );
+	}
+	if( *current_working_directory != NULL )
+	{
+		libcpath_allocator_free(
+		 *current_working_directory );
 
-			last_used_path_segment_index = path_segment_index;
-		}
+		*current_working_directory = NULL;
 	}
-	/* Note that the last path separator serves as the end of string
-	 */
-	full_path_index = 0;
+	*current_working_directory_size = 0;
 
-	*full_path = narrow_string_allocate(
-	              safe_full_path_size );
+	return( -1 );
+}
 
-	if( *full_path == NULL )
+/* Determines the full path of the Windows path specified
+ * The function uses the extended-length path format
+ * (path with \\?\ prefix)
+ *
+ * Multiple successive \ not at the start of the path are combined into one
+ *
+ * Scenario's that are considered full paths:
+ * Device path:			\\.\PhysicalDrive0
+ * Extended-length path:	\\?\C:\directory\file.txt
+ * Extended-length UNC path:	\\?\UNC\server\share\directory\file.txt
+ *
+ * Scenario's that are not considered full paths:
+ * Local 'absolute' path:	\directory\file.txt
+ *                       	\directory\\file.txt
+ * Local 'relative' path:	..\directory\file.txt
+ * Local 'relative' path:	.\directory\file.txt
+ * Volume 'absolute' path:	C:\directory\file.txt
+ *                              C:\..\directory\file.txt
+ * Volume 'relative' path:	C:directory\file.txt
+ * UNC path:			\\server\share\directory\file.txt
+ *
+ * TODO handle:
+ * Volume device path:		\\.\C:
+ * Volume file system path:	\\.\C:\
+ *
+ * Returns 1 if succesful or -1 on error
+ */
+int libcpath_path_get_full_path(
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	libcsplit_narrow_split_string_t *current_directory_split_string = NULL;
+	libcsplit_narrow_split_string_t *path_split_string              = NULL;
+	char *current_directory                                         = NULL;
+	char *current_directory_string_segment                          = NULL;
+	char *full_path_prefix                                          = NULL;
+	char *last_used_path_string_segment                             = NULL;
+	char *path_string_segment                                       = NULL;
+	char *volume_name                                               = NULL;
+	int *path_segment_stack                                         = NULL;
+	static char *function                                           = "libcpath_path_get_full_path";
+	size_t current_directory_length                                 = 0;
+	size_t current_directory_name_index                             = 0;
+	size_t current_directory_size                                   = 0;
+	size_t current_directory_string_segment_size                    = 0;
+	size_t full_path_index                                          = 0;
+	size_t full_path_prefix_length                                  = 0;
+	size_t last_used_path_string_segment_size                       = 0;
+	size_t path_directory_name_index                                = 0;
+	size_t path_string_segment_size                                 = 0;
+	size_t safe_full_path_size                                      = 0;
+	size_t volume_name_length                                       = 0;
+	uint8_t path_type                                               = LIBCPATH_TYPE_RELATIVE;
+	int current_directory_number_of_segments                        = 0;
+	int current_directory_segment_index                             = 0;
+	int last_used_path_segment_index                                = 0;
+	int path_number_of_segments                                     = 0;
+	int path_segment_index                                          = 0;
+	int path_segment_stack_depth                                    = 0;
+
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     *full_path,
-	     0,
-	     sizeof( char ) * safe_full_path_size ) == NULL )
+	if( path_length == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	*full_path_size = safe_full_path_size;
-
-	if( path_type == LIBCPATH_TYPE_ABSOLUTE )
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
-		( *full_path )[ full_path_index ] = '/';
-
-		full_path_index += 1;
-	}
-	/* If the path is relative
-	 * add the current working directory elements
-	 */
-	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
-	 && ( current_directory_split_string != NULL ) )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path == NULL )
 	{
-		for( current_directory_segment_index = 0;
-		     current_directory_segment_index < current_directory_number_of_segments;
-		     current_directory_segment_index++ )
-		{
-			if( libcsplit_narrow_split_string_get_segment_by_index(
-			     current_directory_split_string,
-			     current_directory_segment_index,
-			     &current_directory_string_segment,
-			     &current_directory_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve current working directory string segment: %d.",
-				 function,
-				 current_directory_segment_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
 
-				goto on_error;
-			}
-			if( current_directory_string_segment_size != 0 )
-			{
-				if( current_directory_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
+		return( -1 );
+	}
+	if( *full_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path value already set.",
+		 function );
 
-					goto on_error;
-				}
-				if( narrow_string_copy(
-				     &( ( *full_path )[ full_path_index ] ),
-				     current_directory_string_segment,
-				     current_directory_string_segment_size - 1 ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set current working directory split value: %d in full path.",
-					 function,
-					 current_directory_segment_index );
+		return( -1 );
+	}
+	if( full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path size.",
+		 function );
 
-					goto on_error;
-				}
-				full_path_index += current_directory_string_segment_size - 1;
+		return( -1 );
+	}
+	if( libcpath_path_get_path_type(
+	     path,
+	     path_length,
+	     &path_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path type.",
+		 function );
 
-				( *full_path )[ full_path_index ] = '/';
+		goto on_error;
+	}
+	if( libcpath_path_get_volume_name(
+	     path,
+	     path_length,
+	     &volume_name,
+	     &volume_name_length,
+	     &path_directory_name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine volume name.",
+		 function );
 
-				full_path_index += 1;
-			}
-		}
+		goto on_error;
 	}
-	for( path_segment_index = 0;
-	     path_segment_index < path_number_of_segments;
-	     path_segment_index++ )
+	/* If the path is a device path, an extended-length path or an UNC
+	 * do not bother to lookup the current working directory
+	 */
+	if( ( path_type != LIBCPATH_TYPE_DEVICE )
+	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH )
+	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
+	 && ( path_type != LIBCPATH_TYPE_UNC ) )
 	{
-		if( libcsplit_narrow_split_string_get_segment_by_index(
-		     path_split_string,
-		     path_segment_index,
-		     &path_string_segment,
-		     &path_string_segment_size,
+		if( libcpath_path_get_current_working_directory_by_volume(
+		     volume_name,
+		     volume_name_length,
+		     &current_directory,
+		     &current_directory_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve path string segment: %d.",
-			 function,
-			 path_segment_index );
+			 "%s: unable to retrieve current working directory by volume.",
+			 function );
 
 			goto on_error;
 		}
-		if( path_string_segment_size != 0 )
+		/* Determine the volume name using the current working directory if necessary
+		 */
+		if( libcpath_path_get_volume_name(
+		     current_directory,
+		     current_directory_size - 1,
+		     &volume_name,
+		     &volume_name_length,
+		     &current_directory_name_index,
+		     error ) != 1 )
 		{
-			if( path_string_segment == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing path string segment: %d.",
-				 function,
-				 path_segment_index );
-
-				goto on_error;
-			}
-			if( narrow_string_copy(
-			     &( ( *full_path )[ full_path_index ] ),
-			     path_string_segment,
-			     path_string_segment_size - 1 ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path split value: %d in full path.",
-				 function,
-				 path_segment_index );
-
-				goto on_error;
-			}
-			full_path_index += path_string_segment_size - 1;
-
-			( *full_path )[ full_path_index ] = '/';
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine volume name from current working directory.",
+			 function );
 
-			full_path_index += 1;
+			goto on_error;
 		}
 	}
-	( *full_path )[ full_path_index - 1 ] = 0;
-
-	if( libcsplit_narrow_split_string_free(
-	     &path_split_string,
-	     error ) != 1 )
+	if( ( current_directory != NULL )
+	 && ( current_directory_name_index < current_directory_size ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free path split string.",
-		 function );
+		current_directory_length = narrow_string_length(
+		                            &( current_directory[ current_directory_name_index ] ) );
 
-		goto on_error;
-	}
-	if( current_directory_split_string != NULL )
-	{
-		if( libcsplit_narrow_split_string_free(
+		if( libcsplit_narrow_string_split(
+		     &( current_directory[ current_directory_name_index ] ),
+		     current_directory_length + 1,
+		     '\\',
 		     &current_directory_split_string,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free current working directory split string.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to split current working directory.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	if( current_directory != NULL )
+	if( libcsplit_narrow_string_split(
+	     &( path[ path_directory_name_index ] ),
+	     path_length - path_directory_name_index + 1,
+	     '\\',
+	     &path_split_string,
+	     error ) != 1 )
 	{
-		memory_free(
-		 current_directory );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split path.",
+		 function );
+
+		goto on_error;
 	}
-	return( 1 );
+	/* The size of the full path consists of:
+	 * the size of the prefix (\\?\ or \\.\)
+	 */
+	safe_full_path_size = 4;
 
-on_error:
-	if( *full_path != NULL )
+	/* If the path contains a volume name
+	 * the length of the volume name
+	 * a directory separator
+	 */
+	if( volume_name != NULL )
 	{
-		memory_free(
-		 *full_path );
-
-		*full_path = NULL;
+		safe_full_path_size += volume_name_length + 1;
 	}
-	*full_path_size = 0;
-
-	if( path_split_string != NULL )
-	{
-		libcsplit_narrow_split_string_free(
-		 &path_split_string,
-		 NULL );
-	}
-	if( current_directory_split_string != NULL )
-	{
-		libcsplit_narrow_split_string_free(
-		 &current_directory_split_string,
-		 NULL );
-	}
-	if( current_directory != NULL )
-	{
-		memory_free(
-		 current_directory );
-	}
-	return( -1 );
-}
-
-#endif /* defined( WINAPI ) */
-
-/* Retrieves the size of a sanitized version of the path character
- * Returns 1 if successful or -1 on error
- */
-int libcpath_path_get_sanitized_character_size(
-     char character,
-     size_t *sanitized_character_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libcpath_path_get_sanitized_character_size";
-
-	if( sanitized_character_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized character size.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( character >= 0x00 )
-	 && ( character <= 0x1f ) )
-	{
-		*sanitized_character_size = 4;
-	}
-	else if( character == LIBCPATH_ESCAPE_CHARACTER )
-	{
-		*sanitized_character_size = 2;
-	}
-#if defined( WINAPI )
-	else if( character == '/' )
-	{
-		*sanitized_character_size = 4;
-	}
-#endif
-	else if( ( character == '!' )
-	      || ( character == '$' )
-	      || ( character == '%' )
-	      || ( character == '&' )
-	      || ( character == '*' )
-	      || ( character == '+' )
-	      || ( character == ':' )
-	      || ( character == ';' )
-	      || ( character == '<' )
-	      || ( character == '>' )
-	      || ( character == '?' )
-	      || ( character == '|' )
-	      || ( character == 0x7f ) )
-	{
-		*sanitized_character_size = 4;
-	}
-	else
-	{
-		*sanitized_character_size = 1;
-	}
-	return( 1 );
-}
-
-/* Retrieves a sanitized version of the path character
- * Returns 1 if successful or -1 on error
- */
-int libcpath_path_get_sanitized_character(
-     char character,
-     size_t sanitized_character_size,
-     char *sanitized_path,
-     size_t sanitized_path_size,
-     size_t *sanitized_path_index,
-     libcerror_error_t **error )
-{
-	static char *function            = "libcpath_path_get_sanitized_character";
-	size_t safe_sanitized_path_index = 0;
-	char lower_nibble                = 0;
-	char upper_nibble                = 0;
-
-	if( ( sanitized_character_size != 1 )
-	 && ( sanitized_character_size != 2 )
-	 && ( sanitized_character_size != 4 ) )
+	/* If the path contains an UNC path
+	 * add the size of the UNC\ prefix
+	 */
+	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
+	 || ( path_type == LIBCPATH_TYPE_UNC ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sanitized character size value out of bounds.",
-		 function );
-
-		return( -1 );
+		safe_full_path_size += 4;
 	}
-	if( sanitized_path == NULL )
+	/* If the path is relative
+	 * add the size of the current working directory
+	 * a directory separator, if necessary
+	 */
+	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
+	 && ( current_directory_name_index < current_directory_size ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path.",
-		 function );
+		safe_full_path_size += ( current_directory_size - ( current_directory_name_index + 1 ) );
 
-		return( -1 );
+		if( ( current_directory_size >= 2 )
+		 && ( current_directory[ current_directory_size - 2 ] != '\\' ) )
+		{
+			safe_full_path_size += 1;
+		}
 	}
-	if( sanitized_path_size > (size_t) SSIZE_MAX )
+	if( current_directory_split_string != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sanitized path size value exceeds maximum.",
-		 function );
+		if( libcsplit_narrow_split_string_get_number_of_segments(
+		     current_directory_split_string,
+		     &current_directory_number_of_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of current working directory string segments.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
+		current_directory_segment_index = current_directory_number_of_segments - 1;
 	}
-	if( sanitized_path_index == NULL )
+	if( libcsplit_narrow_split_string_get_number_of_segments(
+	     path_split_string,
+	     &path_number_of_segments,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path index.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of path string segments.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	safe_sanitized_path_index = *sanitized_path_index;
-
-	if( safe_sanitized_path_index > sanitized_path_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sanitized path index value out of bounds.",
-		 function );
+	/* The indexes of the kept path segments are maintained on a stack
+	 * so that a parent directory (..) segment removes the last kept
+	 * segment in constant time, which bounds the cost by the number
+	 * of segments in the path
+	 */
+	path_segment_stack = (int *) libcpath_allocator_allocate(
+	                              sizeof( int ) * path_number_of_segments );
 
-		return( -1 );
-	}
-	if( ( sanitized_character_size > sanitized_path_size )
-	 || ( safe_sanitized_path_index > ( sanitized_path_size - sanitized_character_size ) ) )
+	if( path_segment_stack == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid sanitized path size value too small.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path segment stack.",
 		 function );
 
-		return( -1 );
-	}
-	if( sanitized_character_size == 1 )
-	{
-		sanitized_path[ safe_sanitized_path_index++ ] = character;
-	}
-	else if( sanitized_character_size == 2 )
-	{
-		sanitized_path[ safe_sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
-		sanitized_path[ safe_sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+		goto on_error;
 	}
-	else if( sanitized_character_size == 4 )
+	for( path_segment_index = 0;
+	     path_segment_index < path_number_of_segments;
+	     path_segment_index++ )
 	{
-		lower_nibble = character & 0x0f;
-		upper_nibble = ( character >> 4 ) & 0x0f;
-
-		if( lower_nibble > 10 )
-		{
-			lower_nibble += 'a' - 10;
-		}
-		else
+		if( libcsplit_narrow_split_string_get_segment_by_index(
+		     path_split_string,
+		     path_segment_index,
+		     &path_string_segment,
+		     &path_string_segment_size,
+		     error ) != 1 )
 		{
-			lower_nibble += '0';
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path string segment: %d.",
+			 function,
+			 path_segment_index );
+
+			goto on_error;
 		}
-		if( upper_nibble > 10 )
+		if( path_string_segment == NULL )
 		{
-			upper_nibble += 'a' - 10;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing path string segment: %d.",
+			 function,
+			 path_segment_index );
+
+			goto on_error;
 		}
-		else
+		/* If the path is .. reverse the current path by one directory
+		 */
+		if( ( path_string_segment_size == 3 )
+		 && ( path_string_segment[ 0 ] == '.' )
+		 && ( path_string_segment[ 1 ] == '.' ) )
 		{
-			upper_nibble += '0';
-		}
-		sanitized_path[ safe_sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
-		sanitized_path[ safe_sanitized_path_index++ ] = 'x';
-		sanitized_path[ safe_sanitized_path_index++ ] = upper_nibble;
-		sanitized_path[ safe_sanitized_path_index++ ] = lower_nibble;
-	}
-	*sanitized_path_index = safe_sanitized_path_index;
-
-	return( 1 );
-}
+			if( path_segment_stack_depth > 0 )
+			{
+				path_segment_stack_depth--;
 
-/* Retrieves a sanitized version of the filename
- * Returns 1 if successful or -1 on error
- */
-int libcpath_path_get_sanitized_filename(
-     const char *filename,
-     size_t filename_length,
-     char **sanitized_filename,
-     size_t *sanitized_filename_size,
-     libcerror_error_t **error )
-{
-	static char *function               = "libcpath_path_get_sanitized_filename";
-	char *safe_sanitized_filename       = NULL;
-	size_t filename_index               = 0;
-	size_t sanitized_character_size     = 0;
-	size_t safe_sanitized_filename_size = 0;
-	size_t sanitized_filename_index     = 0;
+				last_used_path_segment_index = path_segment_stack[ path_segment_stack_depth ];
 
-	if( filename == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
-		 function );
+				if( libcsplit_narrow_split_string_get_segment_by_index(
+				     path_split_string,
+				     last_used_path_segment_index,
+				     &last_used_path_string_segment,
+				     &last_used_path_string_segment_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve last used path string segment: %d.",
+					 function,
+					 last_used_path_segment_index );
 
-		return( -1 );
+					goto on_error;
+				}
+				if( last_used_path_string_segment == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing last used path string string segment: %d.",
+					 function,
+					 last_used_path_segment_index );
+
+					goto on_error;
+				}
+				/* Remove the size of the parent directory name and a directory separator
+				 * Note that the size includes the end of string character
+				 */
+				safe_full_path_size -= last_used_path_string_segment_size;
+
+				if( libcsplit_narrow_split_string_set_segment_by_index(
+				     path_split_string,
+				     last_used_path_segment_index,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set path string segment: %d.",
+					 function,
+					 last_used_path_segment_index );
+
+					goto on_error;
+				}
+			}
+			else if( ( path_type == LIBCPATH_TYPE_RELATIVE )
+			      && ( current_directory_split_string != NULL )
+			      && ( current_directory_segment_index >= 0 ) )
+			{
+				if( libcsplit_narrow_split_string_get_segment_by_index(
+				     current_directory_split_string,
+				     current_directory_segment_index,
+				     &current_directory_string_segment,
+				     &current_directory_string_segment_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve current working directory string segment: %d.",
+					 function,
+					 current_directory_segment_index );
+
+					goto on_error;
+				}
+				if( current_directory_string_segment == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing current working directory string segment: %d.",
+					 function,
+					 current_directory_segment_index );
+
+					goto on_error;
+				}
+				/* Remove the size of the parent directory name and a directory separator
+				 * Note that the size includes the end of string character
+				 */
+				safe_full_path_size -= current_directory_string_segment_size;
+
+				if( libcsplit_narrow_split_string_set_segment_by_index(
+				     current_directory_split_string,
+				     current_directory_segment_index,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set current working directory string segment: %d.",
+					 function,
+					 current_directory_segment_index );
+
+					goto on_error;
+				}
+				current_directory_segment_index--;
+			}
+			if( libcsplit_narrow_split_string_set_segment_by_index(
+			     path_split_string,
+			     path_segment_index,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set path string segment: %d.",
+				 function,
+				 path_segment_index );
+
+				goto on_error;
+			}
+		}
+		/* If the path is . ignore the entry
+		 */
+		else if( ( path_string_segment_size == 2 )
+		      && ( path_string_segment[ 0 ] == '.' ) )
+		{
+			if( libcsplit_narrow_split_string_set_segment_by_index(
+			     path_split_string,
+			     path_segment_index,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set path string segment: %d.",
+				 function,
+				 path_segment_index );
+
+				goto on_error;
+			}
+		}
+		/* If the path is empty ignore the entry
+		 */
+		else if( path_string_segment_size <= 1 )
+		{
+			if( libcsplit_narrow_split_string_set_segment_by_index(
+			     path_split_string,
+			     path_segment_index,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set path string segment: %d.",
+				 function,
+				 path_segment_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			/* Add the size of the directory or file name and a directory separator
+			 * Note that the size includes the end of string character
+			 */
+			safe_full_path_size += path_string_segment_size;
+
+			path_segment_stack[ path_segment_stack_depth ] = path_segment_index;
+
+			path_segment_stack_depth++;
+		}
 	}
-	if( filename_length == 0 )
+	/* Note that the last path separator serves as the end of string
+	 */
+	full_path_index = 0;
+
+	*full_path = libcpath_allocator_allocate_narrow_string(
+	              safe_full_path_size );
+
+	if( *full_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid filename length is zero.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( filename_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( memory_set(
+	     *full_path,
+	     0,
+	     sizeof( char ) * safe_full_path_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid filename length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear full path.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( sanitized_filename == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized filename.",
-		 function );
+	*full_path_size = safe_full_path_size;
 
-		return( -1 );
+	if( path_type == LIBCPATH_TYPE_DEVICE )
+	{
+		full_path_prefix        = "\\\\.\\";
+		full_path_prefix_length = 4;
 	}
-	if( *sanitized_filename != NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sanitized filename value already set.",
-		 function );
-
-		return( -1 );
+		full_path_prefix        = "\\\\?\\";
+		full_path_prefix_length = 4;
 	}
-	if( sanitized_filename_size == NULL )
+	if( narrow_string_copy(
+	     &( ( *full_path )[ full_path_index ] ),
+	     full_path_prefix,
+	     full_path_prefix_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized filename size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set prefix in full path.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	safe_sanitized_filename_size = 1;
+	full_path_index += full_path_prefix_length;
 
-	for( filename_index = 0;
-	     filename_index < filename_length;
-	     filename_index++ )
+	/* If there is a share name the path is an UNC path
+	 */
+	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
+	 || ( path_type == LIBCPATH_TYPE_UNC ) )
 	{
-		if( filename[ filename_index ] == LIBCPATH_SEPARATOR )
-		{
-			sanitized_character_size = 4;
-		}
-		else if( libcpath_path_get_sanitized_character_size(
-		          filename[ filename_index ],
-		          &sanitized_character_size,
-		          error ) != 1 )
+		if( narrow_string_copy(
+		     &( ( *full_path )[ full_path_index ] ),
+		     "UNC\\",
+		     4 ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set UNC\\ prefix in full path.",
 			 function );
 
 			goto on_error;
 		}
-		safe_sanitized_filename_size += sanitized_character_size;
+		full_path_index += 4;
 	}
-	if( safe_sanitized_filename_size > (size_t) SSIZE_MAX )
+	if( volume_name != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sanitized filename size value exceeds maximum.",
-		 function );
+		if( narrow_string_copy(
+		     &( ( *full_path )[ full_path_index ] ),
+		     volume_name,
+		     volume_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set volume name in full path.",
+			 function );
 
-		goto on_error;
-	}
-	safe_sanitized_filename = narrow_string_allocate(
-	                           safe_sanitized_filename_size );
+			goto on_error;
+		}
+		full_path_index += volume_name_length;
 
-	if( safe_sanitized_filename == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create sanitized filename.",
-		 function );
+		( *full_path )[ full_path_index ] = '\\';
 
-		goto on_error;
+		full_path_index += 1;
 	}
-	for( filename_index = 0;
-	     filename_index < filename_length;
-	     filename_index++ )
+	/* If the path is relative
+	 * add the current working directory elements
+	 */
+	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
+	 && ( current_directory_split_string != NULL ) )
 	{
-		if( filename[ filename_index ] == LIBCPATH_SEPARATOR )
+		for( current_directory_segment_index = 0;
+		     current_directory_segment_index < current_directory_number_of_segments;
+		     current_directory_segment_index++ )
 		{
-			sanitized_character_size = 4;
+			if( libcsplit_narrow_split_string_get_segment_by_index(
+			     current_directory_split_string,
+			     current_directory_segment_index,
+			     &current_directory_string_segment,
+			     &current_directory_string_segment_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current working directory string segment: %d.",
+				 function,
+				 current_directory_segment_index );
+
+				goto on_error;
+			}
+			if( current_directory_string_segment_size != 0 )
+			{
+				if( current_directory_string_segment == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing current working directory string segment: %d.",
+					 function,
+					 current_directory_segment_index );
+
+					goto on_error;
+				}
+				if( narrow_string_copy(
+				     &( ( *full_path )[ full_path_index ] ),
+				     current_directory_string_segment,
+				     current_directory_string_segment_size - 1 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set current working directory split value: %d in full path.",
+					 function,
+					 current_directory_segment_index );
+
+					goto on_error;
+				}
+				full_path_index += current_directory_string_segment_size - 1;
+
+				( *full_path )[ full_path_index ] = '\\';
+
+				full_path_index += 1;
+			}
 		}
-		else if( libcpath_path_get_sanitized_character_size(
-		          filename[ filename_index ],
-		          &sanitized_character_size,
-		          error ) != 1 )
+	}
+	for( path_segment_index = 0;
+	     path_segment_index < path_number_of_segments;
+	     path_segment_index++ )
+	{
+		if( libcsplit_narrow_split_string_get_segment_by_index(
+		     path_split_string,
+		     path_segment_index,
+		     &path_string_segment,
+		     &path_string_segment_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
+			 "%s: unable to retrieve path string segment: %d.",
+			 function,
+			 path_segment_index );
 
 			goto on_error;
 		}
-		if( libcpath_path_get_sanitized_character(
-		     filename[ filename_index ],
-		     sanitized_character_size,
-		     safe_sanitized_filename,
-		     safe_sanitized_filename_size,
-		     &sanitized_filename_index,
+		if( path_string_segment_size != 0 )
+		{
+			if( path_string_segment == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing path string segment: %d.",
+				 function,
+				 path_segment_index );
+
+				goto on_error;
+			}
+			if( narrow_string_copy(
+			     &( ( *full_path )[ full_path_index ] ),
+			     path_string_segment,
+			     path_string_segment_size - 1 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set path split value: %d in full path.",
+				 function,
+				 path_segment_index );
+
+				goto on_error;
+			}
+			full_path_index += path_string_segment_size - 1;
+
+			( *full_path )[ full_path_index ] = '\\';
+
+			full_path_index += 1;
+		}
+	}
+	( *full_path )[ full_path_index - 1 ] = 0;
+
+	libcpath_allocator_free(
+	 path_segment_stack );
+
+	path_segment_stack = NULL;
+
+	if( libcsplit_narrow_split_string_free(
+	     &path_split_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free path split string.",
+		 function );
+
+		goto on_error;
+	}
+	if( current_directory_split_string != NULL )
+	{
+		if( libcsplit_narrow_split_string_free(
+		     &current_directory_split_string,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free current working directory split string.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	safe_sanitized_filename[ sanitized_filename_index ] = 0;
-
-	*sanitized_filename      = safe_sanitized_filename;
-	*sanitized_filename_size = safe_sanitized_filename_size;
-
+	if( current_directory != NULL )
+	{
+		libcpath_allocator_free(
+		 current_directory );
+	}
 	return( 1 );
 
 on_error:
-	if( safe_sanitized_filename != NULL )
+	if( *full_path != NULL )
 	{
-		memory_free(
-		 safe_sanitized_filename );
+		libcpath_allocator_free(
+		 *full_path );
+
+		*full_path = NULL;
+	}
+	*full_path_size = 0;
+
+	if( path_segment_stack != NULL )
+	{
+		libcpath_allocator_free(
+		 path_segment_stack );
+	}
+	if( path_split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &path_split_string,
+		 NULL );
+	}
+	if( current_directory_split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &current_directory_split_string,
+		 NULL );
+	}
+	if( current_directory != NULL )
+	{
+		libcpath_allocator_free(
+		 current_directory );
 	}
 	return( -1 );
 }
 
-/* Retrieves a sanitized version of the path
- * Returns 1 if successful or -1 on error
+#else
+
+/* Determines the full path of the POSIX path specified
+ * Multiple successive / are combined into one
+ *
+ * Scenarios:
+ * /home/user/file.txt
+ * /home/user//file.txt
+ * /home/user/../user/file.txt
+ * /../home/user/file.txt
+ * user/../user/file.txt
+ *
+ * The path is normalized in a single backwards pass, without splitting it
+ * into segments, and the full path is allocated with its exact size
+ * Relative paths are resolved against the working directory or, when NULL,
+ * the current working directory of the process
+ * Returns 1 if succesful or -1 on error
  */
-int libcpath_path_get_sanitized_path(
+int libcpath_path_get_full_path_with_working_directory(
+     const char *working_directory,
+     size_t working_directory_length,
      const char *path,
      size_t path_length,
-     char **sanitized_path,
-     size_t *sanitized_path_size,
+     char **full_path,
+     size_t *full_path_size,
      libcerror_error_t **error )
 {
-	static char *function                    = "libcpath_path_get_sanitized_path";
-	char *safe_sanitized_path                = NULL;
-	size_t path_index                        = 0;
-	size_t safe_sanitized_path_size          = 0;
-	size_t sanitized_character_size          = 0;
-	size_t sanitized_path_index              = 0;
-
-#if defined( WINAPI )
-	size_t last_path_segment_seperator_index = 0;
+	const char *base_path           = NULL;
+	char *current_directory         = NULL;
+	static char *function           = "libcpath_path_get_full_path_with_working_directory";
+	size_t current_directory_length = 0;
+	size_t current_directory_size   = 0;
+	size_t safe_full_path_size      = 0;
+
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+	int result                      = 0;
 #endif
 
 	if( path == NULL )
@@ -3052,1258 +3161,1665 @@ int libcpath_path_get_sanitized_path(
 
 		return( -1 );
 	}
-	if( sanitized_path == NULL )
+	if( full_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path.",
+		 "%s: invalid full path.",
 		 function );
 
 		return( -1 );
 	}
-	if( *sanitized_path != NULL )
+	if( *full_path != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sanitized path value already set.",
+		 "%s: invalid full path value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_path_size == NULL )
+	if( full_path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path size.",
+		 "%s: invalid full path size.",
 		 function );
 
 		return( -1 );
 	}
-	safe_sanitized_path_size = 1;
-
-	for( path_index = 0;
-	     path_index < path_length;
-	     path_index++ )
+	if( ( path[ 0 ] != '/' )
+	 && ( working_directory != NULL ) )
 	{
-		if( libcpath_path_get_sanitized_character_size(
-		     path[ path_index ],
-		     &sanitized_character_size,
-		     error ) != 1 )
+		base_path                = working_directory;
+		current_directory_length = working_directory_length;
+	}
+	else if( path[ 0 ] != '/' )
+	{
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+		result = libcpath_path_get_cached_current_working_directory(
+		          &base_path,
+		          &current_directory_length,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
+			 "%s: unable to retrieve cached current working directory.",
 			 function );
 
 			goto on_error;
 		}
-		safe_sanitized_path_size += sanitized_character_size;
-
-#if defined( WINAPI )
-		if( path[ path_index ] == LIBCPATH_SEPARATOR )
+		else if( result == 0 )
+#endif
 		{
-			last_path_segment_seperator_index = path_index;
+			if( libcpath_path_get_current_working_directory(
+			     &current_directory,
+			     &current_directory_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current working directory.",
+				 function );
+
+				goto on_error;
+			}
+			/* The current working directory size includes the end of string character
+			 */
+			current_directory_length = current_directory_size - 1;
+
+			base_path = current_directory;
 		}
-#endif
 	}
-	if( safe_sanitized_path_size > (size_t) SSIZE_MAX )
+	if( libcpath_path_normalize_with_base(
+	     base_path,
+	     current_directory_length,
+	     path,
+	     path_length,
+	     NULL,
+	     0,
+	     &safe_full_path_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sanitized path size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path size.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( WINAPI )
-	if( last_path_segment_seperator_index > 32767 )
+	*full_path = libcpath_allocator_allocate_narrow_string(
+	              safe_full_path_size );
+
+	if( *full_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: last path segment separator value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path.",
 		 function );
 
 		goto on_error;
 	}
-	if( safe_sanitized_path_size > 32767 )
-	{
-		safe_sanitized_path_size = 32767;
-	}
-#endif
-	safe_sanitized_path = narrow_string_allocate(
-	                       safe_sanitized_path_size );
-
-	if( safe_sanitized_path == NULL )
+	if( libcpath_path_normalize_with_base(
+	     base_path,
+	     current_directory_length,
+	     path,
+	     path_length,
+	     *full_path,
+	     safe_full_path_size,
+	     &safe_full_path_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create sanitized path.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set full path.",
 		 function );
 
 		goto on_error;
 	}
-	for( path_index = 0;
-	     path_index < path_length;
-	     path_index++ )
-	{
-		if( libcpath_path_get_sanitized_character_size(
-		     path[ path_index ],
-		     &sanitized_character_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcpath_path_get_sanitized_character(
-		     path[ path_index ],
-		     sanitized_character_size,
-		     safe_sanitized_path,
-		     safe_sanitized_path_size,
-		     &sanitized_path_index,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
+	*full_path_size = safe_full_path_size;
 
-			goto on_error;
-		}
+	if( current_directory != NULL )
+	{
+		libcpath_allocator_free(
+		 current_directory );
 	}
-	safe_sanitized_path[ sanitized_path_index ] = 0;
-
-	*sanitized_path      = safe_sanitized_path;
-	*sanitized_path_size = safe_sanitized_path_size;
-
 	return( 1 );
 
 on_error:
-	if( safe_sanitized_path != NULL )
+	if( *full_path != NULL )
 	{
-		memory_free(
-		 safe_sanitized_path );
+		libcpath_allocator_free(
+		 *full_path );
+
+		*full_path = NULL;
+	}
+	*full_path_size = 0;
+
+	if( current_directory != NULL )
+	{
+		libcpath_allocator_free(
+		 current_directory );
 	}
 	return( -1 );
 }
 
-/* Combines the directory name and filename into a path
- * Returns 1 if successful or -1 on error
+/* Determines the full path of the POSIX path specified
+ * Relative paths are resolved against the current working directory of the process
+ * Returns 1 if succesful or -1 on error
  */
-int libcpath_path_join(
-     char **path,
-     size_t *path_size,
-     const char *directory_name,
-     size_t directory_name_length,
-     const char *filename,
-     size_t filename_length,
+int libcpath_path_get_full_path(
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_join";
-	size_t filename_index = 0;
-	size_t path_index     = 0;
+	return( libcpath_path_get_full_path_with_working_directory(
+	         NULL,
+	         0,
+	         path,
+	         path_length,
+	         full_path,
+	         full_path_size,
+	         error ) );
+}
 
-	if( path == NULL )
+#endif /* defined( WINAPI ) */
+
+/* Determines the full path of the path specified using a context
+ * Relative paths are resolved against the working directory of the context,
+ * hence contexts can be used concurrently by different threads
+ * Returns 1 if succesful or -1 on error
+ */
+int libcpath_path_get_full_path_context(
+     libcpath_context_t *context,
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libcpath_path_get_full_path_context";
+
+#if !defined( WINAPI )
+	const char *working_directory   = NULL;
+	size_t working_directory_length = 0;
+#endif
+
+	if( context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 "%s: invalid context.",
 		 function );
 
 		return( -1 );
 	}
-	if( *path != NULL )
+#if defined( WINAPI )
+	/* The Windows API has no working directory that is not process wide
+	 */
+	return( libcpath_path_get_full_path(
+	         path,
+	         path_length,
+	         full_path,
+	         full_path_size,
+	         error ) );
+#else
+	if( libcpath_context_get_working_directory(
+	     context,
+	     &working_directory,
+	     &working_directory_length,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid path value already set.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve working directory from context.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path size.",
-		 function );
+	return( libcpath_path_get_full_path_with_working_directory(
+	         working_directory,
+	         working_directory_length,
+	         path,
+	         path_length,
+	         full_path,
+	         full_path_size,
+	         error ) );
+#endif
+}
 
-		return( -1 );
-	}
-	if( directory_name == NULL )
+#if defined( WINAPI )
+
+/* Determines the full path of the Windows path specified into a buffer
+ * The full path is determined by libcpath_path_get_full_path and copied
+ * into the buffer, hence this function does not prevent memory allocations
+ * Returns 1 if successful, 0 if the full path size is too small or -1 on error
+ */
+int libcpath_path_get_full_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error )
+{
+	char *safe_full_path       = NULL;
+	static char *function      = "libcpath_path_get_full_path_to_buffer";
+	size_t safe_full_path_size = 0;
+	int result                 = 0;
+
+	if( ( full_path == NULL )
+	 && ( full_path_size != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name.",
+		 "%s: invalid full path.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_name_length > (size_t) SSIZE_MAX )
+	if( full_path_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid directory name length value exceeds maximum.",
+		 "%s: invalid full path size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( filename == NULL )
+	if( required_full_path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid required full path size.",
 		 function );
 
 		return( -1 );
 	}
-	if( filename_length > (size_t) SSIZE_MAX )
+	if( libcpath_path_get_full_path(
+	     path,
+	     path_length,
+	     &safe_full_path,
+	     &safe_full_path_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid filename length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO strip other patterns like /./ */
-	while( directory_name_length > 0 )
-	{
-		if( directory_name[ directory_name_length - 1 ] != (char) LIBCPATH_SEPARATOR )
-		{
-			break;
-		}
-		directory_name_length--;
-	}
-	while( filename_length > 0 )
+	*required_full_path_size = safe_full_path_size;
+
+	if( safe_full_path_size <= full_path_size )
 	{
-		if( filename[ filename_index ] != (char) LIBCPATH_SEPARATOR )
+		if( narrow_string_copy(
+		     full_path,
+		     safe_full_path,
+		     safe_full_path_size ) == NULL )
 		{
-			break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy full path.",
+			 function );
+
+			libcpath_allocator_free(
+			 safe_full_path );
+
+			return( -1 );
 		}
-		filename_index++;
-		filename_length--;
+		result = 1;
 	}
-	*path_size = directory_name_length + filename_length + 2;
+	libcpath_allocator_free(
+	 safe_full_path );
+
+	return( result );
+}
 
-	*path = narrow_string_allocate(
-	         *path_size );
+#else
 
-	if( *path == NULL )
+/* Determines the full path of the POSIX path specified into a buffer
+ * The current working directory is retrieved into a buffer on the stack,
+ * hence this function does not allocate memory unless the current working
+ * directory does not fit in that buffer
+ * Relative paths are resolved against the working directory or, when NULL,
+ * the current working directory of the process
+ * Returns 1 if successful, 0 if the full path size is too small or -1 on error
+ */
+int libcpath_path_get_full_path_to_buffer_with_working_directory(
+     const char *working_directory,
+     size_t working_directory_length,
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error )
+{
+	char current_directory_buffer[ LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE ];
+
+	const char *base_path           = NULL;
+	char *current_directory         = NULL;
+	static char *function           = "libcpath_path_get_full_path_to_buffer_with_working_directory";
+	size_t current_directory_length = 0;
+	int result                      = 0;
+
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( narrow_string_copy(
-	     *path,
-	     directory_name,
-	     directory_name_length ) == NULL )
+	if( path_length == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy directory name to path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	path_index = directory_name_length;
-
-	( *path )[ path_index++ ] = (char) LIBCPATH_SEPARATOR;
-
-	if( narrow_string_copy(
-	     &( ( *path )[ path_index ] ),
-	     &( filename[ filename_index ] ),
-	     filename_length ) == NULL )
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy filename to path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	path_index += filename_length;
-
-	( *path )[ path_index ] = 0;
-
-	return( 1 );
+	if( ( full_path == NULL )
+	 && ( full_path_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
 
-on_error:
-	if( *path != NULL )
+		return( -1 );
+	}
+	if( full_path_size > (size_t) SSIZE_MAX )
 	{
-		memory_free(
-		 *path );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
+		 function );
 
-		*path = NULL;
+		return( -1 );
 	}
-	*path_size = 0;
+	if( required_full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required full path size.",
+		 function );
 
-	return( -1 );
-}
+		return( -1 );
+	}
+	if( ( path[ 0 ] != '/' )
+	 && ( working_directory != NULL ) )
+	{
+		base_path                = working_directory;
+		current_directory_length = working_directory_length;
+	}
+	else if( path[ 0 ] != '/' )
+	{
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+		result = libcpath_path_get_cached_current_working_directory(
+		          &base_path,
+		          &current_directory_length,
+		          error );
 
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached current working directory.",
+			 function );
 
-/* Cross Windows safe version of CreateDirectoryA
- * Returns TRUE if successful or FALSE on error
- */
-BOOL libcpath_CreateDirectoryA(
-      LPCSTR path,
-      SECURITY_ATTRIBUTES *security_attributes )
-{
-	FARPROC function       = NULL;
-	HMODULE library_handle = NULL;
-	BOOL result            = FALSE;
+			return( -1 );
+		}
+		else if( result == 0 )
+#endif
+		{
+			if( libcpath_path_getcwd(
+			     current_directory_buffer,
+			     LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE,
+			     &current_directory,
+			     &current_directory_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current working directory.",
+				 function );
 
-	if( path == NULL )
-	{
-		return( 0 );
+				return( -1 );
+			}
+			base_path = current_directory;
+		}
 	}
-	library_handle = LoadLibrary(
-	                  _SYSTEM_STRING( "kernel32.dll" ) );
+	result = libcpath_path_normalize_with_base(
+	          base_path,
+	          current_directory_length,
+	          path,
+	          path_length,
+	          ( full_path_size > 0 ) ? full_path : NULL,
+	          full_path_size,
+	          required_full_path_size,
+	          error );
 
-	if( library_handle == NULL )
+	if( ( current_directory != NULL )
+	 && ( current_directory != current_directory_buffer ) )
 	{
-		return( 0 );
+		libcpath_allocator_free(
+		 current_directory );
 	}
-	function = GetProcAddress(
-		    library_handle,
-		    (LPCSTR) "CreateDirectoryA" );
-
-	if( function != NULL )
+	if( result == -1 )
 	{
-		result = function(
-			  path,
-			  security_attributes );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path.",
+		 function );
+
+		return( -1 );
 	}
-	/* This call should be after using the function
-	 * in most cases kernel32.dll will still be available after free
-	 */
-	if( FreeLibrary(
-	     library_handle ) != TRUE )
+	else if( full_path_size == 0 )
 	{
-		libcpath_CloseHandle(
-		 library_handle );
-
 		return( 0 );
 	}
 	return( result );
 }
 
-#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+/* Determines the full path of the POSIX path specified into a buffer
+ * Relative paths are resolved against the current working directory of the process
+ * Returns 1 if successful, 0 if the full path size is too small or -1 on error
+ */
+int libcpath_path_get_full_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_get_full_path_to_buffer_with_working_directory(
+	         NULL,
+	         0,
+	         path,
+	         path_length,
+	         full_path,
+	         full_path_size,
+	         required_full_path_size,
+	         error ) );
+}
 
-#if defined( WINAPI )
+#endif /* defined( WINAPI ) */
 
-/* Makes the directory
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns 1 if successful or -1 on error
+/* Determines the full path of the path specified into a buffer using a context
+ * Relative paths are resolved against the working directory of the context,
+ * hence contexts can be used concurrently by different threads
+ * Returns 1 if successful, 0 if the full path size is too small or -1 on error
  */
-int libcpath_path_make_directory(
-     const char *directory_name,
+int libcpath_path_get_full_path_to_buffer_context(
+     libcpath_context_t *context,
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_make_directory";
-	DWORD error_code      = 0;
+	static char *function           = "libcpath_path_get_full_path_to_buffer_context";
 
-#if defined( WINAPI ) && ( WINVER > 0x0500 )
-	size_t bytesNeeded            = 0;
-	wchar_t* directory_name_UTF16 = NULL;
-	int converted                 = 0;
-	int createdFolder             = 0;
+#if !defined( WINAPI )
+	const char *working_directory   = NULL;
+	size_t working_directory_length = 0;
 #endif
 
-	if( directory_name == NULL )
+	if( context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name.",
+		 "%s: invalid context.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
-	if( libcpath_CreateDirectoryA(
-	     directory_name,
-	     NULL ) == 0 )
+#if defined( WINAPI )
+	/* The Windows API has no working directory that is not process wide
+	 */
+	return( libcpath_path_get_full_path_to_buffer(
+	         path,
+	         path_length,
+	         full_path,
+	         full_path_size,
+	         required_full_path_size,
+	         error ) );
 #else
-	// Allocate buffer to store UTF-16
-	bytesNeeded = 2 * MultiByteToWideChar(
-		CP_UTF8,
-		0,
-	     directory_name,
-		-1,
-		NULL,
-		0);
-	if( bytesNeeded == 0 ) {
-		libcerror_error_set(
-			error,
-			LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			LIBCERROR_IO_ERROR_INVALID_RESOURCE,
-			"%s: invalid UTF-8 string: %" PRIs_SYSTEM ".",
-			function,
-			directory_name);
-		return(-1);
-	}
-	directory_name_UTF16 = malloc(bytesNeeded);
-	if (directory_name_UTF16 == NULL) {
-		libcerror_error_set(
-			error,
-			LIBCERROR_ERROR_DOMAIN_MEMORY,
-			LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			"%s: failed to allocate memory for: %" PRIs_SYSTEM ".",
-			function,
-			directory_name);
-		return(-1);
-	}
-
-	// Convert filename to UTF-16
-	// Calling MultiByteToWideChar with "-1" for arg #4 ensures that the value returned by MultiByteToWideChar
-	// includes the terminating character
-	converted = MultiByteToWideChar(
-		CP_UTF8,
-		0,
-		directory_name,
-		-1,
-		directory_name_UTF16,
-		bytesNeeded);
-	if (converted == 0) {
-		libcerror_error_set(
-			error,
-			LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			LIBCERROR_IO_ERROR_INVALID_RESOURCE,
-			"%s: invalid UTF-8 string: %" PRIs_SYSTEM ".",
-			function,
-			directory_name_UTF16);
-		free(directory_name_UTF16);
-		return(-1);
-	}
-
-	// Create the folder
-	createdFolder = CreateDirectoryW(
-		directory_name_UTF16,
-		NULL);
-
-	// Free buffer
-	free(directory_name_UTF16);
-
-	if (createdFolder == 0)
-#endif
+	if( libcpath_context_get_working_directory(
+	     context,
+	     &working_directory,
+	     &working_directory_length,
+	     error ) == -1 )
 	{
-		error_code = GetLastError();
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 error_code,
-		 "%s: unable to make directory.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve working directory from context.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	return( libcpath_path_get_full_path_to_buffer_with_working_directory(
+	         working_directory,
+	         working_directory_length,
+	         path,
+	         path_length,
+	         full_path,
+	         full_path_size,
+	         required_full_path_size,
+	         error ) );
+#endif
 }
 
-#elif defined( HAVE_MKDIR )
-
-/* Makes the directory
- * This function uses the POSIX mkdir function or equivalent
+/* Determines the full path of the path specified
+ * The full path is allocated from the arena and remains valid until the arena is reset or freed
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_make_directory(
-     const char *directory_name,
+int libcpath_path_get_full_path_arena(
+     libcpath_arena_t *arena,
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_make_directory";
+	void *data                 = NULL;
+	static char *function      = "libcpath_path_get_full_path_arena";
+	size_t data_size           = 0;
+	size_t safe_full_path_size = 0;
+	int result                 = 0;
 
-	if( directory_name == NULL )
+	if( full_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name.",
+		 "%s: invalid full path.",
 		 function );
 
 		return( -1 );
 	}
-	if( mkdir(
-	     directory_name,
-	     0755 ) != 0 )
+	if( full_path_size == NULL )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The full path is written into the data available in the arena
+	 * and only if it does not fit, data of the required size is allocated
+	 */
+	if( libcpath_arena_get_available_data(
+	     arena,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 errno,
-		 "%s: unable to make directory.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve available data from arena.",
 		 function );
 
 		return( -1 );
 	}
+	result = libcpath_path_get_full_path_to_buffer(
+	          path,
+	          path_length,
+	          (char *) data,
+	          data_size / sizeof( char ),
+	          &safe_full_path_size,
+	          error );
 
-	return( 1 );
-}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path.",
+		 function );
 
-#else
-#error Missing make directory function
-#endif
+		return( -1 );
+	}
+	/* If the full path did not fit, data of the required size is allocated
+	 * and the full path is determined again, since the current working directory
+	 * can be changed in the meantime the required size can grow, in which case
+	 * this is repeated with the new required size
+	 */
+	do
+	{
+		if( libcpath_arena_allocate(
+		     arena,
+		     sizeof( char ) * safe_full_path_size,
+		     &data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to allocate full path from arena.",
+			 function );
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
+			return( -1 );
+		}
+		if( result == 0 )
+		{
+			result = libcpath_path_get_full_path_to_buffer(
+			          path,
+			          path_length,
+			          (char *) data,
+			          safe_full_path_size,
+			          &safe_full_path_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine full path.",
+				 function );
 
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+				return( -1 );
+			}
+		}
+	}
+	while( result == 0 );
 
-/* Cross Windows safe version of SetCurrentDirectoryW
- * Returns TRUE if successful or FALSE on error
+	*full_path      = (char *) data;
+	*full_path_size = safe_full_path_size;
+
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Determines the full paths of the Windows paths specified
+ * The full path of every path is determined by libcpath_path_get_full_path
+ * and appended to the full paths, hence this function does not prevent
+ * memory allocations
+ *
+ * The full paths are stored consecutively, each terminated by an end of string
+ * character, and full_path_offsets contains the offset of every full path
+ * Returns 1 if successful or -1 on error
  */
-BOOL libcpath_SetCurrentDirectoryW(
-      LPCWSTR path )
+int libcpath_path_get_full_paths(
+     const char **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     char **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error )
 {
-	FARPROC function       = NULL;
-	HMODULE library_handle = NULL;
-	BOOL result            = FALSE;
+	char *full_path             = NULL;
+	char *reallocation          = NULL;
+	static char *function       = "libcpath_path_get_full_paths";
+	size_t full_path_size       = 0;
+	size_t safe_full_paths_size = 0;
+	int path_index              = 0;
 
-	if( path == NULL )
+	if( paths == NULL )
 	{
-		return( FALSE );
-	}
-	library_handle = LoadLibrary(
-	                  _SYSTEM_STRING( "kernel32.dll" ) );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
 
-	if( library_handle == NULL )
-	{
-		return( FALSE );
+		return( -1 );
 	}
-	function = GetProcAddress(
-		    library_handle,
-		    (LPCSTR) "SetCurrentDirectoryW" );
-
-	if( function != NULL )
+	if( path_lengths == NULL )
 	{
-		result = function(
-			  path );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path lengths.",
+		 function );
+
+		return( -1 );
 	}
-	/* This call should be after using the function
-	 * in most cases kernel32.dll will still be available after free
-	 */
-	if( FreeLibrary(
-	     library_handle ) != TRUE )
+	if( number_of_paths <= 0 )
 	{
-		libcpath_CloseHandle(
-		 library_handle );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of paths value zero or less.",
+		 function );
 
-		return( FALSE );
+		return( -1 );
 	}
-	return( result );
-}
-
-#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
-
-#if defined( WINAPI )
-
-/* Changes the directory
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns 1 if successful or -1 on error
- */
-int libcpath_path_change_directory_wide(
-     const wchar_t *directory_name,
-     libcerror_error_t **error )
-{
-	static char *function = "libcpath_path_change_directory_wide";
-	DWORD error_code      = 0;
+	if( (size_t) number_of_paths > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of paths value exceeds maximum.",
+		 function );
 
-	if( directory_name == NULL )
+		return( -1 );
+	}
+	if( full_paths == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name.",
+		 "%s: invalid full paths.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
-	if( libcpath_SetCurrentDirectoryW(
-	     directory_name ) == 0 )
-#else
-	if( SetCurrentDirectoryW(
-	     directory_name ) == 0 )
-#endif
+	if( *full_paths != NULL )
 	{
-		error_code = GetLastError();
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 error_code,
-		 "%s: unable to change directory.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full paths value already set.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-#elif defined( HAVE_CHDIR )
-
-/* Changes the directory
- * This function uses the POSIX chdir function or equivalent
- * Returns 1 if successful or -1 on error
- */
-int libcpath_path_change_directory_wide(
-     const wchar_t *directory_name,
-     libcerror_error_t **error )
-{
-	static char *function             = "libcpath_path_change_directory_wide";
-	char *narrow_directory_name       = 0;
-	size_t directory_name_length      = 0;
-	size_t narrow_directory_name_size = 0;
-
-	if( directory_name == NULL )
+	if( full_paths_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name.",
+		 "%s: invalid full paths size.",
 		 function );
 
 		return( -1 );
 	}
-	directory_name_length = wide_string_length(
-	                         directory_name );
-
-	if( libcpath_system_string_size_from_wide_string(
-	     directory_name,
-	     directory_name_length + 1,
-	     &narrow_directory_name_size,
-	     error ) != 1 )
+	if( full_path_offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine narrow directory name size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path offsets.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( narrow_directory_name_size > (size_t) SSIZE_MAX )
-	 || ( ( sizeof( char ) * narrow_directory_name_size )  > (size_t) SSIZE_MAX ) )
+	if( *full_path_offsets != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid narrow directory name size value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path offsets value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	narrow_directory_name = narrow_string_allocate(
-	                         narrow_directory_name_size );
+	*full_path_offsets = (size_t *) libcpath_allocator_allocate(
+	                                 sizeof( size_t ) * number_of_paths );
 
-	if( narrow_directory_name == NULL )
+	if( *full_path_offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create narrow directory name.",
+		 "%s: unable to create full path offsets.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcpath_system_string_copy_from_wide_string(
-	     narrow_directory_name,
-	     narrow_directory_name_size,
-	     directory_name,
-	     directory_name_length + 1,
-	     error ) != 1 )
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set name.",
-		 function );
+		if( libcpath_path_get_full_path(
+		     paths[ path_index ],
+		     path_lengths[ path_index ],
+		     &full_path,
+		     &full_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine full path: %d.",
+			 function,
+			 path_index );
 
-		goto on_error;
-	}
-	if( chdir(
-	     narrow_directory_name ) != 0 )
-	{
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 errno,
-		 "%s: unable to change directory.",
-		 function );
+			goto on_error;
+		}
+		if( full_path_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - safe_full_paths_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid full paths size value out of bounds.",
+			 function );
 
-		return( -1 );
-	}
-	memory_free(
-	 narrow_directory_name );
+			goto on_error;
+		}
+		reallocation = (char *) libcpath_allocator_reallocate(
+		                         *full_paths,
+		                         sizeof( char ) * ( safe_full_paths_size + full_path_size ) );
 
-	return( 1 );
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize full paths.",
+			 function );
 
-on_error:
-	if( narrow_directory_name != NULL )
-	{
-		memory_free(
-		 narrow_directory_name );
-	}
-	return( -1 );
-}
+			goto on_error;
+		}
+		*full_paths = reallocation;
 
-#else
-#error Missing change directory function
-#endif
+		if( narrow_string_copy(
+		     &( ( *full_paths )[ safe_full_paths_size ] ),
+		     full_path,
+		     full_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy full path: %d.",
+			 function,
+			 path_index );
 
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+			goto on_error;
+		}
+		( *full_path_offsets )[ path_index ] = safe_full_paths_size;
 
-/* Cross Windows safe version of GetCurrentDirectoryW
- * Returns the number of characters in the current directory string or 0 on error
- */
-DWORD libcpath_GetCurrentDirectoryW(
-       DWORD buffer_size,
-       LPCWSTR buffer )
-{
-	FARPROC function       = NULL;
-	HMODULE library_handle = NULL;
-	DWORD result           = 0;
+		safe_full_paths_size += full_path_size;
 
-	library_handle = LoadLibrary(
-	                  _SYSTEM_STRING( "kernel32.dll" ) );
+		libcpath_allocator_free(
+		 full_path );
 
-	if( library_handle == NULL )
-	{
-		return( 0 );
+		full_path = NULL;
 	}
-	function = GetProcAddress(
-		    library_handle,
-		    (LPCSTR) "GetCurrentDirectoryW" );
+	*full_paths_size = safe_full_paths_size;
 
-	if( function != NULL )
+	return( 1 );
+
+on_error:
+	if( full_path != NULL )
 	{
-		result = function(
-			  buffer_size,
-			  buffer );
+		libcpath_allocator_free(
+		 full_path );
 	}
-	/* This call should be after using the function
-	 * in most cases kernel32.dll will still be available after free
-	 */
-	if( FreeLibrary(
-	     library_handle ) != TRUE )
+	if( *full_paths != NULL )
 	{
-		libcpath_CloseHandle(
-		 library_handle );
+		libcpath_allocator_free(
+		 *full_paths );
 
-		return( 0 );
+		*full_paths = NULL;
 	}
-	return( result );
-}
+	if( *full_path_offsets != NULL )
+	{
+		libcpath_allocator_free(
+		 *full_path_offsets );
 
-#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+		*full_path_offsets = NULL;
+	}
+	*full_paths_size = 0;
 
-#if defined( WINAPI )
+	return( -1 );
+}
 
-/* Retrieves the current working directory
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+#else
+
+/* Retrieves the normalized working directory
+ * The working directory or, when NULL, the current working directory of the
+ * process is normalized into the buffer provided by the caller, typically on
+ * the stack. When the normalized working directory does not fit a buffer of
+ * the required size is allocated
+ * On return normalized_working_directory points to either buffer or an allocated
+ * buffer that must be freed with libcpath_allocator_free
+ * The root directory is represented by an empty normalized working directory
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_current_working_directory_wide(
-     wchar_t **current_working_directory,
-     size_t *current_working_directory_size,
+int libcpath_path_get_normalized_working_directory(
+     const char *working_directory,
+     size_t working_directory_length,
+     char *buffer,
+     size_t buffer_size,
+     char **normalized_working_directory,
+     size_t *normalized_working_directory_length,
      libcerror_error_t **error )
 {
-	static char *function                     = "libcpath_path_get_current_working_directory_wide";
-	DWORD safe_current_working_directory_size = 0;
-	DWORD error_code                          = 0;
+	char current_directory_buffer[ LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE ];
 
-	if( current_working_directory == NULL )
+	const char *base_path                    = NULL;
+	char *current_directory                  = NULL;
+	char *safe_normalized_directory          = NULL;
+	static char *function                    = "libcpath_path_get_normalized_working_directory";
+	size_t base_path_length                  = 0;
+	size_t normalized_working_directory_size = 0;
+	int result                               = 0;
+
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory.",
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( *current_working_directory != NULL )
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid current working directory value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( current_working_directory_size == NULL )
+	if( normalized_working_directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory size.",
+		 "%s: invalid normalized working directory.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
-	safe_current_working_directory_size = libcpath_GetCurrentDirectoryW(
-	                                       0,
-	                                       NULL );
-#else
-	safe_current_working_directory_size = GetCurrentDirectoryW(
-	                                       0,
-	                                       NULL );
-#endif
-	if( safe_current_working_directory_size == 0 )
+	if( normalized_working_directory_length == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve current working directory size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalized working directory length.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( (size_t) safe_current_working_directory_size > (size_t) SSIZE_MAX )
+	if( working_directory != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current working directory size value out of bounds.",
-		 function );
+		base_path        = working_directory;
+		base_path_length = working_directory_length;
+	}
+	else
+	{
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+		result = libcpath_path_get_cached_current_working_directory(
+		          &base_path,
+		          &base_path_length,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached current working directory.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+#endif
+		{
+			if( libcpath_path_getcwd(
+			     current_directory_buffer,
+			     LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE,
+			     &current_directory,
+			     &base_path_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current working directory.",
+				 function );
+
+				goto on_error;
+			}
+			base_path = current_directory;
+		}
 	}
-	*current_working_directory_size = (size_t) safe_current_working_directory_size;
+	safe_normalized_directory = buffer;
 
-	*current_working_directory = wide_string_allocate(
-	                              *current_working_directory_size );
+	result = libcpath_path_normalize_with_base(
+	          NULL,
+	          0,
+	          base_path,
+	          base_path_length,
+	          safe_normalized_directory,
+	          buffer_size,
+	          &normalized_working_directory_size,
+	          error );
 
-	if( *current_working_directory == NULL )
+	if( result == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create current working directory.",
-		 function );
+		safe_normalized_directory = libcpath_allocator_allocate_narrow_string(
+		                             normalized_working_directory_size );
 
-		goto on_error;
-	}
-	if( memory_set(
-	     *current_working_directory,
-	     0,
-	     sizeof( wchar_t ) * *current_working_directory_size ) == NULL )
+		if( safe_normalized_directory == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create normalized working directory.",
+			 function );
+
+			goto on_error;
+		}
+		result = libcpath_path_normalize_with_base(
+		          NULL,
+		          0,
+		          base_path,
+		          base_path_length,
+		          safe_normalized_directory,
+		          normalized_working_directory_size,
+		          &normalized_working_directory_size,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear current working directory.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to normalize working directory.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
-	if( libcpath_GetCurrentDirectoryW(
-	     safe_current_working_directory_size,
-	     *current_working_directory ) != ( safe_current_working_directory_size - 1 ) )
-#else
-	if( GetCurrentDirectoryW(
-	     safe_current_working_directory_size,
-	     *current_working_directory ) != ( safe_current_working_directory_size - 1 ) )
-#endif
+	if( ( current_directory != NULL )
+	 && ( current_directory != current_directory_buffer ) )
 	{
-		error_code = GetLastError();
-
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 error_code,
-		 "%s: unable to retrieve current working directory.",
-		 function );
+		libcpath_allocator_free(
+		 current_directory );
+	}
+	*normalized_working_directory = safe_normalized_directory;
 
-		goto on_error;
+	/* The root directory is represented by an empty normalized working directory
+	 */
+	if( normalized_working_directory_size > 2 )
+	{
+		*normalized_working_directory_length = normalized_working_directory_size - 1;
+	}
+	else
+	{
+		*normalized_working_directory_length = 0;
 	}
 	return( 1 );
 
 on_error:
-	if( *current_working_directory != NULL )
+	if( ( safe_normalized_directory != NULL )
+	 && ( safe_normalized_directory != buffer ) )
 	{
-		memory_free(
-		 *current_working_directory );
-
-		*current_working_directory = NULL;
+		libcpath_allocator_free(
+		 safe_normalized_directory );
+	}
+	if( ( current_directory != NULL )
+	 && ( current_directory != current_directory_buffer ) )
+	{
+		libcpath_allocator_free(
+		 current_directory );
 	}
-	*current_working_directory_size = 0;
-
 	return( -1 );
 }
 
-#elif defined( HAVE_GETCWD )
-
-/* Retrieves the current working directory
- * This function uses the POSIX getcwd function or equivalent
+/* Determines the full paths of the POSIX paths specified
+ * The current working directory is retrieved and normalized once, on the stack
+ * unless it does not fit, and shared by all relative paths. The full paths are determined in two passes
+ * so that they can be stored in a single allocation of their exact size
+ *
+ * The full paths are stored consecutively, each terminated by an end of string
+ * character, and full_path_offsets contains the offset of every full path
+ * Relative paths are resolved against the working directory or, when NULL,
+ * the current working directory of the process
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_current_working_directory_wide(
-     wchar_t **current_working_directory,
-     size_t *current_working_directory_size,
+int libcpath_path_get_full_paths_with_working_directory(
+     const char *working_directory,
+     size_t working_directory_length,
+     const char **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     char **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
      libcerror_error_t **error )
 {
-	static char *function                          = "libcpath_path_get_current_working_directory_wide";
-	char *narrow_current_working_directory         = 0;
-	size_t narrow_current_working_directory_length = 0;
+	char normalized_current_directory_buffer[ LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE ];
 
-	if( current_working_directory == NULL )
+	char *normalized_current_directory         = NULL;
+	static char *function                      = "libcpath_path_get_full_paths_with_working_directory";
+	size_t full_path_size                      = 0;
+	size_t normalized_current_directory_length = 0;
+	size_t safe_full_paths_size                = 0;
+	int current_directory_is_set               = 0;
+	int path_index                             = 0;
+
+	if( paths == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory.",
-		 function );
-
-		return( -1 );
-	}
-	if( *current_working_directory != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid current working directory value already set.",
+		 "%s: invalid paths.",
 		 function );
 
 		return( -1 );
 	}
-	if( current_working_directory_size == NULL )
+	if( path_lengths == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory size.",
+		 "%s: invalid path lengths.",
 		 function );
 
 		return( -1 );
 	}
-	narrow_current_working_directory = narrow_string_allocate(
-	                                    PATH_MAX );
-
-	if( narrow_current_working_directory == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create narrow current working directory.",
-		 function );
-
-		goto on_error;
-	}
-	if( getcwd(
-	     narrow_current_working_directory,
-	     PATH_MAX ) == NULL )
-	{
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 errno,
-		 "%s: unable to retrieve current working directory.",
-		 function );
-
-		goto on_error;
-	}
-	narrow_current_working_directory_length = narrow_string_length(
-	                                           narrow_current_working_directory );
-
-	/* Convert the current working directory to a wide string
-	 * if the platform has no wide character open function
-	 */
-	if( libcpath_system_string_size_from_narrow_string(
-	     narrow_current_working_directory,
-	     narrow_current_working_directory_length + 1,
-	     current_working_directory_size,
-	     error ) != 1 )
+	if( number_of_paths <= 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine wide character current working directory size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of paths value zero or less.",
 		 function );
 
 		return( -1 );
 	}
-	*current_working_directory = wide_string_allocate(
-	                              *current_working_directory_size );
-
-	if( *current_working_directory == NULL )
+	if( (size_t) number_of_paths > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create current working directory.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of paths value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     *current_working_directory,
-	     0,
-	     sizeof( wchar_t ) * *current_working_directory_size ) == NULL )
+	if( full_paths == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear current working directory.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcpath_system_string_copy_to_wide_string(
-	     narrow_current_working_directory,
-	     narrow_current_working_directory_length + 1,
-	     *current_working_directory,
-	     *current_working_directory_size,
-	     error ) != 1 )
+	if( *full_paths != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set current working directory.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full paths value already set.",
 		 function );
 
-		goto on_error;
-	}
-	memory_free(
-	 narrow_current_working_directory );
-
-	return( 1 );
-
-on_error:
-	if( narrow_current_working_directory != NULL )
-	{
-		memory_free(
-		 narrow_current_working_directory );
-	}
-	if( *current_working_directory != NULL )
-	{
-		memory_free(
-		 *current_working_directory );
-
-		*current_working_directory = NULL;
+		return( -1 );
 	}
-	*current_working_directory_size = 0;
-
-	return( -1 );
-}
-
-#else
-#error Missing get current working directory function
-#endif
-
-#if defined( WINAPI )
-
-/* Determines the path type
- * Returns 1 if succesful or -1 on error
- */
-int libcpath_path_get_path_type_wide(
-     const wchar_t *path,
-     size_t path_length,
-     uint8_t *path_type,
-     libcerror_error_t **error )
-{
-	static char *function = "libcpath_path_get_path_type_wide";
-
-	if( path == NULL )
+	if( full_paths_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 "%s: invalid full paths size.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_length == 0 )
+	if( full_path_offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid path length is zero.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path offsets.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( *full_path_offsets != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path offsets value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_type == NULL )
+	*full_path_offsets = (size_t *) libcpath_allocator_allocate(
+	                                 sizeof( size_t ) * number_of_paths );
+
+	if( *full_path_offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path type.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path offsets.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*path_type = LIBCPATH_TYPE_RELATIVE;
-
-	/* Determine if the path is a special path
-	 * device path prefix:          \\.\
-	 * extended-length path prefix: \\?\
+	/* The first pass determines the offset and size of every full path
 	 */
-	if( ( path_length >= 4 )
-	 && ( path[ 0 ] == (wchar_t) '\\' )
-	 && ( path[ 1 ] == (wchar_t) '\\' )
-	 && ( ( path[ 2 ] == (wchar_t) '.' )
-	  ||  ( path[ 2 ] == (wchar_t) '?' ) )
-	 && ( path[ 3 ] == (wchar_t) '\\' ) )
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
 	{
-		if( path[ 2 ] == (wchar_t) '.' )
+		if( ( paths[ path_index ] == NULL )
+		 || ( path_lengths[ path_index ] == 0 ) )
 		{
-			*path_type = LIBCPATH_TYPE_DEVICE;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid path: %d.",
+			 function,
+			 path_index );
+
+			goto on_error;
 		}
-		/* Determine if the path in an extended-length UNC path
-		 * \\?\UNC\server\share
-		 */
-		else if( ( path_length >= 8 )
-		      && ( path[ 4 ] == (wchar_t) 'U' )
-		      && ( path[ 5 ] == (wchar_t) 'N' )
-		      && ( path[ 6 ] == (wchar_t) 'C' )
-		      && ( path[ 7 ] == (wchar_t) '\\' ) )
+		if( ( paths[ path_index ][ 0 ] != '/' )
+		 && ( current_directory_is_set == 0 ) )
 		{
-			*path_type = LIBCPATH_TYPE_EXTENDED_LENGTH_UNC;
+			if( libcpath_path_get_normalized_working_directory(
+			     working_directory,
+			     working_directory_length,
+			     normalized_current_directory_buffer,
+			     LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE,
+			     &normalized_current_directory,
+			     &normalized_current_directory_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve normalized current working directory.",
+				 function );
+
+				goto on_error;
+			}
+			current_directory_is_set = 1;
 		}
-		else
+		if( libcpath_path_normalize_with_normalized_base(
+		     normalized_current_directory,
+		     normalized_current_directory_length,
+		     paths[ path_index ],
+		     path_lengths[ path_index ],
+		     NULL,
+		     0,
+		     &full_path_size,
+		     error ) != 1 )
 		{
-			*path_type = LIBCPATH_TYPE_EXTENDED_LENGTH;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine full path size: %d.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+		if( full_path_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - safe_full_paths_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid full paths size value out of bounds.",
+			 function );
+
+			goto on_error;
 		}
+		( *full_path_offsets )[ path_index ] = safe_full_paths_size;
+
+		safe_full_paths_size += full_path_size;
 	}
-	/* Determine if the path is an UNC path
-	 * \\server\share
-	 */
-	else if( ( path_length >= 2 )
-	      && ( path[ 0 ] == (wchar_t) '\\' )
-	      && ( path[ 1 ] == (wchar_t) '\\' ) )
+	*full_paths = libcpath_allocator_allocate_narrow_string(
+	               safe_full_paths_size );
+
+	if( *full_paths == NULL )
 	{
-		*path_type = LIBCPATH_TYPE_UNC;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full paths.",
+		 function );
+
+		goto on_error;
 	}
-	else if( path[ 0 ] == (wchar_t) '\\' )
+	/* The second pass writes every full path at its offset
+	 */
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
 	{
-		*path_type = LIBCPATH_TYPE_ABSOLUTE;
+		if( libcpath_path_normalize_with_normalized_base(
+		     normalized_current_directory,
+		     normalized_current_directory_length,
+		     paths[ path_index ],
+		     path_lengths[ path_index ],
+		     &( ( *full_paths )[ ( *full_path_offsets )[ path_index ] ] ),
+		     safe_full_paths_size - ( *full_path_offsets )[ path_index ],
+		     &full_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set full path: %d.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
 	}
-	else if( ( path_length >= 3 )
-	      && ( path[ 1 ] == (wchar_t) ':' )
-	      && ( path[ 2 ] == (wchar_t) '\\' )
-	      && ( ( ( path[ 0 ] >= (wchar_t) 'A' )
-	        &&   ( path[ 0 ] <= (wchar_t) 'Z' ) )
-	       ||  ( ( path[ 0 ] >= (wchar_t) 'a' )
-	        &&   ( path[ 0 ] <= (wchar_t) 'z' ) ) ) )
+	*full_paths_size = safe_full_paths_size;
+
+	if( ( normalized_current_directory != NULL )
+	 && ( normalized_current_directory != normalized_current_directory_buffer ) )
 	{
-		*path_type = LIBCPATH_TYPE_ABSOLUTE;
+		libcpath_allocator_free(
+		 normalized_current_directory );
 	}
 	return( 1 );
+
+on_error:
+	if( ( normalized_current_directory != NULL )
+	 && ( normalized_current_directory != normalized_current_directory_buffer ) )
+	{
+		libcpath_allocator_free(
+		 normalized_current_directory );
+	}
+	if( *full_paths != NULL )
+	{
+		libcpath_allocator_free(
+		 *full_paths );
+
+		*full_paths = NULL;
+	}
+	if( *full_path_offsets != NULL )
+	{
+		libcpath_allocator_free(
+		 *full_path_offsets );
+
+		*full_path_offsets = NULL;
+	}
+	*full_paths_size = 0;
+
+	return( -1 );
 }
 
-/* Determines the volume name
- * Returns 1 if succesful or -1 on error
+/* Determines the full paths of the POSIX paths specified
+ * Relative paths are resolved against the current working directory of the process
+ * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_volume_name_wide(
-     const wchar_t *path,
+int libcpath_path_get_full_paths(
+     const char **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     char **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_get_full_paths_with_working_directory(
+	         NULL,
+	         0,
+	         paths,
+	         path_lengths,
+	         number_of_paths,
+	         full_paths,
+	         full_paths_size,
+	         full_path_offsets,
+	         error ) );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Determines the full paths of multiple paths using a context
+ * Relative paths are resolved against the working directory of the context,
+ * hence contexts can be used concurrently by different threads
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_full_paths_context(
+     libcpath_context_t *context,
+     const char **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     char **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error )
+{
+	static char *function           = "libcpath_path_get_full_paths_context";
+
+#if !defined( WINAPI )
+	const char *working_directory   = NULL;
+	size_t working_directory_length = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The Windows API has no working directory that is not process wide
+	 */
+	return( libcpath_path_get_full_paths(
+	         paths,
+	         path_lengths,
+	         number_of_paths,
+	         full_paths,
+	         full_paths_size,
+	         full_path_offsets,
+	         error ) );
+#else
+	if( libcpath_context_get_working_directory(
+	     context,
+	     &working_directory,
+	     &working_directory_length,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve working directory from context.",
+		 function );
+
+		return( -1 );
+	}
+	return( libcpath_path_get_full_paths_with_working_directory(
+	         working_directory,
+	         working_directory_length,
+	         paths,
+	         path_lengths,
+	         number_of_paths,
+	         full_paths,
+	         full_paths_size,
+	         full_path_offsets,
+	         error ) );
+#endif
+}
+
+/* Retrieves the full path of the path relative to a base path
+ * The base path must be an absolute path. Unlike libcpath_path_get_full_path
+ * the current working directory is not used and on POSIX the path is resolved
+ * lexically, without accessing the file system, hence a parent directory (..)
+ * segment can refer to a directory outside the base path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_full_path_with_base(
+     const char *base_path,
+     size_t base_path_length,
+     const char *path,
      size_t path_length,
-     wchar_t **volume_name,
-     size_t *volume_name_length,
-     size_t *directory_name_index,
+     char **full_path,
+     size_t *full_path_size,
      libcerror_error_t **error )
 {
-	static char *function    = "libcpath_path_get_volume_name_wide";
-	size_t path_index        = 0;
-	size_t share_name_index  = 0;
-	size_t volume_name_index = 0;
+	static char *function      = "libcpath_path_get_full_path_with_base";
+
+#if defined( WINAPI )
+	char *joined_path          = NULL;
+	size_t joined_path_size    = 0;
+	uint8_t path_type          = 0;
+	int result                 = 0;
+#else
+	size_t safe_full_path_size = 0;
+#endif
+
+	if( base_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base path.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid base path length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base path length value exceeds maximum.",
+		 function );
 
+		return( -1 );
+	}
 	if( path == NULL )
 	{
 		libcerror_error_set(
@@ -4337,1247 +4853,1263 @@ int libcpath_path_get_volume_name_wide(
 
 		return( -1 );
 	}
-	if( volume_name == NULL )
+	if( full_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume name.",
+		 "%s: invalid full path.",
 		 function );
 
 		return( -1 );
 	}
-	if( volume_name_length == NULL )
+	if( *full_path != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume name length.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_name_index == NULL )
+	if( full_path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name index.",
+		 "%s: invalid full path size.",
 		 function );
 
 		return( -1 );
 	}
-	*volume_name          = NULL;
-	*volume_name_length   = 0;
-	*directory_name_index = 0;
+#if defined( WINAPI )
+	if( libcpath_path_get_path_type(
+	     base_path,
+	     base_path_length,
+	     &path_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine base path type.",
+		 function );
 
-	/* Determine if the path is a special path
-	 * device path prefix:          \\.\
-	 * extended-length path prefix: \\?\
+		return( -1 );
+	}
+	if( path_type == LIBCPATH_TYPE_RELATIVE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported base path value not absolute.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_path_type(
+	     path,
+	     path_length,
+	     &path_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path type.",
+		 function );
+
+		return( -1 );
+	}
+	/* The Windows path prefixes are resolved by libcpath_path_get_full_path
 	 */
-	if( ( path_length >= 4 )
-	 && ( path[ 0 ] == (wchar_t) '\\' )
-	 && ( path[ 1 ] == (wchar_t) '\\' )
-	 && ( ( path[ 2 ] == (wchar_t) '.' )
-	  ||  ( path[ 2 ] == (wchar_t) '?' ) )
-	 && ( path[ 3 ] == (wchar_t) '\\' ) )
+	if( path_type != LIBCPATH_TYPE_RELATIVE )
 	{
-		if( path[ 2 ] == (wchar_t) '.' )
+		result = libcpath_path_get_full_path(
+		          path,
+		          path_length,
+		          full_path,
+		          full_path_size,
+		          error );
+	}
+	else
+	{
+		if( libcpath_path_join(
+		     &joined_path,
+		     &joined_path_size,
+		     base_path,
+		     base_path_length,
+		     path,
+		     path_length,
+		     error ) != 1 )
 		{
-			volume_name_index = 4;
-		}
-		/* Determine if the path in an extended-length UNC path
-		 * \\?\UNC\server\share
-		 */
-		else if( ( path_length >= 8 )
-		      && ( path[ 4 ] == (wchar_t) 'U' )
-		      && ( path[ 5 ] == (wchar_t) 'N' )
-		      && ( path[ 6 ] == (wchar_t) 'C' )
-		      && ( path[ 7 ] == (wchar_t) '\\' ) )
-		{
-			volume_name_index = 8;
-		}
-		else
-		{
-			volume_name_index = 4;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to join base path and path.",
+			 function );
+
+			return( -1 );
 		}
+		result = libcpath_path_get_full_path(
+		          joined_path,
+		          joined_path_size - 1,
+		          full_path,
+		          full_path_size,
+		          error );
+
+		libcpath_allocator_free(
+		 joined_path );
 	}
-	/* Determine if the path is an UNC path
-	 * \\server\share
-	 */
-	else if( ( path_length >= 2 )
-	      && ( path[ 0 ] == (wchar_t) '\\' )
-	      && ( path[ 1 ] == (wchar_t) '\\' ) )
+	if( result != 1 )
 	{
-		volume_name_index = 2;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path.",
+		 function );
+
+		return( -1 );
 	}
-	/* Check if the path contains a volume letter
-	 */
-	if( ( path_length >= 2 )
-	 && ( volume_name_index <= ( path_length - 2 ) )
-	 && ( path[ volume_name_index + 1 ] == (wchar_t) ':' )
-	 && ( ( ( path[ volume_name_index ] >= (wchar_t) 'A' )
-	   &&   ( path[ volume_name_index ] <= (wchar_t) 'Z' ) )
-	  ||  ( ( path[ volume_name_index ] >= (wchar_t) 'a' )
-	   &&   ( path[ volume_name_index ] <= (wchar_t) 'z' ) ) ) )
+	return( 1 );
+#else
+	if( base_path[ 0 ] != (char) LIBCPATH_SEPARATOR )
 	{
-		path_index = volume_name_index + 2;
-
-		if( ( path_index < path_length )
-		 && ( path[ path_index ] == (wchar_t) '\\' ) )
-		{
-			path_index++;
-		}
-		*volume_name        = (wchar_t *) &( path[ volume_name_index ] );
-		*volume_name_length = path_index - volume_name_index;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported base path value not absolute.",
+		 function );
 
-		if( path[ path_index - 1 ] == (wchar_t) '\\' )
-		{
-			*volume_name_length -= 1;
-		}
-		*directory_name_index = path_index;
+		return( -1 );
 	}
-	else if( volume_name_index == 4 )
+	if( libcpath_path_normalize_with_base(
+	     base_path,
+	     base_path_length,
+	     path,
+	     path_length,
+	     NULL,
+	     0,
+	     &safe_full_path_size,
+	     error ) != 1 )
 	{
-		for( path_index = volume_name_index;
-		     path_index < path_length;
-		     path_index++ )
-		{
-			if( path[ path_index ] == (wchar_t) '\\' )
-			{
-				path_index++;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path size.",
+		 function );
 
-				break;
-			}
-		}
-		*volume_name        = (wchar_t *) &( path[ 4 ] );
-		*volume_name_length = path_index - 4;
+		goto on_error;
+	}
+	*full_path = libcpath_allocator_allocate_narrow_string(
+	              safe_full_path_size );
 
-		if( path[ path_index - 1 ] == (wchar_t) '\\' )
-		{
-			*volume_name_length -= 1;
-		}
-		*directory_name_index = path_index;
+	if( *full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path.",
+		 function );
+
+		goto on_error;
 	}
-	else if( ( volume_name_index == 2 )
-	      || ( volume_name_index == 8 ) )
+	if( libcpath_path_normalize_with_base(
+	     base_path,
+	     base_path_length,
+	     path,
+	     path_length,
+	     *full_path,
+	     safe_full_path_size,
+	     &safe_full_path_size,
+	     error ) != 1 )
 	{
-		for( share_name_index = volume_name_index;
-		     share_name_index < path_length;
-		     share_name_index++ )
-		{
-			if( path[ share_name_index ] == (wchar_t) '\\' )
-			{
-				share_name_index++;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set full path.",
+		 function );
 
-				break;
-			}
-		}
-		if( share_name_index > path_length )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid path - missing share name.",
-			 function );
+		goto on_error;
+	}
+	*full_path_size = safe_full_path_size;
 
-			return( -1 );
-		}
-		for( path_index = share_name_index;
-		     path_index < path_length;
-		     path_index++ )
-		{
-			if( path[ path_index ] == (wchar_t) '\\' )
-			{
-				path_index++;
+	return( 1 );
 
-				break;
-			}
-		}
-		*volume_name        = (wchar_t *) &( path[ volume_name_index ] );
-		*volume_name_length = path_index - volume_name_index;
+on_error:
+	if( *full_path != NULL )
+	{
+		libcpath_allocator_free(
+		 *full_path );
 
-		if( path[ path_index - 1 ] == (wchar_t) '\\' )
-		{
-			*volume_name_length -= 1;
-		}
-		*directory_name_index = path_index;
+		*full_path = NULL;
 	}
-	return( 1 );
+	*full_path_size = 0;
+
+	return( -1 );
+#endif /* defined( WINAPI ) */
 }
 
-/* Retrieves the current working directory of a specific volume
- * Returns 1 if successful or -1 on error
+/* Normalizes a path lexically into a buffer
+ * Empty and . segments are removed and a parent directory (..) segment removes
+ * the segment it follows. The parent directory segments that remain at the start
+ * of a relative path are kept, those of an absolute path refer to the root directory
+ * The path is not combined with a base path or the current working directory
+ * and the file system is not accessed
+ * Returns 1 if successful, 0 if the normalized path size is too small or -1 on error
  */
-int libcpath_path_get_current_working_directory_by_volume_wide(
-     wchar_t *volume_name,
-     size_t volume_name_length,
-     wchar_t **current_working_directory,
-     size_t *current_working_directory_size,
+int libcpath_path_normalize_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
      libcerror_error_t **error )
 {
-	wchar_t *change_volume_name                  = NULL;
-	wchar_t *current_volume_working_directory    = NULL;
-	static char *function                        = "libcpath_path_get_current_working_directory_by_volume_wide";
-	size_t current_volume_working_directory_size = 0;
-	int result                                   = 1;
+	static char *function               = "libcpath_path_normalize_to_buffer";
+	size_t normalized_path_index        = 0;
+	size_t number_of_parent_directories = 0;
+	size_t prefix_length                = 0;
+	size_t safe_normalized_path_size    = 0;
+	size_t segments_end_index           = 0;
+	size_t segments_length              = 0;
+	int is_absolute                     = 0;
+	int is_verbatim                     = 0;
 
-	if( current_working_directory == NULL )
+#if defined( WINAPI )
+	uint8_t path_type                   = 0;
+#endif
+
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory.",
+		 "%s: invalid path.",
 		 function );
 
 		return( -1 );
 	}
-	if( current_working_directory_size == NULL )
+	if( path_length == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
 		 function );
 
 		return( -1 );
 	}
-	/* If the path contains a volume name switch to that
-	 * volume to determine the current directory
-	 */
-	if( volume_name != NULL )
+	if( path_length > (size_t) ( ( SSIZE_MAX - 2 ) / 2 ) )
 	{
-		if( volume_name_length > (size_t) ( SSIZE_MAX - 1 ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid volume name length value exceeds maximum.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcpath_path_get_current_working_directory_wide(
-		     &current_volume_working_directory,
-		     &current_volume_working_directory_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve current volume working directory.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
 
-			goto on_error;
-		}
-		change_volume_name = wide_string_allocate(
-		                      volume_name_length + 1 );
+		return( -1 );
+	}
+	if( ( normalized_path == NULL )
+	 && ( normalized_path_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalized path.",
+		 function );
 
-		if( change_volume_name == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create change volume name.",
-			 function );
+		return( -1 );
+	}
+	if( normalized_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid normalized path size value exceeds maximum.",
+		 function );
 
-			goto on_error;
-		}
-		if( wide_string_copy(
-		     change_volume_name,
-		     volume_name,
-		     volume_name_length ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to set change volume name.",
-			 function );
-
-			goto on_error;
-		}
-		change_volume_name[ volume_name_length ] = 0;
-
-		if( libcpath_path_change_directory_wide(
-		     change_volume_name,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to change current working directory.",
-			 function );
-
-			goto on_error;
-		}
-		memory_free(
-		 change_volume_name );
+		return( -1 );
+	}
+	if( required_normalized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required normalized path size.",
+		 function );
 
-		change_volume_name = NULL;
+		return( -1 );
 	}
-	if( libcpath_path_get_current_working_directory_wide(
-	     current_working_directory,
-	     current_working_directory_size,
+#if defined( WINAPI )
+	if( libcpath_path_get_path_type(
+	     path,
+	     path_length,
+	     &path_type,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve current directory.",
+		 "%s: unable to determine path type.",
 		 function );
 
-		/* Make sure the current working directory has been changed
-		 * back to its original value
+		return( -1 );
+	}
+	if( ( path_type == LIBCPATH_TYPE_DEVICE )
+	 || ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH )
+	 || ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC ) )
+	{
+		/* Device and extended-length paths are passed to the file system as-is
 		 */
-		result = -1;
+		prefix_length = path_length;
+		is_verbatim   = 1;
 	}
-	if( current_volume_working_directory != NULL )
+	else if( path_type == LIBCPATH_TYPE_UNC )
 	{
-		if( libcpath_path_change_directory_wide(
-		     current_volume_working_directory,
+		/* The server and share names of an UNC path are part of its prefix
+		 */
+		prefix_length = 2;
+
+		while( ( prefix_length < path_length )
+		    && ( path[ prefix_length ] != (char) LIBCPATH_SEPARATOR ) )
+		{
+			prefix_length++;
+		}
+		if( prefix_length < path_length )
+		{
+			prefix_length++;
+		}
+		while( ( prefix_length < path_length )
+		    && ( path[ prefix_length ] != (char) LIBCPATH_SEPARATOR ) )
+		{
+			prefix_length++;
+		}
+		is_absolute = 1;
+	}
+	else if( ( path_length >= 2 )
+	      && ( path[ 1 ] == ':' ) )
+	{
+		/* The volume letter and colon are the prefix of a volume path
+		 */
+		prefix_length = 2;
+	}
+#endif /* defined( WINAPI ) */
+
+	if( is_verbatim == 0 )
+	{
+		if( ( prefix_length < path_length )
+		 && ( path[ prefix_length ] == (char) LIBCPATH_SEPARATOR ) )
+		{
+			is_absolute = 1;
+		}
+		if( libcpath_path_normalize_segments(
+		     &( path[ prefix_length ] ),
+		     path_length - prefix_length,
+		     NULL,
+		     0,
+		     &segments_length,
+		     &number_of_parent_directories,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to change current working directory.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of normalized path segments.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		memory_free(
-		 current_volume_working_directory );
+	}
+	/* The size consists of the prefix, the (relative) parent directory segments,
+	 * the remaining segments and the end of string character
+	 */
+	safe_normalized_path_size = prefix_length + 1;
 
-		current_volume_working_directory = NULL;
+	if( is_verbatim != 0 )
+	{
 	}
-	return( result );
+	else if( is_absolute != 0 )
+	{
+		/* The root directory consists of a single separator
+		 */
+		if( segments_length == 0 )
+		{
+			safe_normalized_path_size += 1;
+		}
+		else
+		{
+			safe_normalized_path_size += segments_length;
+		}
+	}
+	else if( number_of_parent_directories > 0 )
+	{
+		safe_normalized_path_size += ( number_of_parent_directories * 3 ) - 1 + segments_length;
+	}
+	else if( segments_length > 0 )
+	{
+		/* The separator in front of the first segment is not part of a relative path
+		 */
+		safe_normalized_path_size += segments_length - 1;
+	}
+	else
+	{
+		/* The current directory consists of a single .
+		 */
+		safe_normalized_path_size += 1;
+	}
+	*required_normalized_path_size = safe_normalized_path_size;
 
-on_error:
-	if( change_volume_name != NULL )
+	if( normalized_path_size < safe_normalized_path_size )
 	{
-		memory_free(
-		 change_volume_name );
+		return( 0 );
 	}
-	if( current_volume_working_directory != NULL )
+	if( prefix_length > 0 )
 	{
-		memory_free(
-		 current_volume_working_directory );
+		if( narrow_string_copy(
+		     normalized_path,
+		     path,
+		     prefix_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy prefix to normalized path.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	if( *current_working_directory != NULL )
+	normalized_path_index = prefix_length;
+
+	if( is_verbatim == 0 )
 	{
-		memory_free(
-		 *current_working_directory );
+		segments_end_index = safe_normalized_path_size - 1;
 
-		*current_working_directory = NULL;
+		if( is_absolute != 0 )
+		{
+		}
+		else if( number_of_parent_directories > 0 )
+		{
+			normalized_path[ normalized_path_index++ ] = '.';
+			normalized_path[ normalized_path_index++ ] = '.';
+
+			while( number_of_parent_directories > 1 )
+			{
+				normalized_path[ normalized_path_index++ ] = (char) LIBCPATH_SEPARATOR;
+				normalized_path[ normalized_path_index++ ] = '.';
+				normalized_path[ normalized_path_index++ ] = '.';
+
+				number_of_parent_directories--;
+			}
+		}
+		else if( segments_length > 0 )
+		{
+			/* The segments are written one character further, in place of the
+			 * end of string character, and moved back afterwards to remove
+			 * the separator in front of the first segment
+			 */
+			segments_end_index = safe_normalized_path_size;
+		}
+		if( segments_length > 0 )
+		{
+			segments_length              = 0;
+			number_of_parent_directories = 0;
+
+			if( libcpath_path_normalize_segments(
+			     &( path[ prefix_length ] ),
+			     path_length - prefix_length,
+			     normalized_path,
+			     segments_end_index,
+			     &segments_length,
+			     &number_of_parent_directories,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to normalize path segments.",
+				 function );
+
+				return( -1 );
+			}
+			if( segments_end_index == safe_normalized_path_size )
+			{
+				while( normalized_path_index < ( safe_normalized_path_size - 1 ) )
+				{
+					normalized_path[ normalized_path_index ] = normalized_path[ normalized_path_index + 1 ];
+
+					normalized_path_index++;
+				}
+			}
+		}
+		else if( is_absolute != 0 )
+		{
+			normalized_path[ normalized_path_index ] = (char) LIBCPATH_SEPARATOR;
+		}
+		else if( normalized_path_index == prefix_length )
+		{
+			normalized_path[ normalized_path_index ] = '.';
+		}
 	}
-	*current_working_directory_size = 0;
+	normalized_path[ safe_normalized_path_size - 1 ] = 0;
 
-	return( -1 );
+	return( 1 );
 }
 
-/* Determines the full path of the Windows path specified
- * The function uses the extended-length path format
- * (path with \\?\ prefix)
- *
- * Multiple successive \ not at the start of the path are combined into one
- *
- * Scenario's that are considered full paths:
- * Device path:			\\.\PhysicalDrive0
- * Extended-length path:	\\?\C:\directory\file.txt
- * Extended-length UNC path:	\\?\UNC\server\share\directory\file.txt
- *
- * Scenario's that are not considered full paths:
- * Local 'absolute' path:	\directory\file.txt
- * Local 'relative' path:	..\directory\file.txt
- * Local 'relative' path:	.\directory\file.txt
- * Volume 'absolute' path:	C:\directory\file.txt
- *                              C:\..\directory\file.txt
- * Volume 'relative' path:	C:directory\file.txt
- * UNC path:			\\server\share\directory\file.txt
- *
- * Returns 1 if succesful or -1 on error
+/* Normalizes a path lexically
+ * The path is normalized as described by libcpath_path_normalize_to_buffer
+ * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_full_path_wide(
-     const wchar_t *path,
+int libcpath_path_normalize(
+     const char *path,
      size_t path_length,
-     wchar_t **full_path,
-     size_t *full_path_size,
+     char **normalized_path,
+     size_t *normalized_path_size,
      libcerror_error_t **error )
 {
-	libcsplit_wide_split_string_t *current_directory_split_string = NULL;
-	libcsplit_wide_split_string_t *path_split_string              = NULL;
-	wchar_t *current_directory                                    = NULL;
-	wchar_t *current_directory_string_segment                     = NULL;
-	wchar_t *full_path_prefix                                     = NULL;
-	wchar_t *last_used_path_string_segment                        = NULL;
-	wchar_t *path_string_segment                                  = NULL;
-	wchar_t *volume_name                                          = NULL;
-	static char *function                                         = "libcpath_path_get_full_path_wide";
-	size_t current_directory_length                               = 0;
-	size_t current_directory_name_index                           = 0;
-	size_t current_directory_size                                 = 0;
-	size_t current_directory_string_segment_size                  = 0;
-	size_t full_path_index                                        = 0;
-	size_t full_path_prefix_length                                = 0;
-	size_t last_used_path_string_segment_size                     = 0;
-	size_t path_directory_name_index                              = 0;
-	size_t path_string_segment_size                               = 0;
-	size_t safe_full_path_size                                    = 0;
-	size_t volume_name_length                                     = 0;
-	uint8_t path_type                                             = LIBCPATH_TYPE_RELATIVE;
-	int current_directory_number_of_segments                      = 0;
-	int current_directory_segment_index                           = 0;
-	int last_used_path_segment_index                              = -1;
-	int path_number_of_segments                                   = 0;
-	int path_segment_index                                        = 0;
+	static char *function            = "libcpath_path_normalize";
+	size_t safe_normalized_path_size = 0;
 
-	if( path == NULL )
+	if( normalized_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
-		 function );
-
-		return( -1 );
-	}
-	if( path_length == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid path length is zero.",
+		 "%s: invalid normalized path.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( *normalized_path != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid normalized path value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( full_path == NULL )
+	if( normalized_path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path.",
+		 "%s: invalid normalized path size.",
 		 function );
 
 		return( -1 );
 	}
-	if( *full_path != NULL )
+	if( libcpath_path_normalize_to_buffer(
+	     path,
+	     path_length,
+	     NULL,
+	     0,
+	     &safe_normalized_path_size,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid full path value already set.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine normalized path size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( full_path_size == NULL )
+	*normalized_path = libcpath_allocator_allocate_narrow_string(
+	                    safe_normalized_path_size );
+
+	if( *normalized_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path size.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create normalized path.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcpath_path_get_path_type_wide(
+	if( libcpath_path_normalize_to_buffer(
 	     path,
 	     path_length,
-	     &path_type,
+	     *normalized_path,
+	     safe_normalized_path_size,
+	     &safe_normalized_path_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine path type.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set normalized path.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcpath_path_get_volume_name_wide(
-	     path,
-	     path_length,
-	     &volume_name,
-	     &volume_name_length,
-	     &path_directory_name_index,
-	     error ) != 1 )
+	*normalized_path_size = safe_normalized_path_size;
+
+	return( 1 );
+
+on_error:
+	if( *normalized_path != NULL )
+	{
+		libcpath_allocator_free(
+		 *normalized_path );
+
+		*normalized_path = NULL;
+	}
+	*normalized_path_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the size of a sanitized version of the path character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_character_size(
+     char character,
+     size_t *sanitized_character_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_get_sanitized_character_size";
+
+	if( sanitized_character_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine volume name.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized character size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	/* If the path is a device path, an extended-length path or an UNC
-	 * do not bother to lookup the current working directory
-	 */
-	if( ( path_type != LIBCPATH_TYPE_DEVICE )
-	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH )
-	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
-	 && ( path_type != LIBCPATH_TYPE_UNC ) )
-	{
-		if( libcpath_path_get_current_working_directory_by_volume_wide(
-		     volume_name,
-		     volume_name_length,
-		     &current_directory,
-		     &current_directory_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve current working directory by volume.",
-			 function );
-
-			goto on_error;
-		}
-		/* Determine the volume name using the current working directory if necessary
-		 */
-		if( libcpath_path_get_volume_name_wide(
-		     current_directory,
-		     current_directory_size - 1,
-		     &volume_name,
-		     &volume_name_length,
-		     &current_directory_name_index,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine volume name from current working directory.",
-			 function );
+	*sanitized_character_size = (size_t) libcpath_sanitize_character_sizes[ (uint8_t) character ];
 
-			goto on_error;
-		}
-	}
-	if( ( current_directory != NULL )
-	 && ( current_directory_name_index < current_directory_size ) )
-	{
-		current_directory_length = wide_string_length(
-		                            &( current_directory[ current_directory_name_index ] ) );
+	return( 1 );
+}
 
-		if( libcsplit_wide_string_split(
-		     &( current_directory[ current_directory_name_index ] ),
-		     current_directory_length + 1,
-		     (wchar_t) '\\',
-		     &current_directory_split_string,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to split current working directory.",
-			 function );
+/* Retrieves a sanitized version of the path character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_character(
+     char character,
+     size_t sanitized_character_size,
+     char *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *sanitized_path_index,
+     libcerror_error_t **error )
+{
+	static char *function            = "libcpath_path_get_sanitized_character";
+	size_t safe_sanitized_path_index = 0;
+	char lower_nibble                = 0;
+	char upper_nibble                = 0;
 
-			goto on_error;
-		}
-	}
-	if( libcsplit_wide_string_split(
-	     &( path[ path_directory_name_index ] ),
-	     path_length - path_directory_name_index + 1,
-	     (wchar_t) '\\',
-	     &path_split_string,
-	     error ) != 1 )
+	if( ( sanitized_character_size != 1 )
+	 && ( sanitized_character_size != 2 )
+	 && ( sanitized_character_size != 4 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized character size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	/* The size of the full path consists of:
-	 * the size of the prefix (\\?\ or \\.\)
-	 * the length of the volume name
-	 * a directory separator
-	 */
-	safe_full_path_size = 4;
-
-	/* If the path contains a volume name
-	 * the length of the volume name
-	 * a directory separator
-	 */
-	if( volume_name != NULL )
+	if( sanitized_path == NULL )
 	{
-		safe_full_path_size += volume_name_length + 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path.",
+		 function );
+
+		return( -1 );
 	}
-	/* If the path contains an UNC path
-	 * add the size of the UNC\ prefix
-	 */
-	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
-	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	if( sanitized_path_size > (size_t) SSIZE_MAX )
 	{
-		safe_full_path_size += 4;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
 	}
-	/* If the path is relative
-	 * add the size of the current working directory
-	 * a directory separator, if necessary
-	 */
-	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
-	 && ( current_directory_name_index < current_directory_size ) )
+	if( sanitized_path_index == NULL )
 	{
-		safe_full_path_size += ( current_directory_size - ( current_directory_name_index + 1 ) );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path index.",
+		 function );
 
-		if( ( current_directory_size >= 2 )
-		 && ( current_directory[ current_directory_size - 2 ] != (wchar_t) '\\' ) )
-		{
-			safe_full_path_size += 1;
-		}
+		return( -1 );
 	}
-	if( current_directory_split_string != NULL )
+	safe_sanitized_path_index = *sanitized_path_index;
+
+	if( safe_sanitized_path_index > sanitized_path_size )
 	{
-		if( libcsplit_wide_split_string_get_number_of_segments(
-		     current_directory_split_string,
-		     &current_directory_number_of_segments,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of current working directory string segments.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized path index value out of bounds.",
+		 function );
 
-			goto on_error;
-		}
-		current_directory_segment_index = current_directory_number_of_segments - 1;
+		return( -1 );
 	}
-	if( libcsplit_wide_split_string_get_number_of_segments(
-	     path_split_string,
-	     &path_number_of_segments,
-	     error ) != 1 )
+	if( ( sanitized_character_size > sanitized_path_size )
+	 || ( safe_sanitized_path_index > ( sanitized_path_size - sanitized_character_size ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of path string segments.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid sanitized path size value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( path_segment_index = 0;
-	     path_segment_index < path_number_of_segments;
-	     path_segment_index++ )
+	if( sanitized_character_size == 1 )
 	{
-		if( libcsplit_wide_split_string_get_segment_by_index(
-		     path_split_string,
-		     path_segment_index,
-		     &path_string_segment,
-		     &path_string_segment_size,
-		     error ) != 1 )
+		sanitized_path[ safe_sanitized_path_index++ ] = character;
+	}
+	else if( sanitized_character_size == 2 )
+	{
+		sanitized_path[ safe_sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+		sanitized_path[ safe_sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+	}
+	else if( sanitized_character_size == 4 )
+	{
+		lower_nibble = character & 0x0f;
+		upper_nibble = ( character >> 4 ) & 0x0f;
+
+		if( lower_nibble > 10 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve path string segment: %d.",
-			 function,
-			 path_segment_index );
-
-			goto on_error;
+			lower_nibble += 'a' - 10;
 		}
-		if( path_string_segment == NULL )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing path string segment: %d.",
-			 function,
-			 path_segment_index );
-
-			goto on_error;
+			lower_nibble += '0';
 		}
-		/* If the path is .. reverse the current path by one directory
-		 */
-		if( ( path_string_segment_size == 3 )
-		 && ( path_string_segment[ 0 ] == (wchar_t) '.' )
-		 && ( path_string_segment[ 1 ] == (wchar_t) '.' ) )
+		if( upper_nibble > 10 )
 		{
-			if( ( current_directory_split_string != NULL )
-			 && ( last_used_path_segment_index == -1 ) )
-			{
-				if( libcsplit_wide_split_string_get_segment_by_index(
-				     current_directory_split_string,
-				     current_directory_segment_index,
-				     &current_directory_string_segment,
-				     &current_directory_string_segment_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
+			upper_nibble += 'a' - 10;
+		}
+		else
+		{
+			upper_nibble += '0';
+		}
+		sanitized_path[ safe_sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+		sanitized_path[ safe_sanitized_path_index++ ] = 'x';
+		sanitized_path[ safe_sanitized_path_index++ ] = upper_nibble;
+		sanitized_path[ safe_sanitized_path_index++ ] = lower_nibble;
+	}
+	*sanitized_path_index = safe_sanitized_path_index;
 
-					goto on_error;
-				}
-				if( current_directory_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
+	return( 1 );
+}
 
-					goto on_error;
-				}
-				/* Remove the size of the parent directory name and a directory separator
-				 * Note that the size includes the end of string character
-				 */
-				safe_full_path_size -= current_directory_string_segment_size;
+/* Retrieves a sanitized version of the filename into a buffer
+ * If the sanitized filename does not fit in the buffer the required size
+ * is returned and the buffer contents are undefined
+ * Returns 1 if successful, 0 if the sanitized filename size is too small or -1 on error
+ */
+int libcpath_path_get_sanitized_filename_to_buffer(
+     const char *filename,
+     size_t filename_length,
+     char *sanitized_filename,
+     size_t sanitized_filename_size,
+     size_t *required_sanitized_filename_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcpath_path_get_sanitized_filename_to_buffer";
+	size_t filename_index               = 0;
+	size_t run_length                   = 0;
+	size_t sanitized_character_size     = 0;
+	size_t safe_sanitized_filename_size = 0;
+	size_t sanitized_filename_index     = 0;
+	size_t unescaped_length             = 0;
 
-				if( libcsplit_wide_split_string_set_segment_by_index(
-				     current_directory_split_string,
-				     current_directory_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
 
-					goto on_error;
-				}
-				current_directory_segment_index--;
-			}
-			else if( last_used_path_segment_index >= 0 )
-			{
-				if( libcsplit_wide_split_string_get_segment_by_index(
-				     path_split_string,
-				     last_used_path_segment_index,
-				     &last_used_path_string_segment,
-				     &last_used_path_string_segment_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve last used path string segment: %d.",
-					 function,
-					 last_used_path_segment_index );
+		return( -1 );
+	}
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid filename length is zero.",
+		 function );
 
-					goto on_error;
-				}
-				if( last_used_path_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing last used path string string segment: %d.",
-					 function,
-					 last_used_path_segment_index );
+		return( -1 );
+	}
+	if( filename_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
 
-					goto on_error;
-				}
-				/* Remove the size of the parent directory name and a directory separator
-				 * Note that the size includes the end of string character
-				 */
-				safe_full_path_size -= last_used_path_string_segment_size;
+		return( -1 );
+	}
+	if( ( sanitized_filename == NULL )
+	 && ( sanitized_filename_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename.",
+		 function );
 
-				if( libcsplit_wide_split_string_set_segment_by_index(
-				     path_split_string,
-				     last_used_path_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
+		return( -1 );
+	}
+	if( sanitized_filename_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized filename size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_sanitized_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required sanitized filename size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_sanitized_filename_size = 1;
+
+	/* The sanitized characters are written while they fit in the buffer
+	 * the size of the remaining characters is still determined
+	 */
+	while( filename_index < filename_length )
+	{
+		if( filename[ filename_index ] == LIBCPATH_SEPARATOR )
+		{
+			sanitized_character_size = 4;
+		}
+		else
+		{
+			sanitized_character_size = libcpath_sanitize_character_sizes[ (uint8_t) filename[ filename_index ] ];
+		}
+		if( ( sanitized_character_size == 1 )
+		 && ( run_length >= LIBCPATH_SANITIZE_MINIMUM_RUN_LENGTH ) )
+		{
+			/* Once a run of characters that do not need to be escaped is long enough
+			 * the rest of the run is classified vectorized and copied in bulk
+			 */
+			if( libcpath_sanitize_get_unescaped_length(
+			     &( filename[ filename_index ] ),
+			     filename_length - filename_index,
+			     (char) LIBCPATH_SEPARATOR,
+			     &unescaped_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine unescaped length.",
+				 function );
+
+				return( -1 );
+			}
+			safe_sanitized_filename_size += unescaped_length;
+
+			if( safe_sanitized_filename_size <= sanitized_filename_size )
+			{
+				if( memory_copy(
+				     &( sanitized_filename[ sanitized_filename_index ] ),
+				     &( filename[ filename_index ] ),
+				     unescaped_length ) == NULL )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path string segment: %d.",
-					 function,
-					 last_used_path_segment_index );
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy unescaped characters.",
+					 function );
 
-					goto on_error;
+					return( -1 );
 				}
-				/* Find the previous path split value that contains a name
-				 */
-				while( last_used_path_segment_index > 0 )
-				{
-					last_used_path_segment_index--;
+				sanitized_filename_index += unescaped_length;
+			}
+			filename_index += unescaped_length;
+			run_length = 0;
 
-					if( libcsplit_wide_split_string_get_segment_by_index(
-					     path_split_string,
-					     last_used_path_segment_index,
-					     &last_used_path_string_segment,
-					     &last_used_path_string_segment_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve last used path string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
+			continue;
+		}
+		safe_sanitized_filename_size += sanitized_character_size;
 
-						goto on_error;
-					}
-					if( last_used_path_string_segment_size != 0 )
-					{
-						break;
-					}
-				}
+		if( safe_sanitized_filename_size <= sanitized_filename_size )
+		{
+			if( sanitized_character_size == 1 )
+			{
+				sanitized_filename[ sanitized_filename_index++ ] = filename[ filename_index ];
 			}
-			if( libcsplit_wide_split_string_set_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     NULL,
-			     0,
-			     error ) != 1 )
+			else if( sanitized_character_size == 2 )
+			{
+				sanitized_filename[ sanitized_filename_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+				sanitized_filename[ sanitized_filename_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+			}
+			else if( libcpath_path_get_sanitized_character(
+			          filename[ filename_index ],
+			          sanitized_character_size,
+			          sanitized_filename,
+			          sanitized_filename_size,
+			          &sanitized_filename_index,
+			          error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path string segment: %d.",
-				 function,
-				 path_segment_index );
+				 "%s: unable to set sanitized character.",
+				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 		}
-		/* If the path is . ignore the entry
-		 */
-		else if( ( path_string_segment_size == 2 )
-		      && ( path_string_segment[ 0 ] == (wchar_t) '.' ) )
+		if( sanitized_character_size == 1 )
 		{
-			if( libcsplit_wide_split_string_set_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     NULL,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path string segment: %d.",
-				 function,
-				 path_segment_index );
-
-				goto on_error;
-			}
-		}
-		/* If the path is empty ignore the entry
-		 */
-		else if( path_string_segment_size <= 1 )
-		{
-			if( libcsplit_wide_split_string_set_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     NULL,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path string segment: %d.",
-				 function,
-				 path_segment_index );
-
-				goto on_error;
-			}
+			run_length++;
 		}
 		else
 		{
-			/* Add the size of the directory or file name and a directory separator
-			 * Note that the size includes the end of string character
-			 */
-			safe_full_path_size += path_string_segment_size;
-
-			last_used_path_segment_index = path_segment_index;
+			run_length = 0;
 		}
+		filename_index++;
 	}
-	/* Note that the last path separator serves as the end of string
-	 */
-	full_path_index = 0;
-
-	*full_path = wide_string_allocate(
-	              safe_full_path_size );
-
-	if( *full_path == NULL )
+	if( safe_sanitized_filename_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized filename size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     *full_path,
-	     0,
-	     sizeof( wchar_t ) * safe_full_path_size ) == NULL )
+	*required_sanitized_filename_size = safe_sanitized_filename_size;
+
+	if( safe_sanitized_filename_size > sanitized_filename_size )
+	{
+		return( 0 );
+	}
+	sanitized_filename[ sanitized_filename_index ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of the filename
+ * The sanitized filename is allocated from the arena and remains valid until the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_filename_arena(
+     libcpath_arena_t *arena,
+     const char *filename,
+     size_t filename_length,
+     char **sanitized_filename,
+     size_t *sanitized_filename_size,
+     libcerror_error_t **error )
+{
+	void *data                          = NULL;
+	static char *function               = "libcpath_path_get_sanitized_filename_arena";
+	size_t data_size                    = 0;
+	size_t safe_sanitized_filename_size = 0;
+	int result                          = 0;
+
+	if( sanitized_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	*full_path_size = safe_full_path_size;
-
-	if( path_type == LIBCPATH_TYPE_DEVICE )
+	if( sanitized_filename_size == NULL )
 	{
-		full_path_prefix        = L"\\\\.\\";
-		full_path_prefix_length = 4;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename size.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	/* The sanitized filename is written into the data available in the arena
+	 * and only if it does not fit, data of the required size is allocated
+	 */
+	if( libcpath_arena_get_available_data(
+	     arena,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
 	{
-		full_path_prefix        = L"\\\\?\\";
-		full_path_prefix_length = 4;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve available data from arena.",
+		 function );
+
+		return( -1 );
 	}
-	if( wide_string_copy(
-	     &( ( *full_path )[ full_path_index ] ),
-	     full_path_prefix,
-	     full_path_prefix_length ) == NULL )
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          filename,
+	          filename_length,
+	          (char *) data,
+	          data_size / sizeof( char ),
+	          &safe_sanitized_filename_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set prefix in full path.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized filename.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	full_path_index += full_path_prefix_length;
-
-	/* If there is a share name the path is an UNC path
-	 */
-	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
-	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	if( libcpath_arena_allocate(
+	     arena,
+	     sizeof( char ) * safe_sanitized_filename_size,
+	     &data,
+	     error ) != 1 )
 	{
-		if( wide_string_copy(
-		     &( ( *full_path )[ full_path_index ] ),
-		     L"UNC\\",
-		     4 ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set UNC\\ prefix in full path.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to allocate sanitized filename from arena.",
+		 function );
 
-			goto on_error;
-		}
-		full_path_index += 4;
+		return( -1 );
 	}
-	if( volume_name != NULL )
+	if( result == 0 )
 	{
-		if( wide_string_copy(
-		     &( ( *full_path )[ full_path_index ] ),
-		     volume_name,
-		     volume_name_length ) == NULL )
+		result = libcpath_path_get_sanitized_filename_to_buffer(
+		          filename,
+		          filename_length,
+		          (char *) data,
+		          safe_sanitized_filename_size,
+		          &safe_sanitized_filename_size,
+		          error );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set volume name in full path.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sanitized filename.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		full_path_index += volume_name_length;
-
-		( *full_path )[ full_path_index ] = (wchar_t) '\\';
-
-		full_path_index += 1;
 	}
-	/* If the path is relative
-	 * add the current working directory elements
-	 */
-	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
-	 && ( current_directory_split_string != NULL ) )
-	{
-		for( current_directory_segment_index = 0;
-		     current_directory_segment_index < current_directory_number_of_segments;
-		     current_directory_segment_index++ )
-		{
-			if( libcsplit_wide_split_string_get_segment_by_index(
-			     current_directory_split_string,
-			     current_directory_segment_index,
-			     &current_directory_string_segment,
-			     &current_directory_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve current working directory string segment: %d.",
-				 function,
-				 current_directory_segment_index );
-
-				goto on_error;
-			}
-			if( current_directory_string_segment_size != 0 )
-			{
-				if( current_directory_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
+	*sanitized_filename      = (char *) data;
+	*sanitized_filename_size = safe_sanitized_filename_size;
 
-					goto on_error;
-				}
-				if( wide_string_copy(
-				     &( ( *full_path )[ full_path_index ] ),
-				     current_directory_string_segment,
-				     current_directory_string_segment_size - 1 ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set current working directory split value: %d in full path.",
-					 function,
-					 current_directory_segment_index );
+	return( 1 );
+}
 
-					goto on_error;
-				}
-				full_path_index += current_directory_string_segment_size - 1;
+/* Retrieves a sanitized version of the filename
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_filename(
+     const char *filename,
+     size_t filename_length,
+     char **sanitized_filename,
+     size_t *sanitized_filename_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcpath_path_get_sanitized_filename";
+	char *safe_sanitized_filename       = NULL;
+	size_t safe_sanitized_filename_size = 0;
 
-				( *full_path )[ full_path_index ] = (wchar_t) '\\';
+	if( sanitized_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename.",
+		 function );
 
-				full_path_index += 1;
-			}
-		}
+		return( -1 );
 	}
-	for( path_segment_index = 0;
-	     path_segment_index < path_number_of_segments;
-	     path_segment_index++ )
+	if( *sanitized_filename != NULL )
 	{
-		if( libcsplit_wide_split_string_get_segment_by_index(
-		     path_split_string,
-		     path_segment_index,
-		     &path_string_segment,
-		     &path_string_segment_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve path string segment: %d.",
-			 function,
-			 path_segment_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sanitized filename value already set.",
+		 function );
 
-			goto on_error;
-		}
-		if( path_string_segment_size != 0 )
-		{
-			if( path_string_segment == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing path string segment: %d.",
-				 function,
-				 path_segment_index );
+		return( -1 );
+	}
+	if( sanitized_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename size.",
+		 function );
 
-				goto on_error;
-			}
-			if( wide_string_copy(
-			     &( ( *full_path )[ full_path_index ] ),
-			     path_string_segment,
-			     path_string_segment_size - 1 ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path split value: %d in full path.",
-				 function,
-				 path_segment_index );
+		return( -1 );
+	}
+	if( filename_length > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
 
-				goto on_error;
-			}
-			full_path_index += path_string_segment_size - 1;
+		return( -1 );
+	}
+	/* A sanitized character consists of at most 4 characters, hence the sanitized
+	 * filename is allocated with its upper bound size and written in a single pass
+	 */
+	safe_sanitized_filename_size = ( filename_length * 4 ) + 1;
 
-			( *full_path )[ full_path_index ] = (wchar_t) '\\';
+	safe_sanitized_filename = libcpath_allocator_allocate_narrow_string(
+	                           safe_sanitized_filename_size );
 
-			full_path_index += 1;
-		}
-	}
-	( *full_path )[ full_path_index - 1 ] = 0;
+	if( safe_sanitized_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sanitized filename.",
+		 function );
 
-	if( libcsplit_wide_split_string_free(
-	     &path_split_string,
+		goto on_error;
+	}
+	if( libcpath_path_get_sanitized_filename_to_buffer(
+	     filename,
+	     filename_length,
+	     safe_sanitized_filename,
+	     safe_sanitized_filename_size,
+	     &safe_sanitized_filename_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free path split string.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sanitized filename.",
 		 function );
 
 		goto on_error;
 	}
-	if( current_directory_split_string != NULL )
-	{
-		if( libcsplit_wide_split_string_free(
-		     &current_directory_split_string,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free current working directory split string.",
-			 function );
+	*sanitized_filename      = safe_sanitized_filename;
+	*sanitized_filename_size = safe_sanitized_filename_size;
 
-			goto on_error;
-		}
-	}
-	if( current_directory != NULL )
-	{
-		memory_free(
-		 current_directory );
-	}
 	return( 1 );
 
 on_error:
-	if( *full_path != NULL )
-	{
-		memory_free(
-		 *full_path );
-
-		*full_path = NULL;
-	}
-	*full_path_size = 0;
-
-	if( path_split_string != NULL )
-	{
-		libcsplit_wide_split_string_free(
-		 &path_split_string,
-		 NULL );
-	}
-	if( current_directory_split_string != NULL )
-	{
-		libcsplit_wide_split_string_free(
-		 &current_directory_split_string,
-		 NULL );
-	}
-	if( current_directory != NULL )
+	if( safe_sanitized_filename != NULL )
 	{
-		memory_free(
-		 current_directory );
+		libcpath_allocator_free(
+		 safe_sanitized_filename );
 	}
 	return( -1 );
 }
 
-#else
-
-/* Determines the full path of the POSIX path specified
- * Multiple successive / are combined into one
- *
- * Scenarios:
- * /home/user/file.txt
- * /home/user//file.txt
- * /home/user/../user/file.txt
- * /../home/user/file.txt
- * user/../user/file.txt
- *
- * Returns 1 if succesful or -1 on error
+/* Retrieves a sanitized version of the path into a buffer
+ * If the sanitized path does not fit in the buffer the required size
+ * is returned and the buffer contents are undefined
+ * Returns 1 if successful, 0 if the sanitized path size is too small or -1 on error
  */
-int libcpath_path_get_full_path_wide(
-     const wchar_t *path,
+int libcpath_path_get_sanitized_path_to_buffer(
+     const char *path,
      size_t path_length,
-     wchar_t **full_path,
-     size_t *full_path_size,
+     char *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *required_sanitized_path_size,
      libcerror_error_t **error )
 {
-	libcsplit_wide_split_string_t *current_directory_split_string = NULL;
-	libcsplit_wide_split_string_t *path_split_string              = NULL;
-	wchar_t *current_directory                                    = NULL;
-	wchar_t *current_directory_string_segment                     = NULL;
-	wchar_t *last_used_path_string_segment                        = NULL;
-	wchar_t *path_string_segment                                  = NULL;
-	static char *function                                         = "libcpath_path_get_full_path_wide";
-	size_t current_directory_length                               = 0;
-	size_t current_directory_size                                 = 0;
-	size_t current_directory_string_segment_size                  = 0;
-	size_t full_path_index                                        = 0;
-	size_t last_used_path_string_segment_size                     = 0;
-	size_t path_string_segment_size                               = 0;
-	size_t safe_full_path_size                                    = 0;
-	uint8_t path_type                                             = LIBCPATH_TYPE_RELATIVE;
-	int current_directory_number_of_segments                      = 0;
-	int current_directory_segment_index                           = 0;
-	int last_used_path_segment_index                              = -1;
-	int path_number_of_segments                                   = 0;
-	int path_segment_index                                        = 0;
+	static char *function                    = "libcpath_path_get_sanitized_path_to_buffer";
+	size_t path_index                        = 0;
+	size_t run_length                        = 0;
+	size_t safe_sanitized_path_size          = 0;
+	size_t sanitized_character_size          = 0;
+	size_t sanitized_path_index              = 0;
+	size_t unescaped_length                  = 0;
+
+#if defined( WINAPI )
+	size_t last_path_segment_seperator_index = 0;
+#endif
 
 	if( path == NULL )
 	{
@@ -5612,1043 +6144,10819 @@ int libcpath_path_get_full_path_wide(
 
 		return( -1 );
 	}
-	if( full_path == NULL )
+	if( ( sanitized_path == NULL )
+	 && ( sanitized_path_size != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path.",
+		 "%s: invalid sanitized path.",
 		 function );
 
 		return( -1 );
 	}
-	if( *full_path != NULL )
+	if( sanitized_path_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid full path value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( full_path_size == NULL )
+	if( required_sanitized_path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path size.",
+		 "%s: invalid required sanitized path size.",
 		 function );
 
 		return( -1 );
 	}
-	if( path[ 0 ] == (wchar_t) '/' )
-	{
-		path_type = LIBCPATH_TYPE_ABSOLUTE;
-	}
-	else
-	{
-		if( libcpath_path_get_current_working_directory_wide(
-		     &current_directory,
-		     &current_directory_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve current working directory.",
-			 function );
+	safe_sanitized_path_size = 1;
 
-			goto on_error;
-		}
-	}
-	if( current_directory != NULL )
+	/* The sanitized characters are written while they fit in the buffer
+	 * the size of the remaining characters is still determined
+	 */
+	while( path_index < path_length )
 	{
-		current_directory_length = wide_string_length(
-		                            current_directory );
+		sanitized_character_size = libcpath_sanitize_character_sizes[ (uint8_t) path[ path_index ] ];
 
-		if( libcsplit_wide_string_split(
-		     current_directory,
-		     current_directory_length + 1,
-		     (wchar_t) '/',
-		     &current_directory_split_string,
-		     error ) != 1 )
+		if( ( sanitized_character_size == 1 )
+		 && ( run_length >= LIBCPATH_SANITIZE_MINIMUM_RUN_LENGTH ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to split current working directory.",
-			 function );
+			/* Once a run of characters that do not need to be escaped is long enough
+			 * the rest of the run is classified vectorized and copied in bulk
+			 */
+			if( libcpath_sanitize_get_unescaped_length(
+			     &( path[ path_index ] ),
+			     path_length - path_index,
+			     0,
+			     &unescaped_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine unescaped length.",
+				 function );
 
-			goto on_error;
-		}
-	}
-	if( libcsplit_wide_string_split(
-	     path,
-	     path_length + 1,
-	     (wchar_t) '/',
-	     &path_split_string,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split path.",
-		 function );
+				return( -1 );
+			}
+			safe_sanitized_path_size += unescaped_length;
 
-		goto on_error;
-	}
-	/* Determine the full path size
-	 */
-	/* If the path is absolute
-	 * a directory separator
-	 */
-	if( path_type == LIBCPATH_TYPE_ABSOLUTE )
-	{
-		safe_full_path_size = 1;
-	}
-	/* If the path is relative
-	 * add the size of the current working directory
-	 * a directory separator, if necessary
-	 */
-	else if( path_type == LIBCPATH_TYPE_RELATIVE )
-	{
-		if( current_directory == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing current working directory.",
-			 function );
+			if( safe_sanitized_path_size <= sanitized_path_size )
+			{
+				if( memory_copy(
+				     &( sanitized_path[ sanitized_path_index ] ),
+				     &( path[ path_index ] ),
+				     unescaped_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy unescaped characters.",
+					 function );
 
-			goto on_error;
+					return( -1 );
+				}
+				sanitized_path_index += unescaped_length;
+			}
+			path_index += unescaped_length;
+			run_length = 0;
+
+			continue;
 		}
-		/* We need to use the length here since current_directory_size will be PATH_MAX
-		 */
-		safe_full_path_size = current_directory_length;
+		safe_sanitized_path_size += sanitized_character_size;
+
+		if( safe_sanitized_path_size <= sanitized_path_size )
+		{
+			if( sanitized_character_size == 1 )
+			{
+				sanitized_path[ sanitized_path_index++ ] = path[ path_index ];
+			}
+			else if( sanitized_character_size == 2 )
+			{
+				sanitized_path[ sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+				sanitized_path[ sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+			}
+			else if( libcpath_path_get_sanitized_character(
+			          path[ path_index ],
+			          sanitized_character_size,
+			          sanitized_path,
+			          sanitized_path_size,
+			          &sanitized_path_index,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set sanitized character.",
+				 function );
 
-		if( ( current_directory_length >= 1 )
-		 && ( current_directory[ current_directory_length - 1 ] != (wchar_t) '/' ) )
+				return( -1 );
+			}
+		}
+		if( sanitized_character_size == 1 )
+		{
+			run_length++;
+		}
+		else
 		{
-			safe_full_path_size++;
+			run_length = 0;
 		}
+		path_index++;
 	}
-	if( current_directory_split_string != NULL )
+#if defined( WINAPI )
+	for( path_index = path_length;
+	     path_index > 0;
+	     path_index-- )
 	{
-		if( libcsplit_wide_split_string_get_number_of_segments(
-		     current_directory_split_string,
-		     &current_directory_number_of_segments,
-		     error ) != 1 )
+		if( path[ path_index - 1 ] == LIBCPATH_SEPARATOR )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of current working directory string segments.",
-			 function );
+			last_path_segment_seperator_index = path_index - 1;
 
-			goto on_error;
+			break;
 		}
-		current_directory_segment_index = current_directory_number_of_segments - 1;
 	}
-	if( libcsplit_wide_split_string_get_number_of_segments(
-	     path_split_string,
-	     &path_number_of_segments,
+#endif
+	if( safe_sanitized_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( last_path_segment_seperator_index > 32767 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: last path segment separator value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_sanitized_path_size > 32767 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*required_sanitized_path_size = safe_sanitized_path_size;
+
+	if( safe_sanitized_path_size > sanitized_path_size )
+	{
+		return( 0 );
+	}
+	sanitized_path[ sanitized_path_index ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of the path
+ * The sanitized path is allocated from the arena and remains valid until the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_path_arena(
+     libcpath_arena_t *arena,
+     const char *path,
+     size_t path_length,
+     char **sanitized_path,
+     size_t *sanitized_path_size,
+     libcerror_error_t **error )
+{
+	void *data                      = NULL;
+	static char *function           = "libcpath_path_get_sanitized_path_arena";
+	size_t data_size                = 0;
+	size_t safe_sanitized_path_size = 0;
+	int result                      = 0;
+
+	if( sanitized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sanitized path is written into the data available in the arena
+	 * and only if it does not fit, data of the required size is allocated
+	 */
+	if( libcpath_arena_get_available_data(
+	     arena,
+	     &data,
+	     &data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of path string segments.",
+		 "%s: unable to retrieve available data from arena.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( path_segment_index = 0;
-	     path_segment_index < path_number_of_segments;
-	     path_segment_index++ )
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          path,
+	          path_length,
+	          (char *) data,
+	          data_size / sizeof( char ),
+	          &safe_sanitized_path_size,
+	          error );
+
+	if( result == -1 )
 	{
-		if( libcsplit_wide_split_string_get_segment_by_index(
-		     path_split_string,
-		     path_segment_index,
-		     &path_string_segment,
-		     &path_string_segment_size,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_arena_allocate(
+	     arena,
+	     sizeof( char ) * safe_sanitized_path_size,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to allocate sanitized path from arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		result = libcpath_path_get_sanitized_path_to_buffer(
+		          path,
+		          path_length,
+		          (char *) data,
+		          safe_sanitized_path_size,
+		          &safe_sanitized_path_size,
+		          error );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve path string segment: %d.",
-			 function,
-			 path_segment_index );
+			 "%s: unable to determine sanitized path.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( path_string_segment == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing path string segment: %d.",
-			 function,
-			 path_segment_index );
+	}
+	*sanitized_path      = (char *) data;
+	*sanitized_path_size = safe_sanitized_path_size;
 
-			goto on_error;
-		}
-		/* If the path is .. reverse the current path by one directory
-		 */
-		if( ( path_string_segment_size == 3 )
-		 && ( path_string_segment[ 0 ] == (wchar_t) '.' )
-		 && ( path_string_segment[ 1 ] == (wchar_t) '.' ) )
-		{
-			if( ( current_directory_split_string != NULL )
-			 && ( last_used_path_segment_index == -1 ) )
-			{
-				if( libcsplit_wide_split_string_get_segment_by_index(
-				     current_directory_split_string,
-				     current_directory_segment_index,
-				     &current_directory_string_segment,
-				     &current_directory_string_segment_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
+	return( 1 );
+}
 
-					goto on_error;
-				}
-				if( current_directory_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
+/* Retrieves a sanitized version of the path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_path(
+     const char *path,
+     size_t path_length,
+     char **sanitized_path,
+     size_t *sanitized_path_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libcpath_path_get_sanitized_path";
+	char *safe_sanitized_path       = NULL;
+	size_t safe_sanitized_path_size = 0;
 
-					goto on_error;
-				}
-				/* Remove the size of the parent directory name and a directory separator
-				 * Note that the size includes the end of string character
-				 */
-				safe_full_path_size -= current_directory_string_segment_size;
+	if( sanitized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path.",
+		 function );
 
-				if( libcsplit_wide_split_string_set_segment_by_index(
-				     current_directory_split_string,
-				     current_directory_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
+		return( -1 );
+	}
+	if( *sanitized_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sanitized path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* A sanitized character consists of at most 4 characters, hence the sanitized
+	 * path is allocated with its upper bound size and written in a single pass
+	 */
+	safe_sanitized_path_size = ( path_length * 4 ) + 1;
+
+	safe_sanitized_path = libcpath_allocator_allocate_narrow_string(
+	                       safe_sanitized_path_size );
+
+	if( safe_sanitized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sanitized path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_get_sanitized_path_to_buffer(
+	     path,
+	     path_length,
+	     safe_sanitized_path,
+	     safe_sanitized_path_size,
+	     &safe_sanitized_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sanitized path.",
+		 function );
+
+		goto on_error;
+	}
+	*sanitized_path      = safe_sanitized_path;
+	*sanitized_path_size = safe_sanitized_path_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_sanitized_path != NULL )
+	{
+		libcpath_allocator_free(
+		 safe_sanitized_path );
+	}
+	return( -1 );
+}
+
+/* Combines the directory name and filename into a path in a buffer
+ * Returns 1 if successful, 0 if the path size is too small or -1 on error
+ */
+int libcpath_path_join_to_buffer(
+     char *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_join_to_buffer";
+	size_t filename_index = 0;
+	size_t path_index     = 0;
+	size_t safe_path_size = 0;
+
+	if( ( path == NULL )
+	 && ( path_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+/* TODO strip other patterns like /./ */
+	while( directory_name_length > 0 )
+	{
+		if( directory_name[ directory_name_length - 1 ] != (char) LIBCPATH_SEPARATOR )
+		{
+			break;
+		}
+		directory_name_length--;
+	}
+	while( filename_length > 0 )
+	{
+		if( filename[ filename_index ] != (char) LIBCPATH_SEPARATOR )
+		{
+			break;
+		}
+		filename_index++;
+		filename_length--;
+	}
+	safe_path_size = directory_name_length + filename_length + 2;
+
+	*required_path_size = safe_path_size;
+
+	if( safe_path_size > path_size )
+	{
+		return( 0 );
+	}
+	if( narrow_string_copy(
+	     path,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name to path.",
+		 function );
+
+		return( -1 );
+	}
+	path_index = directory_name_length;
+
+	path[ path_index++ ] = (char) LIBCPATH_SEPARATOR;
+
+	if( narrow_string_copy(
+	     &( path[ path_index ] ),
+	     &( filename[ filename_index ] ),
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename to path.",
+		 function );
+
+		return( -1 );
+	}
+	path_index += filename_length;
+
+	path[ path_index ] = 0;
+
+	return( 1 );
+}
+
+/* Combines the directory name and filename into a path
+ * The path is allocated from the arena and remains valid until the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_join_arena(
+     libcpath_arena_t *arena,
+     char **path,
+     size_t *path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	void *data            = NULL;
+	static char *function = "libcpath_path_join_arena";
+	size_t data_size      = 0;
+	size_t safe_path_size = 0;
+	int result            = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The path is written into the data available in the arena
+	 * and only if it does not fit, data of the required size is allocated
+	 */
+	if( libcpath_arena_get_available_data(
+	     arena,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve available data from arena.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcpath_path_join_to_buffer(
+	          (char *) data,
+	          data_size / sizeof( char ),
+	          &safe_path_size,
+	          directory_name,
+	          directory_name_length,
+	          filename,
+	          filename_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_arena_allocate(
+	     arena,
+	     sizeof( char ) * safe_path_size,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to allocate path from arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		result = libcpath_path_join_to_buffer(
+		          (char *) data,
+		          safe_path_size,
+		          &safe_path_size,
+		          directory_name,
+		          directory_name_length,
+		          filename,
+		          filename_length,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*path      = (char *) data;
+	*path_size = safe_path_size;
+
+	return( 1 );
+}
+
+/* Combines the directory name and filename into a path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_join(
+     char **path,
+     size_t *path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_join";
+	size_t safe_path_size = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_join_to_buffer(
+	     NULL,
+	     0,
+	     &safe_path_size,
+	     directory_name,
+	     directory_name_length,
+	     filename,
+	     filename_length,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path size.",
+		 function );
+
+		goto on_error;
+	}
+	*path = libcpath_allocator_allocate_narrow_string(
+	         safe_path_size );
+
+	if( *path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_join_to_buffer(
+	     *path,
+	     safe_path_size,
+	     &safe_path_size,
+	     directory_name,
+	     directory_name_length,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path.",
+		 function );
+
+		goto on_error;
+	}
+	*path_size = safe_path_size;
+
+	return( 1 );
+
+on_error:
+	if( *path != NULL )
+	{
+		libcpath_allocator_free(
+		 *path );
+
+		*path = NULL;
+	}
+	*path_size = 0;
+
+	return( -1 );
+}
+
+/* Combines multiple components into a path in a buffer
+ * The trailing separators of a component and the leading separators of the
+ * component that follows it are replaced by a single separator. Components,
+ * other than the first and the last, that are empty or consist of separators
+ * only are ignored. The last component is always preceded by a separator,
+ * hence the path equals that of libcpath_path_join applied to the components
+ * one by one, e.g. { "/", "" } results in "/" and { "a", "/" } in "a/"
+ * The size of the path is determined first and the path is written after that,
+ * hence every component is copied once regardless of the number of components
+ * Returns 1 if successful, 0 if the path size is too small or -1 on error
+ */
+int libcpath_path_join_components_to_buffer(
+     char *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const char **components,
+     const size_t *component_lengths,
+     int number_of_components,
+     libcerror_error_t **error )
+{
+	static char *function   = "libcpath_path_join_components_to_buffer";
+	size_t component_length = 0;
+	size_t path_index       = 0;
+	size_t safe_path_size   = 0;
+	size_t string_index     = 0;
+	int component_index     = 0;
+	int pass                = 0;
+
+	if( ( path == NULL )
+	 && ( path_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( components == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid components.",
+		 function );
+
+		return( -1 );
+	}
+	if( component_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid component lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_components <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of components value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first pass determines the size of the path
+	 * the second pass writes the path
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		path_index = 0;
+
+		for( component_index = 0;
+		     component_index < number_of_components;
+		     component_index++ )
+		{
+			if( pass == 0 )
+			{
+				if( components[ component_index ] == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+					 "%s: invalid component: %d.",
+					 function,
+					 component_index );
+
+					return( -1 );
+				}
+				if( component_lengths[ component_index ] > (size_t) SSIZE_MAX )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid component: %d length value exceeds maximum.",
+					 function,
+					 component_index );
+
+					return( -1 );
+				}
+			}
+			component_length = component_lengths[ component_index ];
+			string_index     = 0;
+
+			if( component_index > 0 )
+			{
+				while( ( string_index < component_length )
+				    && ( components[ component_index ][ string_index ] == (char) LIBCPATH_SEPARATOR ) )
+				{
+					string_index++;
+				}
+			}
+			if( component_index < ( number_of_components - 1 ) )
+			{
+				while( ( component_length > string_index )
+				    && ( components[ component_index ][ component_length - 1 ] == (char) LIBCPATH_SEPARATOR ) )
+				{
+					component_length--;
+				}
+			}
+			component_length -= string_index;
+
+			if( ( component_index > 0 )
+			 && ( component_index < ( number_of_components - 1 ) )
+			 && ( component_length == 0 ) )
+			{
+				continue;
+			}
+			if( ( pass == 0 )
+			 && ( ( component_length + 1 ) > ( (size_t) ( SSIZE_MAX - 1 ) - path_index ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid path size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			if( component_index > 0 )
+			{
+				if( pass == 1 )
+				{
+					path[ path_index ] = (char) LIBCPATH_SEPARATOR;
+				}
+				path_index++;
+			}
+			if( ( pass == 1 )
+			 && ( component_length > 0 ) )
+			{
+				if( narrow_string_copy(
+				     &( path[ path_index ] ),
+				     &( components[ component_index ][ string_index ] ),
+				     component_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy component: %d to path.",
+					 function,
+					 component_index );
+
+					return( -1 );
+				}
+			}
+			path_index += component_length;
+		}
+		if( pass == 0 )
+		{
+			safe_path_size = path_index + 1;
+
+			*required_path_size = safe_path_size;
+
+			if( safe_path_size > path_size )
+			{
+				return( 0 );
+			}
+		}
+	}
+	path[ path_index ] = 0;
+
+	return( 1 );
+}
+
+/* Combines multiple components into a path
+ * The components are combined as described by libcpath_path_join_components_to_buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_join_components(
+     char **path,
+     size_t *path_size,
+     const char **components,
+     const size_t *component_lengths,
+     int number_of_components,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_join_components";
+	size_t safe_path_size = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_join_components_to_buffer(
+	     NULL,
+	     0,
+	     &safe_path_size,
+	     components,
+	     component_lengths,
+	     number_of_components,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path size.",
+		 function );
+
+		goto on_error;
+	}
+	*path = libcpath_allocator_allocate_narrow_string(
+	         safe_path_size );
+
+	if( *path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_join_components_to_buffer(
+	     *path,
+	     safe_path_size,
+	     &safe_path_size,
+	     components,
+	     component_lengths,
+	     number_of_components,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path.",
+		 function );
+
+		goto on_error;
+	}
+	*path_size = safe_path_size;
+
+	return( 1 );
+
+on_error:
+	if( *path != NULL )
+	{
+		libcpath_allocator_free(
+		 *path );
+
+		*path = NULL;
+	}
+	*path_size = 0;
+
+	return( -1 );
+}
+
+/* Combines the directory name and a sanitized version of the filename into a path in a buffer
+ * The filename is sanitized as with libcpath_path_get_sanitized_filename while it is
+ * written after the directory name, hence separators in the filename are escaped
+ * If the path does not fit in the buffer the required size is returned and
+ * the buffer contents are undefined
+ * Returns 1 if successful, 0 if the path size is too small or -1 on error
+ */
+int libcpath_path_join_sanitized_to_buffer(
+     char *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	char *sanitized_filename       = NULL;
+	static char *function          = "libcpath_path_join_sanitized_to_buffer";
+	size_t sanitized_filename_size = 0;
+	size_t path_index              = 0;
+	int result                     = 0;
+
+	if( ( path == NULL )
+	 && ( path_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( directory_name_length > 0 )
+	{
+		if( directory_name[ directory_name_length - 1 ] != (char) LIBCPATH_SEPARATOR )
+		{
+			break;
+		}
+		directory_name_length--;
+	}
+	path_index = directory_name_length + 1;
+
+	/* The filename is sanitized directly into the buffer after the directory name
+	 */
+	if( path_size > path_index )
+	{
+		sanitized_filename      = &( path[ path_index ] );
+		sanitized_filename_size = path_size - path_index;
+	}
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          filename,
+	          filename_length,
+	          sanitized_filename,
+	          sanitized_filename_size,
+	          &sanitized_filename_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sanitize filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_filename_size > ( (size_t) SSIZE_MAX - path_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized filename size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*required_path_size = path_index + sanitized_filename_size;
+
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( directory_name_length > 0 )
+	{
+		if( narrow_string_copy(
+		     path,
+		     directory_name,
+		     directory_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy directory name to path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	path[ directory_name_length ] = (char) LIBCPATH_SEPARATOR;
+
+	return( 1 );
+}
+
+/* Combines the directory name and a sanitized version of the filename into a path
+ * The size of the path is determined first, hence the path is allocated with its
+ * exact size and the sanitized filename is written directly after the directory name
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_join_sanitized(
+     char **path,
+     size_t *path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_join_sanitized";
+	size_t safe_path_size = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_join_sanitized_to_buffer(
+	     NULL,
+	     0,
+	     &safe_path_size,
+	     directory_name,
+	     directory_name_length,
+	     filename,
+	     filename_length,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path size.",
+		 function );
+
+		goto on_error;
+	}
+	*path = libcpath_allocator_allocate_narrow_string(
+	         safe_path_size );
+
+	if( *path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_join_sanitized_to_buffer(
+	     *path,
+	     safe_path_size,
+	     &safe_path_size,
+	     directory_name,
+	     directory_name_length,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path.",
+		 function );
+
+		goto on_error;
+	}
+	*path_size = safe_path_size;
+
+	return( 1 );
+
+on_error:
+	if( *path != NULL )
+	{
+		libcpath_allocator_free(
+		 *path );
+
+		*path = NULL;
+	}
+	*path_size = 0;
+
+	return( -1 );
+}
+
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Cross Windows safe version of CreateDirectoryA
+ * Returns TRUE if successful or FALSE on error
+ */
+BOOL libcpath_CreateDirectoryA(
+      LPCSTR path,
+      SECURITY_ATTRIBUTES *security_attributes )
+{
+	FARPROC function       = NULL;
+	HMODULE library_handle = NULL;
+	BOOL result            = FALSE;
+
+	if( path == NULL )
+	{
+		return( 0 );
+	}
+	library_handle = LoadLibrary(
+	                  _SYSTEM_STRING( "kernel32.dll" ) );
+
+	if( library_handle == NULL )
+	{
+		return( 0 );
+	}
+	function = GetProcAddress(
+		    library_handle,
+		    (LPCSTR) "CreateDirectoryA" );
+
+	if( function != NULL )
+	{
+		result = function(
+			  path,
+			  security_attributes );
+	}
+	/* This call should be after using the function
+	 * in most cases kernel32.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle ) != TRUE )
+	{
+		libcpath_CloseHandle(
+		 library_handle );
+
+		return( 0 );
+	}
+	return( result );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+#if defined( WINAPI )
+
+/* Makes the directory
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * The status, if not NULL, is set on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory(
+     const char *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error )
+{
+	static char *function          = "libcpath_internal_path_make_directory";
+	DWORD error_code               = 0;
+
+#if ( WINVER > 0x0500 )
+	wchar_t *wide_directory_name   = NULL;
+	int wide_directory_name_size   = 0;
+#endif
+
+	if( directory_name == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+#if ( WINVER <= 0x0500 )
+	if( libcpath_CreateDirectoryA(
+	     directory_name,
+	     NULL ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 (uint32_t) error_code );
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 error_code,
+		 "%s: unable to make directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	/* The directory name is UTF-8 encoded, the size includes the end of string character
+	 */
+	wide_directory_name_size = MultiByteToWideChar(
+	                            CP_UTF8,
+	                            0,
+	                            directory_name,
+	                            -1,
+	                            NULL,
+	                            0 );
+
+	if( wide_directory_name_size == 0 )
+	{
+		error_code = GetLastError();
+
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 (uint32_t) error_code );
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 error_code,
+		 "%s: unable to determine wide directory name size.",
+		 function );
+
+		goto on_error;
+	}
+	wide_directory_name = libcpath_allocator_allocate_wide_string(
+	                       (size_t) wide_directory_name_size );
+
+	if( wide_directory_name == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create wide directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( MultiByteToWideChar(
+	     CP_UTF8,
+	     0,
+	     directory_name,
+	     -1,
+	     wide_directory_name,
+	     wide_directory_name_size ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 (uint32_t) error_code );
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 error_code,
+		 "%s: unable to set wide directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( CreateDirectoryW(
+	     wide_directory_name,
+	     NULL ) == 0 )
+	{
+		/* The error code is retrieved before any other function is called
+		 * that could overwrite it
+		 */
+		error_code = GetLastError();
+
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 (uint32_t) error_code );
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 error_code,
+		 "%s: unable to make directory.",
+		 function );
+
+		goto on_error;
+	}
+	libcpath_allocator_free(
+	 wide_directory_name );
+
+	return( 1 );
+
+on_error:
+	if( wide_directory_name != NULL )
+	{
+		libcpath_allocator_free(
+		 wide_directory_name );
+	}
+	return( -1 );
+#endif /* ( WINVER <= 0x0500 ) */
+}
+
+#elif defined( HAVE_MKDIR )
+
+/* Makes the directory
+ * This function uses the POSIX mkdir function or equivalent
+ * The status, if not NULL, is set on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory(
+     const char *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_internal_path_make_directory";
+
+	if( directory_name == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( mkdir(
+	     directory_name,
+	     0755 ) != 0 )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 (uint32_t) errno );
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 errno,
+		 "%s: unable to make directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#else
+#error Missing make directory function
+#endif
+
+/* Makes the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory(
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_make_directory(
+	         directory_name,
+	         NULL,
+	         error ) );
+}
+
+/* Makes the directory
+ * On error the status, if not NULL, is set instead of an error, hence no error
+ * message is formatted or allocated, for example when the directory already exists.
+ * The status is cleared if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_with_status(
+     const char *directory_name,
+     libcpath_status_t *status )
+{
+	libcpath_status_clear(
+	 status );
+
+	return( libcpath_internal_path_make_directory(
+	         directory_name,
+	         status,
+	         NULL ) );
+}
+
+/* Makes the directory using a context
+ * A relative directory name is created in the working directory of the context,
+ * using the working directory descriptor when the context has one
+ * The status, if not NULL, is set on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory_context(
+     libcpath_context_t *context,
+     const char *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error )
+{
+	static char *function           = "libcpath_internal_path_make_directory_context";
+
+#if !defined( WINAPI )
+	const char *working_directory   = NULL;
+	char *full_path                 = NULL;
+	size_t full_path_size           = 0;
+	size_t working_directory_length = 0;
+	int result                      = 0;
+#endif
+#if defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR ) && defined( HAVE_MKDIRAT )
+	int descriptor                  = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( WINAPI )
+	if( directory_name[ 0 ] != '/' )
+	{
+#if defined( HAVE_LIBCPATH_WORKING_DIRECTORY_DESCRIPTOR ) && defined( HAVE_MKDIRAT )
+		result = libcpath_context_get_working_directory_descriptor(
+		          context,
+		          &descriptor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcpath_status_set(
+			 status,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 0 );
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve working directory descriptor from context.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( mkdirat(
+			     descriptor,
+			     directory_name,
+			     0755 ) != 0 )
+			{
+				libcpath_status_set(
+				 status,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 (uint32_t) errno );
+
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 errno,
+				 "%s: unable to make directory.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+#endif
+		result = libcpath_context_get_working_directory(
+		          context,
+		          &working_directory,
+		          &working_directory_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcpath_status_set(
+			 status,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 0 );
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve working directory from context.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libcpath_path_get_full_path_with_working_directory(
+			     working_directory,
+			     working_directory_length,
+			     directory_name,
+			     narrow_string_length(
+			      directory_name ),
+			     &full_path,
+			     &full_path_size,
+			     error ) != 1 )
+			{
+				libcpath_status_set(
+				 status,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 0 );
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine full path.",
+				 function );
+
+				return( -1 );
+			}
+			result = libcpath_internal_path_make_directory(
+			          full_path,
+			          status,
+			          error );
+
+			libcpath_allocator_free(
+			 full_path );
+
+			return( result );
+		}
+	}
+#endif /* !defined( WINAPI ) */
+
+	return( libcpath_internal_path_make_directory(
+	         directory_name,
+	         status,
+	         error ) );
+}
+
+/* Makes the directory using a context
+ * A relative directory name is created in the working directory of the context,
+ * using the working directory descriptor when the context has one
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_context(
+     libcpath_context_t *context,
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_make_directory_context(
+	         context,
+	         directory_name,
+	         NULL,
+	         error ) );
+}
+
+/* Makes the directory using a context
+ * On error the status, if not NULL, is set instead of an error, hence no error
+ * message is formatted or allocated. The status is cleared if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_context_with_status(
+     libcpath_context_t *context,
+     const char *directory_name,
+     libcpath_status_t *status )
+{
+	libcpath_status_clear(
+	 status );
+
+	return( libcpath_internal_path_make_directory_context(
+	         context,
+	         directory_name,
+	         status,
+	         NULL ) );
+}
+
+#if defined( WINAPI )
+
+/* Makes the directory and any missing parent directories
+ * The status, if not NULL, is set on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory_recursive(
+     const char *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_internal_path_make_directory_recursive";
+
+	if( directory_name == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	libcpath_status_set(
+	 status,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 0 );
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: making directories recursively is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+#elif defined( HAVE_MKDIR )
+
+/* Makes the directory and any missing parent directories
+ * The deepest existing ancestor is determined by probing the path backwards,
+ * after which only the missing directories are created. Where supported the
+ * missing directories are created one level at a time relative to a descriptor
+ * of their parent directory, so that their parents do not have to be resolved again
+ * An existing directory is not considered an error, an existing file is
+ * The status, if not NULL, is set on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory_recursive(
+     const char *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function        = "libcpath_internal_path_make_directory_recursive";
+	char *path                   = NULL;
+	size_t component_index       = 0;
+	size_t directory_name_length = 0;
+	size_t existing_length       = 0;
+	size_t path_index            = 0;
+	char character               = 0;
+	int result                   = 0;
+
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR_FUNCTIONS )
+	int descriptor               = -1;
+	int next_descriptor          = -1;
+#endif
+
+	if( directory_name == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = narrow_string_length(
+	                         directory_name );
+
+	/* Ignore trailing separators but keep a root directory
+	 */
+	while( ( directory_name_length > 1 )
+	    && ( directory_name[ directory_name_length - 1 ] == (char) LIBCPATH_SEPARATOR ) )
+	{
+		directory_name_length--;
+	}
+	if( directory_name_length == 0 )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid directory name length value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length + 1 ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* A copy of the directory name is used so that its parent directories
+	 * can be terminated in place
+	 */
+	path = libcpath_allocator_allocate_narrow_string(
+	        directory_name_length + 1 );
+
+	if( path == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     path,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	path[ directory_name_length ] = 0;
+
+	/* Probe backwards for the deepest existing directory, in the common case
+	 * that only the last directory is missing a single call suffices
+	 */
+	existing_length = directory_name_length;
+
+	while( existing_length > 0 )
+	{
+		character = path[ existing_length ];
+
+		path[ existing_length ] = 0;
+
+		if( mkdir(
+		     path,
+		     0755 ) == 0 )
+		{
+			path[ existing_length ] = character;
+
+			break;
+		}
+		if( errno == EEXIST )
+		{
+			if( existing_length == directory_name_length )
+			{
+				if( ( stat(
+				       path,
+				       &file_statistics ) != 0 )
+				 || ( S_ISDIR( file_statistics.st_mode ) == 0 ) )
+				{
+					libcpath_status_set(
+					 status,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 (uint32_t) EEXIST );
+
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 EEXIST,
+					 "%s: unable to make directory.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			path[ existing_length ] = character;
+
+			break;
+		}
+		if( errno != ENOENT )
+		{
+			libcpath_status_set(
+			 status,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 (uint32_t) errno );
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 errno,
+			 "%s: unable to make directory.",
+			 function );
+
+			goto on_error;
+		}
+		path[ existing_length ] = character;
+
+		while( ( existing_length > 0 )
+		    && ( path[ existing_length - 1 ] != (char) LIBCPATH_SEPARATOR ) )
+		{
+			existing_length--;
+		}
+		while( ( existing_length > 1 )
+		    && ( path[ existing_length - 1 ] == (char) LIBCPATH_SEPARATOR ) )
+		{
+			existing_length--;
+		}
+	}
+	if( existing_length == 0 )
+	{
+		/* A relative directory name without an existing parent directory
+		 * is created from the current working directory
+		 */
+		path_index = 0;
+	}
+	else
+	{
+		path_index = existing_length;
+	}
+	/* Skip the separators in front of the first missing directory
+	 */
+	while( ( path_index < directory_name_length )
+	    && ( path[ path_index ] == (char) LIBCPATH_SEPARATOR ) )
+	{
+		path_index++;
+	}
+	if( path_index >= directory_name_length )
+	{
+		libcpath_allocator_free(
+		 path );
+
+		return( 1 );
+	}
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR_FUNCTIONS )
+	if( existing_length == 0 )
+	{
+		descriptor = AT_FDCWD;
+	}
+	else
+	{
+		character = path[ existing_length ];
+
+		path[ existing_length ] = 0;
+
+		descriptor = open(
+		              path,
+		              LIBCPATH_PATH_OPEN_DIRECTORY_FLAGS );
+
+		path[ existing_length ] = character;
+
+		if( descriptor == -1 )
+		{
+			libcpath_status_set(
+			 status,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 (uint32_t) errno );
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open parent directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	/* Create the missing directories from the top down, where supported every
+	 * directory is created in and opened relative to its parent directory, so
+	 * that every level requires a single lookup
+	 */
+	while( path_index < directory_name_length )
+	{
+		component_index = path_index;
+
+		while( ( path_index < directory_name_length )
+		    && ( path[ path_index ] != (char) LIBCPATH_SEPARATOR ) )
+		{
+			path_index++;
+		}
+		character = path[ path_index ];
+
+		path[ path_index ] = 0;
+
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR_FUNCTIONS )
+		result = mkdirat(
+		          descriptor,
+		          &( path[ component_index ] ),
+		          0755 );
+#else
+		result = mkdir(
+		          path,
+		          0755 );
+#endif
+		if( ( result != 0 )
+		 && ( errno != EEXIST ) )
+		{
+			libcpath_status_set(
+			 status,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 (uint32_t) errno );
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 errno,
+			 "%s: unable to make directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( path_index >= directory_name_length )
+		{
+			/* The last directory could have been created by another process
+			 * in the meantime, which is only accepted if it is a directory
+			 */
+			if( result != 0 )
+			{
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR_FUNCTIONS )
+				result = fstatat(
+				          descriptor,
+				          &( path[ component_index ] ),
+				          &file_statistics,
+				          0 );
+#else
+				result = stat(
+				          path,
+				          &file_statistics );
+#endif
+				if( ( result != 0 )
+				 || ( S_ISDIR( file_statistics.st_mode ) == 0 ) )
+				{
+					libcpath_status_set(
+					 status,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 (uint32_t) EEXIST );
+
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 EEXIST,
+					 "%s: unable to make directory.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			break;
+		}
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR_FUNCTIONS )
+		/* Descend into the directory, which fails if it is not a directory
+		 */
+		next_descriptor = openat(
+		                   descriptor,
+		                   &( path[ component_index ] ),
+		                   LIBCPATH_PATH_OPEN_DIRECTORY_FLAGS );
+
+		if( next_descriptor == -1 )
+		{
+			libcpath_status_set(
+			 status,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 (uint32_t) errno );
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( descriptor != AT_FDCWD )
+		{
+			close(
+			 descriptor );
+		}
+		descriptor = next_descriptor;
+#endif
+		path[ path_index ] = character;
+
+		/* Skip sequences of separators
+		 */
+		while( ( path_index < directory_name_length )
+		    && ( path[ path_index ] == (char) LIBCPATH_SEPARATOR ) )
+		{
+			path_index++;
+		}
+	}
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR_FUNCTIONS )
+	if( descriptor != AT_FDCWD )
+	{
+		if( close(
+		     descriptor ) != 0 )
+		{
+			descriptor = -1;
+
+			libcpath_status_set(
+			 status,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 (uint32_t) errno );
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	libcpath_allocator_free(
+	 path );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR_FUNCTIONS )
+	if( ( descriptor != -1 )
+	 && ( descriptor != AT_FDCWD ) )
+	{
+		close(
+		 descriptor );
+	}
+#endif
+	if( path != NULL )
+	{
+		libcpath_allocator_free(
+		 path );
+	}
+	return( -1 );
+}
+
+#else
+#error Missing make directory function
+#endif
+
+/* Makes the directory and any missing parent directories
+ * An existing directory is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_recursive(
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_make_directory_recursive(
+	         directory_name,
+	         NULL,
+	         error ) );
+}
+
+/* Makes the directory and any missing parent directories
+ * On error the status, if not NULL, is set instead of an error, hence no error
+ * message is formatted or allocated. The status is cleared if successful
+ * An existing directory is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_recursive_with_status(
+     const char *directory_name,
+     libcpath_status_t *status )
+{
+	libcpath_status_clear(
+	 status );
+
+	return( libcpath_internal_path_make_directory_recursive(
+	         directory_name,
+	         status,
+	         NULL ) );
+}
+
+/* Determines if a path contains a parent directory (..) segment
+ * Returns 1 if the path contains a parent directory segment or 0 if not
+ */
+int libcpath_path_has_parent_directory_segment(
+     const char *path,
+     size_t path_length )
+{
+	size_t path_index    = 0;
+	size_t segment_start = 0;
+
+	if( path == NULL )
+	{
+		return( 0 );
+	}
+	for( path_index = 0;
+	     path_index <= path_length;
+	     path_index++ )
+	{
+		if( ( path_index == path_length )
+		 || ( path[ path_index ] == '/' )
+		 || ( path[ path_index ] == (char) LIBCPATH_SEPARATOR ) )
+		{
+			if( ( ( path_index - segment_start ) == 2 )
+			 && ( path[ segment_start ] == '.' )
+			 && ( path[ segment_start + 1 ] == '.' ) )
+			{
+				return( 1 );
+			}
+			segment_start = path_index + 1;
+		}
+	}
+	return( 0 );
+}
+
+/* Makes the directory using a directory cache
+ * The directory is only made when it is not in the directory cache and is
+ * added to the directory cache afterwards. An existing directory is not considered an error
+ * The directory is cached by its full path, hence a relative directory name is
+ * resolved against the current working directory. The full path is determined
+ * lexically, hence a directory name with a parent directory (..) segment, which
+ * can refer to a different directory if preceded by a symbolic link, is not cached
+ * The status, if not NULL, is set on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory_with_cache(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI )
+	struct stat file_statistics;
+#endif
+
+	libcpath_status_t make_status;
+
+	char *full_path              = NULL;
+	static char *function        = "libcpath_internal_path_make_directory_with_cache";
+	size_t directory_name_length = 0;
+	size_t full_path_size        = 0;
+	int result                   = 0;
+
+	if( directory_cache == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = narrow_string_length(
+	                         directory_name );
+
+	if( libcpath_path_has_parent_directory_segment(
+	     directory_name,
+	     directory_name_length ) == 0 )
+	{
+		if( libcpath_path_get_full_path(
+		     directory_name,
+		     directory_name_length,
+		     &full_path,
+		     &full_path_size,
+		     error ) != 1 )
+		{
+			libcpath_status_set(
+			 status,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 0 );
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine full path of directory name.",
+			 function );
+
+			goto on_error;
+		}
+		result = libcpath_directory_cache_has_normalized_path(
+		          directory_cache,
+		          full_path,
+		          full_path_size - 1,
+		          error );
+
+		if( result == -1 )
+		{
+			libcpath_status_set(
+			 status,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 0 );
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if directory is in cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+		/* An existing directory is detected without constructing an error
+		 */
+		libcpath_status_clear(
+		 &make_status );
+
+		result = libcpath_internal_path_make_directory(
+		          directory_name,
+		          &make_status,
+		          NULL );
+
+#if !defined( WINAPI )
+		if( ( result != 1 )
+		 && ( make_status.system_error_code == (uint32_t) EEXIST ) )
+		{
+			if( ( stat(
+			       directory_name,
+			       &file_statistics ) == 0 )
+			 && ( S_ISDIR( file_statistics.st_mode ) != 0 ) )
+			{
+				result = 1;
+			}
+		}
+#endif
+		if( result != 1 )
+		{
+			libcpath_status_set(
+			 status,
+			 make_status.error_domain,
+			 make_status.error_code,
+			 make_status.system_error_code );
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 make_status.system_error_code,
+			 "%s: unable to make directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( full_path != NULL )
+		{
+			if( libcpath_directory_cache_add_normalized_path(
+			     directory_cache,
+			     full_path,
+			     full_path_size - 1,
+			     NULL,
+			     error ) == -1 )
+			{
+				libcpath_status_set(
+				 status,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 0 );
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add directory to cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( full_path != NULL )
+	{
+		libcpath_allocator_free(
+		 full_path );
+	}
+	return( 1 );
+
+on_error:
+	if( full_path != NULL )
+	{
+		libcpath_allocator_free(
+		 full_path );
+	}
+	return( -1 );
+}
+
+/* Makes the directory using a directory cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_with_cache(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_make_directory_with_cache(
+	         directory_cache,
+	         directory_name,
+	         NULL,
+	         error ) );
+}
+
+/* Makes the directory using a directory cache
+ * On error the status, if not NULL, is set instead of an error, hence no error
+ * message is formatted or allocated. The status is cleared if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_with_cache_with_status(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     libcpath_status_t *status )
+{
+	libcpath_status_clear(
+	 status );
+
+	return( libcpath_internal_path_make_directory_with_cache(
+	         directory_cache,
+	         directory_name,
+	         status,
+	         NULL ) );
+}
+
+/* Makes the directory and any missing parent directories using a directory cache
+ * The directories are only made when the directory is not in the directory cache,
+ * the directory and its parent directories are added to the directory cache afterwards
+ * The directories are cached by their full path, hence a relative directory name
+ * is resolved against the current working directory. The full path is determined
+ * lexically, hence a directory name with a parent directory (..) segment, which
+ * can refer to a different directory if preceded by a symbolic link, is not cached
+ * The status, if not NULL, is set on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory_recursive_with_cache(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error )
+{
+	char *full_path              = NULL;
+	static char *function        = "libcpath_internal_path_make_directory_recursive_with_cache";
+	size_t directory_name_length = 0;
+	size_t full_path_size        = 0;
+	size_t path_index            = 0;
+	int result                   = 0;
+
+	if( directory_cache == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = narrow_string_length(
+	                         directory_name );
+
+	if( libcpath_path_has_parent_directory_segment(
+	     directory_name,
+	     directory_name_length ) != 0 )
+	{
+		return( libcpath_internal_path_make_directory_recursive(
+		         directory_name,
+		         status,
+		         error ) );
+	}
+	if( libcpath_path_get_full_path(
+	     directory_name,
+	     directory_name_length,
+	     &full_path,
+	     &full_path_size,
+	     error ) != 1 )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path of directory name.",
+		 function );
+
+		goto on_error;
+	}
+	result = libcpath_directory_cache_has_normalized_path(
+	          directory_cache,
+	          full_path,
+	          full_path_size - 1,
+	          error );
+
+	if( result == -1 )
+	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 0 );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if directory is in cache.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* When the parent directory exists this costs a single call
+		 */
+		if( libcpath_internal_path_make_directory_recursive(
+		     directory_name,
+		     status,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to make directory.",
+			 function );
+
+			goto on_error;
+		}
+		/* Add the directory and its parent directories, from the deepest up,
+		 * until a directory is found that already is in the cache
+		 */
+		path_index = full_path_size - 1;
+
+		while( path_index > 0 )
+		{
+			if( ( path_index == ( full_path_size - 1 ) )
+			 || ( full_path[ path_index ] == (char) LIBCPATH_SEPARATOR ) )
+			{
+				result = libcpath_directory_cache_add_normalized_path(
+				          directory_cache,
+				          full_path,
+				          path_index,
+				          NULL,
+				          error );
+
+				if( result == -1 )
+				{
+					libcpath_status_set(
+					 status,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 0 );
+
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to add directory to cache.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					break;
+				}
+			}
+			path_index--;
+		}
+	}
+	libcpath_allocator_free(
+	 full_path );
+
+	return( 1 );
+
+on_error:
+	if( full_path != NULL )
+	{
+		libcpath_allocator_free(
+		 full_path );
+	}
+	return( -1 );
+}
+
+/* Makes the directory and any missing parent directories using a directory cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_recursive_with_cache(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_make_directory_recursive_with_cache(
+	         directory_cache,
+	         directory_name,
+	         NULL,
+	         error ) );
+}
+
+/* Makes the directory and any missing parent directories using a directory cache
+ * On error the status, if not NULL, is set instead of an error, hence no error
+ * message is formatted or allocated. The status is cleared if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_recursive_with_cache_with_status(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     libcpath_status_t *status )
+{
+	libcpath_status_clear(
+	 status );
+
+	return( libcpath_internal_path_make_directory_recursive_with_cache(
+	         directory_cache,
+	         directory_name,
+	         status,
+	         NULL ) );
+}
+
+/* Makes or probes multiple directories
+ * Relative directory names are resolved against the working directory of
+ * the context if not NULL. The io_uring of the context is reused across calls,
+ * without a context an io_uring is created for the call
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_batch_directories(
+     libcpath_context_t *context,
+     int operation,
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI )
+	struct stat file_statistics;
+#endif
+
+#if defined( HAVE_LIBCPATH_IO_URING )
+	libcpath_allocator_t allocator;
+
+	libcpath_io_uring_t *io_uring                = NULL;
+	uint32_t number_of_entries                   = 0;
+#endif
+
+	static char *function                        = "libcpath_internal_path_batch_directories";
+	int directory_index                          = 0;
+
+#if !defined( WINAPI )
+	const char **resolved_directory_names        = NULL;
+	const char *working_directory                = NULL;
+	char **full_paths                            = NULL;
+	size_t full_path_size                        = 0;
+	size_t working_directory_length              = 0;
+	int descriptor                               = -1;
+	int result                                   = 1;
+#endif
+
+	if( ( operation != LIBCPATH_PATH_BATCH_OPERATION_MAKE_DIRECTORY )
+	 && ( operation != LIBCPATH_PATH_BATCH_OPERATION_PROBE_DIRECTORY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported operation.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory names.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_directories < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of directories value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_codes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error codes.",
+		 function );
+
+		return( -1 );
+	}
+	for( directory_index = 0;
+	     directory_index < number_of_directories;
+	     directory_index++ )
+	{
+		if( directory_names[ directory_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid directory name: %d.",
+			 function,
+			 directory_index );
+
+			return( -1 );
+		}
+	}
+#if defined( WINAPI )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: batch directory operations not supported.",
+	 function );
+
+	return( -1 );
+#else
+	resolved_directory_names = directory_names;
+
+	if( context != NULL )
+	{
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR_FUNCTIONS )
+		result = libcpath_context_get_working_directory_descriptor(
+		          context,
+		          &descriptor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve working directory descriptor from context.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			descriptor = -1;
+		}
+#endif
+		result = 0;
+
+		if( descriptor == -1 )
+		{
+			result = libcpath_context_get_working_directory(
+			          context,
+			          &working_directory,
+			          &working_directory_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve working directory from context.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Without a working directory descriptor the relative directory names
+		 * are resolved into full paths
+		 */
+		if( ( result != 0 )
+		 && ( number_of_directories > 0 ) )
+		{
+			full_paths = (char **) libcpath_allocator_allocate(
+			                        sizeof( char * ) * number_of_directories );
+
+			if( full_paths == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create full paths.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     full_paths,
+			     0,
+			     sizeof( char * ) * number_of_directories ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear full paths.",
+				 function );
+
+				libcpath_allocator_free(
+				 full_paths );
+
+				full_paths = NULL;
+
+				goto on_error;
+			}
+			resolved_directory_names = (const char **) libcpath_allocator_allocate(
+			                                            sizeof( const char * ) * number_of_directories );
+
+			if( resolved_directory_names == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create resolved directory names.",
+				 function );
+
+				goto on_error;
+			}
+			for( directory_index = 0;
+			     directory_index < number_of_directories;
+			     directory_index++ )
+			{
+				if( directory_names[ directory_index ][ 0 ] == '/' )
+				{
+					resolved_directory_names[ directory_index ] = directory_names[ directory_index ];
+
+					continue;
+				}
+				if( libcpath_path_get_full_path_with_working_directory(
+				     working_directory,
+				     working_directory_length,
+				     directory_names[ directory_index ],
+				     narrow_string_length(
+				      directory_names[ directory_index ] ),
+				     &( full_paths[ directory_index ] ),
+				     &full_path_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine full path of directory name: %d.",
+					 function,
+					 directory_index );
+
+					goto on_error;
+				}
+				resolved_directory_names[ directory_index ] = full_paths[ directory_index ];
+			}
+		}
+	}
+	result = 0;
+
+#if defined( HAVE_LIBCPATH_IO_URING )
+	if( number_of_directories >= LIBCPATH_IO_URING_MINIMUM_NUMBER_OF_OPERATIONS )
+	{
+		if( number_of_directories < LIBCPATH_IO_URING_MAXIMUM_NUMBER_OF_ENTRIES )
+		{
+			number_of_entries = (uint32_t) number_of_directories;
+		}
+		else
+		{
+			number_of_entries = LIBCPATH_IO_URING_MAXIMUM_NUMBER_OF_ENTRIES;
+		}
+		if( context != NULL )
+		{
+			result = libcpath_context_get_io_uring(
+			          context,
+			          number_of_entries,
+			          &io_uring,
+			          error );
+		}
+		else
+		{
+			libcpath_allocator_get_current(
+			 &allocator );
+
+			result = libcpath_io_uring_initialize(
+			          &io_uring,
+			          number_of_entries,
+			          &allocator,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create io_uring.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( operation == LIBCPATH_PATH_BATCH_OPERATION_MAKE_DIRECTORY )
+			{
+				result = libcpath_io_uring_make_directories(
+				          io_uring,
+				          ( descriptor != -1 ) ? descriptor : AT_FDCWD,
+				          resolved_directory_names,
+				          number_of_directories,
+				          error_codes,
+				          error );
+			}
+			else
+			{
+				result = libcpath_io_uring_probe_directories(
+				          io_uring,
+				          ( descriptor != -1 ) ? descriptor : AT_FDCWD,
+				          resolved_directory_names,
+				          number_of_directories,
+				          error_codes,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to perform batch directory operations.",
+				 function );
+			}
+			/* After an error the io_uring can still contain unsubmitted or
+			 * in flight operations, hence it is not reused
+			 */
+			if( ( context == NULL )
+			 || ( result != 1 ) )
+			{
+				if( context != NULL )
+				{
+					if( libcpath_context_free_io_uring(
+					     context,
+					     error ) != 1 )
+					{
+						result = -1;
+					}
+				}
+				else if( libcpath_io_uring_free(
+				          &io_uring,
+				          error ) != 1 )
+				{
+					result = -1;
+				}
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free io_uring.",
+					 function );
+				}
+			}
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+#endif /* defined( HAVE_LIBCPATH_IO_URING ) */
+
+	if( result == 0 )
+	{
+		for( directory_index = 0;
+		     directory_index < number_of_directories;
+		     directory_index++ )
+		{
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR_FUNCTIONS )
+			if( descriptor != -1 )
+			{
+				if( operation == LIBCPATH_PATH_BATCH_OPERATION_MAKE_DIRECTORY )
+				{
+					result = mkdirat(
+					          descriptor,
+					          resolved_directory_names[ directory_index ],
+					          0755 );
+				}
+				else
+				{
+					result = fstatat(
+					          descriptor,
+					          resolved_directory_names[ directory_index ],
+					          &file_statistics,
+					          0 );
+				}
+			}
+			else
+#endif
+			if( operation == LIBCPATH_PATH_BATCH_OPERATION_MAKE_DIRECTORY )
+			{
+				result = mkdir(
+				          resolved_directory_names[ directory_index ],
+				          0755 );
+			}
+			else
+			{
+				result = stat(
+				          resolved_directory_names[ directory_index ],
+				          &file_statistics );
+			}
+			if( result != 0 )
+			{
+				error_codes[ directory_index ] = errno;
+			}
+			else if( ( operation == LIBCPATH_PATH_BATCH_OPERATION_PROBE_DIRECTORY )
+			      && ( S_ISDIR( file_statistics.st_mode ) == 0 ) )
+			{
+				error_codes[ directory_index ] = ENOTDIR;
+			}
+			else
+			{
+				error_codes[ directory_index ] = 0;
+			}
+		}
+	}
+	if( full_paths != NULL )
+	{
+		for( directory_index = 0;
+		     directory_index < number_of_directories;
+		     directory_index++ )
+		{
+			if( full_paths[ directory_index ] != NULL )
+			{
+				libcpath_allocator_free(
+				 full_paths[ directory_index ] );
+			}
+		}
+		libcpath_allocator_free(
+		 full_paths );
+	}
+	if( resolved_directory_names != directory_names )
+	{
+		libcpath_allocator_free(
+		 resolved_directory_names );
+	}
+	return( 1 );
+
+on_error:
+	if( full_paths != NULL )
+	{
+		for( directory_index = 0;
+		     directory_index < number_of_directories;
+		     directory_index++ )
+		{
+			if( full_paths[ directory_index ] != NULL )
+			{
+				libcpath_allocator_free(
+				 full_paths[ directory_index ] );
+			}
+		}
+		libcpath_allocator_free(
+		 full_paths );
+	}
+	if( ( resolved_directory_names != NULL )
+	 && ( resolved_directory_names != directory_names ) )
+	{
+		libcpath_allocator_free(
+		 resolved_directory_names );
+	}
+	return( -1 );
+
+#endif /* defined( WINAPI ) */
+}
+
+/* Makes multiple directories
+ * The directories are made independently of each other, which means that their
+ * parent directories must already exist. On Linux the directories are made
+ * in batches using io_uring, if supported by the kernel, and one by one otherwise
+ * The directories of an io_uring batch are made concurrently and, unlike when
+ * made one by one, in no particular order. Hence with io_uring, which is used
+ * from LIBCPATH_IO_URING_MINIMUM_NUMBER_OF_OPERATIONS directories, the names
+ * { "a", "a/b" } can fail with ENOENT for "a/b"
+ * Every error code is set to 0 if the directory was made or to the corresponding
+ * errno value otherwise, for example EEXIST if the directory already exists
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directories(
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_batch_directories(
+	         NULL,
+	         LIBCPATH_PATH_BATCH_OPERATION_MAKE_DIRECTORY,
+	         directory_names,
+	         number_of_directories,
+	         error_codes,
+	         error ) );
+}
+
+/* Makes multiple directories using a context
+ * Relative directory names are made in the working directory of the context
+ * The io_uring is created on first use and reused by subsequent calls with
+ * the same context, hence the context should not be used concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directories_context(
+     libcpath_context_t *context,
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_make_directories_context";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	return( libcpath_internal_path_batch_directories(
+	         context,
+	         LIBCPATH_PATH_BATCH_OPERATION_MAKE_DIRECTORY,
+	         directory_names,
+	         number_of_directories,
+	         error_codes,
+	         error ) );
+}
+
+/* Probes multiple directories
+ * On Linux the directories are probed in batches using io_uring, if supported
+ * by the kernel, and one by one otherwise
+ * Every error code is set to 0 if the directory exists, to ENOTDIR if the path
+ * exists but is not a directory or to the corresponding errno value otherwise
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_probe_directories(
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_batch_directories(
+	         NULL,
+	         LIBCPATH_PATH_BATCH_OPERATION_PROBE_DIRECTORY,
+	         directory_names,
+	         number_of_directories,
+	         error_codes,
+	         error ) );
+}
+
+/* Probes multiple directories using a context
+ * Relative directory names are probed in the working directory of the context
+ * The io_uring is created on first use and reused by subsequent calls with
+ * the same context, hence the context should not be used concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_probe_directories_context(
+     libcpath_context_t *context,
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_probe_directories_context";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	return( libcpath_internal_path_batch_directories(
+	         context,
+	         LIBCPATH_PATH_BATCH_OPERATION_PROBE_DIRECTORY,
+	         directory_names,
+	         number_of_directories,
+	         error_codes,
+	         error ) );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Cross Windows safe version of SetCurrentDirectoryW
+ * Returns TRUE if successful or FALSE on error
+ */
+BOOL libcpath_SetCurrentDirectoryW(
+      LPCWSTR path )
+{
+	FARPROC function       = NULL;
+	HMODULE library_handle = NULL;
+	BOOL result            = FALSE;
+
+	if( path == NULL )
+	{
+		return( FALSE );
+	}
+	library_handle = LoadLibrary(
+	                  _SYSTEM_STRING( "kernel32.dll" ) );
+
+	if( library_handle == NULL )
+	{
+		return( FALSE );
+	}
+	function = GetProcAddress(
+		    library_handle,
+		    (LPCSTR) "SetCurrentDirectoryW" );
+
+	if( function != NULL )
+	{
+		result = function(
+			  path );
+	}
+	/* This call should be after using the function
+	 * in most cases kernel32.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle ) != TRUE )
+	{
+		libcpath_CloseHandle(
+		 library_handle );
+
+		return( FALSE );
+	}
+	return( result );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+#if defined( WINAPI )
+
+/* Changes the directory
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_change_directory_wide(
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_change_directory_wide";
+	DWORD error_code      = 0;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+	if( libcpath_SetCurrentDirectoryW(
+	     directory_name ) == 0 )
+#else
+	if( SetCurrentDirectoryW(
+	     directory_name ) == 0 )
+#endif
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 error_code,
+		 "%s: unable to change directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_CHDIR )
+
+/* Changes the directory
+ * This function uses the POSIX chdir function or equivalent
+ * The codepage is used for the narrow strings, where 0 represents UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_change_directory_with_codepage_wide(
+     const wchar_t *directory_name,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function             = "libcpath_path_change_directory_with_codepage_wide";
+	char *narrow_directory_name       = 0;
+	size_t directory_name_length      = 0;
+	size_t narrow_directory_name_size = 0;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = wide_string_length(
+	                         directory_name );
+
+	if( libcpath_system_string_size_from_wide_string(
+	     directory_name,
+	     directory_name_length + 1,
+	     &narrow_directory_name_size,
+	     codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow directory name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( narrow_directory_name_size > (size_t) SSIZE_MAX )
+	 || ( ( sizeof( char ) * narrow_directory_name_size )  > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid narrow directory name size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	narrow_directory_name = libcpath_allocator_allocate_narrow_string(
+	                         narrow_directory_name_size );
+
+	if( narrow_directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create narrow directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_system_string_copy_from_wide_string(
+	     narrow_directory_name,
+	     narrow_directory_name_size,
+	     directory_name,
+	     directory_name_length + 1,
+	     codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set name.",
+		 function );
+
+		goto on_error;
+	}
+	if( chdir(
+	     narrow_directory_name ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 errno,
+		 "%s: unable to change directory.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+	__atomic_add_fetch(
+	 &libcpath_change_directory_generation,
+	 1,
+	 __ATOMIC_RELEASE );
+#endif
+	libcpath_allocator_free(
+	 narrow_directory_name );
+
+	return( 1 );
+
+on_error:
+	if( narrow_directory_name != NULL )
+	{
+		libcpath_allocator_free(
+		 narrow_directory_name );
+	}
+	return( -1 );
+}
+
+/* Changes the directory
+ * The codepage of the library is used for the narrow strings
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_change_directory_wide(
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_change_directory_with_codepage_wide(
+	         directory_name,
+	         libclocale_codepage,
+	         error ) );
+}
+
+#else
+#error Missing change directory function
+#endif
+
+#if !defined( WINAPI )
+
+/* Converts a wide character path into a narrow character path
+ * The codepage is used for the narrow path, where 0 represents UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_narrow_path_wide(
+     const wchar_t *path,
+     char **narrow_path,
+     size_t *narrow_path_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function   = "libcpath_path_get_narrow_path_wide";
+	size_t path_length      = 0;
+	size_t safe_narrow_size = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid narrow path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *narrow_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid narrow path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid narrow path size.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = wide_string_length(
+	               path );
+
+	if( libcpath_system_string_size_from_wide_string(
+	     path,
+	     path_length + 1,
+	     &safe_narrow_size,
+	     codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow path size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( safe_narrow_size == 0 )
+	 || ( safe_narrow_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid narrow path size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	*narrow_path = libcpath_allocator_allocate_narrow_string(
+	                safe_narrow_size );
+
+	if( *narrow_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create narrow path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_system_string_copy_from_wide_string(
+	     *narrow_path,
+	     safe_narrow_size,
+	     path,
+	     path_length + 1,
+	     codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set narrow path.",
+		 function );
+
+		goto on_error;
+	}
+	*narrow_path_size = safe_narrow_size;
+
+	return( 1 );
+
+on_error:
+	if( *narrow_path != NULL )
+	{
+		libcpath_allocator_free(
+		 *narrow_path );
+
+		*narrow_path = NULL;
+	}
+	return( -1 );
+}
+
+#endif /* !defined( WINAPI ) */
+
+/* Changes the working directory of a context
+ * The current working directory of the process is not changed, only the paths
+ * resolved using the context, hence contexts can be used concurrently by different threads
+ * Like libcpath_path_change_directory_wide the directory must exist
+ * The codepage of the context is used for the narrow strings
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_change_directory_context_wide(
+     libcpath_context_t *context,
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	static char *function             = "libcpath_path_change_directory_context_wide";
+	int codepage                      = 0;
+
+#if !defined( WINAPI )
+	char *narrow_directory_name       = NULL;
+	size_t narrow_directory_name_size = 0;
+#endif
+
+	if( libcpath_context_get_codepage(
+	     context,
+	     &codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve codepage from context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	LIBCPATH_UNREFERENCED_PARAMETER( directory_name )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: working directory not supported.",
+	 function );
+
+	return( -1 );
+#else
+	if( libcpath_path_get_narrow_path_wide(
+	     directory_name,
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_change_directory_context(
+	     context,
+	     narrow_directory_name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to change working directory of context.",
+		 function );
+
+		goto on_error;
+	}
+	libcpath_allocator_free(
+	 narrow_directory_name );
+
+	return( 1 );
+
+on_error:
+	if( narrow_directory_name != NULL )
+	{
+		libcpath_allocator_free(
+		 narrow_directory_name );
+	}
+	return( -1 );
+
+#endif /* defined( WINAPI ) */
+}
+
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Cross Windows safe version of GetCurrentDirectoryW
+ * Returns the number of characters in the current directory string or 0 on error
+ */
+DWORD libcpath_GetCurrentDirectoryW(
+       DWORD buffer_size,
+       LPCWSTR buffer )
+{
+	FARPROC function       = NULL;
+	HMODULE library_handle = NULL;
+	DWORD result           = 0;
+
+	library_handle = LoadLibrary(
+	                  _SYSTEM_STRING( "kernel32.dll" ) );
+
+	if( library_handle == NULL )
+	{
+		return( 0 );
+	}
+	function = GetProcAddress(
+		    library_handle,
+		    (LPCSTR) "GetCurrentDirectoryW" );
+
+	if( function != NULL )
+	{
+		result = function(
+			  buffer_size,
+			  buffer );
+	}
+	/* This call should be after using the function
+	 * in most cases kernel32.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle ) != TRUE )
+	{
+		libcpath_CloseHandle(
+		 library_handle );
+
+		return( 0 );
+	}
+	return( result );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+#if defined( WINAPI )
+
+/* Retrieves the current working directory
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_current_working_directory_wide(
+     wchar_t **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error )
+{
+	static char *function                     = "libcpath_path_get_current_working_directory_wide";
+	DWORD safe_current_working_directory_size = 0;
+	DWORD error_code                          = 0;
+
+	if( current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *current_working_directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid current working directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_working_directory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+	safe_current_working_directory_size = libcpath_GetCurrentDirectoryW(
+	                                       0,
+	                                       NULL );
+#else
+	safe_current_working_directory_size = GetCurrentDirectoryW(
+	                                       0,
+	                                       NULL );
+#endif
+	if( safe_current_working_directory_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current working directory size.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size_t) safe_current_working_directory_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current working directory size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	*current_working_directory_size = (size_t) safe_current_working_directory_size;
+
+	*current_working_directory = libcpath_allocator_allocate_wide_string(
+	                              *current_working_directory_size );
+
+	if( *current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *current_working_directory,
+	     0,
+	     sizeof( wchar_t ) * *current_working_directory_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear current working directory.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+	if( libcpath_GetCurrentDirectoryW(
+	     safe_current_working_directory_size,
+	     *current_working_directory ) != ( safe_current_working_directory_size - 1 ) )
+#else
+	if( GetCurrentDirectoryW(
+	     safe_current_working_directory_size,
+	     *current_working_directory ) != ( safe_current_working_directory_size - 1 ) )
+#endif
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *current_working_directory != NULL )
+	{
+		libcpath_allocator_free(
+		 *current_working_directory );
+
+		*current_working_directory = NULL;
+	}
+	*current_working_directory_size = 0;
+
+	return( -1 );
+}
+
+#elif defined( HAVE_GETCWD )
+
+/* Retrieves the current working directory
+ * This function uses the POSIX getcwd function or equivalent
+ * The size of the current working directory is exact, its allocation can be
+ * larger when the current working directory contains non-ASCII characters
+ * The codepage is used for the narrow strings, where 0 represents UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_current_working_directory_with_codepage_wide(
+     wchar_t **current_working_directory,
+     size_t *current_working_directory_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	char buffer[ LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE ];
+
+	static char *function                          = "libcpath_path_get_current_working_directory_with_codepage_wide";
+	char *narrow_current_working_directory         = NULL;
+	size_t narrow_current_working_directory_length = 0;
+
+	if( current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *current_working_directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid current working directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_working_directory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_getcwd(
+	     buffer,
+	     LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE,
+	     &narrow_current_working_directory,
+	     &narrow_current_working_directory_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	/* A narrow character never decodes into more than one wide character
+	 * hence the current working directory is decoded in a single pass
+	 */
+	*current_working_directory = libcpath_allocator_allocate_wide_string(
+	                              narrow_current_working_directory_length + 1 );
+
+	if( *current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_system_string_decode_narrow_string(
+	     narrow_current_working_directory,
+	     narrow_current_working_directory_length + 1,
+	     *current_working_directory,
+	     narrow_current_working_directory_length + 1,
+	     current_working_directory_size,
+	     codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_current_working_directory != buffer )
+	{
+		libcpath_allocator_free(
+		 narrow_current_working_directory );
+	}
+	return( 1 );
+
+on_error:
+	if( ( narrow_current_working_directory != NULL )
+	 && ( narrow_current_working_directory != buffer ) )
+	{
+		libcpath_allocator_free(
+		 narrow_current_working_directory );
+	}
+	if( *current_working_directory != NULL )
+	{
+		libcpath_allocator_free(
+		 *current_working_directory );
+
+		*current_working_directory = NULL;
+	}
+	*current_working_directory_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the current working directory
+ * The codepage of the library is used for the narrow strings
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_current_working_directory_wide(
+     wchar_t **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_get_current_working_directory_with_codepage_wide(
+	         current_working_directory,
+	         current_working_directory_size,
+	         libclocale_codepage,
+	         error ) );
+}
+
+#else
+#error Missing get current working directory function
+#endif
+
+/* Retrieves the current working directory of a context
+ * This is the working directory of the context or, if not set,
+ * the current working directory of the process
+ * The codepage of the context is used for the narrow strings
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_current_working_directory_context_wide(
+     libcpath_context_t *context,
+     wchar_t **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error )
+{
+	static char *function                      = "libcpath_path_get_current_working_directory_context_wide";
+	int codepage                               = 0;
+
+#if !defined( WINAPI )
+	const char *working_directory              = NULL;
+	size_t safe_current_working_directory_size = 0;
+	size_t working_directory_length            = 0;
+	int result                                 = 0;
+#endif
+
+	if( libcpath_context_get_codepage(
+	     context,
+	     &codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve codepage from context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The wide character Windows API functions do not use a codepage
+	 */
+	return( libcpath_path_get_current_working_directory_wide(
+	         current_working_directory,
+	         current_working_directory_size,
+	         error ) );
+#else
+	result = libcpath_context_get_working_directory(
+	          context,
+	          &working_directory,
+	          &working_directory_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve working directory from context.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( libcpath_path_get_current_working_directory_with_codepage_wide(
+		         current_working_directory,
+		         current_working_directory_size,
+		         codepage,
+		         error ) );
+	}
+	if( current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *current_working_directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid current working directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_working_directory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory size.",
+		 function );
+
+		return( -1 );
+	}
+	/* A wide character string never contains more characters than the narrow
+	 * string it was decoded from
+	 */
+	*current_working_directory = libcpath_allocator_allocate_wide_string(
+	                              working_directory_length + 1 );
+
+	if( *current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create current working directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_system_string_decode_narrow_string(
+	     working_directory,
+	     working_directory_length + 1,
+	     *current_working_directory,
+	     working_directory_length + 1,
+	     &safe_current_working_directory_size,
+	     codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set current working directory.",
+		 function );
+
+		libcpath_allocator_free(
+		 *current_working_directory );
+
+		*current_working_directory = NULL;
+
+		return( -1 );
+	}
+	*current_working_directory_size = safe_current_working_directory_size;
+
+	return( 1 );
+
+#endif /* defined( WINAPI ) */
+}
+
+/* Normalizes the segments of a path
+ * The string is scanned backwards, in which a parent directory (..) segment
+ * increments the number of parent directories and a directory or file name
+ * segment decrements it or is kept otherwise. This way every segment is
+ * visited once and no segment stack or split string is needed, hence the cost
+ * is linear in the string length regardless of the number of parent directories
+ * Empty segments, caused by successive separators, and . segments are ignored
+ *
+ * If normalized_path is set the kept segments, each prefixed with a separator,
+ * are written right aligned in front of normalized_path_end_index
+ * normalized_path_length is incremented with the number of characters written
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_normalize_segments_wide(
+     const wchar_t *string,
+     size_t string_length,
+     wchar_t *normalized_path,
+     size_t normalized_path_end_index,
+     size_t *normalized_path_length,
+     size_t *number_of_parent_directories,
+     libcerror_error_t **error )
+{
+	static char *function                    = "libcpath_path_normalize_segments_wide";
+	size_t safe_normalized_path_length       = 0;
+	size_t safe_number_of_parent_directories = 0;
+	size_t segment_end_index                 = 0;
+	size_t segment_length                    = 0;
+	size_t string_index                      = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( normalized_path_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalized path length.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_parent_directories == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of parent directories.",
+		 function );
+
+		return( -1 );
+	}
+	safe_normalized_path_length       = *normalized_path_length;
+	safe_number_of_parent_directories = *number_of_parent_directories;
+
+	string_index = string_length;
+
+	while( string_index > 0 )
+	{
+		segment_end_index = string_index;
+
+		while( ( string_index > 0 )
+		    && ( string[ string_index - 1 ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			string_index--;
+		}
+		segment_length = segment_end_index - string_index;
+
+		/* Ignore empty and . segments
+		 */
+		if( ( segment_length == 0 )
+		 || ( ( segment_length == 1 )
+		  &&  ( string[ string_index ] == (wchar_t) '.' ) ) )
+		{
+		}
+		else if( ( segment_length == 2 )
+		      && ( string[ string_index ] == (wchar_t) '.' )
+		      && ( string[ string_index + 1 ] == (wchar_t) '.' ) )
+		{
+			safe_number_of_parent_directories++;
+		}
+		else if( safe_number_of_parent_directories > 0 )
+		{
+			safe_number_of_parent_directories--;
+		}
+		else
+		{
+			safe_normalized_path_length += segment_length + 1;
+
+			if( normalized_path != NULL )
+			{
+				if( safe_normalized_path_length > normalized_path_end_index )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: invalid normalized path end index value too small.",
+					 function );
+
+					return( -1 );
+				}
+				normalized_path[ normalized_path_end_index - safe_normalized_path_length ] = (wchar_t) LIBCPATH_SEPARATOR;
+
+				if( wide_string_copy(
+				     &( normalized_path[ normalized_path_end_index - safe_normalized_path_length + 1 ] ),
+				     &( string[ string_index ] ),
+				     segment_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy segment to normalized path.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		/* Skip the separator
+		 */
+		if( string_index > 0 )
+		{
+			string_index--;
+		}
+	}
+	*normalized_path_length       = safe_normalized_path_length;
+	*number_of_parent_directories = safe_number_of_parent_directories;
+
+	return( 1 );
+}
+
+/* Normalizes a path into an absolute path
+ * A relative path is appended to the base path, an absolute path replaces it
+ * A parent directory (..) segment of the root directory refers to the root directory
+ *
+ * The size of the normalized path, including the end of string character,
+ * is determined first. If normalized_path is set the normalized path is written
+ * after that, hence all the characters are only written once
+ * Returns 1 if successful, 0 if the normalized path size is too small or -1 on error
+ */
+int libcpath_path_normalize_with_base_wide(
+     const wchar_t *base_path,
+     size_t base_path_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcpath_path_normalize_with_base_wide";
+	size_t normalized_path_length       = 0;
+	size_t number_of_parent_directories = 0;
+	size_t safe_normalized_path_size    = 0;
+	int pass                            = 0;
+	int use_base_path                   = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( base_path != NULL )
+	 && ( base_path_length > ( (size_t) ( SSIZE_MAX - 2 ) - path_length ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_normalized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required normalized path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( base_path != NULL )
+	 && ( ( path_length == 0 )
+	  ||  ( path[ 0 ] != (wchar_t) LIBCPATH_SEPARATOR ) ) )
+	{
+		use_base_path = 1;
+	}
+	/* The first pass determines the size of the normalized path
+	 * the second pass writes the normalized path
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		if( pass == 1 )
+		{
+			if( normalized_path == NULL )
+			{
+				break;
+			}
+			if( normalized_path_size < safe_normalized_path_size )
+			{
+				*required_normalized_path_size = safe_normalized_path_size;
+
+				return( 0 );
+			}
+		}
+		normalized_path_length       = 0;
+		number_of_parent_directories = 0;
+
+		if( libcpath_path_normalize_segments_wide(
+		     path,
+		     path_length,
+		     ( pass == 1 ) ? normalized_path : NULL,
+		     safe_normalized_path_size - 1,
+		     &normalized_path_length,
+		     &number_of_parent_directories,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to normalize path segments.",
+			 function );
+
+			return( -1 );
+		}
+		if( use_base_path != 0 )
+		{
+			if( libcpath_path_normalize_segments_wide(
+			     base_path,
+			     base_path_length,
+			     ( pass == 1 ) ? normalized_path : NULL,
+			     safe_normalized_path_size - 1,
+			     &normalized_path_length,
+			     &number_of_parent_directories,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to normalize base path segments.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		/* The normalized path of the root directory consists of a single separator
+		 */
+		if( normalized_path_length == 0 )
+		{
+			normalized_path_length = 1;
+
+			if( pass == 1 )
+			{
+				normalized_path[ 0 ] = (wchar_t) LIBCPATH_SEPARATOR;
+			}
+		}
+		if( pass == 0 )
+		{
+			safe_normalized_path_size = normalized_path_length + 1;
+		}
+		else
+		{
+			normalized_path[ normalized_path_length ] = 0;
+		}
+	}
+	*required_normalized_path_size = safe_normalized_path_size;
+
+	return( 1 );
+}
+
+/* Normalizes a path into an absolute path using a normalized base path
+ * The base path must be normalized, for example by libcpath_path_normalize_with_base_wide,
+ * and the root directory is represented by an empty base path. A parent
+ * directory (..) segment of the path removes the last segment of the base path
+ * hence the base path is not scanned again for every path it is combined with
+ * Returns 1 if successful, 0 if the normalized path size is too small or -1 on error
+ */
+int libcpath_path_normalize_with_normalized_base_wide(
+     const wchar_t *base_path,
+     size_t base_path_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcpath_path_normalize_with_normalized_base_wide";
+	size_t normalized_path_length       = 0;
+	size_t number_of_parent_directories = 0;
+	size_t safe_normalized_path_size    = 0;
+
+	if( ( base_path == NULL )
+	 && ( base_path_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_path_length > ( (size_t) ( SSIZE_MAX - 2 ) - path_length ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_normalized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required normalized path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length > 0 )
+	 && ( path[ 0 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		base_path_length = 0;
+	}
+	if( libcpath_path_normalize_segments_wide(
+	     path,
+	     path_length,
+	     NULL,
+	     0,
+	     &normalized_path_length,
+	     &number_of_parent_directories,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of normalized path segments.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every remaining parent directory (..) segment removes the last segment
+	 * of the base path
+	 */
+	while( ( number_of_parent_directories > 0 )
+	    && ( base_path_length > 0 ) )
+	{
+		base_path_length--;
+
+		while( ( base_path_length > 0 )
+		    && ( base_path[ base_path_length ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			base_path_length--;
+		}
+		number_of_parent_directories--;
+	}
+	safe_normalized_path_size = base_path_length + normalized_path_length + 1;
+
+	/* The normalized path of the root directory consists of a single separator
+	 */
+	if( safe_normalized_path_size == 1 )
+	{
+		safe_normalized_path_size = 2;
+	}
+	*required_normalized_path_size = safe_normalized_path_size;
+
+	if( normalized_path == NULL )
+	{
+		return( 1 );
+	}
+	if( normalized_path_size < safe_normalized_path_size )
+	{
+		return( 0 );
+	}
+	if( base_path_length > 0 )
+	{
+		if( wide_string_copy(
+		     normalized_path,
+		     base_path,
+		     base_path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy base path to normalized path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	normalized_path_length       = 0;
+	number_of_parent_directories = 0;
+
+	if( libcpath_path_normalize_segments_wide(
+	     path,
+	     path_length,
+	     normalized_path,
+	     safe_normalized_path_size - 1,
+	     &normalized_path_length,
+	     &number_of_parent_directories,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to normalize path segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_normalized_path_size == 2 )
+	{
+		normalized_path[ 0 ] = (wchar_t) LIBCPATH_SEPARATOR;
+	}
+	normalized_path[ safe_normalized_path_size - 1 ] = 0;
+
+	return( 1 );
+}
+
+#if !defined( WINAPI )
+
+/* Normalizes a wide path combined with a narrow base path that is already normalized,
+ * such as the current working directory returned by getcwd
+ * The part of the base path that remains after the parent directory (..) segments
+ * are applied is decoded directly into the normalized path, hence no wide copy
+ * of the base path is needed
+ * Returns 1 if successful, 0 if the normalized path size is too small or -1 on error
+ */
+int libcpath_path_normalize_with_normalized_narrow_base_wide(
+     const char *base_path,
+     size_t base_path_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcpath_path_normalize_with_normalized_narrow_base_wide";
+	size_t normalized_path_length       = 0;
+	size_t number_of_parent_directories = 0;
+	size_t safe_normalized_path_size    = 0;
+	size_t wide_base_path_size          = 0;
+
+	if( ( base_path == NULL )
+	 && ( base_path_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_path_length > ( (size_t) ( SSIZE_MAX - 2 ) - path_length ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_normalized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required normalized path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length > 0 )
+	 && ( path[ 0 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		base_path_length = 0;
+	}
+	/* The root directory is represented by an empty base path
+	 */
+	while( ( base_path_length > 0 )
+	    && ( base_path[ base_path_length - 1 ] == LIBCPATH_SEPARATOR ) )
+	{
+		base_path_length--;
+	}
+	if( libcpath_path_normalize_segments_wide(
+	     path,
+	     path_length,
+	     NULL,
+	     0,
+	     &normalized_path_length,
+	     &number_of_parent_directories,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of normalized path segments.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every remaining parent directory (..) segment removes the last segment
+	 * of the base path
+	 */
+	while( ( number_of_parent_directories > 0 )
+	    && ( base_path_length > 0 ) )
+	{
+		base_path_length--;
+
+		while( ( base_path_length > 0 )
+		    && ( base_path[ base_path_length ] != LIBCPATH_SEPARATOR ) )
+		{
+			base_path_length--;
+		}
+		number_of_parent_directories--;
+	}
+	/* The base path is not terminated at base_path_length, hence the wide
+	 * string size includes an end of string character that is not part
+	 * of the base path
+	 */
+	if( base_path_length > 0 )
+	{
+		if( libcpath_system_string_size_to_wide_string(
+		     base_path,
+		     base_path_length,
+		     &wide_base_path_size,
+		     codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to determine wide base path size.",
+			 function );
+
+			return( -1 );
+		}
+		if( wide_base_path_size > 0 )
+		{
+			wide_base_path_size -= 1;
+		}
+	}
+	safe_normalized_path_size = wide_base_path_size + normalized_path_length + 1;
+
+	/* The normalized path of the root directory consists of a single separator
+	 */
+	if( safe_normalized_path_size == 1 )
+	{
+		safe_normalized_path_size = 2;
+	}
+	*required_normalized_path_size = safe_normalized_path_size;
+
+	if( normalized_path == NULL )
+	{
+		return( 1 );
+	}
+	if( normalized_path_size < safe_normalized_path_size )
+	{
+		return( 0 );
+	}
+	if( wide_base_path_size > 0 )
+	{
+		if( libcpath_system_string_copy_to_wide_string(
+		     base_path,
+		     base_path_length,
+		     normalized_path,
+		     wide_base_path_size + 1,
+		     codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to copy base path to normalized path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	normalized_path_length       = 0;
+	number_of_parent_directories = 0;
+
+	if( libcpath_path_normalize_segments_wide(
+	     path,
+	     path_length,
+	     normalized_path,
+	     safe_normalized_path_size - 1,
+	     &normalized_path_length,
+	     &number_of_parent_directories,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to normalize path segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_normalized_path_size == 2 )
+	{
+		normalized_path[ 0 ] = (wchar_t) LIBCPATH_SEPARATOR;
+	}
+	normalized_path[ safe_normalized_path_size - 1 ] = 0;
+
+	return( 1 );
+}
+
+#endif /* !defined( WINAPI ) */
+
+#if defined( WINAPI )
+
+/* Determines the path type
+ * Returns 1 if succesful or -1 on error
+ */
+int libcpath_path_get_path_type_wide(
+     const wchar_t *path,
+     size_t path_length,
+     uint8_t *path_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_get_path_type_wide";
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path type.",
+		 function );
+
+		return( -1 );
+	}
+	*path_type = LIBCPATH_TYPE_RELATIVE;
+
+	/* Determine if the path is a special path
+	 * device path prefix:          \\.\
+	 * extended-length path prefix: \\?\
+	 */
+	if( ( path_length >= 4 )
+	 && ( path[ 0 ] == (wchar_t) '\\' )
+	 && ( path[ 1 ] == (wchar_t) '\\' )
+	 && ( ( path[ 2 ] == (wchar_t) '.' )
+	  ||  ( path[ 2 ] == (wchar_t) '?' ) )
+	 && ( path[ 3 ] == (wchar_t) '\\' ) )
+	{
+		if( path[ 2 ] == (wchar_t) '.' )
+		{
+			*path_type = LIBCPATH_TYPE_DEVICE;
+		}
+		/* Determine if the path in an extended-length UNC path
+		 * \\?\UNC\server\share
+		 */
+		else if( ( path_length >= 8 )
+		      && ( path[ 4 ] == (wchar_t) 'U' )
+		      && ( path[ 5 ] == (wchar_t) 'N' )
+		      && ( path[ 6 ] == (wchar_t) 'C' )
+		      && ( path[ 7 ] == (wchar_t) '\\' ) )
+		{
+			*path_type = LIBCPATH_TYPE_EXTENDED_LENGTH_UNC;
+		}
+		else
+		{
+			*path_type = LIBCPATH_TYPE_EXTENDED_LENGTH;
+		}
+	}
+	/* Determine if the path is an UNC path
+	 * \\server\share
+	 */
+	else if( ( path_length >= 2 )
+	      && ( path[ 0 ] == (wchar_t) '\\' )
+	      && ( path[ 1 ] == (wchar_t) '\\' ) )
+	{
+		*path_type = LIBCPATH_TYPE_UNC;
+	}
+	else if( path[ 0 ] == (wchar_t) '\\' )
+	{
+		*path_type = LIBCPATH_TYPE_ABSOLUTE;
+	}
+	else if( ( path_length >= 3 )
+	      && ( path[ 1 ] == (wchar_t) ':' )
+	      && ( path[ 2 ] == (wchar_t) '\\' )
+	      && ( ( ( path[ 0 ] >= (wchar_t) 'A' )
+	        &&   ( path[ 0 ] <= (wchar_t) 'Z' ) )
+	       ||  ( ( path[ 0 ] >= (wchar_t) 'a' )
+	        &&   ( path[ 0 ] <= (wchar_t) 'z' ) ) ) )
+	{
+		*path_type = LIBCPATH_TYPE_ABSOLUTE;
+	}
+	return( 1 );
+}
+
+/* Determines the volume name
+ * Returns 1 if succesful or -1 on error
+ */
+int libcpath_path_get_volume_name_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **volume_name,
+     size_t *volume_name_length,
+     size_t *directory_name_index,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcpath_path_get_volume_name_wide";
+	size_t path_index        = 0;
+	size_t share_name_index  = 0;
+	size_t volume_name_index = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume name.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume name length.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name index.",
+		 function );
+
+		return( -1 );
+	}
+	*volume_name          = NULL;
+	*volume_name_length   = 0;
+	*directory_name_index = 0;
+
+	/* Determine if the path is a special path
+	 * device path prefix:          \\.\
+	 * extended-length path prefix: \\?\
+	 */
+	if( ( path_length >= 4 )
+	 && ( path[ 0 ] == (wchar_t) '\\' )
+	 && ( path[ 1 ] == (wchar_t) '\\' )
+	 && ( ( path[ 2 ] == (wchar_t) '.' )
+	  ||  ( path[ 2 ] == (wchar_t) '?' ) )
+	 && ( path[ 3 ] == (wchar_t) '\\' ) )
+	{
+		if( path[ 2 ] == (wchar_t) '.' )
+		{
+			volume_name_index = 4;
+		}
+		/* Determine if the path in an extended-length UNC path
+		 * \\?\UNC\server\share
+		 */
+		else if( ( path_length >= 8 )
+		      && ( path[ 4 ] == (wchar_t) 'U' )
+		      && ( path[ 5 ] == (wchar_t) 'N' )
+		      && ( path[ 6 ] == (wchar_t) 'C' )
+		      && ( path[ 7 ] == (wchar_t) '\\' ) )
+		{
+			volume_name_index = 8;
+		}
+		else
+		{
+			volume_name_index = 4;
+		}
+	}
+	/* Determine if the path is an UNC path
+	 * \\server\share
+	 */
+	else if( ( path_length >= 2 )
+	      && ( path[ 0 ] == (wchar_t) '\\' )
+	      && ( path[ 1 ] == (wchar_t) '\\' ) )
+	{
+		volume_name_index = 2;
+	}
+	/* Check if the path contains a volume letter
+	 */
+	if( ( path_length >= 2 )
+	 && ( volume_name_index <= ( path_length - 2 ) )
+	 && ( path[ volume_name_index + 1 ] == (wchar_t) ':' )
+	 && ( ( ( path[ volume_name_index ] >= (wchar_t) 'A' )
+	   &&   ( path[ volume_name_index ] <= (wchar_t) 'Z' ) )
+	  ||  ( ( path[ volume_name_index ] >= (wchar_t) 'a' )
+	   &&   ( path[ volume_name_index ] <= (wchar_t) 'z' ) ) ) )
+	{
+		path_index = volume_name_index + 2;
+
+		if( ( path_index < path_length )
+		 && ( path[ path_index ] == (wchar_t) '\\' ) )
+		{
+			path_index++;
+		}
+		*volume_name        = (wchar_t *) &( path[ volume_name_index ] );
+		*volume_name_length = path_index - volume_name_index;
+
+		if( path[ path_index - 1 ] == (wchar_t) '\\' )
+		{
+			*volume_name_length -= 1;
+		}
+		*directory_name_index = path_index;
+	}
+	else if( volume_name_index == 4 )
+	{
+		for( path_index = volume_name_index;
+		     path_index < path_length;
+		     path_index++ )
+		{
+			if( path[ path_index ] == (wchar_t) '\\' )
+			{
+				path_index++;
+
+				break;
+			}
+		}
+		*volume_name        = (wchar_t *) &( path[ 4 ] );
+		*volume_name_length = path_index - 4;
+
+		if( path[ path_index - 1 ] == (wchar_t) '\\' )
+		{
+			*volume_name_length -= 1;
+		}
+		*directory_name_index = path_index;
+	}
+	else if( ( volume_name_index == 2 )
+	      || ( volume_name_index == 8 ) )
+	{
+		for( share_name_index = volume_name_index;
+		     share_name_index < path_length;
+		     share_name_index++ )
+		{
+			if( path[ share_name_index ] == (wchar_t) '\\' )
+			{
+				share_name_index++;
+
+				break;
+			}
+		}
+		if( share_name_index > path_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid path - missing share name.",
+			 function );
+
+			return( -1 );
+		}
+		for( path_index = share_name_index;
+		     path_index < path_length;
+		     path_index++ )
+		{
+			if( path[ path_index ] == (wchar_t) '\\' )
+			{
+				path_index++;
+
+				break;
+			}
+		}
+		*volume_name        = (wchar_t *) &( path[ volume_name_index ] );
+		*volume_name_length = path_index - volume_name_index;
+
+		if( path[ path_index - 1 ] == (wchar_t) '\\' )
+		{
+			*volume_name_length -= 1;
+		}
+		*directory_name_index = path_index;
+	}
+	return( 1 );
+}
+
+/* Retrieves the current working directory of a specific volume
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_current_working_directory_by_volume_wide(
+     wchar_t *volume_name,
+     size_t volume_name_length,
+     wchar_t **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error )
+{
+	wchar_t *change_volume_name                  = NULL;
+	wchar_t *current_volume_working_directory    = NULL;
+	static char *function                        = "libcpath_path_get_current_working_directory_by_volume_wide";
+	size_t current_volume_working_directory_size = 0;
+	int result                                   = 1;
+
+	if( current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_working_directory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory size.",
+		 function );
+
+		return( -1 );
+	}
+	/* If the path contains a volume name switch to that
+	 * volume to determine the current directory
+	 */
+	if( volume_name != NULL )
+	{
+		if( volume_name_length > (size_t) ( SSIZE_MAX - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid volume name length value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcpath_path_get_current_working_directory_wide(
+		     &current_volume_working_directory,
+		     &current_volume_working_directory_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current volume working directory.",
+			 function );
+
+			goto on_error;
+		}
+		change_volume_name = libcpath_allocator_allocate_wide_string(
+		                      volume_name_length + 1 );
+
+		if( change_volume_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create change volume name.",
+			 function );
+
+			goto on_error;
+		}
+		if( wide_string_copy(
+		     change_volume_name,
+		     volume_name,
+		     volume_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to set change volume name.",
+			 function );
+
+			goto on_error;
+		}
+		change_volume_name[ volume_name_length ] = 0;
+
+		if( libcpath_path_change_directory_wide(
+		     change_volume_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to change current working directory.",
+			 function );
+
+			goto on_error;
+		}
+		libcpath_allocator_free(
+		 change_volume_name );
+
+		change_volume_name = NULL;
+	}
+	if( libcpath_path_get_current_working_directory_wide(
+	     current_working_directory,
+	     current_working_directory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current directory.",
+		 function );
+
+		/* Make sure the current working directory has been changed
+		 * back to its original value
+		 */
+		result = -1;
+	}
+	if( current_volume_working_directory != NULL )
+	{
+		if( libcpath_path_change_directory_wide(
+		     current_volume_working_directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to change current working directory.",
+			 function );
+
+			goto on_error;
+		}
+		libcpath_allocator_free(
+		 current_volume_working_directory );
+
+		current_volume_working_directory = NULL;
+	}
+	return( result );
+
+on_error:
+	if( change_volume_name != NULL )
+	{
+		libcpath_allocator_free(
+		 change_volume_name );
+	}
+	if( current_volume_working_directory != NULL )
+	{
+		libcpath_allocator_free(
+		 current_volume_working_directory );
+	}
+	if( *current_working_directory != NULL )
+	{
+		libcpath_allocator_free(
+		 *current_working_directory );
+
+		*current_working_directory = NULL;
+	}
+	*current_working_directory_size = 0;
+
+	return( -1 );
+}
+
+/* Determines the full path of the Windows path specified
+ * The function uses the extended-length path format
+ * (path with \\?\ prefix)
+ *
+ * Multiple successive \ not at the start of the path are combined into one
+ *
+ * Scenario's that are considered full paths:
+ * Device path:			\\.\PhysicalDrive0
+ * Extended-length path:	\\?\C:\directory\file.txt
+ * Extended-length UNC path:	\\?\UNC\server\share\directory\file.txt
+ *
+ * Scenario's that are not considered full paths:
+ * Local 'absolute' path:	\directory\file.txt
+ * Local 'relative' path:	..\directory\file.txt
+ * Local 'relative' path:	.\directory\file.txt
+ * Volume 'absolute' path:	C:\directory\file.txt
+ *                              C:\..\directory\file.txt
+ * Volume 'relative' path:	C:directory\file.txt
+ * UNC path:			\\server\share\directory\file.txt
+ *
+ * Returns 1 if succesful or -1 on error
+ */
+int libcpath_path_get_full_path_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	libcsplit_wide_split_string_t *current_directory_split_string = NULL;
+	libcsplit_wide_split_string_t *path_split_string              = NULL;
+	wchar_t *current_directory                                    = NULL;
+	wchar_t *current_directory_string_segment                     = NULL;
+	wchar_t *full_path_prefix                                     = NULL;
+	wchar_t *last_used_path_string_segment                        = NULL;
+	wchar_t *path_string_segment                                  = NULL;
+	wchar_t *volume_name                                          = NULL;
+	int *path_segment_stack                                       = NULL;
+	static char *function                                         = "libcpath_path_get_full_path_wide";
+	size_t current_directory_length                               = 0;
+	size_t current_directory_name_index                           = 0;
+	size_t current_directory_size                                 = 0;
+	size_t current_directory_string_segment_size                  = 0;
+	size_t full_path_index                                        = 0;
+	size_t full_path_prefix_length                                = 0;
+	size_t last_used_path_string_segment_size                     = 0;
+	size_t path_directory_name_index                              = 0;
+	size_t path_string_segment_size                               = 0;
+	size_t safe_full_path_size                                    = 0;
+	size_t volume_name_length                                     = 0;
+	uint8_t path_type                                             = LIBCPATH_TYPE_RELATIVE;
+	int current_directory_number_of_segments                      = 0;
+	int current_directory_segment_index                           = 0;
+	int last_used_path_segment_index                              = 0;
+	int path_number_of_segments                                   = 0;
+	int path_segment_index                                        = 0;
+	int path_segment_stack_depth                                  = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_path_type_wide(
+	     path,
+	     path_length,
+	     &path_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path type.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_get_volume_name_wide(
+	     path,
+	     path_length,
+	     &volume_name,
+	     &volume_name_length,
+	     &path_directory_name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine volume name.",
+		 function );
+
+		goto on_error;
+	}
+	/* If the path is a device path, an extended-length path or an UNC
+	 * do not bother to lookup the current working directory
+	 */
+	if( ( path_type != LIBCPATH_TYPE_DEVICE )
+	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH )
+	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
+	 && ( path_type != LIBCPATH_TYPE_UNC ) )
+	{
+		if( libcpath_path_get_current_working_directory_by_volume_wide(
+		     volume_name,
+		     volume_name_length,
+		     &current_directory,
+		     &current_directory_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current working directory by volume.",
+			 function );
+
+			goto on_error;
+		}
+		/* Determine the volume name using the current working directory if necessary
+		 */
+		if( libcpath_path_get_volume_name_wide(
+		     current_directory,
+		     current_directory_size - 1,
+		     &volume_name,
+		     &volume_name_length,
+		     &current_directory_name_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine volume name from current working directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( current_directory != NULL )
+	 && ( current_directory_name_index < current_directory_size ) )
+	{
+		current_directory_length = wide_string_length(
+		                            &( current_directory[ current_directory_name_index ] ) );
+
+		if( libcsplit_wide_string_split(
+		     &( current_directory[ current_directory_name_index ] ),
+		     current_directory_length + 1,
+		     (wchar_t) '\\',
+		     &current_directory_split_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to split current working directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcsplit_wide_string_split(
+	     &( path[ path_directory_name_index ] ),
+	     path_length - path_directory_name_index + 1,
+	     (wchar_t) '\\',
+	     &path_split_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split path.",
+		 function );
+
+		goto on_error;
+	}
+	/* The size of the full path consists of:
+	 * the size of the prefix (\\?\ or \\.\)
+	 * the length of the volume name
+	 * a directory separator
+	 */
+	safe_full_path_size = 4;
+
+	/* If the path contains a volume name
+	 * the length of the volume name
+	 * a directory separator
+	 */
+	if( volume_name != NULL )
+	{
+		safe_full_path_size += volume_name_length + 1;
+	}
+	/* If the path contains an UNC path
+	 * add the size of the UNC\ prefix
+	 */
+	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
+	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	{
+		safe_full_path_size += 4;
+	}
+	/* If the path is relative
+	 * add the size of the current working directory
+	 * a directory separator, if necessary
+	 */
+	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
+	 && ( current_directory_name_index < current_directory_size ) )
+	{
+		safe_full_path_size += ( current_directory_size - ( current_directory_name_index + 1 ) );
+
+		if( ( current_directory_size >= 2 )
+		 && ( current_directory[ current_directory_size - 2 ] != (wchar_t) '\\' ) )
+		{
+			safe_full_path_size += 1;
+		}
+	}
+	if( current_directory_split_string != NULL )
+	{
+		if( libcsplit_wide_split_string_get_number_of_segments(
+		     current_directory_split_string,
+		     &current_directory_number_of_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of current working directory string segments.",
+			 function );
+
+			goto on_error;
+		}
+		current_directory_segment_index = current_directory_number_of_segments - 1;
+	}
+	if( libcsplit_wide_split_string_get_number_of_segments(
+	     path_split_string,
+	     &path_number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of path string segments.",
+		 function );
+
+		goto on_error;
+	}
+	/* The indexes of the kept path segments are maintained on a stack
+	 * so that a parent directory (..) segment removes the last kept
+	 * segment in constant time, which bounds the cost by the number
+	 * of segments in the path
+	 */
+	path_segment_stack = (int *) libcpath_allocator_allocate(
+	                              sizeof( int ) * path_number_of_segments );
+
+	if( path_segment_stack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path segment stack.",
+		 function );
+
+		goto on_error;
+	}
+	for( path_segment_index = 0;
+	     path_segment_index < path_number_of_segments;
+	     path_segment_index++ )
+	{
+		if( libcsplit_wide_split_string_get_segment_by_index(
+		     path_split_string,
+		     path_segment_index,
+		     &path_string_segment,
+		     &path_string_segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path string segment: %d.",
+			 function,
+			 path_segment_index );
+
+			goto on_error;
+		}
+		if( path_string_segment == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing path string segment: %d.",
+			 function,
+			 path_segment_index );
+
+			goto on_error;
+		}
+		/* If the path is .. reverse the current path by one directory
+		 */
+		if( ( path_string_segment_size == 3 )
+		 && ( path_string_segment[ 0 ] == (wchar_t) '.' )
+		 && ( path_string_segment[ 1 ] == (wchar_t) '.' ) )
+		{
+			if( path_segment_stack_depth > 0 )
+			{
+				path_segment_stack_depth--;
+
+				last_used_path_segment_index = path_segment_stack[ path_segment_stack_depth ];
+
+				if( libcsplit_wide_split_string_get_segment_by_index(
+				     path_split_string,
+				     last_used_path_segment_index,
+				     &last_used_path_string_segment,
+				     &last_used_path_string_segment_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve last used path string segment: %d.",
+					 function,
+					 last_used_path_segment_index );
+
+					goto on_error;
+				}
+				if( last_used_path_string_segment == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing last used path string string segment: %d.",
+					 function,
+					 last_used_path_segment_index );
+
+					goto on_error;
+				}
+				/* Remove the size of the parent directory name and a directory separator
+				 * Note that the size includes the end of string character
+				 */
+				safe_full_path_size -= last_used_path_string_segment_size;
+
+				if( libcsplit_wide_split_string_set_segment_by_index(
+				     path_split_string,
+				     last_used_path_segment_index,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set path string segment: %d.",
+					 function,
+					 last_used_path_segment_index );
+
+					goto on_error;
+				}
+			}
+			else if( ( path_type == LIBCPATH_TYPE_RELATIVE )
+			      && ( current_directory_split_string != NULL )
+			      && ( current_directory_segment_index >= 0 ) )
+			{
+				if( libcsplit_wide_split_string_get_segment_by_index(
+				     current_directory_split_string,
+				     current_directory_segment_index,
+				     &current_directory_string_segment,
+				     &current_directory_string_segment_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve current working directory string segment: %d.",
+					 function,
+					 current_directory_segment_index );
+
+					goto on_error;
+				}
+				if( current_directory_string_segment == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing current working directory string segment: %d.",
+					 function,
+					 current_directory_segment_index );
+
+					goto on_error;
+				}
+				/* Remove the size of the parent directory name and a directory separator
+				 * Note that the size includes the end of string character
+				 */
+				safe_full_path_size -= current_directory_string_segment_size;
+
+				if( libcsplit_wide_split_string_set_segment_by_index(
+				     current_directory_split_string,
+				     current_directory_segment_index,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set current working directory string segment: %d.",
+					 function,
+					 current_directory_segment_index );
+
+					goto on_error;
+				}
+				current_directory_segment_index--;
+			}
+			if( libcsplit_wide_split_string_set_segment_by_index(
+			     path_split_string,
+			     path_segment_index,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set path string segment: %d.",
+				 function,
+				 path_segment_index );
+
+				goto on_error;
+			}
+		}
+		/* If the path is . ignore the entry
+		 */
+		else if( ( path_string_segment_size == 2 )
+		      && ( path_string_segment[ 0 ] == (wchar_t) '.' ) )
+		{
+			if( libcsplit_wide_split_string_set_segment_by_index(
+			     path_split_string,
+			     path_segment_index,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set path string segment: %d.",
+				 function,
+				 path_segment_index );
+
+				goto on_error;
+			}
+		}
+		/* If the path is empty ignore the entry
+		 */
+		else if( path_string_segment_size <= 1 )
+		{
+			if( libcsplit_wide_split_string_set_segment_by_index(
+			     path_split_string,
+			     path_segment_index,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set path string segment: %d.",
+				 function,
+				 path_segment_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			/* Add the size of the directory or file name and a directory separator
+			 * Note that the size includes the end of string character
+			 */
+			safe_full_path_size += path_string_segment_size;
+
+			path_segment_stack[ path_segment_stack_depth ] = path_segment_index;
+
+			path_segment_stack_depth++;
+		}
+	}
+	/* Note that the last path separator serves as the end of string
+	 */
+	full_path_index = 0;
+
+	*full_path = libcpath_allocator_allocate_wide_string(
+	              safe_full_path_size );
+
+	if( *full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *full_path,
+	     0,
+	     sizeof( wchar_t ) * safe_full_path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear full path.",
+		 function );
+
+		goto on_error;
+	}
+	*full_path_size = safe_full_path_size;
+
+	if( path_type == LIBCPATH_TYPE_DEVICE )
+	{
+		full_path_prefix        = L"\\\\.\\";
+		full_path_prefix_length = 4;
+	}
+	else
+	{
+		full_path_prefix        = L"\\\\?\\";
+		full_path_prefix_length = 4;
+	}
+	if( wide_string_copy(
+	     &( ( *full_path )[ full_path_index ] ),
+	     full_path_prefix,
+	     full_path_prefix_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set prefix in full path.",
+		 function );
+
+		goto on_error;
+	}
+	full_path_index += full_path_prefix_length;
+
+	/* If there is a share name the path is an UNC path
+	 */
+	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
+	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	{
+		if( wide_string_copy(
+		     &( ( *full_path )[ full_path_index ] ),
+		     L"UNC\\",
+		     4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set UNC\\ prefix in full path.",
+			 function );
+
+			goto on_error;
+		}
+		full_path_index += 4;
+	}
+	if( volume_name != NULL )
+	{
+		if( wide_string_copy(
+		     &( ( *full_path )[ full_path_index ] ),
+		     volume_name,
+		     volume_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set volume name in full path.",
+			 function );
+
+			goto on_error;
+		}
+		full_path_index += volume_name_length;
+
+		( *full_path )[ full_path_index ] = (wchar_t) '\\';
+
+		full_path_index += 1;
+	}
+	/* If the path is relative
+	 * add the current working directory elements
+	 */
+	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
+	 && ( current_directory_split_string != NULL ) )
+	{
+		for( current_directory_segment_index = 0;
+		     current_directory_segment_index < current_directory_number_of_segments;
+		     current_directory_segment_index++ )
+		{
+			if( libcsplit_wide_split_string_get_segment_by_index(
+			     current_directory_split_string,
+			     current_directory_segment_index,
+			     &current_directory_string_segment,
+			     &current_directory_string_segment_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current working directory string segment: %d.",
+				 function,
+				 current_directory_segment_index );
+
+				goto on_error;
+			}
+			if( current_directory_string_segment_size != 0 )
+			{
+				if( current_directory_string_segment == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing current working directory string segment: %d.",
+					 function,
+					 current_directory_segment_index );
+
+					goto on_error;
+				}
+				if( wide_string_copy(
+				     &( ( *full_path )[ full_path_index ] ),
+				     current_directory_string_segment,
+				     current_directory_string_segment_size - 1 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set current working directory split value: %d in full path.",
+					 function,
+					 current_directory_segment_index );
+
+					goto on_error;
+				}
+				full_path_index += current_directory_string_segment_size - 1;
+
+				( *full_path )[ full_path_index ] = (wchar_t) '\\';
+
+				full_path_index += 1;
+			}
+		}
+	}
+	for( path_segment_index = 0;
+	     path_segment_index < path_number_of_segments;
+	     path_segment_index++ )
+	{
+		if( libcsplit_wide_split_string_get_segment_by_index(
+		     path_split_string,
+		     path_segment_index,
+		     &path_string_segment,
+		     &path_string_segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path string segment: %d.",
+			 function,
+			 path_segment_index );
+
+			goto on_error;
+		}
+		if( path_string_segment_size != 0 )
+		{
+			if( path_string_segment == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing path string segment: %d.",
+				 function,
+				 path_segment_index );
+
+				goto on_error;
+			}
+			if( wide_string_copy(
+			     &( ( *full_path )[ full_path_index ] ),
+			     path_string_segment,
+			     path_string_segment_size - 1 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set path split value: %d in full path.",
+				 function,
+				 path_segment_index );
+
+				goto on_error;
+			}
+			full_path_index += path_string_segment_size - 1;
+
+			( *full_path )[ full_path_index ] = (wchar_t) '\\';
+
+			full_path_index += 1;
+		}
+	}
+	( *full_path )[ full_path_index - 1 ] = 0;
+
+	libcpath_allocator_free(
+	 path_segment_stack );
+
+	path_segment_stack = NULL;
+
+	if( libcsplit_wide_split_string_free(
+	     &path_split_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free path split string.",
+		 function );
+
+		goto on_error;
+	}
+	if( current_directory_split_string != NULL )
+	{
+		if( libcsplit_wide_split_string_free(
+		     &current_directory_split_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free current working directory split string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( current_directory != NULL )
+	{
+		libcpath_allocator_free(
+		 current_directory );
+	}
+	return( 1 );
+
+on_error:
+	if( *full_path != NULL )
+	{
+		libcpath_allocator_free(
+		 *full_path );
+
+		*full_path = NULL;
+	}
+	*full_path_size = 0;
+
+	if( path_segment_stack != NULL )
+	{
+		libcpath_allocator_free(
+		 path_segment_stack );
+	}
+	if( path_split_string != NULL )
+	{
+		libcsplit_wide_split_string_free(
+		 &path_split_string,
+		 NULL );
+	}
+	if( current_directory_split_string != NULL )
+	{
+		libcsplit_wide_split_string_free(
+		 &current_directory_split_string,
+		 NULL );
+	}
+	if( current_directory != NULL )
+	{
+		libcpath_allocator_free(
+		 current_directory );
+	}
+	return( -1 );
+}
+
+#else
+
+/* Determines the full path of the POSIX path specified
+ * Multiple successive / are combined into one
+ *
+ * Scenarios:
+ * /home/user/file.txt
+ * /home/user//file.txt
+ * /home/user/../user/file.txt
+ * /../home/user/file.txt
+ * user/../user/file.txt
+ *
+ * The path is normalized in a single backwards pass, without splitting it
+ * into segments, and the full path is allocated with its exact size
+ * The current working directory is decoded directly into the full path,
+ * hence the full path is the only allocation
+ * Relative paths are resolved against the working directory or, when NULL,
+ * the current working directory of the process
+ * The codepage is used for the narrow strings, where 0 represents UTF-8
+ * Returns 1 if succesful or -1 on error
+ */
+int libcpath_path_get_full_path_with_working_directory_wide(
+     const char *working_directory,
+     size_t working_directory_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	char current_directory_buffer[ LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE ];
+
+	const char *base_path           = NULL;
+	char *current_directory         = NULL;
+	static char *function           = "libcpath_path_get_full_path_with_working_directory_wide";
+	size_t current_directory_length = 0;
+	size_t safe_full_path_size      = 0;
+
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+	int result                      = 0;
+#endif
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path[ 0 ] != (wchar_t) '/' )
+	 && ( working_directory != NULL ) )
+	{
+		base_path                = working_directory;
+		current_directory_length = working_directory_length;
+	}
+	else if( path[ 0 ] != (wchar_t) '/' )
+	{
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+		result = libcpath_path_get_cached_current_working_directory(
+		          &base_path,
+		          &current_directory_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached current working directory.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+#endif
+		{
+			if( libcpath_path_getcwd(
+			     current_directory_buffer,
+			     LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE,
+			     &current_directory,
+			     &current_directory_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current working directory.",
+				 function );
+
+				goto on_error;
+			}
+			base_path = current_directory;
+		}
+	}
+	if( libcpath_path_normalize_with_normalized_narrow_base_wide(
+	     base_path,
+	     current_directory_length,
+	     path,
+	     path_length,
+	     NULL,
+	     0,
+	     &safe_full_path_size,
+	     codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path size.",
+		 function );
+
+		goto on_error;
+	}
+	*full_path = libcpath_allocator_allocate_wide_string(
+	              safe_full_path_size );
+
+	if( *full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_normalize_with_normalized_narrow_base_wide(
+	     base_path,
+	     current_directory_length,
+	     path,
+	     path_length,
+	     *full_path,
+	     safe_full_path_size,
+	     &safe_full_path_size,
+	     codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set full path.",
+		 function );
+
+		goto on_error;
+	}
+	*full_path_size = safe_full_path_size;
+
+	if( ( current_directory != NULL )
+	 && ( current_directory != current_directory_buffer ) )
+	{
+		libcpath_allocator_free(
+		 current_directory );
+	}
+	return( 1 );
+
+on_error:
+	if( *full_path != NULL )
+	{
+		libcpath_allocator_free(
+		 *full_path );
+
+		*full_path = NULL;
+	}
+	*full_path_size = 0;
+
+	if( ( current_directory != NULL )
+	 && ( current_directory != current_directory_buffer ) )
+	{
+		libcpath_allocator_free(
+		 current_directory );
+	}
+	return( -1 );
+}
+
+/* Determines the full path of the POSIX path specified
+ * The codepage of the library is used for the narrow strings
+ * Returns 1 if succesful or -1 on error
+ */
+int libcpath_path_get_full_path_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_get_full_path_with_working_directory_wide(
+	         NULL,
+	         0,
+	         path,
+	         path_length,
+	         full_path,
+	         full_path_size,
+	         libclocale_codepage,
+	         error ) );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Determines the full path of the path specified using a context
+ * Relative paths are resolved against the working directory of the context,
+ * hence contexts can be used concurrently by different threads
+ * The codepage of the context is used for the narrow strings
+ * Returns 1 if succesful or -1 on error
+ */
+int libcpath_path_get_full_path_context_wide(
+     libcpath_context_t *context,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libcpath_path_get_full_path_context_wide";
+	int codepage                    = 0;
+
+#if !defined( WINAPI )
+	const char *working_directory   = NULL;
+	size_t working_directory_length = 0;
+#endif
+
+	if( libcpath_context_get_codepage(
+	     context,
+	     &codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve codepage from context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The wide character Windows API functions do not use a codepage
+	 */
+	return( libcpath_path_get_full_path_wide(
+	         path,
+	         path_length,
+	         full_path,
+	         full_path_size,
+	         error ) );
+#else
+	if( libcpath_context_get_working_directory(
+	     context,
+	     &working_directory,
+	     &working_directory_length,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve working directory from context.",
+		 function );
+
+		return( -1 );
+	}
+	return( libcpath_path_get_full_path_with_working_directory_wide(
+	         working_directory,
+	         working_directory_length,
+	         path,
+	         path_length,
+	         full_path,
+	         full_path_size,
+	         codepage,
+	         error ) );
+#endif
+}
+
+#if defined( WINAPI )
+
+/* Determines the full path of the Windows path specified into a buffer
+ * The full path is determined by libcpath_path_get_full_path_wide and copied
+ * into the buffer, hence this function does not prevent memory allocations
+ * Returns 1 if successful, 0 if the full path size is too small or -1 on error
+ */
+int libcpath_path_get_full_path_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error )
+{
+	wchar_t *safe_full_path    = NULL;
+	static char *function      = "libcpath_path_get_full_path_to_buffer_wide";
+	size_t safe_full_path_size = 0;
+	int result                 = 0;
+
+	if( ( full_path == NULL )
+	 && ( full_path_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required full path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_full_path_wide(
+	     path,
+	     path_length,
+	     &safe_full_path,
+	     &safe_full_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path.",
+		 function );
+
+		return( -1 );
+	}
+	*required_full_path_size = safe_full_path_size;
+
+	if( safe_full_path_size <= full_path_size )
+	{
+		if( wide_string_copy(
+		     full_path,
+		     safe_full_path,
+		     safe_full_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy full path.",
+			 function );
+
+			libcpath_allocator_free(
+			 safe_full_path );
+
+			return( -1 );
+		}
+		result = 1;
+	}
+	libcpath_allocator_free(
+	 safe_full_path );
+
+	return( result );
+}
+
+#else
+
+/* Determines the full path of the POSIX path specified into a buffer
+ * The current working directory is retrieved into a buffer on the stack and decoded
+ * directly into the full path, hence this function does not allocate memory
+ * unless the current working directory does not fit in that buffer
+ * Relative paths are resolved against the working directory or, when NULL,
+ * the current working directory of the process
+ * The codepage is used for the narrow strings, where 0 represents UTF-8
+ * Returns 1 if successful, 0 if the full path size is too small or -1 on error
+ */
+int libcpath_path_get_full_path_to_buffer_with_working_directory_wide(
+     const char *working_directory,
+     size_t working_directory_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	char narrow_current_directory_buffer[ LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE ];
+
+	const char *narrow_base_path           = NULL;
+	char *narrow_current_directory         = NULL;
+	static char *function                  = "libcpath_path_get_full_path_to_buffer_with_working_directory_wide";
+	size_t narrow_current_directory_length = 0;
+	int result                             = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( full_path == NULL )
+	 && ( full_path_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required full path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path[ 0 ] != (wchar_t) '/' )
+	 && ( working_directory != NULL ) )
+	{
+		narrow_base_path                = working_directory;
+		narrow_current_directory_length = working_directory_length;
+	}
+	else if( path[ 0 ] != (wchar_t) '/' )
+	{
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+		result = libcpath_path_get_cached_current_working_directory(
+		          &narrow_base_path,
+		          &narrow_current_directory_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached current working directory.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+#endif
+		{
+			if( libcpath_path_getcwd(
+			     narrow_current_directory_buffer,
+			     LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE,
+			     &narrow_current_directory,
+			     &narrow_current_directory_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current working directory.",
+				 function );
+
+				return( -1 );
+			}
+			narrow_base_path = narrow_current_directory;
+		}
+	}
+	result = libcpath_path_normalize_with_normalized_narrow_base_wide(
+	          narrow_base_path,
+	          narrow_current_directory_length,
+	          path,
+	          path_length,
+	          ( full_path_size > 0 ) ? full_path : NULL,
+	          full_path_size,
+	          required_full_path_size,
+	          codepage,
+	          error );
+
+	if( ( narrow_current_directory != NULL )
+	 && ( narrow_current_directory != narrow_current_directory_buffer ) )
+	{
+		libcpath_allocator_free(
+		 narrow_current_directory );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path.",
+		 function );
+
+		return( -1 );
+	}
+	else if( full_path_size == 0 )
+	{
+		return( 0 );
+	}
+	return( result );
+}
+
+/* Determines the full path of the POSIX path specified into a buffer
+ * The codepage of the library is used for the narrow strings
+ * Returns 1 if successful, 0 if the full path size is too small or -1 on error
+ */
+int libcpath_path_get_full_path_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_get_full_path_to_buffer_with_working_directory_wide(
+	         NULL,
+	         0,
+	         path,
+	         path_length,
+	         full_path,
+	         full_path_size,
+	         required_full_path_size,
+	         libclocale_codepage,
+	         error ) );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Determines the full path of the path specified into a buffer using a context
+ * Relative paths are resolved against the working directory of the context,
+ * hence contexts can be used concurrently by different threads
+ * The codepage of the context is used for the narrow strings
+ * Returns 1 if successful, 0 if the full path size is too small or -1 on error
+ */
+int libcpath_path_get_full_path_to_buffer_context_wide(
+     libcpath_context_t *context,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libcpath_path_get_full_path_to_buffer_context_wide";
+	int codepage                    = 0;
+
+#if !defined( WINAPI )
+	const char *working_directory   = NULL;
+	size_t working_directory_length = 0;
+#endif
+
+	if( libcpath_context_get_codepage(
+	     context,
+	     &codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve codepage from context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The wide character Windows API functions do not use a codepage
+	 */
+	return( libcpath_path_get_full_path_to_buffer_wide(
+	         path,
+	         path_length,
+	         full_path,
+	         full_path_size,
+	         required_full_path_size,
+	         error ) );
+#else
+	if( libcpath_context_get_working_directory(
+	     context,
+	     &working_directory,
+	     &working_directory_length,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve working directory from context.",
+		 function );
+
+		return( -1 );
+	}
+	return( libcpath_path_get_full_path_to_buffer_with_working_directory_wide(
+	         working_directory,
+	         working_directory_length,
+	         path,
+	         path_length,
+	         full_path,
+	         full_path_size,
+	         required_full_path_size,
+	         codepage,
+	         error ) );
+#endif
+}
+
+/* Determines the full path of the path specified
+ * The full path is allocated from the arena and remains valid until the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_full_path_arena_wide(
+     libcpath_arena_t *arena,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	void *data                 = NULL;
+	static char *function      = "libcpath_path_get_full_path_arena_wide";
+	size_t data_size           = 0;
+	size_t safe_full_path_size = 0;
+	int result                 = 0;
+
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The full path is written into the data available in the arena
+	 * and only if it does not fit, data of the required size is allocated
+	 */
+	if( libcpath_arena_get_available_data(
+	     arena,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve available data from arena.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          path,
+	          path_length,
+	          (wchar_t *) data,
+	          data_size / sizeof( wchar_t ),
+	          &safe_full_path_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path.",
+		 function );
+
+		return( -1 );
+	}
+	/* If the full path did not fit, data of the required size is allocated
+	 * and the full path is determined again, since the current working directory
+	 * can be changed in the meantime the required size can grow, in which case
+	 * this is repeated with the new required size
+	 */
+	do
+	{
+		if( libcpath_arena_allocate(
+		     arena,
+		     sizeof( wchar_t ) * safe_full_path_size,
+		     &data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to allocate full path from arena.",
+			 function );
+
+			return( -1 );
+		}
+		if( result == 0 )
+		{
+			result = libcpath_path_get_full_path_to_buffer_wide(
+			          path,
+			          path_length,
+			          (wchar_t *) data,
+			          safe_full_path_size,
+			          &safe_full_path_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine full path.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( result == 0 );
+
+	*full_path      = (wchar_t *) data;
+	*full_path_size = safe_full_path_size;
+
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Determines the full paths of the Windows paths specified
+ * The full path of every path is determined by libcpath_path_get_full_path_wide
+ * and appended to the full paths, hence this function does not prevent
+ * memory allocations
+ *
+ * The full paths are stored consecutively, each terminated by an end of string
+ * character, and full_path_offsets contains the offset of every full path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_full_paths_wide(
+     const wchar_t **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     wchar_t **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error )
+{
+	wchar_t *full_path          = NULL;
+	wchar_t *reallocation       = NULL;
+	static char *function       = "libcpath_path_get_full_paths_wide";
+	size_t full_path_size       = 0;
+	size_t safe_full_paths_size = 0;
+	int path_index              = 0;
+
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of paths value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_paths > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of paths value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_paths != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full paths value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_paths_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths size.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path_offsets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*full_path_offsets = (size_t *) libcpath_allocator_allocate(
+	                                 sizeof( size_t ) * number_of_paths );
+
+	if( *full_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path offsets.",
+		 function );
+
+		goto on_error;
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		if( libcpath_path_get_full_path_wide(
+		     paths[ path_index ],
+		     path_lengths[ path_index ],
+		     &full_path,
+		     &full_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine full path: %d.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+		if( full_path_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - safe_full_paths_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid full paths size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		reallocation = (wchar_t *) libcpath_allocator_reallocate(
+		                         *full_paths,
+		                         sizeof( wchar_t ) * ( safe_full_paths_size + full_path_size ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize full paths.",
+			 function );
+
+			goto on_error;
+		}
+		*full_paths = reallocation;
+
+		if( wide_string_copy(
+		     &( ( *full_paths )[ safe_full_paths_size ] ),
+		     full_path,
+		     full_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy full path: %d.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+		( *full_path_offsets )[ path_index ] = safe_full_paths_size;
+
+		safe_full_paths_size += full_path_size;
+
+		libcpath_allocator_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+	*full_paths_size = safe_full_paths_size;
+
+	return( 1 );
+
+on_error:
+	if( full_path != NULL )
+	{
+		libcpath_allocator_free(
+		 full_path );
+	}
+	if( *full_paths != NULL )
+	{
+		libcpath_allocator_free(
+		 *full_paths );
+
+		*full_paths = NULL;
+	}
+	if( *full_path_offsets != NULL )
+	{
+		libcpath_allocator_free(
+		 *full_path_offsets );
+
+		*full_path_offsets = NULL;
+	}
+	*full_paths_size = 0;
+
+	return( -1 );
+}
+
+#else
+
+/* Determines the full paths of the POSIX paths specified
+ * The current working directory is retrieved and normalized once, on the stack
+ * unless it does not fit, and shared by all relative paths. The full paths are determined in two passes
+ * so that they can be stored in a single allocation of their exact size
+ *
+ * The full paths are stored consecutively, each terminated by an end of string
+ * character, and full_path_offsets contains the offset of every full path
+ * Relative paths are resolved against the working directory or, when NULL,
+ * the current working directory of the process
+ * The codepage is used for the narrow strings, where 0 represents UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_full_paths_with_working_directory_wide(
+     const char *working_directory,
+     size_t working_directory_length,
+     const wchar_t **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     wchar_t **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     int codepage,
+     libcerror_error_t **error )
+{
+	char narrow_normalized_current_directory_buffer[ LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE ];
+	wchar_t normalized_current_directory_buffer[ LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE ];
+
+	char *narrow_normalized_current_directory         = NULL;
+	wchar_t *normalized_current_directory             = NULL;
+	static char *function                             = "libcpath_path_get_full_paths_with_working_directory_wide";
+	size_t full_path_size                             = 0;
+	size_t narrow_normalized_current_directory_length = 0;
+	size_t normalized_current_directory_length        = 0;
+	size_t normalized_current_directory_size          = 0;
+	size_t safe_full_paths_size                       = 0;
+	int current_directory_is_set                      = 0;
+	int path_index                                    = 0;
+
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of paths value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_paths > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of paths value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_paths != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full paths value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_paths_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths size.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path_offsets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*full_path_offsets = (size_t *) libcpath_allocator_allocate(
+	                                 sizeof( size_t ) * number_of_paths );
+
+	if( *full_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path offsets.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first pass determines the offset and size of every full path
+	 */
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		if( ( paths[ path_index ] == NULL )
+		 || ( path_lengths[ path_index ] == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid path: %d.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+		if( ( paths[ path_index ][ 0 ] != (wchar_t) '/' )
+		 && ( current_directory_is_set == 0 ) )
+		{
+			/* The current working directory is normalized before it is converted
+			 * so that only one wide character buffer is needed
+			 */
+			if( libcpath_path_get_normalized_working_directory(
+			     working_directory,
+			     working_directory_length,
+			     narrow_normalized_current_directory_buffer,
+			     LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE,
+			     &narrow_normalized_current_directory,
+			     &narrow_normalized_current_directory_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve normalized current working directory.",
+				 function );
+
+				goto on_error;
+			}
+			/* The root directory is represented by an empty normalized base path
+			 */
+			if( narrow_normalized_current_directory_length > 0 )
+			{
+				/* A wide character string never contains more characters than the narrow
+				 * string it was decoded from
+				 */
+				normalized_current_directory = normalized_current_directory_buffer;
+
+				if( narrow_normalized_current_directory_length >= LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE )
+				{
+					normalized_current_directory = libcpath_allocator_allocate_wide_string(
+					                                narrow_normalized_current_directory_length + 1 );
+
+					if( normalized_current_directory == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to create normalized current working directory.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				if( libcpath_system_string_decode_narrow_string(
+				     narrow_normalized_current_directory,
+				     narrow_normalized_current_directory_length + 1,
+				     normalized_current_directory,
+				     narrow_normalized_current_directory_length + 1,
+				     &normalized_current_directory_size,
+				     codepage,
+				     error ) != 1 )
+				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_GENERIC,
+					 "%s: unable to set normalized current working directory.",
+					 function );
+
+					goto on_error;
+				}
+				normalized_current_directory_length = normalized_current_directory_size - 1;
+			}
+			if( ( narrow_normalized_current_directory != NULL )
+			 && ( narrow_normalized_current_directory != narrow_normalized_current_directory_buffer ) )
+			{
+				libcpath_allocator_free(
+				 narrow_normalized_current_directory );
+			}
+			narrow_normalized_current_directory = NULL;
+
+			current_directory_is_set = 1;
+		}
+		if( libcpath_path_normalize_with_normalized_base_wide(
+		     normalized_current_directory,
+		     normalized_current_directory_length,
+		     paths[ path_index ],
+		     path_lengths[ path_index ],
+		     NULL,
+		     0,
+		     &full_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine full path size: %d.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+		if( full_path_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - safe_full_paths_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid full paths size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		( *full_path_offsets )[ path_index ] = safe_full_paths_size;
+
+		safe_full_paths_size += full_path_size;
+	}
+	*full_paths = libcpath_allocator_allocate_wide_string(
+	               safe_full_paths_size );
+
+	if( *full_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full paths.",
+		 function );
+
+		goto on_error;
+	}
+	/* The second pass writes every full path at its offset
+	 */
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		if( libcpath_path_normalize_with_normalized_base_wide(
+		     normalized_current_directory,
+		     normalized_current_directory_length,
+		     paths[ path_index ],
+		     path_lengths[ path_index ],
+		     &( ( *full_paths )[ ( *full_path_offsets )[ path_index ] ] ),
+		     safe_full_paths_size - ( *full_path_offsets )[ path_index ],
+		     &full_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set full path: %d.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+	}
+	*full_paths_size = safe_full_paths_size;
+
+	if( ( normalized_current_directory != NULL )
+	 && ( normalized_current_directory != normalized_current_directory_buffer ) )
+	{
+		libcpath_allocator_free(
+		 normalized_current_directory );
+	}
+	return( 1 );
+
+on_error:
+	if( ( narrow_normalized_current_directory != NULL )
+	 && ( narrow_normalized_current_directory != narrow_normalized_current_directory_buffer ) )
+	{
+		libcpath_allocator_free(
+		 narrow_normalized_current_directory );
+	}
+	if( ( normalized_current_directory != NULL )
+	 && ( normalized_current_directory != normalized_current_directory_buffer ) )
+	{
+		libcpath_allocator_free(
+		 normalized_current_directory );
+	}
+	if( *full_paths != NULL )
+	{
+		libcpath_allocator_free(
+		 *full_paths );
+
+		*full_paths = NULL;
+	}
+	if( *full_path_offsets != NULL )
+	{
+		libcpath_allocator_free(
+		 *full_path_offsets );
+
+		*full_path_offsets = NULL;
+	}
+	*full_paths_size = 0;
+
+	return( -1 );
+}
+
+/* Determines the full paths of the POSIX paths specified
+ * The codepage of the library is used for the narrow strings
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_full_paths_wide(
+     const wchar_t **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     wchar_t **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_get_full_paths_with_working_directory_wide(
+	         NULL,
+	         0,
+	         paths,
+	         path_lengths,
+	         number_of_paths,
+	         full_paths,
+	         full_paths_size,
+	         full_path_offsets,
+	         libclocale_codepage,
+	         error ) );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Determines the full paths of the paths specified using a context
+ * Relative paths are resolved against the working directory of the context,
+ * hence contexts can be used concurrently by different threads
+ * The codepage of the context is used for the narrow strings
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_full_paths_context_wide(
+     libcpath_context_t *context,
+     const wchar_t **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     wchar_t **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error )
+{
+	static char *function           = "libcpath_path_get_full_paths_context_wide";
+	int codepage                    = 0;
+
+#if !defined( WINAPI )
+	const char *working_directory   = NULL;
+	size_t working_directory_length = 0;
+#endif
+
+	if( libcpath_context_get_codepage(
+	     context,
+	     &codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve codepage from context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The wide character Windows API functions do not use a codepage
+	 */
+	return( libcpath_path_get_full_paths_wide(
+	         paths,
+	         path_lengths,
+	         number_of_paths,
+	         full_paths,
+	         full_paths_size,
+	         full_path_offsets,
+	         error ) );
+#else
+	if( libcpath_context_get_working_directory(
+	     context,
+	     &working_directory,
+	     &working_directory_length,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve working directory from context.",
+		 function );
+
+		return( -1 );
+	}
+	return( libcpath_path_get_full_paths_with_working_directory_wide(
+	         working_directory,
+	         working_directory_length,
+	         paths,
+	         path_lengths,
+	         number_of_paths,
+	         full_paths,
+	         full_paths_size,
+	         full_path_offsets,
+	         codepage,
+	         error ) );
+#endif
+}
+
+/* Retrieves the full path of the path relative to a base path
+ * The base path must be an absolute path. Unlike libcpath_path_get_full_path_wide
+ * the current working directory is not used and on POSIX the path is resolved
+ * lexically, without accessing the file system, hence a parent directory (..)
+ * segment can refer to a directory outside the base path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_full_path_with_base_wide(
+     const wchar_t *base_path,
+     size_t base_path_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libcpath_path_get_full_path_with_base_wide";
+
+#if defined( WINAPI )
+	wchar_t *joined_path          = NULL;
+	size_t joined_path_size    = 0;
+	uint8_t path_type          = 0;
+	int result                 = 0;
+#else
+	size_t safe_full_path_size = 0;
+#endif
+
+	if( base_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base path.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid base path length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( libcpath_path_get_path_type_wide(
+	     base_path,
+	     base_path_length,
+	     &path_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine base path type.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_type == LIBCPATH_TYPE_RELATIVE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported base path value not absolute.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_path_type_wide(
+	     path,
+	     path_length,
+	     &path_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path type.",
+		 function );
+
+		return( -1 );
+	}
+	/* The Windows path prefixes are resolved by libcpath_path_get_full_path_wide
+	 */
+	if( path_type != LIBCPATH_TYPE_RELATIVE )
+	{
+		result = libcpath_path_get_full_path_wide(
+		          path,
+		          path_length,
+		          full_path,
+		          full_path_size,
+		          error );
+	}
+	else
+	{
+		if( libcpath_path_join_wide(
+		     &joined_path,
+		     &joined_path_size,
+		     base_path,
+		     base_path_length,
+		     path,
+		     path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to join base path and path.",
+			 function );
+
+			return( -1 );
+		}
+		result = libcpath_path_get_full_path_wide(
+		          joined_path,
+		          joined_path_size - 1,
+		          full_path,
+		          full_path_size,
+		          error );
+
+		libcpath_allocator_free(
+		 joined_path );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	if( base_path[ 0 ] != (wchar_t) LIBCPATH_SEPARATOR )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported base path value not absolute.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_normalize_with_base_wide(
+	     base_path,
+	     base_path_length,
+	     path,
+	     path_length,
+	     NULL,
+	     0,
+	     &safe_full_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path size.",
+		 function );
+
+		goto on_error;
+	}
+	*full_path = libcpath_allocator_allocate_wide_string(
+	              safe_full_path_size );
+
+	if( *full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_normalize_with_base_wide(
+	     base_path,
+	     base_path_length,
+	     path,
+	     path_length,
+	     *full_path,
+	     safe_full_path_size,
+	     &safe_full_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set full path.",
+		 function );
+
+		goto on_error;
+	}
+	*full_path_size = safe_full_path_size;
+
+	return( 1 );
+
+on_error:
+	if( *full_path != NULL )
+	{
+		libcpath_allocator_free(
+		 *full_path );
+
+		*full_path = NULL;
+	}
+	*full_path_size = 0;
+
+	return( -1 );
+#endif /* defined( WINAPI ) */
+}
+
+/* Normalizes a path lexically into a buffer
+ * Empty and . segments are removed and a parent directory (..) segment removes
+ * the segment it follows. The parent directory segments that remain at the start
+ * of a relative path are kept, those of an absolute path refer to the root directory
+ * The path is not combined with a base path or the current working directory
+ * and the file system is not accessed
+ * Returns 1 if successful, 0 if the normalized path size is too small or -1 on error
+ */
+int libcpath_path_normalize_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcpath_path_normalize_to_buffer_wide";
+	size_t normalized_path_index        = 0;
+	size_t number_of_parent_directories = 0;
+	size_t prefix_length                = 0;
+	size_t safe_normalized_path_size    = 0;
+	size_t segments_end_index           = 0;
+	size_t segments_length              = 0;
+	int is_absolute                     = 0;
+	int is_verbatim                     = 0;
+
+#if defined( WINAPI )
+	uint8_t path_type                   = 0;
+#endif
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( ( SSIZE_MAX - 2 ) / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( normalized_path == NULL )
+	 && ( normalized_path_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( normalized_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid normalized path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_normalized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required normalized path size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( libcpath_path_get_path_type_wide(
+	     path,
+	     path_length,
+	     &path_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_type == LIBCPATH_TYPE_DEVICE )
+	 || ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH )
+	 || ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC ) )
+	{
+		/* Device and extended-length paths are passed to the file system as-is
+		 */
+		prefix_length = path_length;
+		is_verbatim   = 1;
+	}
+	else if( path_type == LIBCPATH_TYPE_UNC )
+	{
+		/* The server and share names of an UNC path are part of its prefix
+		 */
+		prefix_length = 2;
+
+		while( ( prefix_length < path_length )
+		    && ( path[ prefix_length ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			prefix_length++;
+		}
+		if( prefix_length < path_length )
+		{
+			prefix_length++;
+		}
+		while( ( prefix_length < path_length )
+		    && ( path[ prefix_length ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			prefix_length++;
+		}
+		is_absolute = 1;
+	}
+	else if( ( path_length >= 2 )
+	      && ( path[ 1 ] == (wchar_t) ':' ) )
+	{
+		/* The volume letter and colon are the prefix of a volume path
+		 */
+		prefix_length = 2;
+	}
+#endif /* defined( WINAPI ) */
+
+	if( is_verbatim == 0 )
+	{
+		if( ( prefix_length < path_length )
+		 && ( path[ prefix_length ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			is_absolute = 1;
+		}
+		if( libcpath_path_normalize_segments_wide(
+		     &( path[ prefix_length ] ),
+		     path_length - prefix_length,
+		     NULL,
+		     0,
+		     &segments_length,
+		     &number_of_parent_directories,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of normalized path segments.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The size consists of the prefix, the (relative) parent directory segments,
+	 * the remaining segments and the end of string character
+	 */
+	safe_normalized_path_size = prefix_length + 1;
+
+	if( is_verbatim != 0 )
+	{
+	}
+	else if( is_absolute != 0 )
+	{
+		/* The root directory consists of a single separator
+		 */
+		if( segments_length == 0 )
+		{
+			safe_normalized_path_size += 1;
+		}
+		else
+		{
+			safe_normalized_path_size += segments_length;
+		}
+	}
+	else if( number_of_parent_directories > 0 )
+	{
+		safe_normalized_path_size += ( number_of_parent_directories * 3 ) - 1 + segments_length;
+	}
+	else if( segments_length > 0 )
+	{
+		/* The separator in front of the first segment is not part of a relative path
+		 */
+		safe_normalized_path_size += segments_length - 1;
+	}
+	else
+	{
+		/* The current directory consists of a single .
+		 */
+		safe_normalized_path_size += 1;
+	}
+	*required_normalized_path_size = safe_normalized_path_size;
+
+	if( normalized_path_size < safe_normalized_path_size )
+	{
+		return( 0 );
+	}
+	if( prefix_length > 0 )
+	{
+		if( wide_string_copy(
+		     normalized_path,
+		     path,
+		     prefix_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy prefix to normalized path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	normalized_path_index = prefix_length;
+
+	if( is_verbatim == 0 )
+	{
+		segments_end_index = safe_normalized_path_size - 1;
+
+		if( is_absolute != 0 )
+		{
+		}
+		else if( number_of_parent_directories > 0 )
+		{
+			normalized_path[ normalized_path_index++ ] = (wchar_t) '.';
+			normalized_path[ normalized_path_index++ ] = (wchar_t) '.';
+
+			while( number_of_parent_directories > 1 )
+			{
+				normalized_path[ normalized_path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
+				normalized_path[ normalized_path_index++ ] = (wchar_t) '.';
+				normalized_path[ normalized_path_index++ ] = (wchar_t) '.';
+
+				number_of_parent_directories--;
+			}
+		}
+		else if( segments_length > 0 )
+		{
+			/* The segments are written one character further, in place of the
+			 * end of string character, and moved back afterwards to remove
+			 * the separator in front of the first segment
+			 */
+			segments_end_index = safe_normalized_path_size;
+		}
+		if( segments_length > 0 )
+		{
+			segments_length              = 0;
+			number_of_parent_directories = 0;
+
+			if( libcpath_path_normalize_segments_wide(
+			     &( path[ prefix_length ] ),
+			     path_length - prefix_length,
+			     normalized_path,
+			     segments_end_index,
+			     &segments_length,
+			     &number_of_parent_directories,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to normalize path segments.",
+				 function );
+
+				return( -1 );
+			}
+			if( segments_end_index == safe_normalized_path_size )
+			{
+				while( normalized_path_index < ( safe_normalized_path_size - 1 ) )
+				{
+					normalized_path[ normalized_path_index ] = normalized_path[ normalized_path_index + 1 ];
+
+					normalized_path_index++;
+				}
+			}
+		}
+		else if( is_absolute != 0 )
+		{
+			normalized_path[ normalized_path_index ] = (wchar_t) LIBCPATH_SEPARATOR;
+		}
+		else if( normalized_path_index == prefix_length )
+		{
+			normalized_path[ normalized_path_index ] = (wchar_t) '.';
+		}
+	}
+	normalized_path[ safe_normalized_path_size - 1 ] = 0;
+
+	return( 1 );
+}
+
+/* Normalizes a path lexically
+ * The path is normalized as described by libcpath_path_normalize_to_buffer_wide
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_normalize_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **normalized_path,
+     size_t *normalized_path_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "libcpath_path_normalize_wide";
+	size_t safe_normalized_path_size = 0;
+
+	if( normalized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *normalized_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid normalized path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( normalized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalized path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_normalize_to_buffer_wide(
+	     path,
+	     path_length,
+	     NULL,
+	     0,
+	     &safe_normalized_path_size,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine normalized path size.",
+		 function );
+
+		goto on_error;
+	}
+	*normalized_path = libcpath_allocator_allocate_wide_string(
+	                    safe_normalized_path_size );
+
+	if( *normalized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create normalized path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_normalize_to_buffer_wide(
+	     path,
+	     path_length,
+	     *normalized_path,
+	     safe_normalized_path_size,
+	     &safe_normalized_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set normalized path.",
+		 function );
+
+		goto on_error;
+	}
+	*normalized_path_size = safe_normalized_path_size;
+
+	return( 1 );
+
+on_error:
+	if( *normalized_path != NULL )
+	{
+		libcpath_allocator_free(
+		 *normalized_path );
+
+		*normalized_path = NULL;
+	}
+	*normalized_path_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the size of a sanitized version of the path character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_character_size_wide(
+     wchar_t character,
+     size_t *sanitized_character_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_get_sanitized_character_size_wide";
+
+	if( sanitized_character_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized character size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (uint32_t) character < 256 )
+	{
+		*sanitized_character_size = (size_t) libcpath_sanitize_character_sizes[ (uint8_t) character ];
+	}
+	else
+	{
+		*sanitized_character_size = 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of the path character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_character_wide(
+     wchar_t character,
+     size_t sanitized_character_size,
+     wchar_t *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *sanitized_path_index,
+     libcerror_error_t **error )
+{
+	static char *function            = "libcpath_path_get_sanitized_character_wide";
+	size_t safe_sanitized_path_index = 0;
+	wchar_t lower_nibble             = 0;
+	wchar_t upper_nibble             = 0;
+
+	if( ( sanitized_character_size != 1 )
+	 && ( sanitized_character_size != 2 )
+	 && ( sanitized_character_size != 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized character size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_sanitized_path_index = *sanitized_path_index;
+
+	if( safe_sanitized_path_index > sanitized_path_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized path index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sanitized_character_size > sanitized_path_size )
+	 || ( safe_sanitized_path_index > ( sanitized_path_size - sanitized_character_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid sanitized path size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_character_size == 1 )
+	{
+		sanitized_path[ safe_sanitized_path_index++ ] = character;
+	}
+	else if( sanitized_character_size == 2 )
+	{
+		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+	}
+	else if( sanitized_character_size == 4 )
+	{
+		lower_nibble = character & 0x0f;
+		upper_nibble = ( character >> 4 ) & 0x0f;
+
+		if( lower_nibble > 10 )
+		{
+			lower_nibble += (wchar_t) 'a' - 10;
+		}
+		else
+		{
+			lower_nibble += '0';
+		}
+		if( upper_nibble > 10 )
+		{
+			upper_nibble += (wchar_t) 'a' - 10;
+		}
+		else
+		{
+			upper_nibble += '0';
+		}
+		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) 'x';
+		sanitized_path[ safe_sanitized_path_index++ ] = upper_nibble;
+		sanitized_path[ safe_sanitized_path_index++ ] = lower_nibble;
+	}
+	*sanitized_path_index = safe_sanitized_path_index;
+
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of the filename into a buffer
+ * If the sanitized filename does not fit in the buffer the required size
+ * is returned and the buffer contents are undefined
+ * Returns 1 if successful, 0 if the sanitized filename size is too small or -1 on error
+ */
+int libcpath_path_get_sanitized_filename_to_buffer_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     wchar_t *sanitized_filename,
+     size_t sanitized_filename_size,
+     size_t *required_sanitized_filename_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcpath_path_get_sanitized_filename_to_buffer_wide";
+	size_t filename_index               = 0;
+	size_t sanitized_character_size     = 0;
+	size_t safe_sanitized_filename_size = 0;
+	size_t sanitized_filename_index     = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid filename length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sanitized_filename == NULL )
+	 && ( sanitized_filename_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_filename_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized filename size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_sanitized_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required sanitized filename size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_sanitized_filename_size = 1;
+
+	/* The sanitized characters are written while they fit in the buffer
+	 * the size of the remaining characters is still determined
+	 */
+	for( filename_index = 0;
+	     filename_index < filename_length;
+	     filename_index++ )
+	{
+		if( filename[ filename_index ] == (wchar_t) LIBCPATH_SEPARATOR )
+		{
+			sanitized_character_size = 4;
+		}
+		else if( (uint32_t) filename[ filename_index ] < 256 )
+		{
+			sanitized_character_size = libcpath_sanitize_character_sizes[ (uint8_t) filename[ filename_index ] ];
+		}
+		else
+		{
+			sanitized_character_size = 1;
+		}
+		safe_sanitized_filename_size += sanitized_character_size;
+
+		if( safe_sanitized_filename_size <= sanitized_filename_size )
+		{
+			if( sanitized_character_size == 1 )
+			{
+				sanitized_filename[ sanitized_filename_index++ ] = filename[ filename_index ];
+			}
+			else if( sanitized_character_size == 2 )
+			{
+				sanitized_filename[ sanitized_filename_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+				sanitized_filename[ sanitized_filename_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+			}
+			else if( libcpath_path_get_sanitized_character_wide(
+			          filename[ filename_index ],
+			          sanitized_character_size,
+			          sanitized_filename,
+			          sanitized_filename_size,
+			          &sanitized_filename_index,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set sanitized character.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( safe_sanitized_filename_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized filename size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*required_sanitized_filename_size = safe_sanitized_filename_size;
+
+	if( safe_sanitized_filename_size > sanitized_filename_size )
+	{
+		return( 0 );
+	}
+	sanitized_filename[ sanitized_filename_index ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of the filename
+ * The sanitized filename is allocated from the arena and remains valid until the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_filename_arena_wide(
+     libcpath_arena_t *arena,
+     const wchar_t *filename,
+     size_t filename_length,
+     wchar_t **sanitized_filename,
+     size_t *sanitized_filename_size,
+     libcerror_error_t **error )
+{
+	void *data                          = NULL;
+	static char *function               = "libcpath_path_get_sanitized_filename_arena_wide";
+	size_t data_size                    = 0;
+	size_t safe_sanitized_filename_size = 0;
+	int result                          = 0;
+
+	if( sanitized_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sanitized filename is written into the data available in the arena
+	 * and only if it does not fit, data of the required size is allocated
+	 */
+	if( libcpath_arena_get_available_data(
+	     arena,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve available data from arena.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          filename,
+	          filename_length,
+	          (wchar_t *) data,
+	          data_size / sizeof( wchar_t ),
+	          &safe_sanitized_filename_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_arena_allocate(
+	     arena,
+	     sizeof( wchar_t ) * safe_sanitized_filename_size,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to allocate sanitized filename from arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+		          filename,
+		          filename_length,
+		          (wchar_t *) data,
+		          safe_sanitized_filename_size,
+		          &safe_sanitized_filename_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sanitized filename.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*sanitized_filename      = (wchar_t *) data;
+	*sanitized_filename_size = safe_sanitized_filename_size;
+
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of the filename
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_filename_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     wchar_t **sanitized_filename,
+     size_t *sanitized_filename_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcpath_path_get_sanitized_filename_wide";
+	wchar_t *safe_sanitized_filename    = NULL;
+	size_t safe_sanitized_filename_size = 0;
+
+	if( sanitized_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sanitized_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sanitized filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > ( ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( wchar_t ) ) - 1 ) / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* A sanitized character consists of at most 4 characters, hence the sanitized
+	 * filename is allocated with its upper bound size and written in a single pass
+	 */
+	safe_sanitized_filename_size = ( filename_length * 4 ) + 1;
+
+	safe_sanitized_filename = libcpath_allocator_allocate_wide_string(
+	                           safe_sanitized_filename_size );
+
+	if( safe_sanitized_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sanitized filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_get_sanitized_filename_to_buffer_wide(
+	     filename,
+	     filename_length,
+	     safe_sanitized_filename,
+	     safe_sanitized_filename_size,
+	     &safe_sanitized_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sanitized filename.",
+		 function );
+
+		goto on_error;
+	}
+	*sanitized_filename      = safe_sanitized_filename;
+	*sanitized_filename_size = safe_sanitized_filename_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_sanitized_filename != NULL )
+	{
+		libcpath_allocator_free(
+		 safe_sanitized_filename );
+	}
+	return( -1 );
+}
+
+/* Retrieves a sanitized version of the path into a buffer
+ * If the sanitized path does not fit in the buffer the required size
+ * is returned and the buffer contents are undefined
+ * Returns 1 if successful, 0 if the sanitized path size is too small or -1 on error
+ */
+int libcpath_path_get_sanitized_path_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *required_sanitized_path_size,
+     libcerror_error_t **error )
+{
+	static char *function                    = "libcpath_path_get_sanitized_path_to_buffer_wide";
+	size_t path_index                        = 0;
+	size_t safe_sanitized_path_size          = 0;
+	size_t sanitized_character_size          = 0;
+	size_t sanitized_path_index              = 0;
+
+#if defined( WINAPI )
+	size_t last_path_segment_seperator_index = 0;
+#endif
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sanitized_path == NULL )
+	 && ( sanitized_path_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_sanitized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required sanitized path size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_sanitized_path_size = 1;
+
+	/* The sanitized characters are written while they fit in the buffer
+	 * the size of the remaining characters is still determined
+	 */
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		if( (uint32_t) path[ path_index ] < 256 )
+		{
+			sanitized_character_size = libcpath_sanitize_character_sizes[ (uint8_t) path[ path_index ] ];
+		}
+		else
+		{
+			sanitized_character_size = 1;
+		}
+		safe_sanitized_path_size += sanitized_character_size;
 
-					goto on_error;
-				}
-				current_directory_segment_index--;
+		if( safe_sanitized_path_size <= sanitized_path_size )
+		{
+			if( sanitized_character_size == 1 )
+			{
+				sanitized_path[ sanitized_path_index++ ] = path[ path_index ];
 			}
-			else if( last_used_path_segment_index >= 0 )
+			else if( sanitized_character_size == 2 )
 			{
-				if( libcsplit_wide_split_string_get_segment_by_index(
-				     path_split_string,
-				     last_used_path_segment_index,
-				     &last_used_path_string_segment,
-				     &last_used_path_string_segment_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve last used path string segment: %d.",
-					 function,
-					 last_used_path_segment_index );
+				sanitized_path[ sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+				sanitized_path[ sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+			}
+			else if( libcpath_path_get_sanitized_character_wide(
+			          path[ path_index ],
+			          sanitized_character_size,
+			          sanitized_path,
+			          sanitized_path_size,
+			          &sanitized_path_index,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set sanitized character.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#if defined( WINAPI )
+		if( path[ path_index ] == LIBCPATH_SEPARATOR )
+		{
+			last_path_segment_seperator_index = path_index;
+		}
+#endif
+	}
+	if( safe_sanitized_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( last_path_segment_seperator_index > 32767 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: last path segment separator value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_sanitized_path_size > 32767 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*required_sanitized_path_size = safe_sanitized_path_size;
+
+	if( safe_sanitized_path_size > sanitized_path_size )
+	{
+		return( 0 );
+	}
+	sanitized_path[ sanitized_path_index ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of the path
+ * The sanitized path is allocated from the arena and remains valid until the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_path_arena_wide(
+     libcpath_arena_t *arena,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **sanitized_path,
+     size_t *sanitized_path_size,
+     libcerror_error_t **error )
+{
+	void *data                      = NULL;
+	static char *function           = "libcpath_path_get_sanitized_path_arena_wide";
+	size_t data_size                = 0;
+	size_t safe_sanitized_path_size = 0;
+	int result                      = 0;
+
+	if( sanitized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sanitized path is written into the data available in the arena
+	 * and only if it does not fit, data of the required size is allocated
+	 */
+	if( libcpath_arena_get_available_data(
+	     arena,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve available data from arena.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          path,
+	          path_length,
+	          (wchar_t *) data,
+	          data_size / sizeof( wchar_t ),
+	          &safe_sanitized_path_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_arena_allocate(
+	     arena,
+	     sizeof( wchar_t ) * safe_sanitized_path_size,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to allocate sanitized path from arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		result = libcpath_path_get_sanitized_path_to_buffer_wide(
+		          path,
+		          path_length,
+		          (wchar_t *) data,
+		          safe_sanitized_path_size,
+		          &safe_sanitized_path_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sanitized path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*sanitized_path      = (wchar_t *) data;
+	*sanitized_path_size = safe_sanitized_path_size;
+
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of the path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_path_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **sanitized_path,
+     size_t *sanitized_path_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libcpath_path_get_sanitized_path_wide";
+	wchar_t *safe_sanitized_path    = NULL;
+	size_t safe_sanitized_path_size = 0;
+
+	if( sanitized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sanitized_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sanitized path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > ( ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( wchar_t ) ) - 1 ) / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* A sanitized character consists of at most 4 characters, hence the sanitized
+	 * path is allocated with its upper bound size and written in a single pass
+	 */
+	safe_sanitized_path_size = ( path_length * 4 ) + 1;
+
+	safe_sanitized_path = libcpath_allocator_allocate_wide_string(
+	                       safe_sanitized_path_size );
+
+	if( safe_sanitized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sanitized path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_get_sanitized_path_to_buffer_wide(
+	     path,
+	     path_length,
+	     safe_sanitized_path,
+	     safe_sanitized_path_size,
+	     &safe_sanitized_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sanitized path.",
+		 function );
+
+		goto on_error;
+	}
+	*sanitized_path      = safe_sanitized_path;
+	*sanitized_path_size = safe_sanitized_path_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_sanitized_path != NULL )
+	{
+		libcpath_allocator_free(
+		 safe_sanitized_path );
+	}
+	return( -1 );
+}
+
+/* Combines the directory name and filename into a path in a buffer
+ * Returns 1 if successful, 0 if the path size is too small or -1 on error
+ */
+int libcpath_path_join_to_buffer_wide(
+     wchar_t *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_join_to_buffer_wide";
+	size_t filename_index = 0;
+	size_t path_index     = 0;
+	size_t safe_path_size = 0;
 
-					goto on_error;
-				}
-				if( last_used_path_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing last used path string string segment: %d.",
-					 function,
-					 last_used_path_segment_index );
+	if( ( path == NULL )
+	 && ( path_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
 
-					goto on_error;
-				}
-				/* Remove the size of the parent directory name and a directory separator
-				 * Note that the size includes the end of string character
-				 */
-				safe_full_path_size -= last_used_path_string_segment_size;
+		return( -1 );
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
 
-				if( libcsplit_wide_split_string_set_segment_by_index(
-				     path_split_string,
-				     last_used_path_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path string segment: %d.",
-					 function,
-					 last_used_path_segment_index );
+		return( -1 );
+	}
+	if( required_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required path size.",
+		 function );
 
-					goto on_error;
-				}
-				/* Find the previous path split value that contains a name
-				 */
-				while( last_used_path_segment_index > 0 )
-				{
-					last_used_path_segment_index--;
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
 
-					if( libcsplit_wide_split_string_get_segment_by_index(
-					     path_split_string,
-					     last_used_path_segment_index,
-					     &last_used_path_string_segment,
-					     &last_used_path_string_segment_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve last used path string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
+		return( -1 );
+	}
+	if( directory_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
+		 function );
 
-						goto on_error;
-					}
-					if( last_used_path_string_segment_size != 0 )
-					{
-						break;
-					}
-				}
-			}
-			if( libcsplit_wide_split_string_set_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     NULL,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path string segment: %d.",
-				 function,
-				 path_segment_index );
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
 
-				goto on_error;
-			}
-		}
-		/* If the path is . ignore the entry
-		 */
-		else if( ( path_string_segment_size == 2 )
-		      && ( path_string_segment[ 0 ] == (wchar_t) '.' ) )
-		{
-			if( libcsplit_wide_split_string_set_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     NULL,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path string segment: %d.",
-				 function,
-				 path_segment_index );
+		return( -1 );
+	}
+	if( filename_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
 
-				goto on_error;
-			}
-		}
-		/* If the path is empty ignore the entry
-		 */
-		else if( path_string_segment_size <= 1 )
+		return( -1 );
+	}
+/* TODO strip other patterns like /./ */
+	while( directory_name_length > 0 )
+	{
+		if( directory_name[ directory_name_length - 1 ] != (wchar_t) LIBCPATH_SEPARATOR )
 		{
-			if( libcsplit_wide_split_string_set_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     NULL,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path string segment: %d.",
-				 function,
-				 path_segment_index );
-
-				goto on_error;
-			}
+			break;
 		}
-		else
+		directory_name_length--;
+	}
+	while( filename_length > 0 )
+	{
+		if( filename[ filename_index ] != (wchar_t) LIBCPATH_SEPARATOR )
 		{
-			/* Add the size of the directory or file name and a directory separator
-			 * Note that the size includes the end of string character
-			 */
-			safe_full_path_size += path_string_segment_size;
-
-			last_used_path_segment_index = path_segment_index;
+			break;
 		}
+		filename_index++;
+		filename_length--;
 	}
-	/* Note that the last path separator serves as the end of string
-	 */
-	full_path_index = 0;
+	safe_path_size = directory_name_length + filename_length + 2;
 
-	*full_path = wide_string_allocate(
-	              safe_full_path_size );
+	*required_path_size = safe_path_size;
+
+	if( safe_path_size > path_size )
+	{
+		return( 0 );
+	}
+	if( wide_string_copy(
+	     path,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name to path.",
+		 function );
+
+		return( -1 );
+	}
+	path_index = directory_name_length;
+
+	path[ path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
+
+	if( wide_string_copy(
+	     &( path[ path_index ] ),
+	     &( filename[ filename_index ] ),
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename to path.",
+		 function );
+
+		return( -1 );
+	}
+	path_index += filename_length;
+
+	path[ path_index ] = 0;
+
+	return( 1 );
+}
+
+/* Combines the directory name and filename into a path
+ * The path is allocated from the arena and remains valid until the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_join_arena_wide(
+     libcpath_arena_t *arena,
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	void *data            = NULL;
+	static char *function = "libcpath_path_join_arena_wide";
+	size_t data_size      = 0;
+	size_t safe_path_size = 0;
+	int result            = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
 
-	if( *full_path == NULL )
+		return( -1 );
+	}
+	if( path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     *full_path,
-	     0,
-	     sizeof( wchar_t ) * safe_full_path_size ) == NULL )
+	/* The path is written into the data available in the arena
+	 * and only if it does not fit, data of the required size is allocated
+	 */
+	if( libcpath_arena_get_available_data(
+	     arena,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear full path.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve available data from arena.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	*full_path_size = safe_full_path_size;
+	result = libcpath_path_join_to_buffer_wide(
+	          (wchar_t *) data,
+	          data_size / sizeof( wchar_t ),
+	          &safe_path_size,
+	          directory_name,
+	          directory_name_length,
+	          filename,
+	          filename_length,
+	          error );
 
-	if( path_type == LIBCPATH_TYPE_ABSOLUTE )
+	if( result == -1 )
 	{
-		( *full_path )[ full_path_index ] = (wchar_t) '/';
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path.",
+		 function );
 
-		full_path_index += 1;
+		return( -1 );
 	}
-	/* If the path is relative
-	 * add the current working directory elements
-	 */
-	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
-	 && ( current_directory_split_string != NULL ) )
+	if( libcpath_arena_allocate(
+	     arena,
+	     sizeof( wchar_t ) * safe_path_size,
+	     &data,
+	     error ) != 1 )
 	{
-		for( current_directory_segment_index = 0;
-		     current_directory_segment_index < current_directory_number_of_segments;
-		     current_directory_segment_index++ )
-		{
-			if( libcsplit_wide_split_string_get_segment_by_index(
-			     current_directory_split_string,
-			     current_directory_segment_index,
-			     &current_directory_string_segment,
-			     &current_directory_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve current working directory string segment: %d.",
-				 function,
-				 current_directory_segment_index );
-
-				goto on_error;
-			}
-			if( current_directory_string_segment_size != 0 )
-			{
-				if( current_directory_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				if( wide_string_copy(
-				     &( ( *full_path )[ full_path_index ] ),
-				     current_directory_string_segment,
-				     current_directory_string_segment_size - 1 ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set current working directory split value: %d in full path.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				full_path_index += current_directory_string_segment_size - 1;
-
-				( *full_path )[ full_path_index ] = (wchar_t) '/';
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to allocate path from arena.",
+		 function );
 
-				full_path_index += 1;
-			}
-		}
+		return( -1 );
 	}
-	for( path_segment_index = 0;
-	     path_segment_index < path_number_of_segments;
-	     path_segment_index++ )
+	if( result == 0 )
 	{
-		if( libcsplit_wide_split_string_get_segment_by_index(
-		     path_split_string,
-		     path_segment_index,
-		     &path_string_segment,
-		     &path_string_segment_size,
-		     error ) != 1 )
+		result = libcpath_path_join_to_buffer_wide(
+		          (wchar_t *) data,
+		          safe_path_size,
+		          &safe_path_size,
+		          directory_name,
+		          directory_name_length,
+		          filename,
+		          filename_length,
+		          error );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve path string segment: %d.",
-			 function,
-			 path_segment_index );
+			 "%s: unable to determine path.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( path_string_segment_size != 0 )
-		{
-			if( path_string_segment == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing path string segment: %d.",
-				 function,
-				 path_segment_index );
+	}
+	*path      = (wchar_t *) data;
+	*path_size = safe_path_size;
 
-				goto on_error;
-			}
-			if( wide_string_copy(
-			     &( ( *full_path )[ full_path_index ] ),
-			     path_string_segment,
-			     path_string_segment_size - 1 ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set path split value: %d in full path.",
-				 function,
-				 path_segment_index );
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			full_path_index += path_string_segment_size - 1;
+/* Combines the directory name and filename into a path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_join_wide(
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_join_wide";
+	size_t safe_path_size = 0;
 
-			( *full_path )[ full_path_index ] = (wchar_t) '/';
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
 
-			full_path_index += 1;
-		}
+		return( -1 );
 	}
-	( *full_path )[ full_path_index - 1 ] = 0;
-
-	if( libcsplit_wide_split_string_free(
-	     &path_split_string,
-	     error ) != 1 )
+	if( *path != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free path split string.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( current_directory_split_string != NULL )
+	if( path_size == NULL )
 	{
-		if( libcsplit_wide_split_string_free(
-		     &current_directory_split_string,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free current working directory split string.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
 
-			goto on_error;
-		}
-	}
-	if( current_directory != NULL )
-	{
-		memory_free(
-		 current_directory );
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	if( *full_path != NULL )
+	if( libcpath_path_join_to_buffer_wide(
+	     NULL,
+	     0,
+	     &safe_path_size,
+	     directory_name,
+	     directory_name_length,
+	     filename,
+	     filename_length,
+	     error ) == -1 )
 	{
-		memory_free(
-		 *full_path );
-
-		*full_path = NULL;
-	}
-	*full_path_size = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path size.",
+		 function );
 
-	if( path_split_string != NULL )
-	{
-		libcsplit_wide_split_string_free(
-		 &path_split_string,
-		 NULL );
-	}
-	if( current_directory_split_string != NULL )
-	{
-		libcsplit_wide_split_string_free(
-		 &current_directory_split_string,
-		 NULL );
-	}
-	if( current_directory != NULL )
-	{
-		memory_free(
-		 current_directory );
+		goto on_error;
 	}
-	return( -1 );
-}
-
-#endif /* defined( WINAPI ) */
-
-/* Retrieves the size of a sanitized version of the path character
- * Returns 1 if successful or -1 on error
- */
-int libcpath_path_get_sanitized_character_size_wide(
-     wchar_t character,
-     size_t *sanitized_character_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libcpath_path_get_sanitized_character_size_wide";
+	*path = libcpath_allocator_allocate_wide_string(
+	         safe_path_size );
 
-	if( sanitized_character_size == NULL )
+	if( *path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized character size.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
 		 function );
 
-		return( -1 );
-	}
-	if( ( character >= 0x00 )
-	 && ( character <= 0x1f ) )
-	{
-		*sanitized_character_size = 4;
-	}
-	else if( character == (wchar_t) LIBCPATH_ESCAPE_CHARACTER )
-	{
-		*sanitized_character_size = 2;
+		goto on_error;
 	}
-#if defined( WINAPI )
-	else if( character == (wchar_t) '/' )
+	if( libcpath_path_join_to_buffer_wide(
+	     *path,
+	     safe_path_size,
+	     &safe_path_size,
+	     directory_name,
+	     directory_name_length,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
 	{
-		*sanitized_character_size = 4;
-	}
-#endif
-	else if( ( character == (wchar_t) '!' )
-	      || ( character == (wchar_t) '$' )
-	      || ( character == (wchar_t) '%' )
-	      || ( character == (wchar_t) '&' )
-	      || ( character == (wchar_t) '*' )
-	      || ( character == (wchar_t) '+' )
-	      || ( character == (wchar_t) ':' )
-	      || ( character == (wchar_t) ';' )
-	      || ( character == (wchar_t) '<' )
-	      || ( character == (wchar_t) '>' )
-	      || ( character == (wchar_t) '?' )
-	      || ( character == (wchar_t) '|' )
-	      || ( character == 0x7f ) )
-	{
-		*sanitized_character_size = 4;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path.",
+		 function );
+
+		goto on_error;
 	}
-	else
+	*path_size = safe_path_size;
+
+	return( 1 );
+
+on_error:
+	if( *path != NULL )
 	{
-		*sanitized_character_size = 1;
+		libcpath_allocator_free(
+		 *path );
+
+		*path = NULL;
 	}
-	return( 1 );
+	*path_size = 0;
+
+	return( -1 );
 }
 
-/* Retrieves a sanitized version of the path character
- * Returns 1 if successful or -1 on error
+/* Combines multiple components into a path in a buffer
+ * The trailing separators of a component and the leading separators of the
+ * component that follows it are replaced by a single separator. Components,
+ * other than the first and the last, that are empty or consist of separators
+ * only are ignored. The last component is always preceded by a separator,
+ * hence the path equals that of libcpath_path_join applied to the components
+ * one by one, e.g. { "/", "" } results in "/" and { "a", "/" } in "a/"
+ * The size of the path is determined first and the path is written after that,
+ * hence every component is copied once regardless of the number of components
+ * Returns 1 if successful, 0 if the path size is too small or -1 on error
  */
-int libcpath_path_get_sanitized_character_wide(
-     wchar_t character,
-     size_t sanitized_character_size,
-     wchar_t *sanitized_path,
-     size_t sanitized_path_size,
-     size_t *sanitized_path_index,
+int libcpath_path_join_components_to_buffer_wide(
+     wchar_t *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const wchar_t **components,
+     const size_t *component_lengths,
+     int number_of_components,
      libcerror_error_t **error )
 {
-	static char *function            = "libcpath_path_get_sanitized_character_wide";
-	size_t safe_sanitized_path_index = 0;
-	wchar_t lower_nibble             = 0;
-	wchar_t upper_nibble             = 0;
+	static char *function   = "libcpath_path_join_components_to_buffer_wide";
+	size_t component_length = 0;
+	size_t path_index       = 0;
+	size_t safe_path_size   = 0;
+	size_t string_index     = 0;
+	int component_index     = 0;
+	int pass                = 0;
 
-	if( ( sanitized_character_size != 1 )
-	 && ( sanitized_character_size != 2 )
-	 && ( sanitized_character_size != 4 ) )
+	if( ( path == NULL )
+	 && ( path_size != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sanitized character size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_path == NULL )
+	if( path_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_path_size > (size_t) SSIZE_MAX )
+	if( required_path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sanitized path size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required path size.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_path_index == NULL )
+	if( components == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path index.",
+		 "%s: invalid components.",
 		 function );
 
 		return( -1 );
 	}
-	safe_sanitized_path_index = *sanitized_path_index;
-
-	if( safe_sanitized_path_index > sanitized_path_size )
+	if( component_lengths == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sanitized path index value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid component lengths.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( sanitized_character_size > sanitized_path_size )
-	 || ( safe_sanitized_path_index > ( sanitized_path_size - sanitized_character_size ) ) )
+	if( number_of_components <= 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid sanitized path size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of components value zero or less.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_character_size == 1 )
-	{
-		sanitized_path[ safe_sanitized_path_index++ ] = character;
-	}
-	else if( sanitized_character_size == 2 )
-	{
-		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
-		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
-	}
-	else if( sanitized_character_size == 4 )
+	/* The first pass determines the size of the path
+	 * the second pass writes the path
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
 	{
-		lower_nibble = character & 0x0f;
-		upper_nibble = ( character >> 4 ) & 0x0f;
+		path_index = 0;
 
-		if( lower_nibble > 10 )
-		{
-			lower_nibble += (wchar_t) 'a' - 10;
-		}
-		else
-		{
-			lower_nibble += '0';
-		}
-		if( upper_nibble > 10 )
+		for( component_index = 0;
+		     component_index < number_of_components;
+		     component_index++ )
 		{
-			upper_nibble += (wchar_t) 'a' - 10;
+			if( pass == 0 )
+			{
+				if( components[ component_index ] == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+					 "%s: invalid component: %d.",
+					 function,
+					 component_index );
+
+					return( -1 );
+				}
+				if( component_lengths[ component_index ] > (size_t) SSIZE_MAX )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid component: %d length value exceeds maximum.",
+					 function,
+					 component_index );
+
+					return( -1 );
+				}
+			}
+			component_length = component_lengths[ component_index ];
+			string_index     = 0;
+
+			if( component_index > 0 )
+			{
+				while( ( string_index < component_length )
+				    && ( components[ component_index ][ string_index ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+				{
+					string_index++;
+				}
+			}
+			if( component_index < ( number_of_components - 1 ) )
+			{
+				while( ( component_length > string_index )
+				    && ( components[ component_index ][ component_length - 1 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+				{
+					component_length--;
+				}
+			}
+			component_length -= string_index;
+
+			if( ( component_index > 0 )
+			 && ( component_index < ( number_of_components - 1 ) )
+			 && ( component_length == 0 ) )
+			{
+				continue;
+			}
+			if( ( pass == 0 )
+			 && ( ( component_length + 1 ) > ( (size_t) ( SSIZE_MAX - 1 ) - path_index ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid path size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			if( component_index > 0 )
+			{
+				if( pass == 1 )
+				{
+					path[ path_index ] = (wchar_t) LIBCPATH_SEPARATOR;
+				}
+				path_index++;
+			}
+			if( ( pass == 1 )
+			 && ( component_length > 0 ) )
+			{
+				if( wide_string_copy(
+				     &( path[ path_index ] ),
+				     &( components[ component_index ][ string_index ] ),
+				     component_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy component: %d to path.",
+					 function,
+					 component_index );
+
+					return( -1 );
+				}
+			}
+			path_index += component_length;
 		}
-		else
+		if( pass == 0 )
 		{
-			upper_nibble += '0';
+			safe_path_size = path_index + 1;
+
+			*required_path_size = safe_path_size;
+
+			if( safe_path_size > path_size )
+			{
+				return( 0 );
+			}
 		}
-		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
-		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) 'x';
-		sanitized_path[ safe_sanitized_path_index++ ] = upper_nibble;
-		sanitized_path[ safe_sanitized_path_index++ ] = lower_nibble;
 	}
-	*sanitized_path_index = safe_sanitized_path_index;
+	path[ path_index ] = 0;
 
 	return( 1 );
 }
 
-/* Retrieves a sanitized version of the filename
+/* Combines multiple components into a path
+ * The components are combined as described by libcpath_path_join_components_to_buffer_wide
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_sanitized_filename_wide(
-     const wchar_t *filename,
-     size_t filename_length,
-     wchar_t **sanitized_filename,
-     size_t *sanitized_filename_size,
+int libcpath_path_join_components_wide(
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t **components,
+     const size_t *component_lengths,
+     int number_of_components,
      libcerror_error_t **error )
 {
-	static char *function               = "libcpath_path_get_sanitized_filename_wide";
-	wchar_t *safe_sanitized_filename    = NULL;
-	size_t filename_index               = 0;
-	size_t sanitized_character_size     = 0;
-	size_t safe_sanitized_filename_size = 0;
-	size_t sanitized_filename_index     = 0;
+	static char *function = "libcpath_path_join_components_wide";
+	size_t safe_path_size = 0;
 
-	if( filename == NULL )
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_join_components_to_buffer_wide(
+	     NULL,
+	     0,
+	     &safe_path_size,
+	     components,
+	     component_lengths,
+	     number_of_components,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path size.",
+		 function );
+
+		goto on_error;
+	}
+	*path = libcpath_allocator_allocate_wide_string(
+	         safe_path_size );
+
+	if( *path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_join_components_to_buffer_wide(
+	     *path,
+	     safe_path_size,
+	     &safe_path_size,
+	     components,
+	     component_lengths,
+	     number_of_components,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path.",
 		 function );
 
-		return( -1 );
-	}
-	if( filename_length == 0 )
+		goto on_error;
+	}
+	*path_size = safe_path_size;
+
+	return( 1 );
+
+on_error:
+	if( *path != NULL )
+	{
+		libcpath_allocator_free(
+		 *path );
+
+		*path = NULL;
+	}
+	*path_size = 0;
+
+	return( -1 );
+}
+
+/* Combines the directory name and a sanitized version of the filename into a path in a buffer
+ * The filename is sanitized as with libcpath_path_get_sanitized_filename_wide while it is
+ * written after the directory name, hence separators in the filename are escaped
+ * If the path does not fit in the buffer the required size is returned and
+ * the buffer contents are undefined
+ * Returns 1 if successful, 0 if the path size is too small or -1 on error
+ */
+int libcpath_path_join_sanitized_to_buffer_wide(
+     wchar_t *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	wchar_t *sanitized_filename    = NULL;
+	static char *function          = "libcpath_path_join_sanitized_to_buffer_wide";
+	size_t sanitized_filename_size = 0;
+	size_t path_index              = 0;
+	int result                     = 0;
+
+	if( ( path == NULL )
+	 && ( path_size != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid filename length is zero.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
 		 function );
 
 		return( -1 );
 	}
-	if( filename_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( path_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid filename length value exceeds maximum.",
+		 "%s: invalid path size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_filename == NULL )
+	if( required_path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized filename.",
+		 "%s: invalid required path size.",
 		 function );
 
 		return( -1 );
 	}
-	if( *sanitized_filename != NULL )
+	if( directory_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sanitized filename value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_filename_size == NULL )
+	if( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized filename size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	safe_sanitized_filename_size = 1;
-
-	for( filename_index = 0;
-	     filename_index < filename_length;
-	     filename_index++ )
+	while( directory_name_length > 0 )
 	{
-		if( filename[ filename_index ] == LIBCPATH_SEPARATOR )
+		if( directory_name[ directory_name_length - 1 ] != (wchar_t) LIBCPATH_SEPARATOR )
 		{
-			sanitized_character_size = 4;
+			break;
 		}
-		else if( libcpath_path_get_sanitized_character_size_wide(
-		          filename[ filename_index ],
-		          &sanitized_character_size,
-		          error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
+		directory_name_length--;
+	}
+	path_index = directory_name_length + 1;
 
-			goto on_error;
-		}
-		safe_sanitized_filename_size += sanitized_character_size;
+	/* The filename is sanitized directly into the buffer after the directory name
+	 */
+	if( path_size > path_index )
+	{
+		sanitized_filename      = &( path[ path_index ] );
+		sanitized_filename_size = path_size - path_index;
 	}
-	if( safe_sanitized_filename_size > (size_t) SSIZE_MAX )
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          filename,
+	          filename_length,
+	          sanitized_filename,
+	          sanitized_filename_size,
+	          &sanitized_filename_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sanitized filename size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sanitize filename.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	safe_sanitized_filename = wide_string_allocate(
-	                           safe_sanitized_filename_size );
-
-	if( safe_sanitized_filename == NULL )
+	if( sanitized_filename_size > ( (size_t) SSIZE_MAX - path_index ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create sanitized filename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized filename size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( filename_index = 0;
-	     filename_index < filename_length;
-	     filename_index++ )
-	{
-		if( filename[ filename_index ] == LIBCPATH_SEPARATOR )
-		{
-			sanitized_character_size = 4;
-		}
-		else if( libcpath_path_get_sanitized_character_size_wide(
-		          filename[ filename_index ],
-		          &sanitized_character_size,
-		          error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
+	*required_path_size = path_index + sanitized_filename_size;
 
-			goto on_error;
-		}
-		if( libcpath_path_get_sanitized_character_wide(
-		     filename[ filename_index ],
-		     sanitized_character_size,
-		     safe_sanitized_filename,
-		     safe_sanitized_filename_size,
-		     &sanitized_filename_index,
-		     error ) != 1 )
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( directory_name_length > 0 )
+	{
+		if( wide_string_copy(
+		     path,
+		     directory_name,
+		     directory_name_length ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy directory name to path.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	safe_sanitized_filename[ sanitized_filename_index ] = 0;
-
-	*sanitized_filename      = safe_sanitized_filename;
-	*sanitized_filename_size = safe_sanitized_filename_size;
+	path[ directory_name_length ] = (wchar_t) LIBCPATH_SEPARATOR;
 
 	return( 1 );
-
-on_error:
-	if( safe_sanitized_filename != NULL )
-	{
-		memory_free(
-		 safe_sanitized_filename );
-	}
-	return( -1 );
 }
 
-/* Retrieves a sanitized version of the path
+/* Combines the directory name and a sanitized version of the filename into a path
+ * The size of the path is determined first, hence the path is allocated with its
+ * exact size and the sanitized filename is written directly after the directory name
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_sanitized_path_wide(
-     const wchar_t *path,
-     size_t path_length,
-     wchar_t **sanitized_path,
-     size_t *sanitized_path_size,
+int libcpath_path_join_sanitized_wide(
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
      libcerror_error_t **error )
 {
-	static char *function                    = "libcpath_path_get_sanitized_path_wide";
-	wchar_t *safe_sanitized_path             = NULL;
-	size_t path_index                        = 0;
-	size_t safe_sanitized_path_size          = 0;
-	size_t sanitized_character_size          = 0;
-	size_t sanitized_path_index              = 0;
-
-#if defined( WINAPI )
-	size_t last_path_segment_seperator_index = 0;
-#endif
+	static char *function = "libcpath_path_join_sanitized_wide";
+	size_t safe_path_size = 0;
 
 	if( path == NULL )
 	{
@@ -6661,235 +16969,237 @@ int libcpath_path_get_sanitized_path_wide(
 
 		return( -1 );
 	}
-	if( path_length == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid path length is zero.",
-		 function );
-
-		return( -1 );
-	}
-	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( *path != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_path == NULL )
+	if( path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path.",
+		 "%s: invalid path size.",
 		 function );
 
 		return( -1 );
 	}
-	if( *sanitized_path != NULL )
+	if( libcpath_path_join_sanitized_to_buffer_wide(
+	     NULL,
+	     0,
+	     &safe_path_size,
+	     directory_name,
+	     directory_name_length,
+	     filename,
+	     filename_length,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sanitized path value already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( sanitized_path_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path size.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	safe_sanitized_path_size = 1;
-
-	for( path_index = 0;
-	     path_index < path_length;
-	     path_index++ )
-	{
-		if( libcpath_path_get_sanitized_character_size_wide(
-		     path[ path_index ],
-		     &sanitized_character_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
-
-			goto on_error;
-		}
-		safe_sanitized_path_size += sanitized_character_size;
+	*path = libcpath_allocator_allocate_wide_string(
+	         safe_path_size );
 
-#if defined( WINAPI )
-		if( path[ path_index ] == LIBCPATH_SEPARATOR )
-		{
-			last_path_segment_seperator_index = path_index;
-		}
-#endif
-	}
-	if( safe_sanitized_path_size > (size_t) SSIZE_MAX )
+	if( *path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sanitized path size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( WINAPI )
-	if( last_path_segment_seperator_index > 32767 )
+	if( libcpath_path_join_sanitized_to_buffer_wide(
+	     *path,
+	     safe_path_size,
+	     &safe_path_size,
+	     directory_name,
+	     directory_name_length,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: last path segment separator value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path.",
 		 function );
 
 		goto on_error;
 	}
-	if( safe_sanitized_path_size > 32767 )
-	{
-		safe_sanitized_path_size = 32767;
-	}
-#endif
-	safe_sanitized_path = wide_string_allocate(
-	                       safe_sanitized_path_size );
+	*path_size = safe_path_size;
 
-	if( safe_sanitized_path == NULL )
+	return( 1 );
+
+on_error:
+	if( *path != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create sanitized path.",
-		 function );
+		libcpath_allocator_free(
+		 *path );
 
-		goto on_error;
+		*path = NULL;
 	}
-	for( path_index = 0;
-	     path_index < path_length;
-	     path_index++ )
-	{
-		if( libcpath_path_get_sanitized_character_size_wide(
-		     path[ path_index ],
-		     &sanitized_character_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
+	*path_size = 0;
 
-			goto on_error;
-		}
-		if( libcpath_path_get_sanitized_character_wide(
-		     path[ path_index ],
-		     sanitized_character_size,
-		     safe_sanitized_path,
-		     safe_sanitized_path_size,
-		     &sanitized_path_index,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
+	return( -1 );
+}
+
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Cross Windows safe version of CreateDirectoryW
+ * Returns TRUE if successful or FALSE on error
+ */
+BOOL libcpath_CreateDirectoryW(
+      LPCWSTR path,
+      SECURITY_ATTRIBUTES *security_attributes )
+{
+	FARPROC function       = NULL;
+	HMODULE library_handle = NULL;
+	BOOL result            = FALSE;
 
-			goto on_error;
-		}
+	if( path == NULL )
+	{
+		return( 0 );
 	}
-	safe_sanitized_path[ sanitized_path_index ] = 0;
-
-	*sanitized_path      = safe_sanitized_path;
-	*sanitized_path_size = safe_sanitized_path_size;
+	library_handle = LoadLibrary(
+	                  _SYSTEM_STRING( "kernel32.dll" ) );
 
-	return( 1 );
+	if( library_handle == NULL )
+	{
+		return( 0 );
+	}
+	function = GetProcAddress(
+		    library_handle,
+		    (LPCSTR) "CreateDirectoryW" );
 
-on_error:
-	if( safe_sanitized_path != NULL )
+	if( function != NULL )
 	{
-		memory_free(
-		 safe_sanitized_path );
+		result = function(
+			  path,
+			  security_attributes );
 	}
-	return( -1 );
+	/* This call should be after using the function
+	 * in most cases kernel32.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle ) != TRUE )
+	{
+		libcpath_CloseHandle(
+		 library_handle );
+
+		return( 0 );
+	}
+	return( result );
 }
 
-/* Combines the directory name and filename into a path
+#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+#if defined( WINAPI )
+
+/* Makes the directory
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * The status, if not NULL, is set on error
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_join_wide(
-     wchar_t **path,
-     size_t *path_size,
+int libcpath_internal_path_make_directory_wide(
      const wchar_t *directory_name,
-     size_t directory_name_length,
-     const wchar_t *filename,
-     size_t filename_length,
+     libcpath_status_t *status,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_join_wide";
-	size_t filename_index = 0;
-	size_t path_index     = 0;
+	static char *function = "libcpath_internal_path_make_directory_wide";
+	DWORD error_code      = 0;
 
-	if( path == NULL )
+	if( directory_name == NULL )
 	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 "%s: invalid directory name.",
 		 function );
 
 		return( -1 );
 	}
-	if( *path != NULL )
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+	if( libcpath_CreateDirectoryW(
+	     directory_name,
+	     NULL ) == 0 )
+#else
+	if( CreateDirectoryW(
+	     directory_name,
+	     NULL ) == 0 )
+#endif
 	{
-		libcerror_error_set(
+		error_code = GetLastError();
+
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 (uint32_t) error_code );
+
+		libcerror_system_set_error(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid path value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 error_code,
+		 "%s: unable to make directory.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_size == NULL )
+	return( 1 );
+}
+
+#elif defined( HAVE_MKDIR )
+
+/* Makes the directory
+ * This function uses the POSIX mkdir function or equivalent
+ * The codepage is used for the narrow strings, where 0 represents UTF-8
+ * The status, if not NULL, is set on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory_with_codepage_wide(
+     const wchar_t *directory_name,
+     int codepage,
+     libcpath_status_t *status,
+     libcerror_error_t **error )
+{
+	static char *function             = "libcpath_internal_path_make_directory_with_codepage_wide";
+	char *narrow_directory_name       = NULL;
+	size_t narrow_directory_name_size = 0;
+
+	if( directory_name == NULL )
 	{
-		libcerror_error_set(
-		 error,
+		libcpath_status_set(
+		 status,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path size.",
-		 function );
+		 0 );
 
-		return( -1 );
-	}
-	if( directory_name == NULL )
-	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
@@ -6899,190 +17209,287 @@ int libcpath_path_join_wide(
 
 		return( -1 );
 	}
-	if( directory_name_length > (size_t) SSIZE_MAX )
+	if( libcpath_path_get_narrow_path_wide(
+	     directory_name,
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     codepage,
+	     error ) != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid directory name length value exceeds maximum.",
-		 function );
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 0 );
 
-		return( -1 );
-	}
-	if( filename == NULL )
-	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow directory name.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( filename_length > (size_t) SSIZE_MAX )
+	if( libcpath_internal_path_make_directory(
+	     narrow_directory_name,
+	     status,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid filename length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directory.",
 		 function );
 
-		return( -1 );
-	}
-/* TODO strip other patterns like /./ */
-	while( directory_name_length > 0 )
-	{
-		if( directory_name[ directory_name_length - 1 ] != (wchar_t) LIBCPATH_SEPARATOR )
-		{
-			break;
-		}
-		directory_name_length--;
+		goto on_error;
 	}
-	while( filename_length > 0 )
+	libcpath_allocator_free(
+	 narrow_directory_name );
+
+	return( 1 );
+
+on_error:
+	if( narrow_directory_name != NULL )
 	{
-		if( filename[ filename_index ] != (wchar_t) LIBCPATH_SEPARATOR )
-		{
-			break;
-		}
-		filename_index++;
-		filename_length--;
+		libcpath_allocator_free(
+		 narrow_directory_name );
 	}
-	*path_size = directory_name_length + filename_length + 2;
+	return( -1 );
+}
+
+/* Makes the directory
+ * This function uses the POSIX mkdir function or equivalent
+ * The codepage is used for the narrow strings, where 0 represents UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_with_codepage_wide(
+     const wchar_t *directory_name,
+     int codepage,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_make_directory_with_codepage_wide(
+	         directory_name,
+	         codepage,
+	         NULL,
+	         error ) );
+}
 
-	*path = wide_string_allocate(
-	         *path_size );
+/* Makes the directory
+ * The codepage of the library is used for the narrow strings
+ * The status, if not NULL, is set on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory_wide(
+     const wchar_t *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_make_directory_with_codepage_wide(
+	         directory_name,
+	         libclocale_codepage,
+	         status,
+	         error ) );
+}
 
-	if( *path == NULL )
+#else
+#error Missing make directory function
+#endif
+
+/* Makes the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_wide(
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_make_directory_wide(
+	         directory_name,
+	         NULL,
+	         error ) );
+}
+
+/* Makes the directory
+ * On error the status, if not NULL, is set instead of an error, hence no error
+ * message is formatted or allocated. The status is cleared if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_with_status_wide(
+     const wchar_t *directory_name,
+     libcpath_status_t *status )
+{
+	libcpath_status_clear(
+	 status );
+
+	return( libcpath_internal_path_make_directory_wide(
+	         directory_name,
+	         status,
+	         NULL ) );
+}
+
+/* Makes the directory using a context
+ * A relative directory name is created in the working directory of the context,
+ * using the working directory descriptor when the context has one
+ * The codepage of the context is used for the narrow strings
+ * The status, if not NULL, is set on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory_context_wide(
+     libcpath_context_t *context,
+     const wchar_t *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error )
+{
+	static char *function             = "libcpath_internal_path_make_directory_context_wide";
+	int codepage                      = 0;
+
+#if !defined( WINAPI )
+	char *narrow_directory_name       = NULL;
+	size_t narrow_directory_name_size = 0;
+#endif
+
+	if( libcpath_context_get_codepage(
+	     context,
+	     &codepage,
+	     error ) != 1 )
 	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 0 );
+
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create path.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve codepage from context.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( wide_string_copy(
-	     *path,
+#if defined( WINAPI )
+	/* The wide character Windows API functions do not use a codepage
+	 */
+	return( libcpath_internal_path_make_directory_wide(
+	         directory_name,
+	         status,
+	         error ) );
+#else
+	if( libcpath_path_get_narrow_path_wide(
 	     directory_name,
-	     directory_name_length ) == NULL )
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     codepage,
+	     error ) != 1 )
 	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 0 );
+
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy directory name to path.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow directory name.",
 		 function );
 
 		goto on_error;
-	}
-	path_index = directory_name_length;
-
-	( *path )[ path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
-
-	if( wide_string_copy(
-	     &( ( *path )[ path_index ] ),
-	     &( filename[ filename_index ] ),
-	     filename_length ) == NULL )
+	}
+	if( libcpath_internal_path_make_directory_context(
+	     context,
+	     narrow_directory_name,
+	     status,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy filename to path.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directory.",
 		 function );
 
 		goto on_error;
 	}
-	path_index += filename_length;
-
-	( *path )[ path_index ] = 0;
+	libcpath_allocator_free(
+	 narrow_directory_name );
 
 	return( 1 );
 
 on_error:
-	if( *path != NULL )
+	if( narrow_directory_name != NULL )
 	{
-		memory_free(
-		 *path );
-
-		*path = NULL;
+		libcpath_allocator_free(
+		 narrow_directory_name );
 	}
-	*path_size = 0;
-
 	return( -1 );
-}
 
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+#endif /* defined( WINAPI ) */
+}
 
-/* Cross Windows safe version of CreateDirectoryW
- * Returns TRUE if successful or FALSE on error
+/* Makes the directory using a context
+ * Returns 1 if successful or -1 on error
  */
-BOOL libcpath_CreateDirectoryW(
-      LPCWSTR path,
-      SECURITY_ATTRIBUTES *security_attributes )
+int libcpath_path_make_directory_context_wide(
+     libcpath_context_t *context,
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
 {
-	FARPROC function       = NULL;
-	HMODULE library_handle = NULL;
-	BOOL result            = FALSE;
-
-	if( path == NULL )
-	{
-		return( 0 );
-	}
-	library_handle = LoadLibrary(
-	                  _SYSTEM_STRING( "kernel32.dll" ) );
-
-	if( library_handle == NULL )
-	{
-		return( 0 );
-	}
-	function = GetProcAddress(
-		    library_handle,
-		    (LPCSTR) "CreateDirectoryW" );
-
-	if( function != NULL )
-	{
-		result = function(
-			  path,
-			  security_attributes );
-	}
-	/* This call should be after using the function
-	 * in most cases kernel32.dll will still be available after free
-	 */
-	if( FreeLibrary(
-	     library_handle ) != TRUE )
-	{
-		libcpath_CloseHandle(
-		 library_handle );
-
-		return( 0 );
-	}
-	return( result );
+	return( libcpath_internal_path_make_directory_context_wide(
+	         context,
+	         directory_name,
+	         NULL,
+	         error ) );
 }
 
-#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
-
-#if defined( WINAPI )
+/* Makes the directory using a context
+ * On error the status, if not NULL, is set instead of an error, hence no error
+ * message is formatted or allocated. The status is cleared if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_context_with_status_wide(
+     libcpath_context_t *context,
+     const wchar_t *directory_name,
+     libcpath_status_t *status )
+{
+	libcpath_status_clear(
+	 status );
+
+	return( libcpath_internal_path_make_directory_context_wide(
+	         context,
+	         directory_name,
+	         status,
+	         NULL ) );
+}
 
-/* Makes the directory
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+/* Makes the directory and any missing parent directories
+ * The codepage of the library is used for the narrow strings
+ * The status, if not NULL, is set on error
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_make_directory_wide(
+int libcpath_internal_path_make_directory_recursive_wide(
      const wchar_t *directory_name,
+     libcpath_status_t *status,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_make_directory_wide";
-	DWORD error_code      = 0;
+	static char *function             = "libcpath_internal_path_make_directory_recursive_wide";
+
+#if !defined( WINAPI )
+	char *narrow_directory_name       = NULL;
+	size_t narrow_directory_name_size = 0;
+#endif
 
 	if( directory_name == NULL )
 	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
@@ -7092,48 +17499,131 @@ int libcpath_path_make_directory_wide(
 
 		return( -1 );
 	}
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
-	if( libcpath_CreateDirectoryW(
-	     directory_name,
-	     NULL ) == 0 )
+#if defined( WINAPI )
+	libcpath_status_set(
+	 status,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 0 );
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: making directories recursively is not supported.",
+	 function );
+
+	return( -1 );
 #else
-	if( CreateDirectoryW(
+	if( libcpath_path_get_narrow_path_wide(
 	     directory_name,
-	     NULL ) == 0 )
-#endif
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     libclocale_codepage,
+	     error ) != 1 )
 	{
-		error_code = GetLastError();
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 0 );
 
-		libcerror_system_set_error(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_internal_path_make_directory_recursive(
+	     narrow_directory_name,
+	     status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 error_code,
 		 "%s: unable to make directory.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
+	libcpath_allocator_free(
+	 narrow_directory_name );
+
 	return( 1 );
+
+on_error:
+	if( narrow_directory_name != NULL )
+	{
+		libcpath_allocator_free(
+		 narrow_directory_name );
+	}
+	return( -1 );
+
+#endif /* defined( WINAPI ) */
 }
 
-#elif defined( HAVE_MKDIR )
+/* Makes the directory and any missing parent directories
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_recursive_wide(
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_make_directory_recursive_wide(
+	         directory_name,
+	         NULL,
+	         error ) );
+}
 
-/* Makes the directory
- * This function uses the POSIX mkdir function or equivalent
+/* Makes the directory and any missing parent directories
+ * On error the status, if not NULL, is set instead of an error, hence no error
+ * message is formatted or allocated. The status is cleared if successful
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_make_directory_wide(
+int libcpath_path_make_directory_recursive_with_status_wide(
+     const wchar_t *directory_name,
+     libcpath_status_t *status )
+{
+	libcpath_status_clear(
+	 status );
+
+	return( libcpath_internal_path_make_directory_recursive_wide(
+	         directory_name,
+	         status,
+	         NULL ) );
+}
+
+/* Makes the directory using a directory cache
+ * The codepage of the library is used for the narrow strings
+ * The status, if not NULL, is set on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory_with_cache_wide(
+     libcpath_directory_cache_t *directory_cache,
      const wchar_t *directory_name,
+     libcpath_status_t *status,
      libcerror_error_t **error )
 {
-	static char *function             = "libcpath_path_make_directory_wide";
-	char *narrow_directory_name       = 0;
-	size_t directory_name_length      = 0;
+	static char *function             = "libcpath_internal_path_make_directory_with_cache_wide";
+
+#if !defined( WINAPI )
+	char *narrow_directory_name       = NULL;
 	size_t narrow_directory_name_size = 0;
+#endif
 
 	if( directory_name == NULL )
 	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
@@ -7143,81 +17633,199 @@ int libcpath_path_make_directory_wide(
 
 		return( -1 );
 	}
-	directory_name_length = wide_string_length(
-	                         directory_name );
+#if defined( WINAPI )
+	libcpath_status_set(
+	 status,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 0 );
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: making directories using a directory cache is not supported.",
+	 function );
 
-	if( libcpath_system_string_size_from_wide_string(
+	return( -1 );
+#else
+	if( libcpath_path_get_narrow_path_wide(
 	     directory_name,
-	     directory_name_length + 1,
+	     &narrow_directory_name,
 	     &narrow_directory_name_size,
+	     libclocale_codepage,
 	     error ) != 1 )
 	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 0 );
+
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine narrow directory name size.",
+		 "%s: unable to determine narrow directory name.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( narrow_directory_name_size > (size_t) SSIZE_MAX )
-	 || ( ( sizeof( char ) * narrow_directory_name_size )  > (size_t) SSIZE_MAX ) )
+	if( libcpath_internal_path_make_directory_with_cache(
+	     directory_cache,
+	     narrow_directory_name,
+	     status,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid narrow directory name size value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directory.",
 		 function );
 
 		goto on_error;
 	}
-	narrow_directory_name = narrow_string_allocate(
-	                         narrow_directory_name_size );
+	libcpath_allocator_free(
+	 narrow_directory_name );
 
-	if( narrow_directory_name == NULL )
+	return( 1 );
+
+on_error:
+	if( narrow_directory_name != NULL )
+	{
+		libcpath_allocator_free(
+		 narrow_directory_name );
+	}
+	return( -1 );
+
+#endif /* defined( WINAPI ) */
+}
+
+/* Makes the directory using a directory cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_with_cache_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_make_directory_with_cache_wide(
+	         directory_cache,
+	         directory_name,
+	         NULL,
+	         error ) );
+}
+
+/* Makes the directory using a directory cache
+ * On error the status, if not NULL, is set instead of an error, hence no error
+ * message is formatted or allocated. The status is cleared if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_with_cache_with_status_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     libcpath_status_t *status )
+{
+	libcpath_status_clear(
+	 status );
+
+	return( libcpath_internal_path_make_directory_with_cache_wide(
+	         directory_cache,
+	         directory_name,
+	         status,
+	         NULL ) );
+}
+
+/* Makes the directory and any missing parent directories using a directory cache
+ * The codepage of the library is used for the narrow strings
+ * The status, if not NULL, is set on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory_recursive_with_cache_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error )
+{
+	static char *function             = "libcpath_internal_path_make_directory_recursive_with_cache_wide";
+
+#if !defined( WINAPI )
+	char *narrow_directory_name       = NULL;
+	size_t narrow_directory_name_size = 0;
+#endif
+
+	if( directory_name == NULL )
 	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 0 );
+
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create narrow directory name.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcpath_system_string_copy_from_wide_string(
-	     narrow_directory_name,
-	     narrow_directory_name_size,
+#if defined( WINAPI )
+	libcpath_status_set(
+	 status,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 0 );
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: making directories using a directory cache is not supported.",
+	 function );
+
+	return( -1 );
+#else
+	if( libcpath_path_get_narrow_path_wide(
 	     directory_name,
-	     directory_name_length + 1,
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     libclocale_codepage,
 	     error ) != 1 )
 	{
+		libcpath_status_set(
+		 status,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 0 );
+
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set name.",
+		 "%s: unable to determine narrow directory name.",
 		 function );
 
 		goto on_error;
 	}
-	if( mkdir(
+	if( libcpath_internal_path_make_directory_recursive_with_cache(
+	     directory_cache,
 	     narrow_directory_name,
-	     0755 ) != 0 )
+	     status,
+	     error ) != 1 )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 errno,
 		 "%s: unable to make directory.",
 		 function );
 
 		goto on_error;
 	}
-	memory_free(
+	libcpath_allocator_free(
 	 narrow_directory_name );
 
 	return( 1 );
@@ -7225,15 +17833,48 @@ int libcpath_path_make_directory_wide(
 on_error:
 	if( narrow_directory_name != NULL )
 	{
-		memory_free(
+		libcpath_allocator_free(
 		 narrow_directory_name );
 	}
 	return( -1 );
+
+#endif /* defined( WINAPI ) */
 }
 
-#else
-#error Missing make directory function
-#endif
+/* Makes the directory and any missing parent directories using a directory cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_recursive_with_cache_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	return( libcpath_internal_path_make_directory_recursive_with_cache_wide(
+	         directory_cache,
+	         directory_name,
+	         NULL,
+	         error ) );
+}
+
+/* Makes the directory and any missing parent directories using a directory cache
+ * On error the status, if not NULL, is set instead of an error, hence no error
+ * message is formatted or allocated. The status is cleared if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory_recursive_with_cache_with_status_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     libcpath_status_t *status )
+{
+	libcpath_status_clear(
+	 status );
+
+	return( libcpath_internal_path_make_directory_recursive_with_cache_wide(
+	         directory_cache,
+	         directory_name,
+	         status,
+	         NULL ) );
+}
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
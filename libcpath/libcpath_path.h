@@ -25,13 +25,82 @@
 #include <common.h>
 #include <types.h>
 
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_LIMITS_H ) || defined( WINAPI )
+/* Include for PATH_MAX */
+#include <limits.h>
+#endif
+
 #include "libcpath_extern.h"
 #include "libcpath_libcerror.h"
+#include "libcpath_status.h"
+#include "libcpath_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The current working directory cache is kept per thread and relies
+ * on the GNU C thread local storage and atomic builtins
+ */
+#if !defined( WINAPI ) && defined( HAVE_STAT ) && defined( __GNUC__ )
+#define HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE	1
+#endif
+
+/* The size of the buffer on the stack the current working directory is first
+ * retrieved in, a larger buffer is allocated when the directory does not fit
+ */
+#define LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE	256
+
+/* The size of the buffer of the current working directory cache, a current
+ * working directory that does not fit is not cached
+ */
+#define LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_BUFFER_SIZE	512
+
+/* The batch directory operations
+ */
+enum LIBCPATH_PATH_BATCH_OPERATIONS
+{
+	LIBCPATH_PATH_BATCH_OPERATION_MAKE_DIRECTORY	= 1,
+	LIBCPATH_PATH_BATCH_OPERATION_PROBE_DIRECTORY	= 2
+};
+
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+
+typedef struct libcpath_current_working_directory_cache libcpath_current_working_directory_cache_t;
+
+struct libcpath_current_working_directory_cache
+{
+	/* The current working directory
+	 */
+	char current_working_directory[ LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_BUFFER_SIZE ];
+
+	/* The current working directory length
+	 */
+	size_t current_working_directory_length;
+
+	/* The device number of the current working directory
+	 */
+	dev_t device_number;
+
+	/* The inode number of the current working directory
+	 */
+	ino_t inode_number;
+
+	/* The change directory generation the cache was filled in
+	 */
+	uint32_t generation;
+
+	/* Value to indicate the cache contains a current working directory
+	 */
+	uint8_t is_set;
+};
+
+#endif /* defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE ) */
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 BOOL libcpath_CloseHandle(
@@ -51,6 +120,12 @@ int libcpath_path_change_directory(
      const char *directory_name,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_change_directory_context(
+     libcpath_context_t *context,
+     const char *directory_name,
+     libcerror_error_t **error );
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 DWORD libcpath_GetCurrentDirectoryA(
@@ -59,12 +134,78 @@ DWORD libcpath_GetCurrentDirectoryA(
 
 #endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
 
+#if !defined( WINAPI ) && defined( HAVE_GETCWD )
+
+int libcpath_path_getcwd(
+     char *buffer,
+     size_t buffer_size,
+     char **current_working_directory,
+     size_t *current_working_directory_length,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) && defined( HAVE_GETCWD ) */
+
 LIBCPATH_EXTERN \
 int libcpath_path_get_current_working_directory(
      char **current_working_directory,
      size_t *current_working_directory_size,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_get_current_working_directory_context(
+     libcpath_context_t *context,
+     char **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_current_working_directory_cache_mode(
+     int *mode,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_set_current_working_directory_cache_mode(
+     int mode,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+
+int libcpath_path_get_cached_current_working_directory(
+     const char **current_working_directory,
+     size_t *current_working_directory_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE ) */
+
+int libcpath_path_normalize_segments(
+     const char *string,
+     size_t string_length,
+     char *normalized_path,
+     size_t normalized_path_end_index,
+     size_t *normalized_path_length,
+     size_t *number_of_parent_directories,
+     libcerror_error_t **error );
+
+int libcpath_path_normalize_with_base(
+     const char *base_path,
+     size_t base_path_length,
+     const char *path,
+     size_t path_length,
+     char *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
+     libcerror_error_t **error );
+
+int libcpath_path_normalize_with_normalized_base(
+     const char *base_path,
+     size_t base_path_length,
+     const char *path,
+     size_t path_length,
+     char *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
+     libcerror_error_t **error );
+
 #if defined( WINAPI )
 
 int libcpath_path_get_path_type(
@@ -90,6 +231,19 @@ int libcpath_path_get_current_working_directory_by_volume(
 
 #endif /* defined( WINAPI ) */
 
+#if !defined( WINAPI )
+
+int libcpath_path_get_full_path_with_working_directory(
+     const char *working_directory,
+     size_t working_directory_length,
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
 LIBCPATH_EXTERN \
 int libcpath_path_get_full_path(
      const char *path,
@@ -98,6 +252,129 @@ int libcpath_path_get_full_path(
      size_t *full_path_size,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_path_context(
+     libcpath_context_t *context,
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error );
+
+#if !defined( WINAPI )
+
+int libcpath_path_get_full_path_to_buffer_with_working_directory(
+     const char *working_directory,
+     size_t working_directory_length,
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_path_to_buffer_context(
+     libcpath_context_t *context,
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_path_arena(
+     libcpath_arena_t *arena,
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error );
+
+#if !defined( WINAPI )
+
+int libcpath_path_get_normalized_working_directory(
+     const char *working_directory,
+     size_t working_directory_length,
+     char *buffer,
+     size_t buffer_size,
+     char **normalized_working_directory,
+     size_t *normalized_working_directory_length,
+     libcerror_error_t **error );
+
+int libcpath_path_get_full_paths_with_working_directory(
+     const char *working_directory,
+     size_t working_directory_length,
+     const char **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     char **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_paths(
+     const char **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     char **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_paths_context(
+     libcpath_context_t *context,
+     const char **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     char **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_path_with_base(
+     const char *base_path,
+     size_t base_path_length,
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_normalize_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_normalize(
+     const char *path,
+     size_t path_length,
+     char **normalized_path,
+     size_t *normalized_path_size,
+     libcerror_error_t **error );
+
 int libcpath_path_get_sanitized_character_size(
      char character,
      size_t *sanitized_character_size,
@@ -119,6 +396,24 @@ int libcpath_path_get_sanitized_filename(
      size_t *sanitized_filename_size,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_get_sanitized_filename_to_buffer(
+     const char *filename,
+     size_t filename_length,
+     char *sanitized_filename,
+     size_t sanitized_filename_size,
+     size_t *required_sanitized_filename_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_sanitized_filename_arena(
+     libcpath_arena_t *arena,
+     const char *filename,
+     size_t filename_length,
+     char **sanitized_filename,
+     size_t *sanitized_filename_size,
+     libcerror_error_t **error );
+
 LIBCPATH_EXTERN \
 int libcpath_path_get_sanitized_path(
      const char *path,
@@ -127,6 +422,24 @@ int libcpath_path_get_sanitized_path(
      size_t *sanitized_path_size,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_get_sanitized_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *required_sanitized_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_sanitized_path_arena(
+     libcpath_arena_t *arena,
+     const char *path,
+     size_t path_length,
+     char **sanitized_path,
+     size_t *sanitized_path_size,
+     libcerror_error_t **error );
+
 LIBCPATH_EXTERN \
 int libcpath_path_join(
      char **path,
@@ -137,6 +450,68 @@ int libcpath_path_join(
      size_t filename_length,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_join_to_buffer(
+     char *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_arena(
+     libcpath_arena_t *arena,
+     char **path,
+     size_t *path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_components(
+     char **path,
+     size_t *path_size,
+     const char **components,
+     const size_t *component_lengths,
+     int number_of_components,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_components_to_buffer(
+     char *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const char **components,
+     const size_t *component_lengths,
+     int number_of_components,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_sanitized(
+     char **path,
+     size_t *path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_sanitized_to_buffer(
+     char *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 BOOL libcpath_CreateDirectoryA(
@@ -145,11 +520,132 @@ BOOL libcpath_CreateDirectoryA(
 
 #endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
 
+int libcpath_internal_path_make_directory(
+     const char *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error );
+
 LIBCPATH_EXTERN \
 int libcpath_path_make_directory(
      const char *directory_name,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_with_status(
+     const char *directory_name,
+     libcpath_status_t *status );
+
+int libcpath_internal_path_make_directory_context(
+     libcpath_context_t *context,
+     const char *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_context(
+     libcpath_context_t *context,
+     const char *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_context_with_status(
+     libcpath_context_t *context,
+     const char *directory_name,
+     libcpath_status_t *status );
+
+int libcpath_internal_path_make_directory_recursive(
+     const char *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_recursive(
+     const char *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_recursive_with_status(
+     const char *directory_name,
+     libcpath_status_t *status );
+
+int libcpath_path_has_parent_directory_segment(
+     const char *path,
+     size_t path_length );
+
+int libcpath_internal_path_make_directory_with_cache(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_with_cache(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_with_cache_with_status(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     libcpath_status_t *status );
+
+int libcpath_internal_path_make_directory_recursive_with_cache(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_recursive_with_cache(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_recursive_with_cache_with_status(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     libcpath_status_t *status );
+
+int libcpath_internal_path_batch_directories(
+     libcpath_context_t *context,
+     int operation,
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directories(
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directories_context(
+     libcpath_context_t *context,
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_probe_directories(
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_probe_directories_context(
+     libcpath_context_t *context,
+     const char **directory_names,
+     int number_of_directories,
+     int *error_codes,
+     libcerror_error_t **error );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
@@ -159,11 +655,37 @@ BOOL libcpath_SetCurrentDirectoryW(
 
 #endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
 
+#if !defined( WINAPI )
+
+int libcpath_path_change_directory_with_codepage_wide(
+     const wchar_t *directory_name,
+     int codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
 LIBCPATH_EXTERN \
 int libcpath_path_change_directory_wide(
      const wchar_t *directory_name,
      libcerror_error_t **error );
 
+#if !defined( WINAPI )
+
+int libcpath_path_get_narrow_path_wide(
+     const wchar_t *path,
+     char **narrow_path,
+     size_t *narrow_path_size,
+     int codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
+LIBCPATH_EXTERN \
+int libcpath_path_change_directory_context_wide(
+     libcpath_context_t *context,
+     const wchar_t *directory_name,
+     libcerror_error_t **error );
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 DWORD libcpath_GetCurrentDirectoryW(
@@ -172,12 +694,73 @@ DWORD libcpath_GetCurrentDirectoryW(
 
 #endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
 
+#if !defined( WINAPI )
+
+int libcpath_path_get_current_working_directory_with_codepage_wide(
+     wchar_t **current_working_directory,
+     size_t *current_working_directory_size,
+     int codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
 LIBCPATH_EXTERN \
 int libcpath_path_get_current_working_directory_wide(
      wchar_t **current_working_directory,
      size_t *current_working_directory_size,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_get_current_working_directory_context_wide(
+     libcpath_context_t *context,
+     wchar_t **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error );
+
+int libcpath_path_normalize_segments_wide(
+     const wchar_t *string,
+     size_t string_length,
+     wchar_t *normalized_path,
+     size_t normalized_path_end_index,
+     size_t *normalized_path_length,
+     size_t *number_of_parent_directories,
+     libcerror_error_t **error );
+
+int libcpath_path_normalize_with_base_wide(
+     const wchar_t *base_path,
+     size_t base_path_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
+     libcerror_error_t **error );
+
+int libcpath_path_normalize_with_normalized_base_wide(
+     const wchar_t *base_path,
+     size_t base_path_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
+     libcerror_error_t **error );
+
+#if !defined( WINAPI )
+
+int libcpath_path_normalize_with_normalized_narrow_base_wide(
+     const char *base_path,
+     size_t base_path_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
+     int codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
 #if defined( WINAPI )
 
 int libcpath_path_get_path_type_wide(
@@ -203,6 +786,20 @@ int libcpath_path_get_current_working_directory_by_volume_wide(
 
 #endif /* defined( WINAPI ) */
 
+#if !defined( WINAPI )
+
+int libcpath_path_get_full_path_with_working_directory_wide(
+     const char *working_directory,
+     size_t working_directory_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     int codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
 LIBCPATH_EXTERN \
 int libcpath_path_get_full_path_wide(
      const wchar_t *path,
@@ -211,6 +808,122 @@ int libcpath_path_get_full_path_wide(
      size_t *full_path_size,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_path_context_wide(
+     libcpath_context_t *context,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error );
+
+#if !defined( WINAPI )
+
+int libcpath_path_get_full_path_to_buffer_with_working_directory_wide(
+     const char *working_directory,
+     size_t working_directory_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     int codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_path_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_path_to_buffer_context_wide(
+     libcpath_context_t *context,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_path_arena_wide(
+     libcpath_arena_t *arena,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error );
+
+#if !defined( WINAPI )
+
+int libcpath_path_get_full_paths_with_working_directory_wide(
+     const char *working_directory,
+     size_t working_directory_length,
+     const wchar_t **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     wchar_t **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     int codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_paths_wide(
+     const wchar_t **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     wchar_t **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_paths_context_wide(
+     libcpath_context_t *context,
+     const wchar_t **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     wchar_t **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_path_with_base_wide(
+     const wchar_t *base_path,
+     size_t base_path_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_normalize_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *normalized_path,
+     size_t normalized_path_size,
+     size_t *required_normalized_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_normalize_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **normalized_path,
+     size_t *normalized_path_size,
+     libcerror_error_t **error );
+
 int libcpath_path_get_sanitized_character_size_wide(
      wchar_t character,
      size_t *sanitized_character_size,
@@ -232,6 +945,24 @@ int libcpath_path_get_sanitized_filename_wide(
      size_t *sanitized_filename_size,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_get_sanitized_filename_to_buffer_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     wchar_t *sanitized_filename,
+     size_t sanitized_filename_size,
+     size_t *required_sanitized_filename_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_sanitized_filename_arena_wide(
+     libcpath_arena_t *arena,
+     const wchar_t *filename,
+     size_t filename_length,
+     wchar_t **sanitized_filename,
+     size_t *sanitized_filename_size,
+     libcerror_error_t **error );
+
 LIBCPATH_EXTERN \
 int libcpath_path_get_sanitized_path_wide(
      const wchar_t *path,
@@ -240,6 +971,24 @@ int libcpath_path_get_sanitized_path_wide(
      size_t *sanitized_path_size,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_get_sanitized_path_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *required_sanitized_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_sanitized_path_arena_wide(
+     libcpath_arena_t *arena,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **sanitized_path,
+     size_t *sanitized_path_size,
+     libcerror_error_t **error );
+
 LIBCPATH_EXTERN \
 int libcpath_path_join_wide(
      wchar_t **path,
@@ -250,6 +999,68 @@ int libcpath_path_join_wide(
      size_t filename_length,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_join_to_buffer_wide(
+     wchar_t *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_arena_wide(
+     libcpath_arena_t *arena,
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_components_wide(
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t **components,
+     const size_t *component_lengths,
+     int number_of_components,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_components_to_buffer_wide(
+     wchar_t *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const wchar_t **components,
+     const size_t *component_lengths,
+     int number_of_components,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_sanitized_wide(
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_sanitized_to_buffer_wide(
+     wchar_t *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 BOOL libcpath_CreateDirectoryW(
@@ -258,11 +1069,105 @@ BOOL libcpath_CreateDirectoryW(
 
 #endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
 
+#if !defined( WINAPI )
+
+int libcpath_internal_path_make_directory_with_codepage_wide(
+     const wchar_t *directory_name,
+     int codepage,
+     libcpath_status_t *status,
+     libcerror_error_t **error );
+
+int libcpath_path_make_directory_with_codepage_wide(
+     const wchar_t *directory_name,
+     int codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
+int libcpath_internal_path_make_directory_wide(
+     const wchar_t *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error );
+
 LIBCPATH_EXTERN \
 int libcpath_path_make_directory_wide(
      const wchar_t *directory_name,
      libcerror_error_t **error );
 
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_with_status_wide(
+     const wchar_t *directory_name,
+     libcpath_status_t *status );
+
+int libcpath_internal_path_make_directory_context_wide(
+     libcpath_context_t *context,
+     const wchar_t *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_context_wide(
+     libcpath_context_t *context,
+     const wchar_t *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_context_with_status_wide(
+     libcpath_context_t *context,
+     const wchar_t *directory_name,
+     libcpath_status_t *status );
+
+int libcpath_internal_path_make_directory_recursive_wide(
+     const wchar_t *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_recursive_wide(
+     const wchar_t *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_recursive_with_status_wide(
+     const wchar_t *directory_name,
+     libcpath_status_t *status );
+
+int libcpath_internal_path_make_directory_with_cache_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_with_cache_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_with_cache_with_status_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     libcpath_status_t *status );
+
+int libcpath_internal_path_make_directory_recursive_with_cache_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     libcpath_status_t *status,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_recursive_with_cache_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_recursive_with_cache_with_status_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     libcpath_status_t *status );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 #if defined( __cplusplus )
@@ -0,0 +1,745 @@
+/*
+ * Path builder functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libcpath_allocator.h"
+#include "libcpath_definitions.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_path.h"
+#include "libcpath_path_builder.h"
+#include "libcpath_types.h"
+
+/* Creates a path builder
+ * Make sure the value path_builder is referencing, is set to NULL
+ * The path of the path builder is initially empty
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_initialize(
+     libcpath_path_builder_t **path_builder,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libcpath_allocator_t allocator;
+
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_initialize";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_builder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path builder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBCPATH_PATH_BUILDER_FLAG_SANITIZE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	libcpath_allocator_get_current(
+	 &allocator );
+
+	internal_path_builder = libcpath_allocator_allocate_structure_using(
+	                         &allocator,
+	                         libcpath_internal_path_builder_t );
+
+	if( internal_path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path builder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_path_builder,
+	     0,
+	     sizeof( libcpath_internal_path_builder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path builder.",
+		 function );
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_path_builder );
+
+		return( -1 );
+	}
+	internal_path_builder->allocator = allocator;
+
+	internal_path_builder->path = (char *) libcpath_allocator_allocate_using(
+	                                        &allocator,
+	                                        sizeof( char ) * LIBCPATH_PATH_BUILDER_INITIAL_PATH_SIZE );
+
+	if( internal_path_builder->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	internal_path_builder->component_offsets = (size_t *) libcpath_allocator_allocate_using(
+	                                                       &allocator,
+	                                                       sizeof( size_t ) * LIBCPATH_PATH_BUILDER_INITIAL_NUMBER_OF_COMPONENTS );
+
+	if( internal_path_builder->component_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create component offsets.",
+		 function );
+
+		goto on_error;
+	}
+	internal_path_builder->path[ 0 ] = 0;
+
+	internal_path_builder->path_size                      = LIBCPATH_PATH_BUILDER_INITIAL_PATH_SIZE;
+	internal_path_builder->number_of_allocated_components = LIBCPATH_PATH_BUILDER_INITIAL_NUMBER_OF_COMPONENTS;
+	internal_path_builder->flags                          = flags;
+
+	*path_builder = (libcpath_path_builder_t *) internal_path_builder;
+
+	return( 1 );
+
+on_error:
+	if( internal_path_builder != NULL )
+	{
+		if( internal_path_builder->path != NULL )
+		{
+			libcpath_allocator_free_using(
+			 &allocator,
+			 internal_path_builder->path );
+		}
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_path_builder );
+	}
+	return( -1 );
+}
+
+/* Frees a path builder
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_free(
+     libcpath_path_builder_t **path_builder,
+     libcerror_error_t **error )
+{
+	libcpath_allocator_t allocator;
+
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_free";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_builder != NULL )
+	{
+		internal_path_builder = (libcpath_internal_path_builder_t *) *path_builder;
+		*path_builder         = NULL;
+
+		allocator = internal_path_builder->allocator;
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_path_builder->component_offsets );
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_path_builder->path );
+
+		libcpath_allocator_free_using(
+		 &allocator,
+		 internal_path_builder );
+	}
+	return( 1 );
+}
+
+/* Resizes the path of a path builder
+ * The path size is at least doubled, hence the number of reallocations is
+ * logarithmic in the length of the longest path that is built
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_resize_path(
+     libcpath_internal_path_builder_t *internal_path_builder,
+     size_t path_size,
+     libcerror_error_t **error )
+{
+	char *reallocation    = NULL;
+	static char *function = "libcpath_path_builder_resize_path";
+	size_t safe_path_size = 0;
+
+	if( internal_path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( char ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size <= internal_path_builder->path_size )
+	{
+		return( 1 );
+	}
+	safe_path_size = internal_path_builder->path_size;
+
+	if( safe_path_size > ( (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( char ) ) / 2 ) )
+	{
+		safe_path_size = path_size;
+	}
+	else
+	{
+		safe_path_size *= 2;
+
+		if( safe_path_size < path_size )
+		{
+			safe_path_size = path_size;
+		}
+	}
+	reallocation = (char *) libcpath_allocator_reallocate_using(
+	                         &( internal_path_builder->allocator ),
+	                         internal_path_builder->path,
+	                         sizeof( char ) * safe_path_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize path.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder->path      = reallocation;
+	internal_path_builder->path_size = safe_path_size;
+
+	return( 1 );
+}
+
+/* Sets the base path of a path builder
+ * The base path is copied as-is and all the components are removed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_set_base_path(
+     libcpath_path_builder_t *path_builder,
+     const char *base_path,
+     size_t base_path_length,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_set_base_path";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+	if( ( base_path == NULL )
+	 && ( base_path_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base path.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_builder_resize_path(
+	     internal_path_builder,
+	     base_path_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize path.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_path_length > 0 )
+	{
+		if( narrow_string_copy(
+		     internal_path_builder->path,
+		     base_path,
+		     base_path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy base path.",
+			 function );
+
+			internal_path_builder->path[ internal_path_builder->path_length ] = 0;
+
+			return( -1 );
+		}
+	}
+	internal_path_builder->path[ base_path_length ] = 0;
+
+	internal_path_builder->path_length          = base_path_length;
+	internal_path_builder->number_of_components = 0;
+
+	return( 1 );
+}
+
+/* Pushes a component onto the path of a path builder
+ * A separator is added in front of the component unless the path is empty
+ * or already ends with a separator. If LIBCPATH_PATH_BUILDER_FLAG_SANITIZE is
+ * set the component is sanitized as with libcpath_path_get_sanitized_filename
+ * Only the component is copied, hence the cost is linear in the component
+ * length and independent of the length of the path it is pushed onto
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_push_component(
+     libcpath_path_builder_t *path_builder,
+     const char *component,
+     size_t component_length,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	size_t *reallocation                                    = NULL;
+	static char *function                                   = "libcpath_path_builder_push_component";
+	size_t component_index                                  = 0;
+	size_t required_component_size                          = 0;
+	int number_of_allocated_components                      = 0;
+	int result                                              = 0;
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+	if( component == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid component.",
+		 function );
+
+		return( -1 );
+	}
+	if( component_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid component length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( component_length > ( (size_t) ( SSIZE_MAX - 2 ) - internal_path_builder->path_length ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid component length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_path_builder->number_of_components >= internal_path_builder->number_of_allocated_components )
+	{
+		if( (size_t) internal_path_builder->number_of_allocated_components > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of components value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_allocated_components = internal_path_builder->number_of_allocated_components * 2;
+
+		reallocation = (size_t *) libcpath_allocator_reallocate_using(
+		                           &( internal_path_builder->allocator ),
+		                           internal_path_builder->component_offsets,
+		                           sizeof( size_t ) * number_of_allocated_components );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize component offsets.",
+			 function );
+
+			return( -1 );
+		}
+		internal_path_builder->component_offsets              = reallocation;
+		internal_path_builder->number_of_allocated_components = number_of_allocated_components;
+	}
+	component_index = internal_path_builder->path_length;
+
+	if( ( component_index > 0 )
+	 && ( internal_path_builder->path[ component_index - 1 ] != (char) LIBCPATH_SEPARATOR ) )
+	{
+		component_index++;
+	}
+	if( ( internal_path_builder->flags & LIBCPATH_PATH_BUILDER_FLAG_SANITIZE ) != 0 )
+	{
+		/* The component is sanitized into the available space first and only
+		 * sanitized again if it did not fit, which should be rare
+		 */
+		if( libcpath_path_builder_resize_path(
+		     internal_path_builder,
+		     component_index + component_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize path.",
+			 function );
+
+			goto on_error;
+		}
+		result = libcpath_path_get_sanitized_filename_to_buffer(
+		          component,
+		          component_length,
+		          &( internal_path_builder->path[ component_index ] ),
+		          internal_path_builder->path_size - component_index,
+		          &required_component_size,
+		          error );
+
+		if( result == 0 )
+		{
+			if( libcpath_path_builder_resize_path(
+			     internal_path_builder,
+			     component_index + required_component_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize path.",
+				 function );
+
+				goto on_error;
+			}
+			result = libcpath_path_get_sanitized_filename_to_buffer(
+			          component,
+			          component_length,
+			          &( internal_path_builder->path[ component_index ] ),
+			          internal_path_builder->path_size - component_index,
+			          &required_component_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to sanitize component.",
+			 function );
+
+			goto on_error;
+		}
+		component_length = required_component_size - 1;
+	}
+	else
+	{
+		if( libcpath_path_builder_resize_path(
+		     internal_path_builder,
+		     component_index + component_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize path.",
+			 function );
+
+			goto on_error;
+		}
+		if( narrow_string_copy(
+		     &( internal_path_builder->path[ component_index ] ),
+		     component,
+		     component_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy component.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( component_index > internal_path_builder->path_length )
+	{
+		internal_path_builder->path[ internal_path_builder->path_length ] = (char) LIBCPATH_SEPARATOR;
+	}
+	internal_path_builder->component_offsets[ internal_path_builder->number_of_components ] = internal_path_builder->path_length;
+
+	internal_path_builder->number_of_components += 1;
+	internal_path_builder->path_length           = component_index + component_length;
+
+	internal_path_builder->path[ internal_path_builder->path_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	/* The component can have overwritten the end of string character
+	 */
+	internal_path_builder->path[ internal_path_builder->path_length ] = 0;
+
+	return( -1 );
+}
+
+/* Pops the last component from the path of a path builder
+ * The path is truncated to its length before the component was pushed
+ * Returns 1 if successful, 0 if there are no components or -1 on error
+ */
+int libcpath_path_builder_pop_component(
+     libcpath_path_builder_t *path_builder,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_pop_component";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+	if( internal_path_builder->number_of_components == 0 )
+	{
+		return( 0 );
+	}
+	internal_path_builder->number_of_components -= 1;
+	internal_path_builder->path_length           = internal_path_builder->component_offsets[ internal_path_builder->number_of_components ];
+
+	internal_path_builder->path[ internal_path_builder->path_length ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of components of a path builder
+ * The base path is not counted as a component
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_get_number_of_components(
+     libcpath_path_builder_t *path_builder,
+     int *number_of_components,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_get_number_of_components";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+	if( number_of_components == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of components.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_components = internal_path_builder->number_of_components;
+
+	return( 1 );
+}
+
+/* Retrieves the path of a path builder
+ * The path is owned by the path builder and remains valid until the path
+ * builder is modified or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_get_path(
+     libcpath_path_builder_t *path_builder,
+     const char **path,
+     size_t *path_length,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_get_path";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path length.",
+		 function );
+
+		return( -1 );
+	}
+	*path        = internal_path_builder->path;
+	*path_length = internal_path_builder->path_length;
+
+	return( 1 );
+}
+
@@ -0,0 +1,135 @@
+/*
+ * Path builder functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_PATH_BUILDER_H )
+#define _LIBCPATH_PATH_BUILDER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_allocator.h"
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial path size of a path builder
+ */
+#define LIBCPATH_PATH_BUILDER_INITIAL_PATH_SIZE			256
+
+/* The initial number of component offsets of a path builder
+ */
+#define LIBCPATH_PATH_BUILDER_INITIAL_NUMBER_OF_COMPONENTS	16
+
+typedef struct libcpath_internal_path_builder libcpath_internal_path_builder_t;
+
+struct libcpath_internal_path_builder
+{
+	/* The path
+	 */
+	char *path;
+
+	/* The path size
+	 */
+	size_t path_size;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The component offsets, the path length before every component was pushed
+	 */
+	size_t *component_offsets;
+
+	/* The number of components
+	 */
+	int number_of_components;
+
+	/* The number of allocated component offsets
+	 */
+	int number_of_allocated_components;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The allocator the path builder was created with
+	 */
+	libcpath_allocator_t allocator;
+};
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_initialize(
+     libcpath_path_builder_t **path_builder,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_free(
+     libcpath_path_builder_t **path_builder,
+     libcerror_error_t **error );
+
+int libcpath_path_builder_resize_path(
+     libcpath_internal_path_builder_t *internal_path_builder,
+     size_t path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_set_base_path(
+     libcpath_path_builder_t *path_builder,
+     const char *base_path,
+     size_t base_path_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_push_component(
+     libcpath_path_builder_t *path_builder,
+     const char *component,
+     size_t component_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_pop_component(
+     libcpath_path_builder_t *path_builder,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_get_number_of_components(
+     libcpath_path_builder_t *path_builder,
+     int *number_of_components,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_get_path(
+     libcpath_path_builder_t *path_builder,
+     const char **path,
+     size_t *path_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_PATH_BUILDER_H ) */
+
@@ -0,0 +1,1084 @@
+/*
+ * Path view functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_definitions.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_path_view.h"
+
+/* The directory name of a path without separators
+ */
+static const char libcpath_path_view_current_directory[ 2 ] = { '.', 0 };
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+static const wchar_t libcpath_path_view_current_directory_wide[ 2 ] = { (wchar_t) '.', 0 };
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Determines the length of the root of a path
+ * On Windows the root consists of a volume letter followed by a colon and
+ * an optional separator or a leading separator, otherwise of a leading separator
+ * Returns the length of the root or 0 if the path is relative
+ */
+size_t libcpath_path_view_get_root_length(
+        const char *path,
+        size_t path_length )
+{
+	if( ( path == NULL )
+	 || ( path_length == 0 ) )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	if( ( path_length >= 2 )
+	 && ( path[ 1 ] == ':' )
+	 && ( ( ( path[ 0 ] >= 'A' )
+	   &&   ( path[ 0 ] <= 'Z' ) )
+	  ||  ( ( path[ 0 ] >= 'a' )
+	   &&   ( path[ 0 ] <= 'z' ) ) ) )
+	{
+		if( ( path_length >= 3 )
+		 && ( path[ 2 ] == LIBCPATH_SEPARATOR ) )
+		{
+			return( 3 );
+		}
+		return( 2 );
+	}
+#endif
+	if( path[ 0 ] == LIBCPATH_SEPARATOR )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Initializes a path view
+ * The path view refers to the path, no copy of the path is made
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_view_initialize(
+     libcpath_path_view_t *path_view,
+     const char *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_view_initialize";
+
+	if( path_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path view.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	path_view->path        = path;
+	path_view->path_length = path_length;
+	path_view->front_index = 0;
+	path_view->back_index  = path_length;
+
+	return( 1 );
+}
+
+/* Retrieves the next segment of the path view
+ * The segment refers to the path, empty segments are skipped
+ * Returns 1 if successful, 0 if no more segments are available or -1 on error
+ */
+int libcpath_path_view_get_next_segment(
+     libcpath_path_view_t *path_view,
+     const char **segment,
+     size_t *segment_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_view_get_next_segment";
+	size_t segment_index  = 0;
+
+	if( path_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_view->path == NULL )
+	 || ( path_view->back_index > path_view->path_length ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path view - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment length.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( path_view->front_index < path_view->back_index )
+	    && ( path_view->path[ path_view->front_index ] == LIBCPATH_SEPARATOR ) )
+	{
+		path_view->front_index++;
+	}
+	if( path_view->front_index >= path_view->back_index )
+	{
+		return( 0 );
+	}
+	segment_index = path_view->front_index;
+
+	while( ( path_view->front_index < path_view->back_index )
+	    && ( path_view->path[ path_view->front_index ] != LIBCPATH_SEPARATOR ) )
+	{
+		path_view->front_index++;
+	}
+	*segment        = &( path_view->path[ segment_index ] );
+	*segment_length = path_view->front_index - segment_index;
+
+	return( 1 );
+}
+
+/* Retrieves the previous segment of the path view
+ * The segments are iterated from the end of the path, empty segments are skipped
+ * Returns 1 if successful, 0 if no more segments are available or -1 on error
+ */
+int libcpath_path_view_get_previous_segment(
+     libcpath_path_view_t *path_view,
+     const char **segment,
+     size_t *segment_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_view_get_previous_segment";
+	size_t segment_index  = 0;
+
+	if( path_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_view->path == NULL )
+	 || ( path_view->back_index > path_view->path_length ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path view - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment length.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( path_view->back_index > path_view->front_index )
+	    && ( path_view->path[ path_view->back_index - 1 ] == LIBCPATH_SEPARATOR ) )
+	{
+		path_view->back_index--;
+	}
+	if( path_view->back_index <= path_view->front_index )
+	{
+		return( 0 );
+	}
+	segment_index = path_view->back_index;
+
+	while( ( path_view->back_index > path_view->front_index )
+	    && ( path_view->path[ path_view->back_index - 1 ] != LIBCPATH_SEPARATOR ) )
+	{
+		path_view->back_index--;
+	}
+	*segment        = &( path_view->path[ path_view->back_index ] );
+	*segment_length = segment_index - path_view->back_index;
+
+	return( 1 );
+}
+
+/* Retrieves the directory name of the path view
+ * The directory name refers to the path and is determined lexically
+ * comparable to POSIX dirname, e.g. the directory name of "/usr/lib/" is "/usr",
+ * of "/usr" is "/" and of "usr" is "."
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_view_get_dirname(
+     libcpath_path_view_t *path_view,
+     const char **directory_name,
+     size_t *directory_name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_view_get_dirname";
+	size_t path_index     = 0;
+	size_t root_length    = 0;
+
+	if( path_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path view.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_view->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path view - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name length.",
+		 function );
+
+		return( -1 );
+	}
+	root_length = libcpath_path_view_get_root_length(
+	               path_view->path,
+	               path_view->path_length );
+
+	path_index = path_view->path_length;
+
+	/* Ignore trailing separators
+	 */
+	while( ( path_index > root_length )
+	    && ( path_view->path[ path_index - 1 ] == LIBCPATH_SEPARATOR ) )
+	{
+		path_index--;
+	}
+	/* Remove the last segment
+	 */
+	while( ( path_index > root_length )
+	    && ( path_view->path[ path_index - 1 ] != LIBCPATH_SEPARATOR ) )
+	{
+		path_index--;
+	}
+	/* Remove the separators preceding the last segment
+	 */
+	while( ( path_index > root_length )
+	    && ( path_view->path[ path_index - 1 ] == LIBCPATH_SEPARATOR ) )
+	{
+		path_index--;
+	}
+	if( path_index == 0 )
+	{
+		*directory_name        = libcpath_path_view_current_directory;
+		*directory_name_length = 1;
+	}
+	else
+	{
+		*directory_name        = path_view->path;
+		*directory_name_length = path_index;
+	}
+	return( 1 );
+}
+
+/* Retrieves the base name of the path view
+ * The base name refers to the path and is determined lexically
+ * comparable to POSIX basename, e.g. the base name of "/usr/lib/" is "lib"
+ * and of "/" is "/"
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_view_get_basename(
+     libcpath_path_view_t *path_view,
+     const char **base_name,
+     size_t *base_name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_view_get_basename";
+	size_t path_index     = 0;
+	size_t root_length    = 0;
+	size_t segment_index  = 0;
+
+	if( path_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path view.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_view->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path view - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base name.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base name length.",
+		 function );
+
+		return( -1 );
+	}
+	root_length = libcpath_path_view_get_root_length(
+	               path_view->path,
+	               path_view->path_length );
+
+	path_index = path_view->path_length;
+
+	/* Ignore trailing separators
+	 */
+	while( ( path_index > root_length )
+	    && ( path_view->path[ path_index - 1 ] == LIBCPATH_SEPARATOR ) )
+	{
+		path_index--;
+	}
+	if( path_index == root_length )
+	{
+		/* The base name of the root is the root itself
+		 */
+		*base_name        = path_view->path;
+		*base_name_length = root_length;
+
+		return( 1 );
+	}
+	segment_index = path_index;
+
+	while( ( segment_index > root_length )
+	    && ( path_view->path[ segment_index - 1 ] != LIBCPATH_SEPARATOR ) )
+	{
+		segment_index--;
+	}
+	*base_name        = &( path_view->path[ segment_index ] );
+	*base_name_length = path_index - segment_index;
+
+	return( 1 );
+}
+
+/* Retrieves the extension of the base name of the path view
+ * The extension refers to the path and does not include the dot,
+ * e.g. the extension of "archive.tar.gz" is "gz", base names that start
+ * with a dot, such as ".profile", and base names that end with a dot
+ * have no extension
+ * Returns 1 if successful, 0 if the base name has no extension or -1 on error
+ */
+int libcpath_path_view_get_extension(
+     libcpath_path_view_t *path_view,
+     const char **extension,
+     size_t *extension_length,
+     libcerror_error_t **error )
+{
+	const char *base_name   = NULL;
+	static char *function   = "libcpath_path_view_get_extension";
+	size_t base_name_index  = 0;
+	size_t base_name_length = 0;
+
+	if( extension == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension.",
+		 function );
+
+		return( -1 );
+	}
+	if( extension_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_view_get_basename(
+	     path_view,
+	     &base_name,
+	     &base_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve base name.",
+		 function );
+
+		return( -1 );
+	}
+	for( base_name_index = base_name_length;
+	     base_name_index > 1;
+	     base_name_index-- )
+	{
+		if( base_name[ base_name_index - 1 ] == '.' )
+		{
+			break;
+		}
+	}
+	if( ( base_name_index <= 1 )
+	 || ( base_name_index >= base_name_length ) )
+	{
+		return( 0 );
+	}
+	*extension        = &( base_name[ base_name_index ] );
+	*extension_length = base_name_length - base_name_index;
+
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Determines the length of the root of a path
+ * On Windows the root consists of a volume letter followed by a colon and
+ * an optional separator or a leading separator, otherwise of a leading separator
+ * Returns the length of the root or 0 if the path is relative
+ */
+size_t libcpath_path_view_get_root_length_wide(
+        const wchar_t *path,
+        size_t path_length )
+{
+	if( ( path == NULL )
+	 || ( path_length == 0 ) )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	if( ( path_length >= 2 )
+	 && ( path[ 1 ] == (wchar_t) ':' )
+	 && ( ( ( path[ 0 ] >= (wchar_t) 'A' )
+	   &&   ( path[ 0 ] <= (wchar_t) 'Z' ) )
+	  ||  ( ( path[ 0 ] >= (wchar_t) 'a' )
+	   &&   ( path[ 0 ] <= (wchar_t) 'z' ) ) ) )
+	{
+		if( ( path_length >= 3 )
+		 && ( path[ 2 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			return( 3 );
+		}
+		return( 2 );
+	}
+#endif
+	if( path[ 0 ] == (wchar_t) LIBCPATH_SEPARATOR )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Initializes a path view
+ * The path view refers to the path, no copy of the path is made
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_view_initialize_wide(
+     libcpath_path_view_wide_t *path_view,
+     const wchar_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_view_initialize_wide";
+
+	if( path_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path view.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	path_view->path        = path;
+	path_view->path_length = path_length;
+	path_view->front_index = 0;
+	path_view->back_index  = path_length;
+
+	return( 1 );
+}
+
+/* Retrieves the next segment of the path view
+ * The segment refers to the path, empty segments are skipped
+ * Returns 1 if successful, 0 if no more segments are available or -1 on error
+ */
+int libcpath_path_view_get_next_segment_wide(
+     libcpath_path_view_wide_t *path_view,
+     const wchar_t **segment,
+     size_t *segment_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_view_get_next_segment_wide";
+	size_t segment_index  = 0;
+
+	if( path_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_view->path == NULL )
+	 || ( path_view->back_index > path_view->path_length ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path view - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment length.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( path_view->front_index < path_view->back_index )
+	    && ( path_view->path[ path_view->front_index ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		path_view->front_index++;
+	}
+	if( path_view->front_index >= path_view->back_index )
+	{
+		return( 0 );
+	}
+	segment_index = path_view->front_index;
+
+	while( ( path_view->front_index < path_view->back_index )
+	    && ( path_view->path[ path_view->front_index ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		path_view->front_index++;
+	}
+	*segment        = &( path_view->path[ segment_index ] );
+	*segment_length = path_view->front_index - segment_index;
+
+	return( 1 );
+}
+
+/* Retrieves the previous segment of the path view
+ * The segments are iterated from the end of the path, empty segments are skipped
+ * Returns 1 if successful, 0 if no more segments are available or -1 on error
+ */
+int libcpath_path_view_get_previous_segment_wide(
+     libcpath_path_view_wide_t *path_view,
+     const wchar_t **segment,
+     size_t *segment_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_view_get_previous_segment_wide";
+	size_t segment_index  = 0;
+
+	if( path_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_view->path == NULL )
+	 || ( path_view->back_index > path_view->path_length ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path view - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment length.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( path_view->back_index > path_view->front_index )
+	    && ( path_view->path[ path_view->back_index - 1 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		path_view->back_index--;
+	}
+	if( path_view->back_index <= path_view->front_index )
+	{
+		return( 0 );
+	}
+	segment_index = path_view->back_index;
+
+	while( ( path_view->back_index > path_view->front_index )
+	    && ( path_view->path[ path_view->back_index - 1 ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		path_view->back_index--;
+	}
+	*segment        = &( path_view->path[ path_view->back_index ] );
+	*segment_length = segment_index - path_view->back_index;
+
+	return( 1 );
+}
+
+/* Retrieves the directory name of the path view
+ * The directory name refers to the path and is determined lexically
+ * comparable to POSIX dirname, e.g. the directory name of "/usr/lib/" is "/usr",
+ * of "/usr" is "/" and of "usr" is "."
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_view_get_dirname_wide(
+     libcpath_path_view_wide_t *path_view,
+     const wchar_t **directory_name,
+     size_t *directory_name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_view_get_dirname_wide";
+	size_t path_index     = 0;
+	size_t root_length    = 0;
+
+	if( path_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path view.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_view->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path view - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name length.",
+		 function );
+
+		return( -1 );
+	}
+	root_length = libcpath_path_view_get_root_length_wide(
+	               path_view->path,
+	               path_view->path_length );
+
+	path_index = path_view->path_length;
+
+	/* Ignore trailing separators
+	 */
+	while( ( path_index > root_length )
+	    && ( path_view->path[ path_index - 1 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		path_index--;
+	}
+	/* Remove the last segment
+	 */
+	while( ( path_index > root_length )
+	    && ( path_view->path[ path_index - 1 ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		path_index--;
+	}
+	/* Remove the separators preceding the last segment
+	 */
+	while( ( path_index > root_length )
+	    && ( path_view->path[ path_index - 1 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		path_index--;
+	}
+	if( path_index == 0 )
+	{
+		*directory_name        = libcpath_path_view_current_directory_wide;
+		*directory_name_length = 1;
+	}
+	else
+	{
+		*directory_name        = path_view->path;
+		*directory_name_length = path_index;
+	}
+	return( 1 );
+}
+
+/* Retrieves the base name of the path view
+ * The base name refers to the path and is determined lexically
+ * comparable to POSIX basename, e.g. the base name of "/usr/lib/" is "lib"
+ * and of "/" is "/"
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_view_get_basename_wide(
+     libcpath_path_view_wide_t *path_view,
+     const wchar_t **base_name,
+     size_t *base_name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_view_get_basename_wide";
+	size_t path_index     = 0;
+	size_t root_length    = 0;
+	size_t segment_index  = 0;
+
+	if( path_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path view.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_view->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path view - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base name.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base name length.",
+		 function );
+
+		return( -1 );
+	}
+	root_length = libcpath_path_view_get_root_length_wide(
+	               path_view->path,
+	               path_view->path_length );
+
+	path_index = path_view->path_length;
+
+	/* Ignore trailing separators
+	 */
+	while( ( path_index > root_length )
+	    && ( path_view->path[ path_index - 1 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		path_index--;
+	}
+	if( path_index == root_length )
+	{
+		/* The base name of the root is the root itself
+		 */
+		*base_name        = path_view->path;
+		*base_name_length = root_length;
+
+		return( 1 );
+	}
+	segment_index = path_index;
+
+	while( ( segment_index > root_length )
+	    && ( path_view->path[ segment_index - 1 ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		segment_index--;
+	}
+	*base_name        = &( path_view->path[ segment_index ] );
+	*base_name_length = path_index - segment_index;
+
+	return( 1 );
+}
+
+/* Retrieves the extension of the base name of the path view
+ * The extension refers to the path and does not include the dot,
+ * e.g. the extension of "archive.tar.gz" is "gz", base names that start
+ * with a dot, such as ".profile", and base names that end with a dot
+ * have no extension
+ * Returns 1 if successful, 0 if the base name has no extension or -1 on error
+ */
+int libcpath_path_view_get_extension_wide(
+     libcpath_path_view_wide_t *path_view,
+     const wchar_t **extension,
+     size_t *extension_length,
+     libcerror_error_t **error )
+{
+	const wchar_t *base_name = NULL;
+	static char *function    = "libcpath_path_view_get_extension_wide";
+	size_t base_name_index   = 0;
+	size_t base_name_length  = 0;
+
+	if( extension == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension.",
+		 function );
+
+		return( -1 );
+	}
+	if( extension_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_view_get_basename_wide(
+	     path_view,
+	     &base_name,
+	     &base_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve base name.",
+		 function );
+
+		return( -1 );
+	}
+	for( base_name_index = base_name_length;
+	     base_name_index > 1;
+	     base_name_index-- )
+	{
+		if( base_name[ base_name_index - 1 ] == (wchar_t) '.' )
+		{
+			break;
+		}
+	}
+	if( ( base_name_index <= 1 )
+	 || ( base_name_index >= base_name_length ) )
+	{
+		return( 0 );
+	}
+	*extension        = &( base_name[ base_name_index ] );
+	*extension_length = base_name_length - base_name_index;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
@@ -0,0 +1,194 @@
+/*
+ * Path view functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_INTERNAL_PATH_VIEW_H )
+#define _LIBCPATH_INTERNAL_PATH_VIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#if !defined( HAVE_LOCAL_LIBCPATH )
+#include <libcpath/path_view.h>
+#endif
+
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LOCAL_LIBCPATH )
+
+/* The path view is allocated by the caller and refers to the path
+ * without copying it, hence the path must remain valid while the
+ * path view is used
+ */
+typedef struct libcpath_path_view libcpath_path_view_t;
+
+struct libcpath_path_view
+{
+	/* The path
+	 */
+	const char *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The index of the start of the segments that have not been iterated
+	 */
+	size_t front_index;
+
+	/* The index of the end of the segments that have not been iterated
+	 */
+	size_t back_index;
+};
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+typedef struct libcpath_path_view_wide libcpath_path_view_wide_t;
+
+struct libcpath_path_view_wide
+{
+	/* The path
+	 */
+	const wchar_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The index of the start of the segments that have not been iterated
+	 */
+	size_t front_index;
+
+	/* The index of the end of the segments that have not been iterated
+	 */
+	size_t back_index;
+};
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#endif /* defined( HAVE_LOCAL_LIBCPATH ) */
+
+size_t libcpath_path_view_get_root_length(
+        const char *path,
+        size_t path_length );
+
+LIBCPATH_EXTERN \
+int libcpath_path_view_initialize(
+     libcpath_path_view_t *path_view,
+     const char *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_view_get_next_segment(
+     libcpath_path_view_t *path_view,
+     const char **segment,
+     size_t *segment_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_view_get_previous_segment(
+     libcpath_path_view_t *path_view,
+     const char **segment,
+     size_t *segment_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_view_get_dirname(
+     libcpath_path_view_t *path_view,
+     const char **directory_name,
+     size_t *directory_name_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_view_get_basename(
+     libcpath_path_view_t *path_view,
+     const char **base_name,
+     size_t *base_name_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_view_get_extension(
+     libcpath_path_view_t *path_view,
+     const char **extension,
+     size_t *extension_length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+size_t libcpath_path_view_get_root_length_wide(
+        const wchar_t *path,
+        size_t path_length );
+
+LIBCPATH_EXTERN \
+int libcpath_path_view_initialize_wide(
+     libcpath_path_view_wide_t *path_view,
+     const wchar_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_view_get_next_segment_wide(
+     libcpath_path_view_wide_t *path_view,
+     const wchar_t **segment,
+     size_t *segment_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_view_get_previous_segment_wide(
+     libcpath_path_view_wide_t *path_view,
+     const wchar_t **segment,
+     size_t *segment_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_view_get_dirname_wide(
+     libcpath_path_view_wide_t *path_view,
+     const wchar_t **directory_name,
+     size_t *directory_name_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_view_get_basename_wide(
+     libcpath_path_view_wide_t *path_view,
+     const wchar_t **base_name,
+     size_t *base_name_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_view_get_extension_wide(
+     libcpath_path_view_wide_t *path_view,
+     const wchar_t **extension,
+     size_t *extension_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_INTERNAL_PATH_VIEW_H ) */
+
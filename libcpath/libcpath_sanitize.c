@@ -0,0 +1,358 @@
+/*
+ * Sanitize functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_definitions.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_sanitize.h"
+
+#if defined( HAVE_LIBCPATH_SANITIZE_SSE2 ) || defined( HAVE_LIBCPATH_SANITIZE_AVX2 )
+#include <immintrin.h>
+#endif
+
+/* The size of a sanitized character that is not escaped on every platform
+ * The escape character is escaped by itself and a / that is not the separator
+ * is escaped as a hexadecimal value
+ */
+#define LIBCPATH_SANITIZE_CHARACTER_SIZE( character ) \
+	( ( character == LIBCPATH_ESCAPE_CHARACTER ) ? 2 : ( ( character == '/' ) && ( LIBCPATH_SEPARATOR != '/' ) ) ? 4 : 1 )
+
+/* The sizes of the sanitized versions of the path characters
+ * Control characters and characters that have a special meaning in a shell
+ * or on a file system are escaped as a hexadecimal value of 4 characters
+ */
+const uint8_t libcpath_sanitize_character_sizes[ 256 ] = {
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	1, 4, 1, 1, 4, 4, 4, 1, 1, 1, 4, 4, 1, 1, 1,
+	LIBCPATH_SANITIZE_CHARACTER_SIZE( '/' ),
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 4, 4, 1, 4, 4,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	LIBCPATH_SANITIZE_CHARACTER_SIZE( '\\' ),
+	1,
+	LIBCPATH_SANITIZE_CHARACTER_SIZE( '^' ),
+	1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1, 4,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+#if defined( HAVE_LIBCPATH_SANITIZE_AVX2 )
+
+/* The classifier function selected for the CPU at runtime
+ */
+static size_t (*libcpath_sanitize_get_unescaped_length_function)(
+                 const uint8_t *string,
+                 size_t string_length,
+                 uint8_t escaped_character ) = NULL;
+
+#endif /* defined( HAVE_LIBCPATH_SANITIZE_AVX2 ) */
+
+/* Determines the number of leading characters of a string that do not need to be escaped
+ * Besides the characters escaped by every sanitize function the escaped character
+ * is escaped, which is used for the separator when sanitizing a filename
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_sanitize_get_unescaped_length(
+     const char *string,
+     size_t string_length,
+     char escaped_character,
+     size_t *unescaped_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_sanitize_get_unescaped_length";
+
+#if defined( HAVE_LIBCPATH_SANITIZE_AVX2 )
+	size_t (*get_unescaped_length_function)(
+	          const uint8_t *string,
+	          size_t string_length,
+	          uint8_t escaped_character ) = NULL;
+#endif
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( unescaped_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unescaped length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCPATH_SANITIZE_AVX2 )
+	get_unescaped_length_function = __atomic_load_n(
+	                                 &libcpath_sanitize_get_unescaped_length_function,
+	                                 __ATOMIC_RELAXED );
+
+	if( get_unescaped_length_function == NULL )
+	{
+		if( libcpath_sanitize_has_avx2_support() != 0 )
+		{
+			get_unescaped_length_function = &libcpath_sanitize_get_unescaped_length_avx2;
+		}
+		else
+		{
+			get_unescaped_length_function = &libcpath_sanitize_get_unescaped_length_sse2;
+		}
+		__atomic_store_n(
+		 &libcpath_sanitize_get_unescaped_length_function,
+		 get_unescaped_length_function,
+		 __ATOMIC_RELAXED );
+	}
+	/* Short strings are classified using SSE2 since setting up AVX2 costs more
+	 * than it saves when the run of unescaped characters is short
+	 */
+	if( string_length < 64 )
+	{
+		get_unescaped_length_function = &libcpath_sanitize_get_unescaped_length_sse2;
+	}
+	*unescaped_length = get_unescaped_length_function(
+	                     (uint8_t *) string,
+	                     string_length,
+	                     (uint8_t) escaped_character );
+
+#elif defined( HAVE_LIBCPATH_SANITIZE_SSE2 )
+	*unescaped_length = libcpath_sanitize_get_unescaped_length_sse2(
+	                     (uint8_t *) string,
+	                     string_length,
+	                     (uint8_t) escaped_character );
+#else
+	*unescaped_length = libcpath_sanitize_get_unescaped_length_scalar(
+	                     (uint8_t *) string,
+	                     string_length,
+	                     (uint8_t) escaped_character );
+#endif
+	return( 1 );
+}
+
+/* Determines the number of leading characters of a string that do not need to be escaped
+ * This function classifies a single character at a time using libcpath_sanitize_character_sizes
+ * Returns the number of leading characters that do not need to be escaped
+ */
+size_t libcpath_sanitize_get_unescaped_length_scalar(
+        const uint8_t *string,
+        size_t string_length,
+        uint8_t escaped_character )
+{
+	size_t string_index = 0;
+
+	while( string_index < string_length )
+	{
+		if( ( libcpath_sanitize_character_sizes[ string[ string_index ] ] != 1 )
+		 || ( string[ string_index ] == escaped_character ) )
+		{
+			break;
+		}
+		string_index++;
+	}
+	return( string_index );
+}
+
+#if defined( HAVE_LIBCPATH_SANITIZE_SSE2 )
+
+/* Determines if the unsigned 8-bit values in a SSE2 vector are in the range first to first + count - 1
+ * Values outside the range wrap around when first is subtracted and hence become larger than count - 1
+ */
+#define LIBCPATH_SANITIZE_SSE2_IS_IN_RANGE( vector, first, count ) \
+	_mm_cmpeq_epi8( \
+	 _mm_min_epu8( \
+	  _mm_sub_epi8( vector, _mm_set1_epi8( (char) ( first ) ) ), \
+	  _mm_set1_epi8( (char) ( ( count ) - 1 ) ) ), \
+	 _mm_sub_epi8( vector, _mm_set1_epi8( (char) ( first ) ) ) )
+
+/* Determines the number of leading characters of a string that do not need to be escaped
+ * This function classifies 16 characters at a time using SSE2
+ * Returns the number of leading characters that do not need to be escaped
+ */
+size_t libcpath_sanitize_get_unescaped_length_sse2(
+        const uint8_t *string,
+        size_t string_length,
+        uint8_t escaped_character )
+{
+	__m128i escaped_vector = _mm_setzero_si128();
+	__m128i string_vector  = _mm_setzero_si128();
+	size_t string_index    = 0;
+	int escaped_mask       = 0;
+
+	while( ( string_length - string_index ) >= 16 )
+	{
+		string_vector = _mm_loadu_si128(
+		                 (__m128i *) &( string[ string_index ] ) );
+
+		/* Control characters, ! $ % & * + : ; < > ? | and 0x7f
+		 */
+		escaped_vector = LIBCPATH_SANITIZE_SSE2_IS_IN_RANGE( string_vector, 0x00, 32 );
+		escaped_vector = _mm_or_si128( escaped_vector, _mm_cmpeq_epi8( string_vector, _mm_set1_epi8( '!' ) ) );
+		escaped_vector = _mm_or_si128( escaped_vector, LIBCPATH_SANITIZE_SSE2_IS_IN_RANGE( string_vector, '$', 3 ) );
+		escaped_vector = _mm_or_si128( escaped_vector, LIBCPATH_SANITIZE_SSE2_IS_IN_RANGE( string_vector, '*', 2 ) );
+		escaped_vector = _mm_or_si128( escaped_vector, LIBCPATH_SANITIZE_SSE2_IS_IN_RANGE( string_vector, ':', 3 ) );
+		escaped_vector = _mm_or_si128( escaped_vector, LIBCPATH_SANITIZE_SSE2_IS_IN_RANGE( string_vector, '>', 2 ) );
+		escaped_vector = _mm_or_si128( escaped_vector, _mm_cmpeq_epi8( string_vector, _mm_set1_epi8( '|' ) ) );
+		escaped_vector = _mm_or_si128( escaped_vector, _mm_cmpeq_epi8( string_vector, _mm_set1_epi8( 0x7f ) ) );
+
+		/* The escape character, a / that is not the separator and the escaped character
+		 * where 0 is used for a / that is the separator since it is a control character
+		 */
+		escaped_vector = _mm_or_si128( escaped_vector, _mm_cmpeq_epi8( string_vector, _mm_set1_epi8( LIBCPATH_ESCAPE_CHARACTER ) ) );
+		escaped_vector = _mm_or_si128( escaped_vector, _mm_cmpeq_epi8( string_vector, _mm_set1_epi8( ( LIBCPATH_SEPARATOR != '/' ) ? '/' : 0 ) ) );
+		escaped_vector = _mm_or_si128( escaped_vector, _mm_cmpeq_epi8( string_vector, _mm_set1_epi8( (char) escaped_character ) ) );
+
+		escaped_mask = _mm_movemask_epi8(
+		                escaped_vector );
+
+		if( escaped_mask != 0 )
+		{
+			return( string_index + (size_t) __builtin_ctz( (unsigned int) escaped_mask ) );
+		}
+		string_index += 16;
+	}
+	return( string_index + libcpath_sanitize_get_unescaped_length_scalar(
+	                        &( string[ string_index ] ),
+	                        string_length - string_index,
+	                        escaped_character ) );
+}
+
+#endif /* defined( HAVE_LIBCPATH_SANITIZE_SSE2 ) */
+
+#if defined( HAVE_LIBCPATH_SANITIZE_AVX2 )
+
+/* Determines if the CPU supports AVX2
+ * Returns 1 if supported or 0 if not
+ */
+int libcpath_sanitize_has_avx2_support(
+     void )
+{
+	__builtin_cpu_init();
+
+	if( __builtin_cpu_supports( "avx2" ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determines if the unsigned 8-bit values in an AVX2 vector are in the range first to first + count - 1
+ * Values outside the range wrap around when first is subtracted and hence become larger than count - 1
+ */
+#define LIBCPATH_SANITIZE_AVX2_IS_IN_RANGE( vector, first, count ) \
+	_mm256_cmpeq_epi8( \
+	 _mm256_min_epu8( \
+	  _mm256_sub_epi8( vector, _mm256_set1_epi8( (char) ( first ) ) ), \
+	  _mm256_set1_epi8( (char) ( ( count ) - 1 ) ) ), \
+	 _mm256_sub_epi8( vector, _mm256_set1_epi8( (char) ( first ) ) ) )
+
+/* Determines the number of leading characters of a string that do not need to be escaped
+ * This function classifies 32 characters at a time using AVX2 and should only be called
+ * if libcpath_sanitize_has_avx2_support indicates the CPU supports AVX2
+ * Returns the number of leading characters that do not need to be escaped
+ */
+__attribute__(( target( "avx2" ) ))
+size_t libcpath_sanitize_get_unescaped_length_avx2(
+        const uint8_t *string,
+        size_t string_length,
+        uint8_t escaped_character )
+{
+	__m256i escaped_vector = _mm256_setzero_si256();
+	__m256i string_vector  = _mm256_setzero_si256();
+	size_t string_index    = 0;
+	int escaped_mask       = 0;
+
+	while( ( string_length - string_index ) >= 32 )
+	{
+		string_vector = _mm256_loadu_si256(
+		                 (__m256i *) &( string[ string_index ] ) );
+
+		/* Control characters, ! $ % & * + : ; < > ? | and 0x7f
+		 */
+		escaped_vector = LIBCPATH_SANITIZE_AVX2_IS_IN_RANGE( string_vector, 0x00, 32 );
+		escaped_vector = _mm256_or_si256( escaped_vector, _mm256_cmpeq_epi8( string_vector, _mm256_set1_epi8( '!' ) ) );
+		escaped_vector = _mm256_or_si256( escaped_vector, LIBCPATH_SANITIZE_AVX2_IS_IN_RANGE( string_vector, '$', 3 ) );
+		escaped_vector = _mm256_or_si256( escaped_vector, LIBCPATH_SANITIZE_AVX2_IS_IN_RANGE( string_vector, '*', 2 ) );
+		escaped_vector = _mm256_or_si256( escaped_vector, LIBCPATH_SANITIZE_AVX2_IS_IN_RANGE( string_vector, ':', 3 ) );
+		escaped_vector = _mm256_or_si256( escaped_vector, LIBCPATH_SANITIZE_AVX2_IS_IN_RANGE( string_vector, '>', 2 ) );
+		escaped_vector = _mm256_or_si256( escaped_vector, _mm256_cmpeq_epi8( string_vector, _mm256_set1_epi8( '|' ) ) );
+		escaped_vector = _mm256_or_si256( escaped_vector, _mm256_cmpeq_epi8( string_vector, _mm256_set1_epi8( 0x7f ) ) );
+
+		/* The escape character, a / that is not the separator and the escaped character
+		 * where 0 is used for a / that is the separator since it is a control character
+		 */
+		escaped_vector = _mm256_or_si256( escaped_vector, _mm256_cmpeq_epi8( string_vector, _mm256_set1_epi8( LIBCPATH_ESCAPE_CHARACTER ) ) );
+		escaped_vector = _mm256_or_si256( escaped_vector, _mm256_cmpeq_epi8( string_vector, _mm256_set1_epi8( ( LIBCPATH_SEPARATOR != '/' ) ? '/' : 0 ) ) );
+		escaped_vector = _mm256_or_si256( escaped_vector, _mm256_cmpeq_epi8( string_vector, _mm256_set1_epi8( (char) escaped_character ) ) );
+
+		escaped_mask = _mm256_movemask_epi8(
+		                escaped_vector );
+
+		if( escaped_mask != 0 )
+		{
+			return( string_index + (size_t) __builtin_ctz( (unsigned int) escaped_mask ) );
+		}
+		string_index += 32;
+	}
+	/* The remaining characters are classified in this function since calling
+	 * the SSE2 classifier after using AVX2 registers incurs a state transition
+	 */
+	while( string_index < string_length )
+	{
+		if( ( libcpath_sanitize_character_sizes[ string[ string_index ] ] != 1 )
+		 || ( string[ string_index ] == escaped_character ) )
+		{
+			break;
+		}
+		string_index++;
+	}
+	return( string_index );
+}
+
+#endif /* defined( HAVE_LIBCPATH_SANITIZE_AVX2 ) */
+
@@ -0,0 +1,87 @@
+/*
+ * Sanitize functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_SANITIZE_H )
+#define _LIBCPATH_SANITIZE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The SSE2 and AVX2 classifiers rely on GNU C vector intrinsics support
+ * and runtime CPU feature detection
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || ( defined( __i386__ ) && defined( __SSE2__ ) ) )
+#define HAVE_LIBCPATH_SANITIZE_SSE2
+#define HAVE_LIBCPATH_SANITIZE_AVX2
+#endif
+
+/* The number of consecutive characters that do not need to be escaped
+ * after which the rest of the run is classified vectorized
+ */
+#define LIBCPATH_SANITIZE_MINIMUM_RUN_LENGTH	16
+
+extern const uint8_t libcpath_sanitize_character_sizes[ 256 ];
+
+int libcpath_sanitize_get_unescaped_length(
+     const char *string,
+     size_t string_length,
+     char escaped_character,
+     size_t *unescaped_length,
+     libcerror_error_t **error );
+
+size_t libcpath_sanitize_get_unescaped_length_scalar(
+        const uint8_t *string,
+        size_t string_length,
+        uint8_t escaped_character );
+
+#if defined( HAVE_LIBCPATH_SANITIZE_SSE2 )
+
+size_t libcpath_sanitize_get_unescaped_length_sse2(
+        const uint8_t *string,
+        size_t string_length,
+        uint8_t escaped_character );
+
+#endif /* defined( HAVE_LIBCPATH_SANITIZE_SSE2 ) */
+
+#if defined( HAVE_LIBCPATH_SANITIZE_AVX2 )
+
+int libcpath_sanitize_has_avx2_support(
+     void );
+
+size_t libcpath_sanitize_get_unescaped_length_avx2(
+        const uint8_t *string,
+        size_t string_length,
+        uint8_t escaped_character );
+
+#endif /* defined( HAVE_LIBCPATH_SANITIZE_AVX2 ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_SANITIZE_H ) */
+
@@ -0,0 +1,58 @@
+/*
+ * Status functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_status.h"
+
+/* Clears the status
+ */
+void libcpath_status_clear(
+      libcpath_status_t *status )
+{
+	if( status != NULL )
+	{
+		status->error_domain      = 0;
+		status->error_code        = 0;
+		status->system_error_code = 0;
+	}
+}
+
+/* Sets the status
+ * The status is only set when it was not set before, hence it describes
+ * the failure where it originated rather than that of the calling functions
+ */
+void libcpath_status_set(
+      libcpath_status_t *status,
+      int error_domain,
+      int error_code,
+      uint32_t system_error_code )
+{
+	if( ( status != NULL )
+	 && ( status->error_domain == 0 ) )
+	{
+		status->error_domain      = error_domain;
+		status->error_code        = error_code;
+		status->system_error_code = system_error_code;
+	}
+}
+
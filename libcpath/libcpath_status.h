@@ -0,0 +1,74 @@
+/*
+ * Status functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_INTERNAL_STATUS_H )
+#define _LIBCPATH_INTERNAL_STATUS_H
+
+#include <common.h>
+#include <types.h>
+
+#if !defined( HAVE_LOCAL_LIBCPATH )
+#include <libcpath/status.h>
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LOCAL_LIBCPATH )
+
+/* The status is a lightweight alternative to an error, it is allocated
+ * by the caller and is set without formatting a message or allocating memory
+ */
+typedef struct libcpath_status libcpath_status_t;
+
+struct libcpath_status
+{
+	/* The error domain, 0 if not set
+	 */
+	int error_domain;
+
+	/* The error code
+	 */
+	int error_code;
+
+	/* The system error code, such as the errno value, 0 if not available
+	 */
+	uint32_t system_error_code;
+};
+
+#endif /* defined( HAVE_LOCAL_LIBCPATH ) */
+
+void libcpath_status_clear(
+      libcpath_status_t *status );
+
+void libcpath_status_set(
+      libcpath_status_t *status,
+      int error_domain,
+      int error_code,
+      uint32_t system_error_code );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_INTERNAL_STATUS_H ) */
+
@@ -27,14 +27,318 @@
 #include <wide_string.h>
 
 #include "libcpath_libcerror.h"
-#include "libcpath_libclocale.h"
 #include "libcpath_libuna.h"
 #include "libcpath_system_string.h"
+#include "libcpath_unused.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
 #error Unsupported size of wchar_t
 #endif
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Determines the number of leading ASCII characters of a narrow string
+ * The string is scanned 8 bytes at a time, where a block is accepted when none
+ * of its bytes has the most significant bit set and none of its bytes is an
+ * end-of-string character
+ * Returns 1 if the string only contains ASCII characters, 0 if not or -1 on error
+ */
+int libcpath_system_string_get_ascii_length(
+     const char *narrow_string,
+     size_t narrow_string_size,
+     size_t *ascii_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_system_string_get_ascii_length";
+	size_t string_index   = 0;
+	uint64_t block        = 0;
+
+	if( narrow_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid narrow string.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid narrow string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII length.",
+		 function );
+
+		return( -1 );
+	}
+	/* Subtracting 1 from every byte of the block sets the most significant bit
+	 * of a byte that is 0, hence the combined value only has no most significant
+	 * bits set if every byte is in the range 0x01 - 0x7f
+	 */
+	while( ( narrow_string_size - string_index ) >= 8 )
+	{
+		if( memory_copy(
+		     &block,
+		     &( narrow_string[ string_index ] ),
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( ( block | ( block - 0x0101010101010101ULL ) ) & 0x8080808080808080ULL ) != 0 )
+		{
+			break;
+		}
+		string_index += 8;
+	}
+	while( string_index < narrow_string_size )
+	{
+		if( narrow_string[ string_index ] == 0 )
+		{
+			break;
+		}
+		if( ( (uint8_t) narrow_string[ string_index ] & 0x80 ) != 0 )
+		{
+			*ascii_length = string_index;
+
+			return( 0 );
+		}
+		string_index++;
+	}
+	*ascii_length = string_index;
+
+	return( 1 );
+}
+
+/* Decodes a narrow string into a wide string
+ * The leading ASCII characters are widened directly and only the remainder of
+ * the string is decoded by libuna, as UTF-8 if codepage is 0 or as a byte
+ * stream in the codepage otherwise. Every codepage supported by libuna encodes
+ * the ASCII characters as single bytes with the same value.
+ *
+ * If wide_string is NULL only the required wide string size is determined.
+ * A narrow character never decodes into more than one wide character, hence
+ * a wide string of narrow_string_size + 1 characters can be filled in a single
+ * call without determining its size first.
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_system_string_decode_narrow_string(
+     const char *narrow_string,
+     size_t narrow_string_size,
+     wchar_t *wide_string,
+     size_t wide_string_size,
+     size_t *required_wide_string_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_system_string_decode_narrow_string";
+	size_t ascii_length   = 0;
+	size_t remainder_size = 0;
+	size_t string_index   = 0;
+	int result            = 0;
+
+	if( wide_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid wide string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_wide_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required wide string size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcpath_system_string_get_ascii_length(
+	          narrow_string,
+	          narrow_string_size,
+	          &ascii_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII length.",
+		 function );
+
+		return( -1 );
+	}
+	if( wide_string != NULL )
+	{
+		if( ( ( result == 1 ) && ( wide_string_size <= ascii_length ) )
+		 || ( ( result == 0 ) && ( wide_string_size < ascii_length ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid wide string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		for( string_index = 0;
+		     string_index < ascii_length;
+		     string_index++ )
+		{
+			wide_string[ string_index ] = (wchar_t) narrow_string[ string_index ];
+		}
+	}
+	if( result == 1 )
+	{
+		if( wide_string != NULL )
+		{
+			wide_string[ ascii_length ] = 0;
+		}
+		*required_wide_string_size = ascii_length + 1;
+
+		return( 1 );
+	}
+	remainder_size = narrow_string_size - ascii_length;
+
+	if( wide_string == NULL )
+	{
+		if( codepage == 0 )
+		{
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf32_string_size_from_utf8(
+			          (libuna_utf8_character_t *) &( narrow_string[ ascii_length ] ),
+			          remainder_size,
+			          required_wide_string_size,
+			          error );
+#elif SIZEOF_WCHAR_T == 2
+			result = libuna_utf16_string_size_from_utf8(
+			          (libuna_utf8_character_t *) &( narrow_string[ ascii_length ] ),
+			          remainder_size,
+			          required_wide_string_size,
+			          error );
+#endif /* SIZEOF_WCHAR_T */
+		}
+		else
+		{
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf32_string_size_from_byte_stream(
+			          (uint8_t *) &( narrow_string[ ascii_length ] ),
+			          remainder_size,
+			          codepage,
+			          required_wide_string_size,
+			          error );
+#elif SIZEOF_WCHAR_T == 2
+			result = libuna_utf16_string_size_from_byte_stream(
+			          (uint8_t *) &( narrow_string[ ascii_length ] ),
+			          remainder_size,
+			          codepage,
+			          required_wide_string_size,
+			          error );
+#endif /* SIZEOF_WCHAR_T */
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to determine wide string size.",
+			 function );
+
+			return( -1 );
+		}
+		*required_wide_string_size += ascii_length;
+
+		return( 1 );
+	}
+	if( codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_utf8(
+		          (libuna_utf32_character_t *) &( wide_string[ ascii_length ] ),
+		          wide_string_size - ascii_length,
+		          (libuna_utf8_character_t *) &( narrow_string[ ascii_length ] ),
+		          remainder_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_utf8(
+		          (libuna_utf16_character_t *) &( wide_string[ ascii_length ] ),
+		          wide_string_size - ascii_length,
+		          (libuna_utf8_character_t *) &( narrow_string[ ascii_length ] ),
+		          remainder_size,
+		          error );
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_byte_stream(
+		          (libuna_utf32_character_t *) &( wide_string[ ascii_length ] ),
+		          wide_string_size - ascii_length,
+		          (uint8_t *) &( narrow_string[ ascii_length ] ),
+		          remainder_size,
+		          codepage,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_byte_stream(
+		          (libuna_utf16_character_t *) &( wide_string[ ascii_length ] ),
+		          wide_string_size - ascii_length,
+		          (uint8_t *) &( narrow_string[ ascii_length ] ),
+		          remainder_size,
+		          codepage,
+		          error );
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to decode wide string.",
+		 function );
+
+		return( -1 );
+	}
+	*required_wide_string_size = ascii_length + wide_string_length(
+	                                             &( wide_string[ ascii_length ] ) ) + 1;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 /* Determines the size of a narrow string from a system string
  * Returns 1 if successful or -1 on error
  */
@@ -42,6 +346,7 @@ int libcpath_system_string_size_to_narrow_string(
      const system_character_t *system_string,
      size_t system_string_size,
      size_t *narrow_string_size,
+     int codepage,
      libcerror_error_t **error )
 {
 	static char *function = "libcpath_system_string_size_to_narrow_string";
@@ -51,7 +356,7 @@ int libcpath_system_string_size_to_narrow_string(
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
+	if( codepage == 0 )
 	{
 #if SIZEOF_WCHAR_T == 4
 		result = libuna_utf8_string_size_from_utf32(
@@ -73,14 +378,14 @@ int libcpath_system_string_size_to_narrow_string(
 		result = libuna_byte_stream_size_from_utf32(
 		          (libuna_utf32_character_t *) system_string,
 		          system_string_size,
-		          libclocale_codepage,
+		          codepage,
 		          narrow_string_size,
 		          error );
 #elif SIZEOF_WCHAR_T == 2
 		result = libuna_byte_stream_size_from_utf16(
 		          (libuna_utf16_character_t *) system_string,
 		          system_string_size,
-		          libclocale_codepage,
+		          codepage,
 		          narrow_string_size,
 		          error );
 #endif /* SIZEOF_WCHAR_T */
@@ -97,6 +402,8 @@ int libcpath_system_string_size_to_narrow_string(
 		return( -1 );
 	}
 #else
+	LIBCPATH_UNREFERENCED_PARAMETER( codepage )
+
 	if( system_string == NULL )
 	{
 		libcerror_error_set(
@@ -145,6 +452,7 @@ int libcpath_system_string_copy_to_narrow_string(
      size_t system_string_size,
      char *narrow_string,
      size_t narrow_string_size,
+     int codepage,
      libcerror_error_t **error )
 {
 	static char *function = "libcpath_system_string_copy_to_narrow_string";
@@ -154,7 +462,7 @@ int libcpath_system_string_copy_to_narrow_string(
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
+	if( codepage == 0 )
 	{
 #if SIZEOF_WCHAR_T == 4
 		result = libuna_utf8_string_copy_from_utf32(
@@ -178,7 +486,7 @@ int libcpath_system_string_copy_to_narrow_string(
 		result = libuna_byte_stream_copy_from_utf32(
 		          (uint8_t *) narrow_string,
 		          narrow_string_size,
-		          libclocale_codepage,
+		          codepage,
 		          (libuna_utf32_character_t *) system_string,
 		          system_string_size,
 		          error );
@@ -186,7 +494,7 @@ int libcpath_system_string_copy_to_narrow_string(
 		result = libuna_byte_stream_copy_from_utf16(
 		          (uint8_t *) narrow_string,
 		          narrow_string_size,
-		          libclocale_codepage,
+		          codepage,
 		          (libuna_utf16_character_t *) system_string,
 		          system_string_size,
 		          error );
@@ -204,6 +512,8 @@ int libcpath_system_string_copy_to_narrow_string(
 		return( -1 );
 	}
 #else
+	LIBCPATH_UNREFERENCED_PARAMETER( codepage )
+
 	if( system_string == NULL )
 	{
 		libcerror_error_set(
@@ -287,50 +597,20 @@ int libcpath_system_string_size_from_narrow_string(
      const char *narrow_string,
      size_t narrow_string_size,
      size_t *system_string_size,
+     int codepage,
      libcerror_error_t **error )
 {
 	static char *function = "libcpath_system_string_size_from_narrow_string";
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) narrow_string,
-		          narrow_string_size,
-		          system_string_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) narrow_string,
-		          narrow_string_size,
-		          system_string_size,
-		          error );
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) narrow_string,
-		          narrow_string_size,
-		          libclocale_codepage,
-		          system_string_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) narrow_string,
-		          narrow_string_size,
-		          libclocale_codepage,
-		          system_string_size,
-		          error );
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+	if( libcpath_system_string_decode_narrow_string(
+	     narrow_string,
+	     narrow_string_size,
+	     NULL,
+	     0,
+	     system_string_size,
+	     codepage,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -342,6 +622,8 @@ int libcpath_system_string_size_from_narrow_string(
 		return( -1 );
 	}
 #else
+	LIBCPATH_UNREFERENCED_PARAMETER( codepage )
+
 	if( narrow_string == NULL )
 	{
 		libcerror_error_set(
@@ -390,54 +672,35 @@ int libcpath_system_string_copy_from_narrow_string(
      size_t system_string_size,
      const char *narrow_string,
      size_t narrow_string_size,
+     int codepage,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_system_string_copy_from_narrow_string";
+	static char *function              = "libcpath_system_string_copy_from_narrow_string";
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
+	size_t required_system_string_size = 0;
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_utf8(
-		          (libuna_utf32_character_t *) system_string,
-		          system_string_size,
-		          (libuna_utf8_character_t *) narrow_string,
-		          narrow_string_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_utf8(
-		          (libuna_utf16_character_t *) system_string,
-		          system_string_size,
-		          (libuna_utf8_character_t *) narrow_string,
-		          narrow_string_size,
-		          error );
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
+	if( system_string == NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_byte_stream(
-		          (libuna_utf32_character_t *) system_string,
-		          system_string_size,
-		          (uint8_t *) narrow_string,
-		          narrow_string_size,
-		          libclocale_codepage,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_byte_stream(
-		          (libuna_utf16_character_t *) system_string,
-		          system_string_size,
-		          (uint8_t *) narrow_string,
-		          narrow_string_size,
-		          libclocale_codepage,
-		          error );
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system string.",
+		 function );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	if( libcpath_system_string_decode_narrow_string(
+	     narrow_string,
+	     narrow_string_size,
+	     system_string,
+	     system_string_size,
+	     &required_system_string_size,
+	     codepage,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -449,6 +712,8 @@ int libcpath_system_string_copy_from_narrow_string(
 		return( -1 );
 	}
 #else
+	LIBCPATH_UNREFERENCED_PARAMETER( codepage )
+
 	if( system_string == NULL )
 	{
 		libcerror_error_set(
@@ -534,15 +799,14 @@ int libcpath_system_string_size_to_wide_string(
      const system_character_t *system_string,
      size_t system_string_size,
      size_t *wide_string_size,
+     int codepage,
      libcerror_error_t **error )
 {
 	static char *function = "libcpath_system_string_size_to_wide_string";
 
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
-
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	LIBCPATH_UNREFERENCED_PARAMETER( codepage )
+
 	if( system_string == NULL )
 	{
 		libcerror_error_set(
@@ -578,41 +842,14 @@ int libcpath_system_string_size_to_wide_string(
 	}
 	*wide_string_size = system_string_size;
 #else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) system_string,
-		          system_string_size,
-		          wide_string_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) system_string,
-		          system_string_size,
-		          wide_string_size,
-		          error );
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) system_string,
-		          system_string_size,
-		          libclocale_codepage,
-		          wide_string_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) system_string,
-		          system_string_size,
-		          libclocale_codepage,
-		          wide_string_size,
-		          error );
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+	if( libcpath_system_string_decode_narrow_string(
+	     system_string,
+	     system_string_size,
+	     NULL,
+	     0,
+	     wide_string_size,
+	     codepage,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -636,15 +873,18 @@ int libcpath_system_string_copy_to_wide_string(
      size_t system_string_size,
      wchar_t *wide_string,
      size_t wide_string_size,
+     int codepage,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_system_string_copy_to_wide_string";
+	static char *function            = "libcpath_system_string_copy_to_wide_string";
 
 #if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
+	size_t required_wide_string_size = 0;
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	LIBCPATH_UNREFERENCED_PARAMETER( codepage )
+
 	if( system_string == NULL )
 	{
 		libcerror_error_set(
@@ -716,45 +956,25 @@ int libcpath_system_string_copy_to_wide_string(
 	}
 	wide_string[ system_string_size - 1 ] = 0;
 #else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_utf8(
-		          (libuna_utf32_character_t *) wide_string,
-		          wide_string_size,
-		          (libuna_utf8_character_t *) system_string,
-		          system_string_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_utf8(
-		          (libuna_utf16_character_t *) wide_string,
-		          wide_string_size,
-		          (libuna_utf8_character_t *) system_string,
-		          system_string_size,
-		          error );
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
+	if( wide_string == NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_byte_stream(
-		          (libuna_utf32_character_t *) wide_string,
-		          wide_string_size,
-		          (uint8_t *) system_string,
-		          system_string_size,
-		          libclocale_codepage,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_byte_stream(
-		          (libuna_utf16_character_t *) wide_string,
-		          wide_string_size,
-		          (uint8_t *) system_string,
-		          system_string_size,
-		          libclocale_codepage,
-		          error );
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid wide string.",
+		 function );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	if( libcpath_system_string_decode_narrow_string(
+	     system_string,
+	     system_string_size,
+	     wide_string,
+	     wide_string_size,
+	     &required_wide_string_size,
+	     codepage,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -777,6 +997,7 @@ int libcpath_system_string_size_from_wide_string(
      const wchar_t *wide_string,
      size_t wide_string_size,
      size_t *system_string_size,
+     int codepage,
      libcerror_error_t **error )
 {
 	static char *function = "libcpath_system_string_size_from_wide_string";
@@ -786,6 +1007,8 @@ int libcpath_system_string_size_from_wide_string(
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	LIBCPATH_UNREFERENCED_PARAMETER( codepage )
+
 	if( wide_string == NULL )
 	{
 		libcerror_error_set(
@@ -821,7 +1044,7 @@ int libcpath_system_string_size_from_wide_string(
 	}
 	*system_string_size = wide_string_size;
 #else
-	if( libclocale_codepage == 0 )
+	if( codepage == 0 )
 	{
 #if SIZEOF_WCHAR_T == 4
 		result = libuna_utf8_string_size_from_utf32(
@@ -843,14 +1066,14 @@ int libcpath_system_string_size_from_wide_string(
 		result = libuna_byte_stream_size_from_utf32(
 		          (libuna_utf32_character_t *) wide_string,
 		          wide_string_size,
-		          libclocale_codepage,
+		          codepage,
 		          system_string_size,
 		          error );
 #elif SIZEOF_WCHAR_T == 2
 		result = libuna_byte_stream_size_from_utf16(
 		          (libuna_utf16_character_t *) wide_string,
 		          wide_string_size,
-		          libclocale_codepage,
+		          codepage,
 		          system_string_size,
 		          error );
 #endif /* SIZEOF_WCHAR_T */
@@ -879,6 +1102,7 @@ int libcpath_system_string_copy_from_wide_string(
      size_t system_string_size,
      const wchar_t *wide_string,
      size_t wide_string_size,
+     int codepage,
      libcerror_error_t **error )
 {
 	static char *function = "libcpath_system_string_copy_from_wide_string";
@@ -888,6 +1112,8 @@ int libcpath_system_string_copy_from_wide_string(
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	LIBCPATH_UNREFERENCED_PARAMETER( codepage )
+
 	if( system_string == NULL )
 	{
 		libcerror_error_set(
@@ -959,7 +1185,7 @@ int libcpath_system_string_copy_from_wide_string(
 	}
 	system_string[ wide_string_size - 1 ] = 0;
 #else
-	if( libclocale_codepage == 0 )
+	if( codepage == 0 )
 	{
 #if SIZEOF_WCHAR_T == 4
 		result = libuna_utf8_string_copy_from_utf32(
@@ -983,7 +1209,7 @@ int libcpath_system_string_copy_from_wide_string(
 		result = libuna_byte_stream_copy_from_utf32(
 		          (uint8_t *) system_string,
 		          system_string_size,
-		          libclocale_codepage,
+		          codepage,
 		          (libuna_utf32_character_t *) wide_string,
 		          wide_string_size,
 		          error );
@@ -991,7 +1217,7 @@ int libcpath_system_string_copy_from_wide_string(
 		result = libuna_byte_stream_copy_from_utf16(
 		          (uint8_t *) system_string,
 		          system_string_size,
-		          libclocale_codepage,
+		          codepage,
 		          (libuna_utf16_character_t *) wide_string,
 		          wide_string_size,
 		          error );
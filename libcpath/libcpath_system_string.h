@@ -31,10 +31,30 @@
 extern "C" {
 #endif
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libcpath_system_string_get_ascii_length(
+     const char *narrow_string,
+     size_t narrow_string_size,
+     size_t *ascii_length,
+     libcerror_error_t **error );
+
+int libcpath_system_string_decode_narrow_string(
+     const char *narrow_string,
+     size_t narrow_string_size,
+     wchar_t *wide_string,
+     size_t wide_string_size,
+     size_t *required_wide_string_size,
+     int codepage,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 int libcpath_system_string_size_to_narrow_string(
      const system_character_t *system_string,
      size_t system_string_size,
      size_t *narrow_string_size,
+     int codepage,
      libcerror_error_t **error );
 
 int libcpath_system_string_copy_to_narrow_string(
@@ -42,12 +62,14 @@ int libcpath_system_string_copy_to_narrow_string(
      size_t system_string_size,
      char *narrow_string,
      size_t narrow_string_size,
+     int codepage,
      libcerror_error_t **error );
 
 int libcpath_system_string_size_from_narrow_string(
      const char *narrow_string,
      size_t narrow_string_size,
      size_t *system_string_size,
+     int codepage,
      libcerror_error_t **error );
 
 int libcpath_system_string_copy_from_narrow_string(
@@ -55,6 +77,7 @@ int libcpath_system_string_copy_from_narrow_string(
      size_t system_string_size,
      const char *narrow_string,
      size_t narrow_string_size,
+     int codepage,
      libcerror_error_t **error );
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
@@ -63,6 +86,7 @@ int libcpath_system_string_size_to_wide_string(
      const system_character_t *system_string,
      size_t system_string_size,
      size_t *wide_string_size,
+     int codepage,
      libcerror_error_t **error );
 
 int libcpath_system_string_copy_to_wide_string(
@@ -70,12 +94,14 @@ int libcpath_system_string_copy_to_wide_string(
      size_t system_string_size,
      wchar_t *wide_string,
      size_t wide_string_size,
+     int codepage,
      libcerror_error_t **error );
 
 int libcpath_system_string_size_from_wide_string(
      const wchar_t *wide_string,
      size_t wide_string_size,
      size_t *system_string_size,
+     int codepage,
      libcerror_error_t **error );
 
 int libcpath_system_string_copy_from_wide_string(
@@ -83,6 +109,7 @@ int libcpath_system_string_copy_from_wide_string(
      size_t system_string_size,
      const wchar_t *wide_string,
      size_t wide_string_size,
+     int codepage,
      libcerror_error_t **error );
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
@@ -0,0 +1,3188 @@
+/*
+ * Library path functions benchmark program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_LIMITS_H ) || defined( WINAPI )
+#include <limits.h>
+#endif
+
+#if !defined( WINAPI )
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_libcsplit.h"
+#include "cpath_test_unused.h"
+
+#define CPATH_BENCH_DEFAULT_NUMBER_OF_ITERATIONS	2000
+
+/* The size of the buffer used by the to buffer functions
+ * which fits the largest result of the corpora
+ */
+#define CPATH_BENCH_BUFFER_SIZE				16384
+
+#define CPATH_BENCH_MAXIMUM_NUMBER_OF_PATHS		16
+
+/* The size of the paths generated for the deep and parent directory corpora
+ */
+#define CPATH_BENCH_GENERATED_PATH_SIZE			2048
+
+/* The number of adversarial corpora, each one has a larger depth of nested
+ * and parent directory segments, to show the cost of resolving parent
+ * directory (..) segments scales linearly with the path length
+ */
+#define CPATH_BENCH_NUMBER_OF_ADVERSARIAL_CORPORA	3
+
+#define CPATH_BENCH_NUMBER_OF_ADVERSARIAL_PATHS		3
+
+/* The number of directories made by every round of the directory benchmarks
+ */
+#define CPATH_BENCH_NUMBER_OF_DIRECTORIES		1024
+
+/* The number of iterations that corresponds to a round of the directory benchmarks
+ */
+#define CPATH_BENCH_DIRECTORY_ITERATIONS_PER_ROUND	200
+
+enum CPATH_BENCH_CORPORA
+{
+	CPATH_BENCH_CORPUS_SHORT,
+	CPATH_BENCH_CORPUS_DEEP,
+	CPATH_BENCH_CORPUS_PARENT_DIRECTORY,
+	CPATH_BENCH_CORPUS_UTF8,
+	CPATH_BENCH_CORPUS_ESCAPE,
+	CPATH_BENCH_CORPUS_EXISTING,
+
+	CPATH_BENCH_NUMBER_OF_CORPORA
+};
+
+typedef struct cpath_bench_corpus cpath_bench_corpus_t;
+
+struct cpath_bench_corpus
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The paths
+	 */
+	const char *paths[ CPATH_BENCH_MAXIMUM_NUMBER_OF_PATHS + 1 ];
+
+	/* The path lengths
+	 */
+	size_t path_lengths[ CPATH_BENCH_MAXIMUM_NUMBER_OF_PATHS ];
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The wide paths
+	 */
+	wchar_t *wide_paths[ CPATH_BENCH_MAXIMUM_NUMBER_OF_PATHS + 1 ];
+
+	/* The wide path lengths
+	 */
+	size_t wide_path_lengths[ CPATH_BENCH_MAXIMUM_NUMBER_OF_PATHS ];
+#endif
+
+	/* The number of paths
+	 */
+	int number_of_paths;
+
+	/* The number of bytes of the narrow paths
+	 */
+	uint64_t number_of_bytes;
+};
+
+/* The initializers of the values of a corpus that are determined at run time
+ */
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+#define CPATH_BENCH_CORPUS_RUNTIME_VALUES	{ 0 }, { NULL }, { 0 }, 0, 0
+#else
+#define CPATH_BENCH_CORPUS_RUNTIME_VALUES	{ 0 }, 0, 0
+#endif
+
+/* The corpora, the deep and parent directory corpora are generated
+ */
+cpath_bench_corpus_t cpath_bench_corpora[ CPATH_BENCH_NUMBER_OF_CORPORA ] = {
+	{ "short",
+	  { "a", "b.txt", "test", "x/y", "README", "src/main.c", ".profile", "..", NULL },
+	  CPATH_BENCH_CORPUS_RUNTIME_VALUES },
+	{ "deep",
+	  { NULL },
+	  CPATH_BENCH_CORPUS_RUNTIME_VALUES },
+	{ "parent_directory",
+	  { NULL },
+	  CPATH_BENCH_CORPUS_RUNTIME_VALUES },
+	{ "utf8",
+	  { "/home/\xe7\x94\xa8\xe6\x88\xb7/\xe6\x96\x87\xe6\xa1\xa3/r\xc3\xa9sum\xc3\xa9.txt",
+	    "\xd0\xb4\xd0\xbe\xd0\xba\xd1\x83\xd0\xbc\xd0\xb5\xd0\xbd\xd1\x82\xd1\x8b/\xce\xb1\xce\xb2\xce\xb3.txt",
+	    "na\xc3\xafve caf\xc3\xa9/\xc3\xa5\xc3\xa4\xc3\xb6",
+	    "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe3\x81\xae\xe3\x83\x95\xe3\x82\xa1\xe3\x82\xa4\xe3\x83\xab\xe5\x90\x8d.doc",
+	    "/media/\xf0\x9f\x93\x81/\xf0\x9f\x93\x84.txt",
+	    NULL },
+	  CPATH_BENCH_CORPUS_RUNTIME_VALUES },
+	{ "escape",
+	  { "a|b<c>d?e*f+g$h&i;j",
+	    "file\twith\x01" "control\x7f" "characters",
+	    "\x01\x02\x03\x04\x05\x06\x07\x08\x0b\x0c\x0e\x0f",
+	    "100%%%%%%%% done: yes!",
+	    "C:\\Windows\\System32\\config\\SOFTWARE",
+	    "::::\"\"\"\"''''````",
+	    NULL },
+	  CPATH_BENCH_CORPUS_RUNTIME_VALUES },
+	{ "existing",
+	  { "/", "/tmp", "/tmp/.", "/tmp/../tmp/", ".", "./", "..", "../.", NULL },
+	  CPATH_BENCH_CORPUS_RUNTIME_VALUES } };
+
+/* The corpus used by the functions that do not depend on the corpus
+ */
+cpath_bench_corpus_t cpath_bench_corpus_none = {
+	"none",
+	{ "", NULL },
+	CPATH_BENCH_CORPUS_RUNTIME_VALUES };
+
+/* The buffers of the generated corpora
+ */
+char cpath_bench_generated_paths[ 2 ][ 4 ][ CPATH_BENCH_GENERATED_PATH_SIZE ];
+
+/* The adversarial corpora, the paths are generated
+ */
+cpath_bench_corpus_t cpath_bench_adversarial_corpora[ CPATH_BENCH_NUMBER_OF_ADVERSARIAL_CORPORA ] = {
+	{ "adversarial_1024",
+	  { NULL },
+	  CPATH_BENCH_CORPUS_RUNTIME_VALUES },
+	{ "adversarial_4096",
+	  { NULL },
+	  CPATH_BENCH_CORPUS_RUNTIME_VALUES },
+	{ "adversarial_16384",
+	  { NULL },
+	  CPATH_BENCH_CORPUS_RUNTIME_VALUES } };
+
+/* The depths of the adversarial corpora
+ */
+int cpath_bench_adversarial_depths[ CPATH_BENCH_NUMBER_OF_ADVERSARIAL_CORPORA ] = {
+	1024, 4096, 16384 };
+
+/* The buffers of the adversarial corpora
+ */
+char *cpath_bench_adversarial_paths[ CPATH_BENCH_NUMBER_OF_ADVERSARIAL_CORPORA ][ CPATH_BENCH_NUMBER_OF_ADVERSARIAL_PATHS ];
+
+/* The number of allocations made through the benchmark allocator
+ */
+uint64_t cpath_bench_number_of_allocations = 0;
+
+/* Allocates data and counts the allocation
+ */
+void *cpath_bench_allocate(
+       size_t size,
+       void *user_data CPATH_TEST_ATTRIBUTE_UNUSED )
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	cpath_bench_number_of_allocations += 1;
+
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Reallocates data and counts the allocation
+ */
+void *cpath_bench_reallocate(
+       void *data,
+       size_t size,
+       void *user_data CPATH_TEST_ATTRIBUTE_UNUSED )
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	cpath_bench_number_of_allocations += 1;
+
+	return( memory_reallocate(
+	         data,
+	         size ) );
+}
+
+/* Frees data
+ */
+void cpath_bench_free(
+      void *data,
+      void *user_data CPATH_TEST_ATTRIBUTE_UNUSED )
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	memory_free(
+	 data );
+}
+
+/* Retrieves a monotonic timestamp in nano seconds
+ */
+uint64_t cpath_bench_get_timestamp(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	QueryPerformanceCounter(
+	 &counter );
+
+	QueryPerformanceFrequency(
+	 &frequency );
+
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+#else
+	struct timespec time_specification;
+
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &time_specification );
+
+	return( ( (uint64_t) time_specification.tv_sec * 1000000000UL ) + (uint64_t) time_specification.tv_nsec );
+#endif
+}
+
+/* Appends a string to a generated path
+ */
+void cpath_bench_append_string(
+      char *path,
+      size_t *path_index,
+      const char *string )
+{
+	size_t string_index = 0;
+
+	while( ( string[ string_index ] != 0 )
+	    && ( *path_index < ( CPATH_BENCH_GENERATED_PATH_SIZE - 1 ) ) )
+	{
+		path[ *path_index ] = string[ string_index ];
+
+		*path_index  += 1;
+		string_index += 1;
+	}
+	path[ *path_index ] = 0;
+}
+
+/* Generates the deep and parent directory corpora
+ */
+void cpath_bench_generate_corpora(
+      void )
+{
+	char segment[ 16 ];
+
+	int depths[ 4 ]              = { 8, 32, 64, 128 };
+	cpath_bench_corpus_t *corpus = NULL;
+	char *path                   = NULL;
+	size_t path_index            = 0;
+	int depth                    = 0;
+	int path_number              = 0;
+
+	/* The deep corpus consists of alternating absolute and relative paths of 8, 32, 64 and 128 levels
+	 */
+	corpus = &( cpath_bench_corpora[ CPATH_BENCH_CORPUS_DEEP ] );
+
+	for( path_number = 0;
+	     path_number < 4;
+	     path_number++ )
+	{
+		path       = cpath_bench_generated_paths[ 0 ][ path_number ];
+		path_index = 0;
+
+		for( depth = 0;
+		     depth < depths[ path_number ];
+		     depth++ )
+		{
+			snprintf(
+			 segment,
+			 16,
+			 "%sdir%03d",
+			 ( ( path_number % 2 ) == 0 ) || ( depth > 0 ) ? "/" : "",
+			 depth );
+
+			cpath_bench_append_string(
+			 path,
+			 &path_index,
+			 segment );
+		}
+		cpath_bench_append_string(
+		 path,
+		 &path_index,
+		 "/file.txt" );
+
+		corpus->paths[ path_number ] = path;
+	}
+	corpus->paths[ 4 ] = NULL;
+
+	/* The parent directory corpus consists of long paths dominated by . and .. segments
+	 */
+	corpus = &( cpath_bench_corpora[ CPATH_BENCH_CORPUS_PARENT_DIRECTORY ] );
+
+	path       = cpath_bench_generated_paths[ 1 ][ 0 ];
+	path_index = 0;
+
+	for( depth = 0;
+	     depth < 64;
+	     depth++ )
+	{
+		cpath_bench_append_string(
+		 path,
+		 &path_index,
+		 "segment/./next/../" );
+	}
+	cpath_bench_append_string(
+	 path,
+	 &path_index,
+	 "file.txt" );
+
+	corpus->paths[ 0 ] = path;
+
+	path       = cpath_bench_generated_paths[ 1 ][ 1 ];
+	path_index = 0;
+
+	cpath_bench_append_string(
+	 path,
+	 &path_index,
+	 "/x" );
+
+	for( depth = 0;
+	     depth < 256;
+	     depth++ )
+	{
+		cpath_bench_append_string(
+		 path,
+		 &path_index,
+		 "/.." );
+	}
+	cpath_bench_append_string(
+	 path,
+	 &path_index,
+	 "/y" );
+
+	corpus->paths[ 1 ] = path;
+
+	path       = cpath_bench_generated_paths[ 1 ][ 2 ];
+	path_index = 0;
+
+	for( depth = 0;
+	     depth < 128;
+	     depth++ )
+	{
+		cpath_bench_append_string(
+		 path,
+		 &path_index,
+		 "/d" );
+	}
+	for( depth = 0;
+	     depth < 128;
+	     depth++ )
+	{
+		cpath_bench_append_string(
+		 path,
+		 &path_index,
+		 "/.." );
+	}
+	cpath_bench_append_string(
+	 path,
+	 &path_index,
+	 "/file.txt" );
+
+	corpus->paths[ 2 ] = path;
+
+	path       = cpath_bench_generated_paths[ 1 ][ 3 ];
+	path_index = 0;
+
+	for( depth = 0;
+	     depth < 200;
+	     depth++ )
+	{
+		cpath_bench_append_string(
+		 path,
+		 &path_index,
+		 "a/../" );
+	}
+	cpath_bench_append_string(
+	 path,
+	 &path_index,
+	 "b" );
+
+	corpus->paths[ 3 ] = path;
+	corpus->paths[ 4 ] = NULL;
+}
+
+/* Repeats a string in a generated path
+ * The path must be large enough to contain the repeated string
+ */
+void cpath_bench_repeat_string(
+      char *path,
+      size_t *path_index,
+      const char *string,
+      int number_of_repetitions )
+{
+	size_t string_length = 0;
+	int repetition       = 0;
+
+	string_length = narrow_string_length(
+	                 string );
+
+	for( repetition = 0;
+	     repetition < number_of_repetitions;
+	     repetition++ )
+	{
+		memory_copy(
+		 &( path[ *path_index ] ),
+		 string,
+		 string_length );
+
+		*path_index += string_length;
+	}
+	path[ *path_index ] = 0;
+}
+
+/* Generates the adversarial corpora
+ * Every corpus consists of:
+ * a relative path of depth nested directories followed by as many parent directories
+ * an absolute path in which depth directories each are directly followed by a parent directory
+ * a relative path of depth parent directories, which exceeds the current working directory
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_generate_adversarial_corpora(
+     void )
+{
+	cpath_bench_corpus_t *corpus = NULL;
+	char *path                   = NULL;
+	size_t path_index            = 0;
+	size_t path_size             = 0;
+	int corpus_index             = 0;
+	int depth                    = 0;
+	int path_number              = 0;
+
+	for( corpus_index = 0;
+	     corpus_index < CPATH_BENCH_NUMBER_OF_ADVERSARIAL_CORPORA;
+	     corpus_index++ )
+	{
+		corpus = &( cpath_bench_adversarial_corpora[ corpus_index ] );
+		depth  = cpath_bench_adversarial_depths[ corpus_index ];
+
+		/* The longest path consists of depth times /y/.. and the surrounding segments
+		 */
+		path_size = ( 5 * (size_t) depth ) + 16;
+
+		for( path_number = 0;
+		     path_number < CPATH_BENCH_NUMBER_OF_ADVERSARIAL_PATHS;
+		     path_number++ )
+		{
+			path = (char *) memory_allocate(
+			                 sizeof( char ) * path_size );
+
+			if( path == NULL )
+			{
+				return( -1 );
+			}
+			cpath_bench_adversarial_paths[ corpus_index ][ path_number ] = path;
+
+			corpus->paths[ path_number ] = path;
+		}
+		corpus->paths[ CPATH_BENCH_NUMBER_OF_ADVERSARIAL_PATHS ] = NULL;
+
+		path       = cpath_bench_adversarial_paths[ corpus_index ][ 0 ];
+		path_index = 0;
+
+		cpath_bench_repeat_string(
+		 path,
+		 &path_index,
+		 "d/",
+		 depth );
+
+		cpath_bench_repeat_string(
+		 path,
+		 &path_index,
+		 "../",
+		 depth );
+
+		cpath_bench_repeat_string(
+		 path,
+		 &path_index,
+		 "file.txt",
+		 1 );
+
+		path       = cpath_bench_adversarial_paths[ corpus_index ][ 1 ];
+		path_index = 0;
+
+		cpath_bench_repeat_string(
+		 path,
+		 &path_index,
+		 "/x",
+		 1 );
+
+		cpath_bench_repeat_string(
+		 path,
+		 &path_index,
+		 "/y/..",
+		 depth );
+
+		cpath_bench_repeat_string(
+		 path,
+		 &path_index,
+		 "/file.txt",
+		 1 );
+
+		path       = cpath_bench_adversarial_paths[ corpus_index ][ 2 ];
+		path_index = 0;
+
+		cpath_bench_repeat_string(
+		 path,
+		 &path_index,
+		 "../",
+		 depth );
+
+		cpath_bench_repeat_string(
+		 path,
+		 &path_index,
+		 "file.txt",
+		 1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Copies an UTF-8 encoded string to a newly allocated wide string
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_copy_wide_string_from_utf8(
+     const char *utf8_string,
+     size_t utf8_string_length,
+     wchar_t **wide_string,
+     size_t *wide_string_length )
+{
+	uint32_t unicode_character = 0;
+	size_t utf8_string_index   = 0;
+	size_t wide_string_index   = 0;
+	uint8_t byte_value         = 0;
+	int number_of_bytes        = 0;
+
+	/* A wide string never contains more characters than the UTF-8 string contains bytes
+	 */
+	*wide_string = (wchar_t *) memory_allocate(
+	                            sizeof( wchar_t ) * ( utf8_string_length + 1 ) );
+
+	if( *wide_string == NULL )
+	{
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		byte_value = (uint8_t) utf8_string[ utf8_string_index++ ];
+
+		if( byte_value >= 0xf0 )
+		{
+			unicode_character = byte_value & 0x07;
+			number_of_bytes   = 3;
+		}
+		else if( byte_value >= 0xe0 )
+		{
+			unicode_character = byte_value & 0x0f;
+			number_of_bytes   = 2;
+		}
+		else if( byte_value >= 0xc0 )
+		{
+			unicode_character = byte_value & 0x1f;
+			number_of_bytes   = 1;
+		}
+		else
+		{
+			unicode_character = byte_value;
+			number_of_bytes   = 0;
+		}
+		while( ( number_of_bytes > 0 )
+		    && ( utf8_string_index < utf8_string_length ) )
+		{
+			unicode_character <<= 6;
+			unicode_character  |= (uint8_t) utf8_string[ utf8_string_index++ ] & 0x3f;
+
+			number_of_bytes--;
+		}
+		if( ( sizeof( wchar_t ) == 2 )
+		 && ( unicode_character > 0xffff ) )
+		{
+			unicode_character -= 0x10000;
+
+			( *wide_string )[ wide_string_index++ ] = (wchar_t) ( 0xd800 + ( unicode_character >> 10 ) );
+			( *wide_string )[ wide_string_index++ ] = (wchar_t) ( 0xdc00 + ( unicode_character & 0x03ff ) );
+		}
+		else
+		{
+			( *wide_string )[ wide_string_index++ ] = (wchar_t) unicode_character;
+		}
+	}
+	( *wide_string )[ wide_string_index ] = 0;
+
+	*wide_string_length = wide_string_index;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Initializes a corpus
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_initialize_corpus(
+     cpath_bench_corpus_t *corpus )
+{
+	int path_index = 0;
+
+	corpus->number_of_bytes = 0;
+
+	for( path_index = 0;
+	     corpus->paths[ path_index ] != NULL;
+	     path_index++ )
+	{
+		corpus->path_lengths[ path_index ] = narrow_string_length(
+		                                      corpus->paths[ path_index ] );
+
+		corpus->number_of_bytes += corpus->path_lengths[ path_index ];
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		if( cpath_bench_copy_wide_string_from_utf8(
+		     corpus->paths[ path_index ],
+		     corpus->path_lengths[ path_index ],
+		     &( corpus->wide_paths[ path_index ] ),
+		     &( corpus->wide_path_lengths[ path_index ] ) ) != 1 )
+		{
+			return( -1 );
+		}
+		corpus->wide_paths[ path_index + 1 ] = NULL;
+#endif
+		corpus->number_of_paths = path_index + 1;
+	}
+	return( 1 );
+}
+
+/* Frees the wide paths of a corpus
+ */
+void cpath_bench_free_corpus(
+      cpath_bench_corpus_t *corpus )
+{
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	int path_index = 0;
+
+	for( path_index = 0;
+	     path_index < corpus->number_of_paths;
+	     path_index++ )
+	{
+		if( corpus->wide_paths[ path_index ] != NULL )
+		{
+			memory_free(
+			 corpus->wide_paths[ path_index ] );
+
+			corpus->wide_paths[ path_index ] = NULL;
+		}
+	}
+#else
+	CPATH_TEST_UNREFERENCED_PARAMETER( corpus )
+#endif
+}
+
+/* Initializes the corpora
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_initialize_corpora(
+     void )
+{
+	int corpus_index = 0;
+
+	cpath_bench_generate_corpora();
+
+	if( cpath_bench_generate_adversarial_corpora() != 1 )
+	{
+		return( -1 );
+	}
+	for( corpus_index = 0;
+	     corpus_index < CPATH_BENCH_NUMBER_OF_CORPORA;
+	     corpus_index++ )
+	{
+		if( cpath_bench_initialize_corpus(
+		     &( cpath_bench_corpora[ corpus_index ] ) ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	for( corpus_index = 0;
+	     corpus_index < CPATH_BENCH_NUMBER_OF_ADVERSARIAL_CORPORA;
+	     corpus_index++ )
+	{
+		if( cpath_bench_initialize_corpus(
+		     &( cpath_bench_adversarial_corpora[ corpus_index ] ) ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( cpath_bench_initialize_corpus(
+	         &cpath_bench_corpus_none ) );
+}
+
+/* Frees the corpora
+ */
+void cpath_bench_free_corpora(
+      void )
+{
+	int corpus_index = 0;
+	int path_number  = 0;
+
+	for( corpus_index = 0;
+	     corpus_index < CPATH_BENCH_NUMBER_OF_CORPORA;
+	     corpus_index++ )
+	{
+		cpath_bench_free_corpus(
+		 &( cpath_bench_corpora[ corpus_index ] ) );
+	}
+	for( corpus_index = 0;
+	     corpus_index < CPATH_BENCH_NUMBER_OF_ADVERSARIAL_CORPORA;
+	     corpus_index++ )
+	{
+		cpath_bench_free_corpus(
+		 &( cpath_bench_adversarial_corpora[ corpus_index ] ) );
+
+		for( path_number = 0;
+		     path_number < CPATH_BENCH_NUMBER_OF_ADVERSARIAL_PATHS;
+		     path_number++ )
+		{
+			if( cpath_bench_adversarial_paths[ corpus_index ][ path_number ] != NULL )
+			{
+				memory_free(
+				 cpath_bench_adversarial_paths[ corpus_index ][ path_number ] );
+
+				cpath_bench_adversarial_paths[ corpus_index ][ path_number ] = NULL;
+			}
+		}
+	}
+	cpath_bench_free_corpus(
+	 &cpath_bench_corpus_none );
+}
+
+/* Determines the full path using a libcsplit based segment walk
+ * This mirrors the split based implementation that preceded the single pass
+ * normalizer and serves as a baseline
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_split_full_path(
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	libcsplit_narrow_split_string_t *split_string[ 2 ] = { NULL, NULL };
+	char *current_directory                            = NULL;
+	char *segment                                      = NULL;
+	size_t current_directory_size                      = 0;
+	size_t full_path_index                             = 0;
+	size_t safe_full_path_size                         = 2;
+	size_t segment_size                                = 0;
+	int number_of_parent_directories                   = 0;
+	int number_of_segments[ 2 ]                        = { 0, 0 };
+	int segment_index                                  = 0;
+	int split_index                                    = 0;
+
+	if( path[ 0 ] != '/' )
+	{
+		if( libcpath_path_get_current_working_directory(
+		     &current_directory,
+		     &current_directory_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libcsplit_narrow_string_split(
+		     current_directory,
+		     narrow_string_length(
+		      current_directory ) + 1,
+		     '/',
+		     &( split_string[ 1 ] ),
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libcsplit_narrow_string_split(
+	     path,
+	     path_length + 1,
+	     '/',
+	     &( split_string[ 0 ] ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Remove ., .. and empty segments walking backwards over the path and then the current directory
+	 * The full path size starts with the root separator and end-of-string character
+	 */
+	for( split_index = 0;
+	     split_index < 2;
+	     split_index++ )
+	{
+		if( split_string[ split_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcsplit_narrow_split_string_get_number_of_segments(
+		     split_string[ split_index ],
+		     &( number_of_segments[ split_index ] ),
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		for( segment_index = number_of_segments[ split_index ] - 1;
+		     segment_index >= 0;
+		     segment_index-- )
+		{
+			if( libcsplit_narrow_split_string_get_segment_by_index(
+			     split_string[ split_index ],
+			     segment_index,
+			     &segment,
+			     &segment_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( ( segment_size <= 1 )
+			 || ( ( segment_size == 2 )
+			  &&  ( segment[ 0 ] == '.' ) ) )
+			{
+				segment = NULL;
+			}
+			else if( ( segment_size == 3 )
+			      && ( segment[ 0 ] == '.' )
+			      && ( segment[ 1 ] == '.' ) )
+			{
+				number_of_parent_directories++;
+
+				segment = NULL;
+			}
+			else if( number_of_parent_directories > 0 )
+			{
+				number_of_parent_directories--;
+
+				segment = NULL;
+			}
+			else
+			{
+				safe_full_path_size += segment_size;
+			}
+			if( segment == NULL )
+			{
+				if( libcsplit_narrow_split_string_set_segment_by_index(
+				     split_string[ split_index ],
+				     segment_index,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+			}
+		}
+	}
+	*full_path = narrow_string_allocate(
+	              safe_full_path_size );
+
+	if( *full_path == NULL )
+	{
+		goto on_error;
+	}
+	( *full_path )[ full_path_index++ ] = '/';
+
+	for( split_index = 1;
+	     split_index >= 0;
+	     split_index-- )
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments[ split_index ];
+		     segment_index++ )
+		{
+			if( libcsplit_narrow_split_string_get_segment_by_index(
+			     split_string[ split_index ],
+			     segment_index,
+			     &segment,
+			     &segment_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( segment == NULL )
+			{
+				continue;
+			}
+			if( narrow_string_copy(
+			     &( ( *full_path )[ full_path_index ] ),
+			     segment,
+			     segment_size - 1 ) == NULL )
+			{
+				goto on_error;
+			}
+			full_path_index += segment_size - 1;
+
+			( *full_path )[ full_path_index++ ] = '/';
+		}
+	}
+	if( full_path_index > 1 )
+	{
+		full_path_index--;
+	}
+	( *full_path )[ full_path_index ] = 0;
+
+	*full_path_size = full_path_index + 1;
+
+	for( split_index = 0;
+	     split_index < 2;
+	     split_index++ )
+	{
+		if( split_string[ split_index ] != NULL )
+		{
+			libcsplit_narrow_split_string_free(
+			 &( split_string[ split_index ] ),
+			 NULL );
+		}
+	}
+	if( current_directory != NULL )
+	{
+		memory_free(
+		 current_directory );
+	}
+	return( 1 );
+
+on_error:
+	if( *full_path != NULL )
+	{
+		memory_free(
+		 *full_path );
+
+		*full_path = NULL;
+	}
+	for( split_index = 0;
+	     split_index < 2;
+	     split_index++ )
+	{
+		if( split_string[ split_index ] != NULL )
+		{
+			libcsplit_narrow_split_string_free(
+			 &( split_string[ split_index ] ),
+			 NULL );
+		}
+	}
+	if( current_directory != NULL )
+	{
+		memory_free(
+		 current_directory );
+	}
+	return( -1 );
+}
+
+#if !defined( WINAPI )
+
+/* Determines the full path using a lexical normalization that removes the last
+ * segment for every .. segment, as commonly done by path cleaning functions
+ * and serves as a baseline
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_lexical_full_path(
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	char *current_directory         = NULL;
+	char *safe_full_path            = NULL;
+	size_t current_directory_length = 0;
+	size_t current_directory_size   = 0;
+	size_t read_index               = 0;
+	size_t segment_end_index        = 0;
+	size_t segment_length           = 0;
+	size_t source_length            = 0;
+	size_t write_index              = 0;
+
+	if( path[ 0 ] != '/' )
+	{
+		if( libcpath_path_get_current_working_directory(
+		     &current_directory,
+		     &current_directory_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		/* The current working directory size is the size of the buffer
+		 * and not necessarily of the string
+		 */
+		current_directory_length = narrow_string_length(
+		                            current_directory );
+	}
+	source_length = current_directory_length + 1 + path_length;
+
+	safe_full_path = (char *) cpath_bench_allocate(
+	                           sizeof( char ) * ( source_length + 1 ),
+	                           NULL );
+
+	if( safe_full_path == NULL )
+	{
+		memory_free(
+		 current_directory );
+
+		return( -1 );
+	}
+	/* The source path is composed in the buffer and normalized in place
+	 * since the normalized path is never longer than the source path
+	 */
+	if( current_directory != NULL )
+	{
+		memory_copy(
+		 safe_full_path,
+		 current_directory,
+		 current_directory_length );
+
+		memory_free(
+		 current_directory );
+	}
+	safe_full_path[ current_directory_length ] = '/';
+
+	memory_copy(
+	 &( safe_full_path[ current_directory_length + 1 ] ),
+	 path,
+	 path_length );
+
+	write_index = 1;
+	read_index  = 1;
+
+	while( read_index < source_length )
+	{
+		if( safe_full_path[ read_index ] == '/' )
+		{
+			read_index++;
+
+			continue;
+		}
+		segment_end_index = read_index;
+
+		while( ( segment_end_index < source_length )
+		    && ( safe_full_path[ segment_end_index ] != '/' ) )
+		{
+			segment_end_index++;
+		}
+		segment_length = segment_end_index - read_index;
+
+		if( ( segment_length == 2 )
+		 && ( safe_full_path[ read_index ] == '.' )
+		 && ( safe_full_path[ read_index + 1 ] == '.' ) )
+		{
+			while( ( write_index > 1 )
+			    && ( safe_full_path[ write_index - 1 ] != '/' ) )
+			{
+				write_index--;
+			}
+			if( write_index > 1 )
+			{
+				write_index--;
+			}
+		}
+		else if( ( segment_length != 1 )
+		      || ( safe_full_path[ read_index ] != '.' ) )
+		{
+			if( write_index > 1 )
+			{
+				safe_full_path[ write_index++ ] = '/';
+			}
+			while( read_index < segment_end_index )
+			{
+				safe_full_path[ write_index++ ] = safe_full_path[ read_index++ ];
+			}
+		}
+		read_index = segment_end_index;
+	}
+	safe_full_path[ write_index ] = 0;
+
+	*full_path      = safe_full_path;
+	*full_path_size = write_index + 1;
+
+	return( 1 );
+}
+
+/* Determines the full path using realpath, which resolves symbolic links
+ * and requires the path to exist, and serves as a baseline
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_realpath(
+     const char *path,
+     size_t path_length CPATH_TEST_ATTRIBUTE_UNUSED,
+     char *full_path,
+     size_t full_path_size CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t *required_full_path_size,
+     libcerror_error_t **error CPATH_TEST_ATTRIBUTE_UNUSED )
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( path_length )
+	CPATH_TEST_UNREFERENCED_PARAMETER( full_path_size )
+	CPATH_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( realpath(
+	     path,
+	     full_path ) == NULL )
+	{
+		*required_full_path_size = 0;
+	}
+	else
+	{
+		*required_full_path_size = narrow_string_length(
+		                            full_path ) + 1;
+	}
+	return( 1 );
+}
+
+#endif /* !defined( WINAPI ) */
+
+/* Combines the path with a filename
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_join(
+     const char *path,
+     size_t path_length,
+     char **result_path,
+     size_t *result_path_size,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_join(
+	         result_path,
+	         result_path_size,
+	         path,
+	         path_length,
+	         "file.txt",
+	         8,
+	         error ) );
+}
+
+/* Combines the path with a filename into a buffer
+ * Returns 1 if successful, 0 if the buffer is too small or -1 on error
+ */
+int cpath_bench_join_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *result_path,
+     size_t result_path_size,
+     size_t *required_result_path_size,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_join_to_buffer(
+	         result_path,
+	         result_path_size,
+	         required_result_path_size,
+	         path,
+	         path_length,
+	         "file.txt",
+	         8,
+	         error ) );
+}
+
+/* Combines the path with a filename allocated from an arena
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_join_arena(
+     libcpath_arena_t *arena,
+     const char *path,
+     size_t path_length,
+     char **result_path,
+     size_t *result_path_size,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_join_arena(
+	         arena,
+	         result_path,
+	         result_path_size,
+	         path,
+	         path_length,
+	         "file.txt",
+	         8,
+	         error ) );
+}
+
+/* Retrieves the current working directory, the path is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_get_current_working_directory(
+     const char *path CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t path_length CPATH_TEST_ATTRIBUTE_UNUSED,
+     char **result_path,
+     size_t *result_path_size,
+     libcerror_error_t **error )
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( path )
+	CPATH_TEST_UNREFERENCED_PARAMETER( path_length )
+
+	return( libcpath_path_get_current_working_directory(
+	         result_path,
+	         result_path_size,
+	         error ) );
+}
+
+/* Iterates the segments of the path front to back, the buffer is not used
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_path_view_get_next_segment(
+     const char *path,
+     size_t path_length,
+     char *buffer CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t buffer_size CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t *number_of_segments,
+     libcerror_error_t **error )
+{
+	libcpath_path_view_t path_view;
+
+	const char *segment   = NULL;
+	size_t segment_length = 0;
+	int result            = 0;
+
+	CPATH_TEST_UNREFERENCED_PARAMETER( buffer )
+	CPATH_TEST_UNREFERENCED_PARAMETER( buffer_size )
+
+	if( libcpath_path_view_initialize(
+	     &path_view,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	*number_of_segments = 0;
+
+	do
+	{
+		result = libcpath_path_view_get_next_segment(
+		          &path_view,
+		          &segment,
+		          &segment_length,
+		          error );
+
+		if( result == 1 )
+		{
+			*number_of_segments += 1;
+		}
+	}
+	while( result == 1 );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Iterates the segments of the path back to front, the buffer is not used
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_path_view_get_previous_segment(
+     const char *path,
+     size_t path_length,
+     char *buffer CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t buffer_size CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t *number_of_segments,
+     libcerror_error_t **error )
+{
+	libcpath_path_view_t path_view;
+
+	const char *segment   = NULL;
+	size_t segment_length = 0;
+	int result            = 0;
+
+	CPATH_TEST_UNREFERENCED_PARAMETER( buffer )
+	CPATH_TEST_UNREFERENCED_PARAMETER( buffer_size )
+
+	if( libcpath_path_view_initialize(
+	     &path_view,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	*number_of_segments = 0;
+
+	do
+	{
+		result = libcpath_path_view_get_previous_segment(
+		          &path_view,
+		          &segment,
+		          &segment_length,
+		          error );
+
+		if( result == 1 )
+		{
+			*number_of_segments += 1;
+		}
+	}
+	while( result == 1 );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the directory name, base name and extension of the path, the buffer is not used
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_path_view_get_components(
+     const char *path,
+     size_t path_length,
+     char *buffer CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t buffer_size CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t *components_length,
+     libcerror_error_t **error )
+{
+	libcpath_path_view_t path_view;
+
+	const char *component   = NULL;
+	size_t component_length = 0;
+	int result              = 0;
+
+	CPATH_TEST_UNREFERENCED_PARAMETER( buffer )
+	CPATH_TEST_UNREFERENCED_PARAMETER( buffer_size )
+
+	if( libcpath_path_view_initialize(
+	     &path_view,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libcpath_path_view_get_dirname(
+	     &path_view,
+	     &component,
+	     &component_length,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	*components_length = component_length;
+
+	if( libcpath_path_view_get_basename(
+	     &path_view,
+	     &component,
+	     &component_length,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	*components_length += component_length;
+
+	result = libcpath_path_view_get_extension(
+	          &path_view,
+	          &component,
+	          &component_length,
+	          error );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*components_length += component_length;
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Combines the path with a filename
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_join_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **result_path,
+     size_t *result_path_size,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_join_wide(
+	         result_path,
+	         result_path_size,
+	         path,
+	         path_length,
+	         L"file.txt",
+	         8,
+	         error ) );
+}
+
+/* Combines the path with a filename into a buffer
+ * Returns 1 if successful, 0 if the buffer is too small or -1 on error
+ */
+int cpath_bench_join_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *result_path,
+     size_t result_path_size,
+     size_t *required_result_path_size,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_join_to_buffer_wide(
+	         result_path,
+	         result_path_size,
+	         required_result_path_size,
+	         path,
+	         path_length,
+	         L"file.txt",
+	         8,
+	         error ) );
+}
+
+/* Combines the path with a filename allocated from an arena
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_join_arena_wide(
+     libcpath_arena_t *arena,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **result_path,
+     size_t *result_path_size,
+     libcerror_error_t **error )
+{
+	return( libcpath_path_join_arena_wide(
+	         arena,
+	         result_path,
+	         result_path_size,
+	         path,
+	         path_length,
+	         L"file.txt",
+	         8,
+	         error ) );
+}
+
+/* Retrieves the current working directory, the path is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_get_current_working_directory_wide(
+     const wchar_t *path CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t path_length CPATH_TEST_ATTRIBUTE_UNUSED,
+     wchar_t **result_path,
+     size_t *result_path_size,
+     libcerror_error_t **error )
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( path )
+	CPATH_TEST_UNREFERENCED_PARAMETER( path_length )
+
+	return( libcpath_path_get_current_working_directory_wide(
+	         result_path,
+	         result_path_size,
+	         error ) );
+}
+
+/* Iterates the segments of the path front to back, the buffer is not used
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_path_view_get_next_segment_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *buffer CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t buffer_size CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t *number_of_segments,
+     libcerror_error_t **error )
+{
+	libcpath_path_view_wide_t path_view;
+
+	const wchar_t *segment = NULL;
+	size_t segment_length  = 0;
+	int result             = 0;
+
+	CPATH_TEST_UNREFERENCED_PARAMETER( buffer )
+	CPATH_TEST_UNREFERENCED_PARAMETER( buffer_size )
+
+	if( libcpath_path_view_initialize_wide(
+	     &path_view,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	*number_of_segments = 0;
+
+	do
+	{
+		result = libcpath_path_view_get_next_segment_wide(
+		          &path_view,
+		          &segment,
+		          &segment_length,
+		          error );
+
+		if( result == 1 )
+		{
+			*number_of_segments += 1;
+		}
+	}
+	while( result == 1 );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Iterates the segments of the path back to front, the buffer is not used
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_path_view_get_previous_segment_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *buffer CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t buffer_size CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t *number_of_segments,
+     libcerror_error_t **error )
+{
+	libcpath_path_view_wide_t path_view;
+
+	const wchar_t *segment = NULL;
+	size_t segment_length  = 0;
+	int result             = 0;
+
+	CPATH_TEST_UNREFERENCED_PARAMETER( buffer )
+	CPATH_TEST_UNREFERENCED_PARAMETER( buffer_size )
+
+	if( libcpath_path_view_initialize_wide(
+	     &path_view,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	*number_of_segments = 0;
+
+	do
+	{
+		result = libcpath_path_view_get_previous_segment_wide(
+		          &path_view,
+		          &segment,
+		          &segment_length,
+		          error );
+
+		if( result == 1 )
+		{
+			*number_of_segments += 1;
+		}
+	}
+	while( result == 1 );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the directory name, base name and extension of the path, the buffer is not used
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_path_view_get_components_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *buffer CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t buffer_size CPATH_TEST_ATTRIBUTE_UNUSED,
+     size_t *components_length,
+     libcerror_error_t **error )
+{
+	libcpath_path_view_wide_t path_view;
+
+	const wchar_t *component = NULL;
+	size_t component_length  = 0;
+	int result               = 0;
+
+	CPATH_TEST_UNREFERENCED_PARAMETER( buffer )
+	CPATH_TEST_UNREFERENCED_PARAMETER( buffer_size )
+
+	if( libcpath_path_view_initialize_wide(
+	     &path_view,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libcpath_path_view_get_dirname_wide(
+	     &path_view,
+	     &component,
+	     &component_length,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	*components_length = component_length;
+
+	if( libcpath_path_view_get_basename_wide(
+	     &path_view,
+	     &component,
+	     &component_length,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	*components_length += component_length;
+
+	result = libcpath_path_view_get_extension_wide(
+	          &path_view,
+	          &component,
+	          &component_length,
+	          error );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*components_length += component_length;
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* The buffer used by the to buffer functions
+ */
+char cpath_bench_buffer[ CPATH_BENCH_BUFFER_SIZE ];
+
+/* Prints the result of a benchmark
+ * Prints a tab separated line with the name, corpus, number of operations, nano seconds per operation,
+ * number of allocations per operation and number of input bytes processed per second
+ * Only allocations made by the library are counted, not those of the baselines dependencies
+ */
+void cpath_bench_print_result(
+      const char *name,
+      const char *corpus_name,
+      uint64_t number_of_operations,
+      uint64_t number_of_allocations,
+      uint64_t number_of_bytes,
+      uint64_t elapsed_time )
+{
+	if( elapsed_time == 0 )
+	{
+		elapsed_time = 1;
+	}
+	fprintf(
+	 stdout,
+	 "%s\t%s\t%" PRIu64 "\t%.1f\t%.2f\t%.0f\n",
+	 name,
+	 corpus_name,
+	 number_of_operations,
+	 (double) elapsed_time / (double) number_of_operations,
+	 (double) number_of_allocations / (double) number_of_operations,
+	 ( (double) number_of_bytes * 1000000000.0 ) / (double) elapsed_time );
+}
+
+/* Prints the error of a benchmark
+ */
+void cpath_bench_print_error(
+      const char *name,
+      const char *corpus_name,
+      libcerror_error_t **error )
+{
+	fprintf(
+	 stderr,
+	 "Unable to run benchmark: %s over corpus: %s.\n",
+	 name,
+	 corpus_name );
+
+	libcerror_error_backtrace_fprint(
+	 *error,
+	 stderr );
+
+	libcerror_error_free(
+	 error );
+}
+
+/* Benchmarks a path function, that allocates its result, over a corpus
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_bench_path_function(
+     const char *name,
+     cpath_bench_corpus_t *corpus,
+     int (*path_function)(
+            const char *path,
+            size_t path_length,
+            char **result_path,
+            size_t *result_path_size,
+            libcerror_error_t **error ),
+     int number_of_iterations )
+{
+	libcerror_error_t *error       = NULL;
+	char *result_path              = NULL;
+	uint64_t end_timestamp         = 0;
+	uint64_t number_of_allocations = 0;
+	uint64_t start_timestamp       = 0;
+	size_t result_path_size        = 0;
+	int iteration                  = 0;
+	int path_index                 = 0;
+
+	number_of_allocations = cpath_bench_number_of_allocations;
+	start_timestamp       = cpath_bench_get_timestamp();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		for( path_index = 0;
+		     path_index < corpus->number_of_paths;
+		     path_index++ )
+		{
+			if( path_function(
+			     corpus->paths[ path_index ],
+			     corpus->path_lengths[ path_index ],
+			     &result_path,
+			     &result_path_size,
+			     &error ) != 1 )
+			{
+				cpath_bench_print_error(
+				 name,
+				 corpus->name,
+				 &error );
+
+				return( 0 );
+			}
+			memory_free(
+			 result_path );
+
+			result_path = NULL;
+		}
+	}
+	end_timestamp = cpath_bench_get_timestamp();
+
+	cpath_bench_print_result(
+	 name,
+	 corpus->name,
+	 (uint64_t) number_of_iterations * corpus->number_of_paths,
+	 cpath_bench_number_of_allocations - number_of_allocations,
+	 (uint64_t) number_of_iterations * corpus->number_of_bytes,
+	 end_timestamp - start_timestamp );
+
+	return( 1 );
+}
+
+/* Benchmarks a path function, that writes its result into a buffer, over a corpus
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_bench_path_to_buffer_function(
+     const char *name,
+     cpath_bench_corpus_t *corpus,
+     int (*path_function)(
+            const char *path,
+            size_t path_length,
+            char *result_path,
+            size_t result_path_size,
+            size_t *required_result_path_size,
+            libcerror_error_t **error ),
+     int number_of_iterations )
+{
+	libcerror_error_t *error       = NULL;
+	uint64_t end_timestamp         = 0;
+	uint64_t number_of_allocations = 0;
+	uint64_t start_timestamp       = 0;
+	size_t result_path_size        = 0;
+	int iteration                  = 0;
+	int path_index                 = 0;
+
+	number_of_allocations = cpath_bench_number_of_allocations;
+	start_timestamp       = cpath_bench_get_timestamp();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		for( path_index = 0;
+		     path_index < corpus->number_of_paths;
+		     path_index++ )
+		{
+			if( path_function(
+			     corpus->paths[ path_index ],
+			     corpus->path_lengths[ path_index ],
+			     cpath_bench_buffer,
+			     CPATH_BENCH_BUFFER_SIZE,
+			     &result_path_size,
+			     &error ) != 1 )
+			{
+				cpath_bench_print_error(
+				 name,
+				 corpus->name,
+				 &error );
+
+				return( 0 );
+			}
+		}
+	}
+	end_timestamp = cpath_bench_get_timestamp();
+
+	cpath_bench_print_result(
+	 name,
+	 corpus->name,
+	 (uint64_t) number_of_iterations * corpus->number_of_paths,
+	 cpath_bench_number_of_allocations - number_of_allocations,
+	 (uint64_t) number_of_iterations * corpus->number_of_bytes,
+	 end_timestamp - start_timestamp );
+
+	return( 1 );
+}
+
+/* Benchmarks a path function, that allocates its result from an arena, over a corpus
+ * The arena is reset after every pass over the corpus
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_bench_path_arena_function(
+     const char *name,
+     cpath_bench_corpus_t *corpus,
+     int (*path_function)(
+            libcpath_arena_t *arena,
+            const char *path,
+            size_t path_length,
+            char **result_path,
+            size_t *result_path_size,
+            libcerror_error_t **error ),
+     int number_of_iterations )
+{
+	libcerror_error_t *error       = NULL;
+	libcpath_arena_t *arena        = NULL;
+	char *result_path              = NULL;
+	uint64_t end_timestamp         = 0;
+	uint64_t number_of_allocations = 0;
+	uint64_t start_timestamp       = 0;
+	size_t result_path_size        = 0;
+	int iteration                  = 0;
+	int path_index                 = 0;
+
+	number_of_allocations = cpath_bench_number_of_allocations;
+	start_timestamp       = cpath_bench_get_timestamp();
+
+	if( libcpath_arena_initialize(
+	     &arena,
+	     CPATH_BENCH_BUFFER_SIZE,
+	     LIBCPATH_ARENA_FLAG_ALLOW_GROWTH,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		for( path_index = 0;
+		     path_index < corpus->number_of_paths;
+		     path_index++ )
+		{
+			if( path_function(
+			     arena,
+			     corpus->paths[ path_index ],
+			     corpus->path_lengths[ path_index ],
+			     &result_path,
+			     &result_path_size,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		if( libcpath_arena_reset(
+		     arena,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libcpath_arena_free(
+	     &arena,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	end_timestamp = cpath_bench_get_timestamp();
+
+	cpath_bench_print_result(
+	 name,
+	 corpus->name,
+	 (uint64_t) number_of_iterations * corpus->number_of_paths,
+	 cpath_bench_number_of_allocations - number_of_allocations,
+	 (uint64_t) number_of_iterations * corpus->number_of_bytes,
+	 end_timestamp - start_timestamp );
+
+	return( 1 );
+
+on_error:
+	cpath_bench_print_error(
+	 name,
+	 corpus->name,
+	 &error );
+
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Benchmarks the batch full path function over a corpus
+ * Every iteration determines the full paths of the entire corpus in a single call
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_bench_full_paths(
+     cpath_bench_corpus_t *corpus,
+     int number_of_iterations )
+{
+	libcerror_error_t *error       = NULL;
+	char *full_paths               = NULL;
+	size_t *full_path_offsets      = NULL;
+	uint64_t end_timestamp         = 0;
+	uint64_t number_of_allocations = 0;
+	uint64_t start_timestamp       = 0;
+	size_t full_paths_size         = 0;
+	int iteration                  = 0;
+
+	number_of_allocations = cpath_bench_number_of_allocations;
+	start_timestamp       = cpath_bench_get_timestamp();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libcpath_path_get_full_paths(
+		     corpus->paths,
+		     corpus->path_lengths,
+		     corpus->number_of_paths,
+		     &full_paths,
+		     &full_paths_size,
+		     &full_path_offsets,
+		     &error ) != 1 )
+		{
+			cpath_bench_print_error(
+			 "libcpath_path_get_full_paths",
+			 corpus->name,
+			 &error );
+
+			return( 0 );
+		}
+		memory_free(
+		 full_paths );
+
+		full_paths = NULL;
+
+		memory_free(
+		 full_path_offsets );
+
+		full_path_offsets = NULL;
+	}
+	end_timestamp = cpath_bench_get_timestamp();
+
+	cpath_bench_print_result(
+	 "libcpath_path_get_full_paths",
+	 corpus->name,
+	 (uint64_t) number_of_iterations * corpus->number_of_paths,
+	 cpath_bench_number_of_allocations - number_of_allocations,
+	 (uint64_t) number_of_iterations * corpus->number_of_bytes,
+	 end_timestamp - start_timestamp );
+
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* The buffer used by the wide to buffer functions
+ */
+wchar_t cpath_bench_wide_buffer[ CPATH_BENCH_BUFFER_SIZE ];
+
+/* Benchmarks a path function, that allocates its result, over a corpus
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_bench_path_function_wide(
+     const char *name,
+     cpath_bench_corpus_t *corpus,
+     int (*path_function)(
+            const wchar_t *path,
+            size_t path_length,
+            wchar_t **result_path,
+            size_t *result_path_size,
+            libcerror_error_t **error ),
+     int number_of_iterations )
+{
+	libcerror_error_t *error       = NULL;
+	wchar_t *result_path           = NULL;
+	uint64_t end_timestamp         = 0;
+	uint64_t number_of_allocations = 0;
+	uint64_t start_timestamp       = 0;
+	size_t result_path_size        = 0;
+	int iteration                  = 0;
+	int path_index                 = 0;
+
+	number_of_allocations = cpath_bench_number_of_allocations;
+	start_timestamp       = cpath_bench_get_timestamp();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		for( path_index = 0;
+		     path_index < corpus->number_of_paths;
+		     path_index++ )
+		{
+			if( path_function(
+			     corpus->wide_paths[ path_index ],
+			     corpus->wide_path_lengths[ path_index ],
+			     &result_path,
+			     &result_path_size,
+			     &error ) != 1 )
+			{
+				cpath_bench_print_error(
+				 name,
+				 corpus->name,
+				 &error );
+
+				return( 0 );
+			}
+			memory_free(
+			 result_path );
+
+			result_path = NULL;
+		}
+	}
+	end_timestamp = cpath_bench_get_timestamp();
+
+	cpath_bench_print_result(
+	 name,
+	 corpus->name,
+	 (uint64_t) number_of_iterations * corpus->number_of_paths,
+	 cpath_bench_number_of_allocations - number_of_allocations,
+	 (uint64_t) number_of_iterations * corpus->number_of_bytes,
+	 end_timestamp - start_timestamp );
+
+	return( 1 );
+}
+
+/* Benchmarks a path function, that writes its result into a buffer, over a corpus
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_bench_path_to_buffer_function_wide(
+     const char *name,
+     cpath_bench_corpus_t *corpus,
+     int (*path_function)(
+            const wchar_t *path,
+            size_t path_length,
+            wchar_t *result_path,
+            size_t result_path_size,
+            size_t *required_result_path_size,
+            libcerror_error_t **error ),
+     int number_of_iterations )
+{
+	libcerror_error_t *error       = NULL;
+	uint64_t end_timestamp         = 0;
+	uint64_t number_of_allocations = 0;
+	uint64_t start_timestamp       = 0;
+	size_t result_path_size        = 0;
+	int iteration                  = 0;
+	int path_index                 = 0;
+
+	number_of_allocations = cpath_bench_number_of_allocations;
+	start_timestamp       = cpath_bench_get_timestamp();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		for( path_index = 0;
+		     path_index < corpus->number_of_paths;
+		     path_index++ )
+		{
+			if( path_function(
+			     corpus->wide_paths[ path_index ],
+			     corpus->wide_path_lengths[ path_index ],
+			     cpath_bench_wide_buffer,
+			     CPATH_BENCH_BUFFER_SIZE,
+			     &result_path_size,
+			     &error ) != 1 )
+			{
+				cpath_bench_print_error(
+				 name,
+				 corpus->name,
+				 &error );
+
+				return( 0 );
+			}
+		}
+	}
+	end_timestamp = cpath_bench_get_timestamp();
+
+	cpath_bench_print_result(
+	 name,
+	 corpus->name,
+	 (uint64_t) number_of_iterations * corpus->number_of_paths,
+	 cpath_bench_number_of_allocations - number_of_allocations,
+	 (uint64_t) number_of_iterations * corpus->number_of_bytes,
+	 end_timestamp - start_timestamp );
+
+	return( 1 );
+}
+
+/* Benchmarks a path function, that allocates its result from an arena, over a corpus
+ * The arena is reset after every pass over the corpus
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_bench_path_arena_function_wide(
+     const char *name,
+     cpath_bench_corpus_t *corpus,
+     int (*path_function)(
+            libcpath_arena_t *arena,
+            const wchar_t *path,
+            size_t path_length,
+            wchar_t **result_path,
+            size_t *result_path_size,
+            libcerror_error_t **error ),
+     int number_of_iterations )
+{
+	libcerror_error_t *error       = NULL;
+	libcpath_arena_t *arena        = NULL;
+	wchar_t *result_path           = NULL;
+	uint64_t end_timestamp         = 0;
+	uint64_t number_of_allocations = 0;
+	uint64_t start_timestamp       = 0;
+	size_t result_path_size        = 0;
+	int iteration                  = 0;
+	int path_index                 = 0;
+
+	number_of_allocations = cpath_bench_number_of_allocations;
+	start_timestamp       = cpath_bench_get_timestamp();
+
+	if( libcpath_arena_initialize(
+	     &arena,
+	     CPATH_BENCH_BUFFER_SIZE,
+	     LIBCPATH_ARENA_FLAG_ALLOW_GROWTH,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		for( path_index = 0;
+		     path_index < corpus->number_of_paths;
+		     path_index++ )
+		{
+			if( path_function(
+			     arena,
+			     corpus->wide_paths[ path_index ],
+			     corpus->wide_path_lengths[ path_index ],
+			     &result_path,
+			     &result_path_size,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		if( libcpath_arena_reset(
+		     arena,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libcpath_arena_free(
+	     &arena,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	end_timestamp = cpath_bench_get_timestamp();
+
+	cpath_bench_print_result(
+	 name,
+	 corpus->name,
+	 (uint64_t) number_of_iterations * corpus->number_of_paths,
+	 cpath_bench_number_of_allocations - number_of_allocations,
+	 (uint64_t) number_of_iterations * corpus->number_of_bytes,
+	 end_timestamp - start_timestamp );
+
+	return( 1 );
+
+on_error:
+	cpath_bench_print_error(
+	 name,
+	 corpus->name,
+	 &error );
+
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Benchmarks the batch full path function over a corpus
+ * Every iteration determines the full paths of the entire corpus in a single call
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_bench_full_paths_wide(
+     cpath_bench_corpus_t *corpus,
+     int number_of_iterations )
+{
+	libcerror_error_t *error       = NULL;
+	wchar_t *full_paths            = NULL;
+	size_t *full_path_offsets      = NULL;
+	uint64_t end_timestamp         = 0;
+	uint64_t number_of_allocations = 0;
+	uint64_t start_timestamp       = 0;
+	size_t full_paths_size         = 0;
+	int iteration                  = 0;
+
+	number_of_allocations = cpath_bench_number_of_allocations;
+	start_timestamp       = cpath_bench_get_timestamp();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libcpath_path_get_full_paths_wide(
+		     (const wchar_t **) corpus->wide_paths,
+		     corpus->wide_path_lengths,
+		     corpus->number_of_paths,
+		     &full_paths,
+		     &full_paths_size,
+		     &full_path_offsets,
+		     &error ) != 1 )
+		{
+			cpath_bench_print_error(
+			 "libcpath_path_get_full_paths_wide",
+			 corpus->name,
+			 &error );
+
+			return( 0 );
+		}
+		memory_free(
+		 full_paths );
+
+		full_paths = NULL;
+
+		memory_free(
+		 full_path_offsets );
+
+		full_path_offsets = NULL;
+	}
+	end_timestamp = cpath_bench_get_timestamp();
+
+	cpath_bench_print_result(
+	 "libcpath_path_get_full_paths_wide",
+	 corpus->name,
+	 (uint64_t) number_of_iterations * corpus->number_of_paths,
+	 cpath_bench_number_of_allocations - number_of_allocations,
+	 (uint64_t) number_of_iterations * corpus->number_of_bytes,
+	 end_timestamp - start_timestamp );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Benchmarks allocating data from an arena
+ * Every iteration allocates 64 blocks of 24 bytes and resets the arena
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_bench_arena_allocate(
+     int number_of_iterations )
+{
+	libcerror_error_t *error       = NULL;
+	libcpath_arena_t *arena        = NULL;
+	void *data                     = NULL;
+	uint64_t end_timestamp         = 0;
+	uint64_t number_of_allocations = 0;
+	uint64_t start_timestamp       = 0;
+	int allocation_index           = 0;
+	int iteration                  = 0;
+
+	number_of_allocations = cpath_bench_number_of_allocations;
+	start_timestamp       = cpath_bench_get_timestamp();
+
+	if( libcpath_arena_initialize(
+	     &arena,
+	     CPATH_BENCH_BUFFER_SIZE,
+	     LIBCPATH_ARENA_FLAG_ALLOW_GROWTH,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		for( allocation_index = 0;
+		     allocation_index < 64;
+		     allocation_index++ )
+		{
+			if( libcpath_arena_allocate(
+			     arena,
+			     24,
+			     &data,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		if( libcpath_arena_reset(
+		     arena,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libcpath_arena_free(
+	     &arena,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	end_timestamp = cpath_bench_get_timestamp();
+
+	cpath_bench_print_result(
+	 "libcpath_arena_allocate",
+	 "none",
+	 (uint64_t) number_of_iterations * 64,
+	 cpath_bench_number_of_allocations - number_of_allocations,
+	 (uint64_t) number_of_iterations * 64 * 24,
+	 end_timestamp - start_timestamp );
+
+	return( 1 );
+
+on_error:
+	cpath_bench_print_error(
+	 "libcpath_arena_allocate",
+	 "none",
+	 &error );
+
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Benchmarks the expected failure of making an existing directory
+ * reported by an error and by a status
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_bench_make_existing_directory(
+     int number_of_iterations )
+{
+	libcpath_status_t status;
+
+	libcerror_error_t *error = NULL;
+	uint64_t end_timestamp   = 0;
+	uint64_t start_timestamp = 0;
+	int iteration            = 0;
+
+	start_timestamp = cpath_bench_get_timestamp();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libcpath_path_make_directory(
+		     ".",
+		     &error ) != -1 )
+		{
+			goto on_error;
+		}
+		libcerror_error_free(
+		 &error );
+	}
+	end_timestamp = cpath_bench_get_timestamp();
+
+	cpath_bench_print_result(
+	 "libcpath_path_make_directory",
+	 "existing_directory",
+	 (uint64_t) number_of_iterations,
+	 0,
+	 (uint64_t) number_of_iterations,
+	 end_timestamp - start_timestamp );
+
+	start_timestamp = cpath_bench_get_timestamp();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libcpath_path_make_directory_with_status(
+		     ".",
+		     &status ) != -1 )
+		{
+			goto on_error;
+		}
+	}
+	end_timestamp = cpath_bench_get_timestamp();
+
+	cpath_bench_print_result(
+	 "libcpath_path_make_directory_with_status",
+	 "existing_directory",
+	 (uint64_t) number_of_iterations,
+	 0,
+	 (uint64_t) number_of_iterations,
+	 end_timestamp - start_timestamp );
+
+	return( 1 );
+
+on_error:
+	fprintf(
+	 stderr,
+	 "Unable to run benchmark: libcpath_path_make_directory over corpus: existing_directory.\n" );
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if !defined( WINAPI )
+
+/* The directory names used by the directory benchmarks
+ */
+char cpath_bench_directory_names[ CPATH_BENCH_NUMBER_OF_DIRECTORIES ][ 64 ];
+
+/* Removes the directories made by the directory benchmarks
+ */
+void cpath_bench_remove_directories(
+      const char **directory_names,
+      int number_of_directories )
+{
+	int directory_index = 0;
+
+	for( directory_index = 0;
+	     directory_index < number_of_directories;
+	     directory_index++ )
+	{
+		rmdir(
+		 directory_names[ directory_index ] );
+	}
+}
+
+/* Benchmarks making and probing directories one at a time and in batches
+ * Every round makes a number of directories in a temporary directory, probes and removes them,
+ * only making and probing the directories is timed
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_bench_directories(
+     int number_of_iterations )
+{
+	struct stat file_statistics;
+
+	const char *directory_names[ CPATH_BENCH_NUMBER_OF_DIRECTORIES ];
+	char temporary_directory[ 19 ] = "cpath_bench_XXXXXX";
+	int error_codes[ CPATH_BENCH_NUMBER_OF_DIRECTORIES ];
+
+	libcerror_error_t *error       = NULL;
+	const char *name               = "libcpath_path_make_directory";
+	uint64_t batch_allocations     = 0;
+	uint64_t batch_elapsed_time    = 0;
+	uint64_t make_elapsed_time     = 0;
+	uint64_t number_of_allocations = 0;
+	uint64_t number_of_bytes       = 0;
+	uint64_t probe_allocations     = 0;
+	uint64_t probe_elapsed_time    = 0;
+	uint64_t start_timestamp       = 0;
+	uint64_t stat_elapsed_time     = 0;
+	int directory_index            = 0;
+	int number_of_rounds           = 0;
+	int round                      = 0;
+
+	if( mkdtemp(
+	     temporary_directory ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create temporary directory.\n" );
+
+		return( 0 );
+	}
+	for( directory_index = 0;
+	     directory_index < CPATH_BENCH_NUMBER_OF_DIRECTORIES;
+	     directory_index++ )
+	{
+		snprintf(
+		 cpath_bench_directory_names[ directory_index ],
+		 64,
+		 "%s/directory%04d",
+		 temporary_directory,
+		 directory_index );
+
+		directory_names[ directory_index ] = cpath_bench_directory_names[ directory_index ];
+
+		number_of_bytes += narrow_string_length(
+		                    directory_names[ directory_index ] );
+	}
+	number_of_rounds = number_of_iterations / CPATH_BENCH_DIRECTORY_ITERATIONS_PER_ROUND;
+
+	if( number_of_rounds < 1 )
+	{
+		number_of_rounds = 1;
+	}
+	for( round = 0;
+	     round < number_of_rounds;
+	     round++ )
+	{
+		name            = "libcpath_path_make_directory";
+		start_timestamp = cpath_bench_get_timestamp();
+
+		for( directory_index = 0;
+		     directory_index < CPATH_BENCH_NUMBER_OF_DIRECTORIES;
+		     directory_index++ )
+		{
+			if( libcpath_path_make_directory(
+			     directory_names[ directory_index ],
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		make_elapsed_time += cpath_bench_get_timestamp() - start_timestamp;
+
+		name = "stat_baseline";
+
+		start_timestamp = cpath_bench_get_timestamp();
+
+		for( directory_index = 0;
+		     directory_index < CPATH_BENCH_NUMBER_OF_DIRECTORIES;
+		     directory_index++ )
+		{
+			if( ( stat(
+			       directory_names[ directory_index ],
+			       &file_statistics ) != 0 )
+			 || ( S_ISDIR( file_statistics.st_mode ) == 0 ) )
+			{
+				goto on_error;
+			}
+		}
+		stat_elapsed_time += cpath_bench_get_timestamp() - start_timestamp;
+
+		name                  = "libcpath_path_probe_directories";
+		number_of_allocations = cpath_bench_number_of_allocations;
+		start_timestamp       = cpath_bench_get_timestamp();
+
+		if( libcpath_path_probe_directories(
+		     directory_names,
+		     CPATH_BENCH_NUMBER_OF_DIRECTORIES,
+		     error_codes,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		probe_elapsed_time += cpath_bench_get_timestamp() - start_timestamp;
+		probe_allocations  += cpath_bench_number_of_allocations - number_of_allocations;
+
+		for( directory_index = 0;
+		     directory_index < CPATH_BENCH_NUMBER_OF_DIRECTORIES;
+		     directory_index++ )
+		{
+			if( error_codes[ directory_index ] != 0 )
+			{
+				goto on_error;
+			}
+		}
+		cpath_bench_remove_directories(
+		 directory_names,
+		 CPATH_BENCH_NUMBER_OF_DIRECTORIES );
+
+		name                  = "libcpath_path_make_directories";
+		number_of_allocations = cpath_bench_number_of_allocations;
+		start_timestamp       = cpath_bench_get_timestamp();
+
+		if( libcpath_path_make_directories(
+		     directory_names,
+		     CPATH_BENCH_NUMBER_OF_DIRECTORIES,
+		     error_codes,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		batch_elapsed_time += cpath_bench_get_timestamp() - start_timestamp;
+		batch_allocations  += cpath_bench_number_of_allocations - number_of_allocations;
+
+		for( directory_index = 0;
+		     directory_index < CPATH_BENCH_NUMBER_OF_DIRECTORIES;
+		     directory_index++ )
+		{
+			if( error_codes[ directory_index ] != 0 )
+			{
+				goto on_error;
+			}
+		}
+		cpath_bench_remove_directories(
+		 directory_names,
+		 CPATH_BENCH_NUMBER_OF_DIRECTORIES );
+	}
+	rmdir(
+	 temporary_directory );
+
+	cpath_bench_print_result(
+	 "libcpath_path_make_directory",
+	 "directories",
+	 (uint64_t) number_of_rounds * CPATH_BENCH_NUMBER_OF_DIRECTORIES,
+	 0,
+	 (uint64_t) number_of_rounds * number_of_bytes,
+	 make_elapsed_time );
+
+	cpath_bench_print_result(
+	 "libcpath_path_make_directories",
+	 "directories",
+	 (uint64_t) number_of_rounds * CPATH_BENCH_NUMBER_OF_DIRECTORIES,
+	 batch_allocations,
+	 (uint64_t) number_of_rounds * number_of_bytes,
+	 batch_elapsed_time );
+
+	cpath_bench_print_result(
+	 "stat_baseline",
+	 "directories",
+	 (uint64_t) number_of_rounds * CPATH_BENCH_NUMBER_OF_DIRECTORIES,
+	 0,
+	 (uint64_t) number_of_rounds * number_of_bytes,
+	 stat_elapsed_time );
+
+	cpath_bench_print_result(
+	 "libcpath_path_probe_directories",
+	 "directories",
+	 (uint64_t) number_of_rounds * CPATH_BENCH_NUMBER_OF_DIRECTORIES,
+	 probe_allocations,
+	 (uint64_t) number_of_rounds * number_of_bytes,
+	 probe_elapsed_time );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		cpath_bench_print_error(
+		 name,
+		 "directories",
+		 &error );
+	}
+	else
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run benchmark: %s over corpus: directories.\n",
+		 name );
+	}
+	cpath_bench_remove_directories(
+	 directory_names,
+	 CPATH_BENCH_NUMBER_OF_DIRECTORIES );
+
+	rmdir(
+	 temporary_directory );
+
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) */
+
+typedef struct cpath_bench_path_function_definition cpath_bench_path_function_definition_t;
+
+struct cpath_bench_path_function_definition
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The function
+	 */
+	int (*function)(
+	       const char *path,
+	       size_t path_length,
+	       char **result_path,
+	       size_t *result_path_size,
+	       libcerror_error_t **error );
+};
+
+typedef struct cpath_bench_path_to_buffer_function_definition cpath_bench_path_to_buffer_function_definition_t;
+
+struct cpath_bench_path_to_buffer_function_definition
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The function
+	 */
+	int (*function)(
+	       const char *path,
+	       size_t path_length,
+	       char *result_path,
+	       size_t result_path_size,
+	       size_t *required_result_path_size,
+	       libcerror_error_t **error );
+};
+
+typedef struct cpath_bench_path_arena_function_definition cpath_bench_path_arena_function_definition_t;
+
+struct cpath_bench_path_arena_function_definition
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The function
+	 */
+	int (*function)(
+	       libcpath_arena_t *arena,
+	       const char *path,
+	       size_t path_length,
+	       char **result_path,
+	       size_t *result_path_size,
+	       libcerror_error_t **error );
+};
+
+/* The path functions that allocate their result
+ */
+cpath_bench_path_function_definition_t cpath_bench_path_functions[] = {
+	{ "libcpath_path_get_full_path", &libcpath_path_get_full_path },
+	{ "libcpath_path_get_sanitized_filename", &libcpath_path_get_sanitized_filename },
+	{ "libcpath_path_get_sanitized_path", &libcpath_path_get_sanitized_path },
+	{ "libcpath_path_join", &cpath_bench_join },
+#if !defined( WINAPI )
+	{ "split_full_path_baseline", &cpath_bench_split_full_path },
+	{ "lexical_full_path_baseline", &cpath_bench_lexical_full_path },
+#endif
+	{ NULL, NULL } };
+
+/* The path functions that resolve parent directory segments
+ * which are benchmarked over the adversarial corpora
+ */
+cpath_bench_path_function_definition_t cpath_bench_adversarial_path_functions[] = {
+	{ "libcpath_path_get_full_path", &libcpath_path_get_full_path },
+#if !defined( WINAPI )
+	{ "split_full_path_baseline", &cpath_bench_split_full_path },
+	{ "lexical_full_path_baseline", &cpath_bench_lexical_full_path },
+#endif
+	{ NULL, NULL } };
+
+/* The path functions that write their result into a buffer
+ */
+cpath_bench_path_to_buffer_function_definition_t cpath_bench_path_to_buffer_functions[] = {
+	{ "libcpath_path_get_full_path_to_buffer", &libcpath_path_get_full_path_to_buffer },
+	{ "libcpath_path_get_sanitized_filename_to_buffer", &libcpath_path_get_sanitized_filename_to_buffer },
+	{ "libcpath_path_get_sanitized_path_to_buffer", &libcpath_path_get_sanitized_path_to_buffer },
+	{ "libcpath_path_join_to_buffer", &cpath_bench_join_to_buffer },
+	{ "libcpath_path_view_get_next_segment", &cpath_bench_path_view_get_next_segment },
+	{ "libcpath_path_view_get_previous_segment", &cpath_bench_path_view_get_previous_segment },
+	{ "libcpath_path_view_get_dirname_basename_extension", &cpath_bench_path_view_get_components },
+	{ NULL, NULL } };
+
+/* The path functions that allocate their result from an arena
+ */
+cpath_bench_path_arena_function_definition_t cpath_bench_path_arena_functions[] = {
+	{ "libcpath_path_get_full_path_arena", &libcpath_path_get_full_path_arena },
+	{ "libcpath_path_get_sanitized_filename_arena", &libcpath_path_get_sanitized_filename_arena },
+	{ "libcpath_path_get_sanitized_path_arena", &libcpath_path_get_sanitized_path_arena },
+	{ "libcpath_path_join_arena", &cpath_bench_join_arena },
+	{ NULL, NULL } };
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+typedef struct cpath_bench_path_function_definition_wide cpath_bench_path_function_definition_wide_t;
+
+struct cpath_bench_path_function_definition_wide
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The function
+	 */
+	int (*function)(
+	       const wchar_t *path,
+	       size_t path_length,
+	       wchar_t **result_path,
+	       size_t *result_path_size,
+	       libcerror_error_t **error );
+};
+
+typedef struct cpath_bench_path_to_buffer_function_definition_wide cpath_bench_path_to_buffer_function_definition_wide_t;
+
+struct cpath_bench_path_to_buffer_function_definition_wide
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The function
+	 */
+	int (*function)(
+	       const wchar_t *path,
+	       size_t path_length,
+	       wchar_t *result_path,
+	       size_t result_path_size,
+	       size_t *required_result_path_size,
+	       libcerror_error_t **error );
+};
+
+typedef struct cpath_bench_path_arena_function_definition_wide cpath_bench_path_arena_function_definition_wide_t;
+
+struct cpath_bench_path_arena_function_definition_wide
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The function
+	 */
+	int (*function)(
+	       libcpath_arena_t *arena,
+	       const wchar_t *path,
+	       size_t path_length,
+	       wchar_t **result_path,
+	       size_t *result_path_size,
+	       libcerror_error_t **error );
+};
+
+/* The wide path functions that allocate their result
+ */
+cpath_bench_path_function_definition_wide_t cpath_bench_path_functions_wide[] = {
+	{ "libcpath_path_get_full_path_wide", &libcpath_path_get_full_path_wide },
+	{ "libcpath_path_get_sanitized_filename_wide", &libcpath_path_get_sanitized_filename_wide },
+	{ "libcpath_path_get_sanitized_path_wide", &libcpath_path_get_sanitized_path_wide },
+	{ "libcpath_path_join_wide", &cpath_bench_join_wide },
+	{ NULL, NULL } };
+
+/* The wide path functions that write their result into a buffer
+ */
+cpath_bench_path_to_buffer_function_definition_wide_t cpath_bench_path_to_buffer_functions_wide[] = {
+	{ "libcpath_path_get_full_path_to_buffer_wide", &libcpath_path_get_full_path_to_buffer_wide },
+	{ "libcpath_path_get_sanitized_filename_to_buffer_wide", &libcpath_path_get_sanitized_filename_to_buffer_wide },
+	{ "libcpath_path_get_sanitized_path_to_buffer_wide", &libcpath_path_get_sanitized_path_to_buffer_wide },
+	{ "libcpath_path_join_to_buffer_wide", &cpath_bench_join_to_buffer_wide },
+	{ "libcpath_path_view_get_next_segment_wide", &cpath_bench_path_view_get_next_segment_wide },
+	{ "libcpath_path_view_get_previous_segment_wide", &cpath_bench_path_view_get_previous_segment_wide },
+	{ "libcpath_path_view_get_dirname_basename_extension_wide", &cpath_bench_path_view_get_components_wide },
+	{ NULL, NULL } };
+
+/* The wide path functions that allocate their result from an arena
+ */
+cpath_bench_path_arena_function_definition_wide_t cpath_bench_path_arena_functions_wide[] = {
+	{ "libcpath_path_get_full_path_arena_wide", &libcpath_path_get_full_path_arena_wide },
+	{ "libcpath_path_get_sanitized_filename_arena_wide", &libcpath_path_get_sanitized_filename_arena_wide },
+	{ "libcpath_path_get_sanitized_path_arena_wide", &libcpath_path_get_sanitized_path_arena_wide },
+	{ "libcpath_path_join_arena_wide", &cpath_bench_join_arena_wide },
+	{ NULL, NULL } };
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* The main program
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+	libcerror_error_t *error             = NULL;
+	cpath_bench_corpus_t *corpus         = NULL;
+	int adversarial_number_of_iterations = 0;
+	int corpus_index                     = 0;
+	int function_index                   = 0;
+	int number_of_iterations             = CPATH_BENCH_DEFAULT_NUMBER_OF_ITERATIONS;
+	int result                           = EXIT_SUCCESS;
+
+	if( argc > 1 )
+	{
+		number_of_iterations = atoi(
+		                        argv[ 1 ] );
+
+		if( number_of_iterations <= 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Usage: cpath_bench [ number_of_iterations ]\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	/* The allocations of the library are counted by the benchmark allocator
+	 */
+	if( libcpath_set_allocator(
+	     &cpath_bench_allocate,
+	     &cpath_bench_reallocate,
+	     &cpath_bench_free,
+	     NULL,
+	     &error ) != 1 )
+	{
+		cpath_bench_print_error(
+		 "libcpath_set_allocator",
+		 "none",
+		 &error );
+
+		return( EXIT_FAILURE );
+	}
+	if( cpath_bench_initialize_corpora() != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize corpora.\n" );
+
+		cpath_bench_free_corpora();
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "benchmark\tcorpus\toperations\tns_per_op\tallocations_per_op\tbytes_per_second\n" );
+
+	for( corpus_index = 0;
+	     corpus_index < CPATH_BENCH_NUMBER_OF_CORPORA;
+	     corpus_index++ )
+	{
+		corpus = &( cpath_bench_corpora[ corpus_index ] );
+
+		for( function_index = 0;
+		     cpath_bench_path_functions[ function_index ].name != NULL;
+		     function_index++ )
+		{
+			if( cpath_bench_path_function(
+			     cpath_bench_path_functions[ function_index ].name,
+			     corpus,
+			     cpath_bench_path_functions[ function_index ].function,
+			     number_of_iterations ) != 1 )
+			{
+				result = EXIT_FAILURE;
+			}
+		}
+		for( function_index = 0;
+		     cpath_bench_path_to_buffer_functions[ function_index ].name != NULL;
+		     function_index++ )
+		{
+			if( cpath_bench_path_to_buffer_function(
+			     cpath_bench_path_to_buffer_functions[ function_index ].name,
+			     corpus,
+			     cpath_bench_path_to_buffer_functions[ function_index ].function,
+			     number_of_iterations ) != 1 )
+			{
+				result = EXIT_FAILURE;
+			}
+		}
+		for( function_index = 0;
+		     cpath_bench_path_arena_functions[ function_index ].name != NULL;
+		     function_index++ )
+		{
+			if( cpath_bench_path_arena_function(
+			     cpath_bench_path_arena_functions[ function_index ].name,
+			     corpus,
+			     cpath_bench_path_arena_functions[ function_index ].function,
+			     number_of_iterations ) != 1 )
+			{
+				result = EXIT_FAILURE;
+			}
+		}
+		if( cpath_bench_full_paths(
+		     corpus,
+		     number_of_iterations ) != 1 )
+		{
+			result = EXIT_FAILURE;
+		}
+#if !defined( WINAPI )
+		/* realpath fails on the first segment that does not exist
+		 * hence it is only compared on the corpus of existing paths
+		 */
+		if( corpus_index == CPATH_BENCH_CORPUS_EXISTING )
+		{
+			if( cpath_bench_path_to_buffer_function(
+			     "realpath_baseline",
+			     corpus,
+			     &cpath_bench_realpath,
+			     number_of_iterations ) != 1 )
+			{
+				result = EXIT_FAILURE;
+			}
+		}
+#endif
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		for( function_index = 0;
+		     cpath_bench_path_functions_wide[ function_index ].name != NULL;
+		     function_index++ )
+		{
+			if( cpath_bench_path_function_wide(
+			     cpath_bench_path_functions_wide[ function_index ].name,
+			     corpus,
+			     cpath_bench_path_functions_wide[ function_index ].function,
+			     number_of_iterations ) != 1 )
+			{
+				result = EXIT_FAILURE;
+			}
+		}
+		for( function_index = 0;
+		     cpath_bench_path_to_buffer_functions_wide[ function_index ].name != NULL;
+		     function_index++ )
+		{
+			if( cpath_bench_path_to_buffer_function_wide(
+			     cpath_bench_path_to_buffer_functions_wide[ function_index ].name,
+			     corpus,
+			     cpath_bench_path_to_buffer_functions_wide[ function_index ].function,
+			     number_of_iterations ) != 1 )
+			{
+				result = EXIT_FAILURE;
+			}
+		}
+		for( function_index = 0;
+		     cpath_bench_path_arena_functions_wide[ function_index ].name != NULL;
+		     function_index++ )
+		{
+			if( cpath_bench_path_arena_function_wide(
+			     cpath_bench_path_arena_functions_wide[ function_index ].name,
+			     corpus,
+			     cpath_bench_path_arena_functions_wide[ function_index ].function,
+			     number_of_iterations ) != 1 )
+			{
+				result = EXIT_FAILURE;
+			}
+		}
+		if( cpath_bench_full_paths_wide(
+		     corpus,
+		     number_of_iterations ) != 1 )
+		{
+			result = EXIT_FAILURE;
+		}
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+	}
+	/* The adversarial corpora are only used by the functions that resolve
+	 * parent directory segments. The number of iterations is scaled down
+	 * with the depth, hence the corpora process a similar number of bytes
+	 * and a linear cost shows as a similar number of bytes per second
+	 */
+	for( corpus_index = 0;
+	     corpus_index < CPATH_BENCH_NUMBER_OF_ADVERSARIAL_CORPORA;
+	     corpus_index++ )
+	{
+		corpus = &( cpath_bench_adversarial_corpora[ corpus_index ] );
+
+		adversarial_number_of_iterations = number_of_iterations
+		                                 / ( cpath_bench_adversarial_depths[ corpus_index ] / cpath_bench_adversarial_depths[ 0 ] );
+
+		if( adversarial_number_of_iterations < 1 )
+		{
+			adversarial_number_of_iterations = 1;
+		}
+		for( function_index = 0;
+		     cpath_bench_adversarial_path_functions[ function_index ].name != NULL;
+		     function_index++ )
+		{
+			if( cpath_bench_path_function(
+			     cpath_bench_adversarial_path_functions[ function_index ].name,
+			     corpus,
+			     cpath_bench_adversarial_path_functions[ function_index ].function,
+			     adversarial_number_of_iterations ) != 1 )
+			{
+				result = EXIT_FAILURE;
+			}
+		}
+		if( cpath_bench_path_to_buffer_function(
+		     "libcpath_path_get_full_path_to_buffer",
+		     corpus,
+		     &libcpath_path_get_full_path_to_buffer,
+		     adversarial_number_of_iterations ) != 1 )
+		{
+			result = EXIT_FAILURE;
+		}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		if( cpath_bench_path_function_wide(
+		     "libcpath_path_get_full_path_wide",
+		     corpus,
+		     &libcpath_path_get_full_path_wide,
+		     adversarial_number_of_iterations ) != 1 )
+		{
+			result = EXIT_FAILURE;
+		}
+		if( cpath_bench_path_to_buffer_function_wide(
+		     "libcpath_path_get_full_path_to_buffer_wide",
+		     corpus,
+		     &libcpath_path_get_full_path_to_buffer_wide,
+		     adversarial_number_of_iterations ) != 1 )
+		{
+			result = EXIT_FAILURE;
+		}
+#endif
+	}
+	/* The benchmarks of functions that do not depend on the corpus
+	 * use the corpus that only contains an empty path
+	 */
+	if( cpath_bench_path_function(
+	     "libcpath_path_get_current_working_directory",
+	     &cpath_bench_corpus_none,
+	     &cpath_bench_get_current_working_directory,
+	     number_of_iterations ) != 1 )
+	{
+		result = EXIT_FAILURE;
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( cpath_bench_path_function_wide(
+	     "libcpath_path_get_current_working_directory_wide",
+	     &cpath_bench_corpus_none,
+	     &cpath_bench_get_current_working_directory_wide,
+	     number_of_iterations ) != 1 )
+	{
+		result = EXIT_FAILURE;
+	}
+#endif
+	if( cpath_bench_arena_allocate(
+	     number_of_iterations ) != 1 )
+	{
+		result = EXIT_FAILURE;
+	}
+	if( cpath_bench_make_existing_directory(
+	     number_of_iterations ) != 1 )
+	{
+		result = EXIT_FAILURE;
+	}
+#if !defined( WINAPI )
+	if( cpath_bench_directories(
+	     number_of_iterations ) != 1 )
+	{
+		result = EXIT_FAILURE;
+	}
+#endif
+	cpath_bench_free_corpora();
+
+	libcpath_set_allocator(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( result );
+}
+
@@ -0,0 +1,813 @@
+/*
+ * Library allocator functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_macros.h"
+#include "cpath_test_unused.h"
+
+#include "../libcpath/libcpath_allocator.h"
+
+typedef struct cpath_test_allocator cpath_test_allocator_t;
+
+struct cpath_test_allocator
+{
+	/* The number of allocations
+	 */
+	int number_of_allocations;
+
+	/* The number of frees
+	 */
+	int number_of_frees;
+};
+
+/* Allocates data and tracks the allocation
+ */
+void *cpath_test_allocator_allocate(
+       size_t size,
+       void *user_data )
+{
+	cpath_test_allocator_t *allocator = (cpath_test_allocator_t *) user_data;
+
+	allocator->number_of_allocations += 1;
+
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Reallocates data and tracks the allocation
+ */
+void *cpath_test_allocator_reallocate(
+       void *data,
+       size_t size,
+       void *user_data )
+{
+	cpath_test_allocator_t *allocator = (cpath_test_allocator_t *) user_data;
+
+	if( data == NULL )
+	{
+		allocator->number_of_allocations += 1;
+	}
+	return( memory_reallocate(
+	         data,
+	         size ) );
+}
+
+/* Frees data and tracks the free
+ */
+void cpath_test_allocator_free(
+      void *data,
+      void *user_data )
+{
+	cpath_test_allocator_t *allocator = (cpath_test_allocator_t *) user_data;
+
+	if( data != NULL )
+	{
+		allocator->number_of_frees += 1;
+	}
+	memory_free(
+	 data );
+}
+
+/* Tests the libcpath_set_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_set_allocator(
+     void )
+{
+	cpath_test_allocator_t allocator;
+
+	libcerror_error_t *error = NULL;
+	char *path               = NULL;
+	size_t path_size         = 0;
+	int result               = 0;
+
+	allocator.number_of_allocations = 0;
+	allocator.number_of_frees       = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_set_allocator(
+	          &cpath_test_allocator_allocate,
+	          &cpath_test_allocator_reallocate,
+	          &cpath_test_allocator_free,
+	          &allocator,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          "first",
+	          5,
+	          "second",
+	          6,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "path",
+	 path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "allocator.number_of_allocations",
+	 allocator.number_of_allocations,
+	 1 );
+
+	cpath_test_allocator_free(
+	 path,
+	 &allocator );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "allocator.number_of_frees",
+	 allocator.number_of_frees,
+	 1 );
+
+	/* Test that the system allocator is used after reset
+	 */
+	result = libcpath_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          "first",
+	          5,
+	          "second",
+	          6,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "allocator.number_of_allocations",
+	 allocator.number_of_allocations,
+	 1 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_set_allocator(
+	          NULL,
+	          &cpath_test_allocator_reallocate,
+	          &cpath_test_allocator_free,
+	          &allocator,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_set_allocator(
+	          &cpath_test_allocator_allocate,
+	          NULL,
+	          &cpath_test_allocator_free,
+	          &allocator,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_set_allocator(
+	          &cpath_test_allocator_allocate,
+	          &cpath_test_allocator_reallocate,
+	          NULL,
+	          &allocator,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	libcpath_set_allocator(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+#if defined( HAVE_LIBCPATH_THREAD_ALLOCATOR )
+
+/* Tests the libcpath_set_thread_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_set_thread_allocator(
+     void )
+{
+	cpath_test_allocator_t allocator;
+	cpath_test_allocator_t thread_allocator;
+
+	libcerror_error_t *error = NULL;
+	char *path               = NULL;
+	size_t path_size         = 0;
+	int result               = 0;
+
+	allocator.number_of_allocations        = 0;
+	allocator.number_of_frees              = 0;
+	thread_allocator.number_of_allocations = 0;
+	thread_allocator.number_of_frees       = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_set_allocator(
+	          &cpath_test_allocator_allocate,
+	          &cpath_test_allocator_reallocate,
+	          &cpath_test_allocator_free,
+	          &allocator,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_set_thread_allocator(
+	          &cpath_test_allocator_allocate,
+	          &cpath_test_allocator_reallocate,
+	          &cpath_test_allocator_free,
+	          &thread_allocator,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          "first",
+	          5,
+	          "second",
+	          6,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "thread_allocator.number_of_allocations",
+	 thread_allocator.number_of_allocations,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "allocator.number_of_allocations",
+	 allocator.number_of_allocations,
+	 0 );
+
+	cpath_test_allocator_free(
+	 path,
+	 &thread_allocator );
+
+	path = NULL;
+
+	/* Test that the allocator of the library is used after reset
+	 */
+	result = libcpath_set_thread_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          "first",
+	          5,
+	          "second",
+	          6,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "thread_allocator.number_of_allocations",
+	 thread_allocator.number_of_allocations,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "allocator.number_of_allocations",
+	 allocator.number_of_allocations,
+	 1 );
+
+	cpath_test_allocator_free(
+	 path,
+	 &allocator );
+
+	path = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_set_thread_allocator(
+	          &cpath_test_allocator_allocate,
+	          NULL,
+	          NULL,
+	          &thread_allocator,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	libcpath_set_thread_allocator(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	libcpath_set_allocator(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests that objects use the allocator they were created with
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_set_thread_allocator_objects(
+     void )
+{
+	cpath_test_allocator_t thread_allocator;
+
+	libcerror_error_t *error                    = NULL;
+	libcpath_arena_t *arena                     = NULL;
+	libcpath_context_t *context                 = NULL;
+	libcpath_directory_cache_t *directory_cache = NULL;
+	libcpath_path_builder_t *path_builder       = NULL;
+	void *data                                  = NULL;
+	int component_index                         = 0;
+	int result                                  = 0;
+
+	thread_allocator.number_of_allocations = 0;
+	thread_allocator.number_of_frees       = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_set_thread_allocator(
+	          &cpath_test_allocator_allocate,
+	          &cpath_test_allocator_reallocate,
+	          &cpath_test_allocator_free,
+	          &thread_allocator,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_arena_initialize(
+	          &arena,
+	          16,
+	          LIBCPATH_ARENA_FLAG_ALLOW_GROWTH,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_context_initialize(
+	          &context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_initialize(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_initialize(
+	          &path_builder,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the objects keep using the allocator of the thread after reset
+	 */
+	result = libcpath_set_thread_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_arena_allocate(
+	          arena,
+	          64,
+	          &data,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if !defined( WINAPI )
+	result = libcpath_context_set_working_directory(
+	          context,
+	          "/",
+	          1,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+#endif
+	for( component_index = 0;
+	     component_index < 64;
+	     component_index++ )
+	{
+		result = libcpath_path_builder_push_component(
+		          path_builder,
+		          "component",
+		          9,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libcpath_path_builder_free(
+	          &path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_free(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_context_free(
+	          &context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "thread_allocator.number_of_frees",
+	 thread_allocator.number_of_frees,
+	 thread_allocator.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libcpath_set_thread_allocator(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	if( path_builder != NULL )
+	{
+		libcpath_path_builder_free(
+		 &path_builder,
+		 NULL );
+	}
+	if( directory_cache != NULL )
+	{
+		libcpath_directory_cache_free(
+		 &directory_cache,
+		 NULL );
+	}
+	if( context != NULL )
+	{
+		libcpath_context_free(
+		 &context,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBCPATH_THREAD_ALLOCATOR ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( argc )
+	CPATH_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CPATH_TEST_RUN(
+	 "libcpath_set_allocator",
+	 cpath_test_set_allocator );
+
+#if defined( HAVE_LIBCPATH_THREAD_ALLOCATOR )
+
+	CPATH_TEST_RUN(
+	 "libcpath_set_thread_allocator",
+	 cpath_test_set_thread_allocator );
+
+	CPATH_TEST_RUN(
+	 "libcpath_set_thread_allocator_objects",
+	 cpath_test_set_thread_allocator_objects );
+
+#endif /* defined( HAVE_LIBCPATH_THREAD_ALLOCATOR ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
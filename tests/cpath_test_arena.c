@@ -0,0 +1,615 @@
+/*
+ * Library arena functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_macros.h"
+#include "cpath_test_unused.h"
+
+/* Tests the libcpath_arena_initialize and libcpath_arena_free functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libcpath_arena_t *arena  = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_arena_initialize(
+	          &arena,
+	          128,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_arena_initialize(
+	          NULL,
+	          128,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libcpath_arena_t *) 0x12345678UL;
+
+	result = libcpath_arena_initialize(
+	          &arena,
+	          128,
+	          0,
+	          &error );
+
+	arena = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_arena_initialize(
+	          &arena,
+	          0,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_arena_initialize(
+	          &arena,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_arena_free(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_arena_allocate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libcpath_arena_t *arena  = NULL;
+	void *data1              = NULL;
+	void *data2              = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_arena_initialize(
+	          &arena,
+	          64,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_arena_allocate(
+	          arena,
+	          3,
+	          &data1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "data1",
+	 data1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_arena_allocate(
+	          arena,
+	          8,
+	          &data2,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "data2",
+	 data2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Allocations are aligned and do not overlap
+	 */
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "data2 alignment",
+	 (size_t) ( (intptr_t) data2 % 8 ),
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_GREATER_THAN_INT(
+	 "data2 - data1",
+	 (int) ( (uint8_t *) data2 - (uint8_t *) data1 ),
+	 2 );
+
+	/* Test allocation that does not fit when growth is not allowed
+	 */
+	data1 = NULL;
+
+	result = libcpath_arena_allocate(
+	          arena,
+	          128,
+	          &data1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "data1",
+	 data1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libcpath_arena_allocate(
+	          NULL,
+	          8,
+	          &data1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_arena_allocate(
+	          arena,
+	          0,
+	          &data1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_arena_allocate(
+	          arena,
+	          (size_t) SSIZE_MAX + 1,
+	          &data1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_arena_allocate(
+	          arena,
+	          8,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_arena_allocate function with growth
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_arena_allocate_with_growth(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libcpath_arena_t *arena  = NULL;
+	void *data               = NULL;
+	int allocation_index     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_arena_initialize(
+	          &arena,
+	          64,
+	          LIBCPATH_ARENA_FLAG_ALLOW_GROWTH,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( allocation_index = 0;
+	     allocation_index < 32;
+	     allocation_index++ )
+	{
+		data = NULL;
+
+		result = libcpath_arena_allocate(
+		          arena,
+		          24,
+		          &data,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "data",
+		 data );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		memory_set(
+		 data,
+		 0xff,
+		 24 );
+	}
+	/* Test allocation larger than the chunk size
+	 */
+	result = libcpath_arena_allocate(
+	          arena,
+	          1024,
+	          &data,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 data,
+	 0xff,
+	 1024 );
+
+	/* Test allocation after reset reuses the chunks
+	 */
+	result = libcpath_arena_reset(
+	          arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( allocation_index = 0;
+	     allocation_index < 32;
+	     allocation_index++ )
+	{
+		result = libcpath_arena_allocate(
+		          arena,
+		          24,
+		          &data,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcpath_arena_reset(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( argc )
+	CPATH_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CPATH_TEST_RUN(
+	 "libcpath_arena_initialize",
+	 cpath_test_arena_initialize );
+
+	CPATH_TEST_RUN(
+	 "libcpath_arena_allocate",
+	 cpath_test_arena_allocate );
+
+	CPATH_TEST_RUN(
+	 "libcpath_arena_allocate_with_growth",
+	 cpath_test_arena_allocate_with_growth );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
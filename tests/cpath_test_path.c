@@ -36,12 +36,21 @@
 
 #include <errno.h>
 
+#if !defined( WINAPI )
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
 #define __USE_GNU
 #include <dlfcn.h>
 #undef __USE_GNU
 #endif
 
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && defined( HAVE_MKDIRAT )
+#include <fcntl.h>
+#endif
+
 #include "cpath_test_libcerror.h"
 #include "cpath_test_libcpath.h"
 #include "cpath_test_macros.h"
@@ -49,8 +58,14 @@
 #include "cpath_test_unused.h"
 
 #include "../libcpath/libcpath_definitions.h"
+#include "../libcpath/libcpath_io_uring.h"
 #include "../libcpath/libcpath_path.h"
 
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && defined( HAVE_LIBCPATH_IO_URING )
+#include <stdarg.h>
+#include <sys/syscall.h>
+#endif
+
 #if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
 
 static int (*cpath_test_real_chdir)(const char *)      = NULL;
@@ -59,6 +74,38 @@ static char *(*cpath_test_real_getcwd)(char *, size_t) = NULL;
 int cpath_test_chdir_attempts_before_fail              = -1;
 int cpath_test_getcwd_attempts_before_fail             = -1;
 
+/* The directory to change into after the next successful getcwd, to test
+ * a change of the current working directory by another thread
+ */
+const char *cpath_test_getcwd_change_directory         = NULL;
+
+#if defined( HAVE_MKDIRAT )
+
+static int (*cpath_test_real_mkdirat)(int, const char *, mode_t) = NULL;
+
+/* The name of a file to create right before the next mkdirat of that name,
+ * to test a file that is created by another process in the meantime
+ */
+const char *cpath_test_mkdirat_create_file             = NULL;
+
+#endif /* defined( HAVE_MKDIRAT ) */
+
+#if defined( HAVE_LIBCPATH_IO_URING )
+
+static long (*cpath_test_real_syscall)(long, ...)      = NULL;
+
+/* Value to indicate the next io_uring_enter system call only submits
+ * the operations, after which the following one fails, to test waiting
+ * for operations that are in flight on error
+ */
+int cpath_test_io_uring_enter_fail_after_submit        = 0;
+
+/* The number of io_uring_setup system calls, to test reuse of the io_uring
+ */
+int cpath_test_io_uring_setup_count                    = 0;
+
+#endif /* defined( HAVE_LIBCPATH_IO_URING ) */
+
 #endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
 
 #if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
@@ -112,6 +159,8 @@ char *getcwd(
 	{
 		cpath_test_getcwd_attempts_before_fail = -1;
 
+		errno = EACCES;
+
 		return( NULL );
 	}
 	else if( cpath_test_getcwd_attempts_before_fail > 0 )
@@ -122,11 +171,248 @@ char *getcwd(
 	          buf,
 	          size );
 
+	if( ( result != NULL )
+	 && ( cpath_test_getcwd_change_directory != NULL ) )
+	{
+		if( cpath_test_real_chdir == NULL )
+		{
+			cpath_test_real_chdir = dlsym(
+			                         RTLD_NEXT,
+			                         "chdir" );
+		}
+		cpath_test_real_chdir(
+		 cpath_test_getcwd_change_directory );
+
+		cpath_test_getcwd_change_directory = NULL;
+	}
+
 	return( result );
 }
 
+#if defined( HAVE_MKDIRAT )
+
+/* Custom mkdirat for testing error cases
+ * Returns 0 if successful or -1 on error
+ */
+int mkdirat(
+     int directory_descriptor,
+     const char *path,
+     mode_t mode )
+{
+	int file_descriptor = -1;
+
+	if( cpath_test_real_mkdirat == NULL )
+	{
+		cpath_test_real_mkdirat = dlsym(
+		                           RTLD_NEXT,
+		                           "mkdirat" );
+	}
+	if( ( cpath_test_mkdirat_create_file != NULL )
+	 && ( narrow_string_compare(
+	       path,
+	       cpath_test_mkdirat_create_file,
+	       narrow_string_length( cpath_test_mkdirat_create_file ) + 1 ) == 0 ) )
+	{
+		cpath_test_mkdirat_create_file = NULL;
+
+		file_descriptor = openat(
+		                   directory_descriptor,
+		                   path,
+		                   O_CREAT | O_WRONLY,
+		                   0644 );
+
+		if( file_descriptor != -1 )
+		{
+			close(
+			 file_descriptor );
+		}
+	}
+	return( cpath_test_real_mkdirat(
+	         directory_descriptor,
+	         path,
+	         mode ) );
+}
+
+#endif /* defined( HAVE_MKDIRAT ) */
+
+#if defined( HAVE_LIBCPATH_IO_URING )
+
+/* Custom syscall for testing error cases
+ * Returns the result of the system call or -1 on error
+ */
+long syscall(
+      long number,
+      ... )
+{
+	va_list argument_list;
+
+	long arguments[ 6 ];
+
+	int argument_index = 0;
+
+	if( cpath_test_real_syscall == NULL )
+	{
+		cpath_test_real_syscall = dlsym(
+		                           RTLD_NEXT,
+		                           "syscall" );
+	}
+	va_start(
+	 argument_list,
+	 number );
+
+	for( argument_index = 0;
+	     argument_index < 6;
+	     argument_index++ )
+	{
+		arguments[ argument_index ] = va_arg(
+		                               argument_list,
+		                               long );
+	}
+	va_end(
+	 argument_list );
+
+	if( number == __NR_io_uring_setup )
+	{
+		cpath_test_io_uring_setup_count++;
+	}
+	else if( number == __NR_io_uring_enter )
+	{
+		if( cpath_test_io_uring_enter_fail_after_submit == 1 )
+		{
+			cpath_test_io_uring_enter_fail_after_submit = 2;
+
+			/* Submit without waiting for completions
+			 */
+			arguments[ 2 ] = 0;
+			arguments[ 3 ] = 0;
+		}
+		else if( cpath_test_io_uring_enter_fail_after_submit == 2 )
+		{
+			cpath_test_io_uring_enter_fail_after_submit = 0;
+
+			errno = EFAULT;
+
+			return( -1 );
+		}
+	}
+	return( cpath_test_real_syscall(
+	         number,
+	         arguments[ 0 ],
+	         arguments[ 1 ],
+	         arguments[ 2 ],
+	         arguments[ 3 ],
+	         arguments[ 4 ],
+	         arguments[ 5 ] ) );
+}
+
+#endif /* defined( HAVE_LIBCPATH_IO_URING ) */
+
 #endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
 
+#if !defined( WINAPI )
+
+/* The number of directories of the deep directory, the segments of which
+ * result in a current working directory that exceeds PATH_MAX
+ */
+#define CPATH_TEST_PATH_DEEP_DIRECTORY_DEPTH	50
+
+/* The segment of the deep directory
+ */
+const char *cpath_test_path_deep_directory_segment = \
+	"directory_0123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890";
+
+/* Makes a deep directory in a temporary directory and changes into it
+ * The temporary directory name must contain a mkdtemp template
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_test_path_enter_deep_directory(
+     char *temporary_directory_name )
+{
+	int depth = 0;
+
+	if( mkdtemp(
+	     temporary_directory_name ) == NULL )
+	{
+		return( -1 );
+	}
+	if( chdir(
+	     temporary_directory_name ) != 0 )
+	{
+		return( -1 );
+	}
+	for( depth = 0;
+	     depth < CPATH_TEST_PATH_DEEP_DIRECTORY_DEPTH;
+	     depth++ )
+	{
+		if( mkdir(
+		     cpath_test_path_deep_directory_segment,
+		     0755 ) != 0 )
+		{
+			return( -1 );
+		}
+		if( chdir(
+		     cpath_test_path_deep_directory_segment ) != 0 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Removes a deep directory and its temporary directory and changes into the working directory
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_test_path_leave_deep_directory(
+     const char *temporary_directory_name,
+     const char *working_directory )
+{
+	int depth = 0;
+
+	if( chdir(
+	     working_directory ) != 0 )
+	{
+		return( -1 );
+	}
+	if( chdir(
+	     temporary_directory_name ) == 0 )
+	{
+		while( depth < ( CPATH_TEST_PATH_DEEP_DIRECTORY_DEPTH - 1 ) )
+		{
+			if( chdir(
+			     cpath_test_path_deep_directory_segment ) != 0 )
+			{
+				break;
+			}
+			depth++;
+		}
+		while( depth >= 0 )
+		{
+			rmdir(
+			 cpath_test_path_deep_directory_segment );
+
+			if( chdir(
+			     ".." ) != 0 )
+			{
+				break;
+			}
+			depth--;
+		}
+	}
+	if( chdir(
+	     working_directory ) != 0 )
+	{
+		return( -1 );
+	}
+	if( rmdir(
+	     temporary_directory_name ) != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( WINAPI ) */
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 /* Tests the libcpath_CloseHandle function
@@ -296,65 +582,60 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+#if !defined( WINAPI )
 
-/* Tests the libcpath_GetCurrentDirectoryA function
+/* Tests the libcpath_path_change_directory_context function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_GetCurrentDirectoryA(
+int cpath_test_path_change_directory_context(
      void )
 {
-	char buffer[ 256 ];
-
-	DWORD result = 0;
+	libcerror_error_t *error        = NULL;
+	libcpath_context_t *context     = NULL;
+	const char *working_directory   = NULL;
+	size_t working_directory_length = 0;
+	int result                      = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libcpath_GetCurrentDirectoryA(
-	          256,
-	          buffer );
+	result = libcpath_context_initialize(
+	          &context,
+	          &error );
 
-	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-	result = libcpath_GetCurrentDirectoryA(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_context_set_working_directory(
+	          context,
+	          "/",
+	          1,
 	          0,
-	          NULL );
+	          &error );
 
-	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	/* Test error cases
-	 */
-
-	return( 1 );
-
-on_error:
-	return( 0 );
-}
-
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+	 1 );
 
-/* Tests the libcpath_path_get_current_working_directory function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_current_working_directory(
-     void )
-{
-	libcerror_error_t *error              = NULL;
-	char *current_working_directory       = NULL;
-	size_t current_working_directory_size = 0;
-	int result                            = 0;
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libcpath_path_get_current_working_directory(
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_path_change_directory_context(
+	          context,
+	          "dev",
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -362,24 +643,15 @@ int cpath_test_path_get_current_working_directory(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "current_working_directory",
-	 current_working_directory );
-
-	memory_free(
-	 current_working_directory );
-
-	current_working_directory = NULL;
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libcpath_path_get_current_working_directory(
-	          NULL,
-	          &current_working_directory_size,
+	result = libcpath_path_change_directory_context(
+	          context,
+	          "nonexistent_directory",
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -394,15 +666,11 @@ int cpath_test_path_get_current_working_directory(
 	libcerror_error_free(
 	 &error );
 
-	current_working_directory = (char *) 0x12345678UL;
-
-	result = libcpath_path_get_current_working_directory(
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_path_change_directory_context(
+	          context,
+	          "null",
 	          &error );
 
-	current_working_directory = NULL;
-
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -415,9 +683,10 @@ int cpath_test_path_get_current_working_directory(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_current_working_directory(
-	          &current_working_directory,
-	          NULL,
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	result = libcpath_path_change_directory_context_wide(
+	          context,
+	          L"null",
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -432,122 +701,92 @@ int cpath_test_path_get_current_working_directory(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CPATH_TEST_MEMORY )
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-	/* Test libcpath_path_get_current_working_directory with malloc failing
+	/* The working directory is not changed on error
 	 */
-	cpath_test_malloc_attempts_before_fail = 0;
-
-	result = libcpath_path_get_current_working_directory(
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_context_get_working_directory(
+	          context,
+	          &working_directory,
+	          &working_directory_length,
 	          &error );
 
-	if( cpath_test_malloc_attempts_before_fail != -1 )
-	{
-		cpath_test_malloc_attempts_before_fail = -1;
-
-		if( current_working_directory != NULL )
-		{
-			memory_free(
-			 current_working_directory );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-			current_working_directory = NULL;
-		}
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "current_working_directory",
-		 current_working_directory );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "working_directory_length",
+	 working_directory_length,
+	 (size_t) 4 );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	result = narrow_string_compare(
+	          working_directory,
+	          "/dev",
+	          4 );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcpath_path_get_current_working_directory with memset failing
-	 */
-	cpath_test_memset_attempts_before_fail = 0;
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	result = libcpath_path_get_current_working_directory(
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_path_change_directory_context(
+	          context,
+	          NULL,
 	          &error );
 
-	if( cpath_test_memset_attempts_before_fail != -1 )
-	{
-		cpath_test_memset_attempts_before_fail = -1;
-
-		if( current_working_directory != NULL )
-		{
-			memory_free(
-			 current_working_directory );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-			current_working_directory = NULL;
-		}
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "current_working_directory",
-		 current_working_directory );
+	libcerror_error_free(
+	 &error );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	result = libcpath_path_change_directory_context(
+	          NULL,
+	          "dev",
+	          &error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test libcpath_path_change_directory with getcwd failing
-	 */
-	cpath_test_getcwd_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libcpath_path_get_current_working_directory(
-	          &current_working_directory,
-	          &current_working_directory_size,
+	/* Clean up
+	 */
+	result = libcpath_context_free(
+	          &context,
 	          &error );
 
-	if( cpath_test_getcwd_attempts_before_fail != -1 )
-	{
-		cpath_test_getcwd_attempts_before_fail = -1;
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "current_working_directory",
-		 current_working_directory );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	return( 1 );
 
@@ -557,92 +796,76 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( current_working_directory != NULL )
+	if( context != NULL )
 	{
-		memory_free(
-		 current_working_directory );
+		libcpath_context_free(
+		 &context,
+		 NULL );
 	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI )
+#endif /* !defined( WINAPI ) */
 
-/* Tests the libcpath_path_get_path_type function
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Tests the libcpath_GetCurrentDirectoryA function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_path_type(
+int cpath_test_GetCurrentDirectoryA(
      void )
 {
-	libcerror_error_t *error = NULL;
-	uint8_t path_type        = 0;
-	int result               = 0;
+	char buffer[ 256 ];
+
+	DWORD result = 0;
 
 	/* Test regular cases
 	 */
-	result = libcpath_path_get_path_type(
-	          ".",
-	          1,
-	          &path_type,
-	          &error );
+	result = libcpath_GetCurrentDirectoryA(
+	          256,
+	          buffer );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
+	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_RELATIVE );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 0 );
 
-	result = libcpath_path_get_path_type(
-	          "\\",
-	          1,
-	          &path_type,
-	          &error );
+	result = libcpath_GetCurrentDirectoryA(
+	          0,
+	          NULL );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
+	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_ABSOLUTE );
+	 0 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	/* Test error cases
+	 */
 
-	result = libcpath_path_get_path_type(
-	          "c:",
-	          2,
-	          &path_type,
-	          &error );
+	return( 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+on_error:
+	return( 0 );
+}
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_RELATIVE );
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+/* Tests the libcpath_path_get_current_working_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_current_working_directory(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	char *current_working_directory       = NULL;
+	size_t current_working_directory_size = 0;
+	int result                            = 0;
 
-	result = libcpath_path_get_path_type(
-	          "C:\\Windows",
-	          10,
-	          &path_type,
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -650,79 +873,238 @@ int cpath_test_path_get_path_type(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_ABSOLUTE );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+#if !defined( WINAPI )
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "current_working_directory_size",
+	 current_working_directory_size,
+	 narrow_string_length( current_working_directory ) + 1 );
+#endif
+
+	memory_free(
+	 current_working_directory );
+
+	current_working_directory = NULL;
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "\\\\server\\share\\directory",
-	          24,
-	          &path_type,
+	/* Test error cases
+	 */
+	result = libcpath_path_get_current_working_directory(
+	          NULL,
+	          &current_working_directory_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_UNC );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
-	          48,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	current_working_directory = (char *) 0x12345678UL;
+
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_size,
 	          &error );
 
+	current_working_directory = NULL;
+
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_EXTENDED_LENGTH );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "\\\\.\\PhysicalDrive0",
-	          18,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_DEVICE );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "\\\\.\\C:",
-	          6,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	/* Test libcpath_path_get_current_working_directory with malloc failing
+	 */
+	cpath_test_malloc_attempts_before_fail = 0;
+
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	if( cpath_test_malloc_attempts_before_fail != -1 )
+	{
+		cpath_test_malloc_attempts_before_fail = -1;
+
+		if( current_working_directory != NULL )
+		{
+			memory_free(
+			 current_working_directory );
+
+			current_working_directory = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "current_working_directory",
+		 current_working_directory );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcpath_path_get_current_working_directory with memset failing
+	 */
+	cpath_test_memset_attempts_before_fail = 0;
+
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	if( cpath_test_memset_attempts_before_fail != -1 )
+	{
+		cpath_test_memset_attempts_before_fail = -1;
+
+		if( current_working_directory != NULL )
+		{
+			memory_free(
+			 current_working_directory );
+
+			current_working_directory = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "current_working_directory",
+		 current_working_directory );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
+
+	/* Test libcpath_path_change_directory with getcwd failing
+	 */
+	cpath_test_getcwd_attempts_before_fail = 0;
+
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	if( cpath_test_getcwd_attempts_before_fail != -1 )
+	{
+		cpath_test_getcwd_attempts_before_fail = -1;
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "current_working_directory",
+		 current_working_directory );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI ) && defined( HAVE_GETCWD )
+
+/* Tests the libcpath_path_getcwd function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_getcwd(
+     void )
+{
+	char buffer[ LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE ];
+
+	libcerror_error_t *error                       = NULL;
+	char *current_working_directory                = NULL;
+	char *expected_current_working_directory       = NULL;
+	size_t current_working_directory_length        = 0;
+	size_t expected_current_working_directory_size = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_current_working_directory(
+	          &expected_current_working_directory,
+	          &expected_current_working_directory_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -730,19 +1112,21 @@ int cpath_test_path_get_path_type(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_DEVICE );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_current_working_directory",
+	 expected_current_working_directory );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "\\\\.\\C:\\",
-	          7,
-	          &path_type,
+	/* Test regular cases
+	 */
+	result = libcpath_path_getcwd(
+	          buffer,
+	          LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE,
+	          &current_working_directory,
+	          &current_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -750,19 +1134,33 @@ int cpath_test_path_get_path_type(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_DEVICE );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "current_working_directory_length",
+	 current_working_directory_length,
+	 expected_current_working_directory_size - 1 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "\\\\?\\C:\\Windows",
-	          14,
-	          &path_type,
+	if( current_working_directory != buffer )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	current_working_directory = NULL;
+
+	/* Test with a buffer that is too small, which causes the buffer to grow
+	 */
+	result = libcpath_path_getcwd(
+	          buffer,
+	          1,
+	          &current_working_directory,
+	          &current_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -770,41 +1168,46 @@ int cpath_test_path_get_path_type(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_EXTENDED_LENGTH );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "current_working_directory",
+	 (intptr_t) current_working_directory,
+	 (intptr_t) buffer );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "current_working_directory_length",
+	 current_working_directory_length,
+	 expected_current_working_directory_size - 1 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "\\\\?\\UNC\\server\\share\\directory",
-	          30,
-	          &path_type,
-	          &error );
+	result = narrow_string_compare(
+	          current_working_directory,
+	          expected_current_working_directory,
+	          expected_current_working_directory_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_EXTENDED_LENGTH_UNC );
+	memory_free(
+	 current_working_directory );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	current_working_directory = NULL;
 
 	/* Test error cases
 	 */
-	result = libcpath_path_get_path_type(
+	result = libcpath_path_getcwd(
 	          NULL,
-	          1,
-	          &path_type,
+	          LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE,
+	          &current_working_directory,
+	          &current_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -819,10 +1222,11 @@ int cpath_test_path_get_path_type(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_path_type(
-	          ".",
+	result = libcpath_path_getcwd(
+	          buffer,
 	          0,
-	          &path_type,
+	          &current_working_directory,
+	          &current_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -837,10 +1241,11 @@ int cpath_test_path_get_path_type(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_path_type(
-	          ".",
+	result = libcpath_path_getcwd(
+	          buffer,
 	          (size_t) SSIZE_MAX + 1,
-	          &path_type,
+	          &current_working_directory,
+	          &current_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -855,9 +1260,29 @@ int cpath_test_path_get_path_type(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_path_type(
-	          ".",
-	          1,
+	result = libcpath_path_getcwd(
+	          buffer,
+	          LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE,
+	          NULL,
+	          &current_working_directory_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_getcwd(
+	          buffer,
+	          LIBCPATH_CURRENT_WORKING_DIRECTORY_STACK_BUFFER_SIZE,
+	          &current_working_directory,
 	          NULL,
 	          &error );
 
@@ -873,6 +1298,11 @@ int cpath_test_path_get_path_type(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	memory_free(
+	 expected_current_working_directory );
+
 	return( 1 );
 
 on_error:
@@ -881,29 +1311,46 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( ( current_working_directory != NULL )
+	 && ( current_working_directory != buffer ) )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	if( expected_current_working_directory != NULL )
+	{
+		memory_free(
+		 expected_current_working_directory );
+	}
 	return( 0 );
 }
 
-/* Tests the libcpath_path_get_volume_name function
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI ) && defined( HAVE_GETCWD ) */
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI )
+
+/* Tests the libcpath_path_get_normalized_working_directory function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_volume_name(
+int cpath_test_path_get_normalized_working_directory(
      void )
 {
-	libcerror_error_t *error    = NULL;
-	char *volume_name           = NULL;
-	size_t directory_name_index = 0;
-	size_t volume_name_length   = 0;
-	int result                  = 0;
+	char buffer[ 32 ];
+
+	libcerror_error_t *error                   = NULL;
+	char *normalized_working_directory         = NULL;
+	size_t normalized_working_directory_length = 0;
+	int result                                 = 0;
 
 	/* Test regular cases
 	 */
-	result = libcpath_path_get_volume_name(
-	          ".",
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_normalized_working_directory(
+	          "/first/./second/../third",
+	          24,
+	          buffer,
+	          32,
+	          &normalized_working_directory,
+	          &normalized_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -911,57 +1358,41 @@ int cpath_test_path_get_volume_name(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 0 );
+	CPATH_TEST_ASSERT_EQUAL_INTPTR(
+	 "normalized_working_directory",
+	 (intptr_t) normalized_working_directory,
+	 (intptr_t) buffer );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 0 );
+	 "normalized_working_directory_length",
+	 normalized_working_directory_length,
+	 (size_t) 12 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_volume_name(
-	          "\\",
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
-	          &error );
+	result = narrow_string_compare(
+	          normalized_working_directory,
+	          "/first/third",
+	          13 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 0 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 0 );
+	 0 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	/* Test with a normalized working directory that does not fit in the buffer
+	 */
+	normalized_working_directory = NULL;
 
-	result = libcpath_path_get_volume_name(
-	          "c:",
-	          2,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_normalized_working_directory(
+	          "/first/./second/../third",
+	          24,
+	          buffer,
+	          4,
+	          &normalized_working_directory,
+	          &normalized_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -970,39 +1401,42 @@ int cpath_test_path_get_volume_name(
 	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 2 );
+	 "normalized_working_directory",
+	 normalized_working_directory );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 2 );
+	 "normalized_working_directory_length",
+	 normalized_working_directory_length,
+	 (size_t) 12 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = narrow_string_compare(
-	          volume_name,
-	          "c:",
-	          2 );
+	          normalized_working_directory,
+	          "/first/third",
+	          13 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	result = libcpath_path_get_volume_name(
-	          "C:\\Windows",
-	          10,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	memory_free(
+	 normalized_working_directory );
+
+	normalized_working_directory = NULL;
+
+	/* Test with the root directory
+	 */
+	result = libcpath_path_get_normalized_working_directory(
+	          "/first/..",
+	          9,
+	          buffer,
+	          32,
+	          &normalized_working_directory,
+	          &normalized_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1010,40 +1444,24 @@ int cpath_test_path_get_volume_name(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 2 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 3 );
+	 "normalized_working_directory_length",
+	 normalized_working_directory_length,
+	 (size_t) 0 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "C:",
-	          2 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	result = libcpath_path_get_volume_name(
-	          "\\\\server\\share\\directory",
-	          24,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	/* Test with the current working directory
+	 */
+	result = libcpath_path_get_normalized_working_directory(
+	          NULL,
+	          0,
+	          buffer,
+	          4,
+	          &normalized_working_directory,
+	          &normalized_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1051,245 +1469,136 @@ int cpath_test_path_get_volume_name(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 12 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 15 );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "server\\share",
-	          12 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	if( normalized_working_directory != buffer )
+	{
+		memory_free(
+		 normalized_working_directory );
+	}
+	normalized_working_directory = NULL;
 
-	result = libcpath_path_get_volume_name(
-	          "\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
-	          48,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	/* Test error cases
+	 */
+	result = libcpath_path_get_normalized_working_directory(
+	          "/first",
+	          6,
+	          NULL,
+	          32,
+	          &normalized_working_directory,
+	          &normalized_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 44 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 48 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
-	          44 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	libcerror_error_free(
+	 &error );
 
-	result = libcpath_path_get_volume_name(
-	          "\\\\.\\PhysicalDrive0",
-	          18,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_normalized_working_directory(
+	          "/first",
+	          6,
+	          buffer,
+	          0,
+	          &normalized_working_directory,
+	          &normalized_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 14 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 18 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "PhysicalDrive0",
-	          14 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	libcerror_error_free(
+	 &error );
 
-	result = libcpath_path_get_volume_name(
-	          "\\\\.\\C:",
+	result = libcpath_path_get_normalized_working_directory(
+	          "/first",
 	          6,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	          buffer,
+	          32,
+	          NULL,
+	          &normalized_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 2 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 6 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "C:",
-	          2 );
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_normalized_working_directory(
+	          "/first",
+	          6,
+	          buffer,
+	          32,
+	          &normalized_working_directory,
+	          NULL,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	result = libcpath_path_get_volume_name(
-	          "\\\\.\\C:\\",
-	          7,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 2 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 7 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "C:",
-	          2 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	result = libcpath_path_get_volume_name(
-	          "\\\\?\\C:\\Windows",
-	          14,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 2 );
+	libcerror_error_free(
+	 &error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 7 );
+	return( 1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ( normalized_working_directory != NULL )
+	 && ( normalized_working_directory != buffer ) )
+	{
+		memory_free(
+		 normalized_working_directory );
+	}
+	return( 0 );
+}
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "C:",
-	          2 );
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI ) */
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+/* Tests the libcpath_path_get_current_working_directory_cache_mode function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_current_working_directory_cache_mode(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int mode                 = 0;
+	int result               = 0;
 
-	result = libcpath_path_get_volume_name(
-	          "\\\\?\\UNC\\server\\share\\directory",
-	          30,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_current_working_directory_cache_mode(
+	          &mode,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1297,42 +1606,19 @@ int cpath_test_path_get_volume_name(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 12 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 21 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "mode",
+	 mode,
+	 LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_DISABLED );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "server\\share",
-	          12 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
 	/* Test error cases
 	 */
-	result = libcpath_path_get_volume_name(
+	result = libcpath_path_get_current_working_directory_cache_mode(
 	          NULL,
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1347,92 +1633,93 @@ int cpath_test_path_get_volume_name(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_volume_name(
-	          ".",
-	          0,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_set_current_working_directory_cache_mode function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_set_current_working_directory_cache_mode(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int mode                 = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_set_current_working_directory_cache_mode(
+	          LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_DISABLED,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_volume_name(
-	          ".",
-	          (size_t) SSIZE_MAX + 1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+#if defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+	result = libcpath_path_set_current_working_directory_cache_mode(
+	          LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_VALIDATE,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_volume_name(
-	          ".",
-	          1,
-	          NULL,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_current_working_directory_cache_mode(
+	          &mode,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "mode",
+	 mode,
+	 LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_VALIDATE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_volume_name(
-	          ".",
-	          1,
-	          &volume_name,
-	          NULL,
-	          &directory_name_index,
+	result = libcpath_path_set_current_working_directory_cache_mode(
+	          LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_DISABLED,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+#endif /* defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE ) */
 
-	result = libcpath_path_get_volume_name(
-	          ".",
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          NULL,
+	/* Test error cases
+	 */
+	result = libcpath_path_set_current_working_directory_cache_mode(
+	          -1,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1455,25 +1742,37 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	libcpath_path_set_current_working_directory_cache_mode(
+	 LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_DISABLED,
+	 NULL );
+
 	return( 0 );
 }
 
-/* Tests the libcpath_path_get_current_working_directory_by_volume function
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+
+/* Tests the libcpath_path_get_cached_current_working_directory function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_current_working_directory_by_volume(
+int cpath_test_path_get_cached_current_working_directory(
      void )
 {
-	libcerror_error_t *error              = NULL;
-	char *current_working_directory       = NULL;
-	size_t current_working_directory_size = 0;
-	int result                            = 0;
+	char deep_directory_name[ 32 ]          = "cpath_test_XXXXXX";
 
-	/* Test regular cases
+	libcerror_error_t *error                = NULL;
+	const char *cached_working_directory    = NULL;
+	char *current_working_directory         = NULL;
+	char *full_path                         = NULL;
+	size_t cached_working_directory_length  = 0;
+	size_t current_working_directory_length = 0;
+	size_t current_working_directory_size   = 0;
+	size_t full_path_size                   = 0;
+	int deep_directory_created              = 0;
+	int result                              = 0;
+
+	/* Initialize test
 	 */
-	result = libcpath_path_get_current_working_directory_by_volume(
-	          "C:",
-	          2,
+	result = libcpath_path_get_current_working_directory(
 	          &current_working_directory,
 	          &current_working_directory_size,
 	          &error );
@@ -1483,143 +1782,108 @@ int cpath_test_path_get_current_working_directory_by_volume(
 	 result,
 	 1 );
 
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	current_working_directory_length = narrow_string_length(
+	                                    current_working_directory );
+
+	/* Test with the cache disabled
 	 */
-	result = libcpath_path_get_current_working_directory_by_volume(
-	          "C:",
-	          (size_t) SSIZE_MAX + 1,
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_path_get_cached_current_working_directory(
+	          &cached_working_directory,
+	          &cached_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_current_working_directory_by_volume(
-	          "C:",
-	          2,
-	          NULL,
-	          &current_working_directory_size,
+	/* Test with the cache validated against the current directory
+	 */
+	result = libcpath_path_set_current_working_directory_cache_mode(
+	          LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_VALIDATE,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_current_working_directory_by_volume(
-	          "C:",
-	          2,
-	          &current_working_directory,
-	          NULL,
+	result = libcpath_path_get_cached_current_working_directory(
+	          &cached_working_directory,
+	          &cached_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "cached_working_directory_length",
+	 cached_working_directory_length,
+	 current_working_directory_length );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = narrow_string_compare(
+	          cached_working_directory,
+	          current_working_directory,
+	          current_working_directory_length + 1 );
 
-	return( 1 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	/* Test with a current working directory that does not fit in the cache
+	 */
+	deep_directory_created = 1;
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) */
+	result = cpath_test_path_enter_deep_directory(
+	          deep_directory_name );
 
-/* Tests the libcpath_path_get_full_path function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_full_path(
-     void )
-{
-#if defined( WINAPI )
-	char *absolute_paths[] = {
-		"\\home\\user\\test.txt",
-		"c:\\home\\user\\test.txt",
-		"c:\\home\\user\\\\test.txt",
-		"c:\\home\\username\\..\\user\\test.txt",
-		"c:\\..\\home\\user\\test.txt",
-		"c:\\..\\home\\username\\..\\user\\test.txt",
-	};
-	char *relative_paths[] = {
-		"user\\test.txt",
-		"username\\..\\user\\test.txt",
-	};
-	char *special_paths[] = {
-		"\\\\.\\PhysicalDrive0",
-		"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}"
-	};
-	char *unc_paths[] = {
-		"\\\\172.0.0.1\\C$\\test.txt",
-		"\\\\?\\UNC\\172.0.0.1\\C$\\test.txt",
-	};
-#else
-	char *absolute_paths[] = {
-		"/home/user/test.txt",
-		"/home/user//test.txt",
-		"/../home/user/test.txt",
-		"/../home/username/../user/test.txt",
-	};
-	char *relative_paths[] = {
-		"user/test.txt",
-		"username/../user/test.txt",
-	};
-#endif /* defined( WINAPI ) */
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	libcerror_error_t *error                = NULL;
-	char *current_working_directory         = NULL;
-	char *expected_path                     = NULL;
-	char *full_path                         = NULL;
-	char *path                              = NULL;
-	size_t current_working_directory_length = 0;
-	size_t current_working_directory_size   = 0;
-	size_t expected_full_path_length        = 0;
-	size_t expected_path_length             = 0;
-	size_t full_path_length                 = 0;
-	size_t full_path_size                   = 0;
-	size_t path_length                      = 0;
-	int path_index                          = 0;
-	int result                              = 0;
-	int string_index                        = 0;
+	result = libcpath_path_get_cached_current_working_directory(
+	          &cached_working_directory,
+	          &cached_working_directory_length,
+	          &error );
 
-	/* Initialize test
-	 */
-	result = libcpath_path_get_current_working_directory(
-	          &current_working_directory,
-	          &current_working_directory_size,
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_full_path(
+	          "file",
+	          4,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1628,334 +1892,120 @@ int cpath_test_path_get_full_path(
 	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "current_working_directory",
-	 current_working_directory );
+	 "full_path",
+	 full_path );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	current_working_directory_length = narrow_string_length(
-	                                    current_working_directory );
+	memory_free(
+	 full_path );
 
-	/* Test regular cases
-	 */
-#if defined( WINAPI )
-	expected_path = "\\\\?\\C:\\home\\user\\test.txt";
-#else
-	expected_path = "/home/user/test.txt";
-#endif
-	expected_path_length = narrow_string_length(
-	                        expected_path );
+	full_path = NULL;
 
-	for( path_index = 0;
-	     path_index < 4;
-	     path_index++ )
-	{
-		path = absolute_paths[ path_index ];
+	result = cpath_test_path_leave_deep_directory(
+	          deep_directory_name,
+	          current_working_directory );
 
-		path_length = narrow_string_length(
-		               path );
+	deep_directory_created = 0;
 
-		result = libcpath_path_get_full_path(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	/* Test if a change of directory outside the library is detected
+	 */
+	result = chdir(
+	          "/" );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 expected_path_length + 1 );
+	result = libcpath_path_get_cached_current_working_directory(
+	          &cached_working_directory,
+	          &cached_working_directory_length,
+	          &error );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#if defined( WINAPI )
-		result = narrow_string_compare_no_case(
-		          full_path,
-		          expected_path,
-		          expected_path_length );
-#else
-		result = narrow_string_compare(
-		          full_path,
-		          expected_path,
-		          expected_path_length );
-#endif
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "cached_working_directory_length",
+	 cached_working_directory_length,
+	 (size_t) 1 );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		full_path_length = narrow_string_length(
-		                    full_path );
+	/* Test if a change of directory by the library is detected
+	 */
+	result = libcpath_path_set_current_working_directory_cache_mode(
+	          LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_TRUST,
+	          &error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 full_path_length + 1 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		memory_free(
-		 full_path );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		full_path = NULL;
-	}
-#if defined( WINAPI )
-	expected_path = "\\user\\test.txt";
-#else
-	expected_path = "/user/test.txt";
-#endif
-	expected_path_length = narrow_string_length(
-	                        expected_path );
+	result = libcpath_path_change_directory(
+	          current_working_directory,
+	          &error );
 
-	expected_full_path_length = current_working_directory_length + expected_path_length;
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#if defined( WINAPI )
-	expected_full_path_length += 4;
-#endif
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	for( path_index = 0;
-	     path_index < 2;
-	     path_index++ )
-	{
-		path = relative_paths[ path_index ];
+	result = libcpath_path_get_cached_current_working_directory(
+	          &cached_working_directory,
+	          &cached_working_directory_length,
+	          &error );
 
-		path_length = narrow_string_length(
-		               path );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		result = libcpath_path_get_full_path(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "cached_working_directory_length",
+	 cached_working_directory_length,
+	 current_working_directory_length );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 expected_full_path_length + 1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-#if defined( WINAPI )
-		/* A full path on Windows is prefixed with \\?\ while
-		 * the current working directory is not.
-		 */
-		result = narrow_string_compare_no_case(
-		          full_path,
-		          "\\\\?\\",
-		          4 );
-
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
-
-		string_index = 4;
-#else
-		string_index = 0;
-#endif
-#if defined( WINAPI )
-		result = narrow_string_compare_no_case(
-		          &( full_path[ string_index ] ),
-		          current_working_directory,
-		          current_working_directory_length );
-#else
-		result = narrow_string_compare(
-		          &( full_path[ string_index ] ),
-		          current_working_directory,
-		          current_working_directory_length );
-#endif
-
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
-
-#if defined( WINAPI )
-		result = narrow_string_compare_no_case(
-		          &( full_path[ string_index + current_working_directory_length ] ),
-		          expected_path,
-		          expected_path_length );
-#else
-		result = narrow_string_compare(
-		          &( full_path[ string_index + current_working_directory_length ] ),
-		          expected_path,
-		          expected_path_length );
-#endif
-
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
-
-		full_path_length = narrow_string_length(
-		                    full_path );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_length",
-		 full_path_length,
-		 expected_full_path_length );
-
-		memory_free(
-		 full_path );
-
-		full_path = NULL;
-	}
-#if defined( WINAPI )
-/* TODO make changes to have test pass
-	for( path_index = 0;
-	     path_index < 2;
-	     path_index++ )
-	{
-		path = special_paths[ path_index ];
-
-		path_length = narrow_string_length(
-		               path );
-
-		result = libcpath_path_get_full_path(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
-
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 path_length + 1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		result = narrow_string_compare_no_case(
-		          full_path,
-		          expected_path,
-		          expected_path_length );
-
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
-
-		full_path_length = narrow_string_length(
-		                    full_path );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_length",
-		 full_path_length,
-		 path_length );
-
-		memory_free(
-		 full_path );
-
-		full_path = NULL;
-	}
-*/
-	expected_path = "\\\\?\\UNC\\172.0.0.1\\C$\\test.txt";
-
-	expected_path_length = narrow_string_length(
-	                        expected_path );
-
-	for( path_index = 0;
-	     path_index < 2;
-	     path_index++ )
-	{
-		path = unc_paths[ path_index ];
-
-		path_length = narrow_string_length(
-		               path );
-
-		result = libcpath_path_get_full_path(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
-
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 expected_path_length + 1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		result = narrow_string_compare_no_case(
-		          full_path,
-		          expected_path,
-		          expected_path_length );
-
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
-
-		full_path_length = narrow_string_length(
-		                    full_path );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_length",
-		 full_path_length,
-		 expected_path_length );
-
-		memory_free(
-		 full_path );
+	result = narrow_string_compare(
+	          cached_working_directory,
+	          current_working_directory,
+	          current_working_directory_length + 1 );
 
-		full_path = NULL;
-	}
-#endif /* defined( WINAPI ) */
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	/* Test error cases
 	 */
-	result = libcpath_path_get_full_path(
+	result = libcpath_path_get_cached_current_working_directory(
 	          NULL,
-	          8,
-	          &full_path,
-	          &full_path_size,
+	          &cached_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1970,11 +2020,9 @@ int cpath_test_path_get_full_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path(
-	          "test.txt",
-	          0,
-	          &full_path,
-	          &full_path_size,
+	result = libcpath_path_get_cached_current_working_directory(
+	          &cached_working_directory,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1989,166 +2037,159 @@ int cpath_test_path_get_full_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path(
-	          "test.txt",
-	          (size_t) -1,
-	          &full_path,
-	          &full_path_size,
+	/* Clean up
+	 */
+	result = libcpath_path_set_current_working_directory_cache_mode(
+	          LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_DISABLED,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_full_path(
-	          "test.txt",
-	          8,
-	          NULL,
-	          &full_path_size,
-	          &error );
+	memory_free(
+	 current_working_directory );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	return( 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( current_working_directory != NULL )
+	{
+		chdir(
+		 current_working_directory );
 
-	libcerror_error_free(
-	 &error );
+		if( deep_directory_created != 0 )
+		{
+			cpath_test_path_leave_deep_directory(
+			 deep_directory_name,
+			 current_working_directory );
+		}
 
-	full_path = (char *) 0x12345678UL;
+		memory_free(
+		 current_working_directory );
+	}
+	libcpath_path_set_current_working_directory_cache_mode(
+	 LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE_MODE_DISABLED,
+	 NULL );
 
-	result = libcpath_path_get_full_path(
-	          "test.txt",
-	          8,
-	          &full_path,
-	          &full_path_size,
-	          &error );
+	return( 0 );
+}
 
-	full_path = NULL;
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE ) */
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI )
+
+/* Tests the libcpath_path_get_path_type function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_path_type(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t path_type        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_path_type(
+	          ".",
+	          1,
+	          &path_type,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_RELATIVE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_full_path(
-	          "test.txt",
-	          8,
-	          &full_path,
-	          NULL,
+	result = libcpath_path_get_path_type(
+	          "\\",
+	          1,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_ABSOLUTE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
-
-	/* Test libcpath_path_change_directory with getcwd failing
-	 */
-	cpath_test_getcwd_attempts_before_fail = 0;
-
-	result = libcpath_path_get_full_path(
-	          "test.txt",
-	          8,
-	          &full_path,
-	          &full_path_size,
+	result = libcpath_path_get_path_type(
+	          "c:",
+	          2,
+	          &path_type,
 	          &error );
 
-	if( cpath_test_getcwd_attempts_before_fail != -1 )
-	{
-		cpath_test_getcwd_attempts_before_fail = -1;
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "full_path",
-		 full_path );
-
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_RELATIVE );
 
-	/* Clean up
-	 */
-	memory_free(
-	 current_working_directory );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	return( 1 );
+	result = libcpath_path_get_path_type(
+	          "C:\\Windows",
+	          10,
+	          &path_type,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( full_path != NULL )
-	{
-		memory_free(
-		 full_path );
-	}
-	if( current_working_directory != NULL )
-	{
-		memory_free(
-		 current_working_directory );
-	}
-	return( 0 );
-}
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_ABSOLUTE );
 
-/* Tests the libcpath_path_get_sanitized_character_size function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_sanitized_character_size(
-     void )
-{
-	libcerror_error_t *error        = NULL;
-	size_t sanitized_character_size = 0;
-	int result                      = 0;
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libcpath_path_get_sanitized_character_size(
-	          (char) 0,
-	          &sanitized_character_size,
+	result = libcpath_path_get_path_type(
+	          "\\\\server\\share\\directory",
+	          24,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2156,18 +2197,19 @@ int cpath_test_path_get_sanitized_character_size(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 4 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_UNC );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_sanitized_character_size(
-	          LIBCPATH_ESCAPE_CHARACTER,
-	          &sanitized_character_size,
+	result = libcpath_path_get_path_type(
+	          "\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
+	          48,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2175,18 +2217,19 @@ int cpath_test_path_get_sanitized_character_size(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 2 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_EXTENDED_LENGTH );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_sanitized_character_size(
-	          '!',
-	          &sanitized_character_size,
+	result = libcpath_path_get_path_type(
+	          "\\\\.\\PhysicalDrive0",
+	          18,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2194,18 +2237,19 @@ int cpath_test_path_get_sanitized_character_size(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 4 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_DEVICE );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_sanitized_character_size(
-	          'A',
-	          &sanitized_character_size,
+	result = libcpath_path_get_path_type(
+	          "\\\\.\\C:",
+	          6,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2213,143 +2257,59 @@ int cpath_test_path_get_sanitized_character_size(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 1 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_DEVICE );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_get_sanitized_character_size(
-	          'A',
-	          NULL,
+	result = libcpath_path_get_path_type(
+	          "\\\\.\\C:\\",
+	          7,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_DEVICE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libcpath_path_get_sanitized_character function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_sanitized_character(
-     void )
-{
-	char sanitized_path[ 32 ];
-
-	libcerror_error_t *error      = NULL;
-	char *expected_sanitized_path = NULL;
-	size_t sanitized_path_index   = 0;
-	int result                    = 0;
-
-	/* Test regular cases
-	 */
-	sanitized_path_index = 0;
-
-	result = libcpath_path_get_sanitized_character(
-	          (char) 0,
-	          4,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
-	          &error );
+	result = libcpath_path_get_path_type(
+	          "\\\\?\\C:\\Windows",
+	          14,
+	          &path_type,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 4 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-#if defined( WINAPI )
-	expected_sanitized_path = "^x00";
-#else
-	expected_sanitized_path = "\\x00";
-#endif
-
-	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_sanitized_path,
-	          4 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	sanitized_path_index = 0;
-
-	result = libcpath_path_get_sanitized_character(
-	          LIBCPATH_ESCAPE_CHARACTER,
-	          2,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
-	          &error );
-
 	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 2 );
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_EXTENDED_LENGTH );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-#if defined( WINAPI )
-	expected_sanitized_path = "^^";
-#else
-	expected_sanitized_path = "\\\\";
-#endif
-
-	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_sanitized_path,
-	          2 );
-
-	sanitized_path_index = 0;
-
-	result = libcpath_path_get_sanitized_character(
-	          'A',
-	          1,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	result = libcpath_path_get_path_type(
+	          "\\\\?\\UNC\\server\\share\\directory",
+	          30,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2357,30 +2317,21 @@ int cpath_test_path_get_sanitized_character(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 1 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_EXTENDED_LENGTH_UNC );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          sanitized_path,
-	          "A",
-	          1 );
-
 	/* Test error cases
 	 */
-	sanitized_path_index = 0;
-
-	result = libcpath_path_get_sanitized_character(
-	          'A',
-	          8,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	result = libcpath_path_get_path_type(
+	          NULL,
+	          1,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2388,11 +2339,6 @@ int cpath_test_path_get_sanitized_character(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2400,12 +2346,10 @@ int cpath_test_path_get_sanitized_character(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_character(
-	          'A',
-	          1,
-	          NULL,
-	          32,
-	          &sanitized_path_index,
+	result = libcpath_path_get_path_type(
+	          ".",
+	          0,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2413,11 +2357,6 @@ int cpath_test_path_get_sanitized_character(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2425,12 +2364,10 @@ int cpath_test_path_get_sanitized_character(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_character(
-	          'A',
-	          1,
-	          sanitized_path,
+	result = libcpath_path_get_path_type(
+	          ".",
 	          (size_t) SSIZE_MAX + 1,
-	          &sanitized_path_index,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2438,11 +2375,6 @@ int cpath_test_path_get_sanitized_character(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2450,11 +2382,9 @@ int cpath_test_path_get_sanitized_character(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_character(
-	          'A',
+	result = libcpath_path_get_path_type(
+	          ".",
 	          1,
-	          sanitized_path,
-	          32,
 	          NULL,
 	          &error );
 
@@ -2463,38 +2393,6 @@ int cpath_test_path_get_sanitized_character(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	sanitized_path_index = 32;
-
-	result = libcpath_path_get_sanitized_character(
-	          'A',
-	          1,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 32 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2513,37 +2411,26 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
-
-/* Tests the libcpath_path_get_sanitized_filename function
+/* Tests the libcpath_path_get_volume_name function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_sanitized_filename(
+int cpath_test_path_get_volume_name(
      void )
 {
-	libcerror_error_t *error       = NULL;
-	char *expected_filename        = NULL;
-	char *sanitized_filename       = NULL;
-	char *test_filename            = NULL;
-	size_t expected_filename_size  = 0;
-	size_t sanitized_filename_size = 0;
-	size_t test_filename_length    = 0;
-	int result                     = 0;
+	libcerror_error_t *error    = NULL;
+	char *volume_name           = NULL;
+	size_t directory_name_index = 0;
+	size_t volume_name_length   = 0;
+	int result                  = 0;
 
 	/* Test regular cases
 	 */
-	/* Test libcpath_path_get_sanitized_filename without replacement characters
-	 */
-	test_filename          = "test.txt";
-	test_filename_length   = 8;
-	expected_filename      = "test.txt";
-	expected_filename_size = 9;
-
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	result = libcpath_path_get_volume_name(
+	          ".",
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2551,54 +2438,57 @@ int cpath_test_path_get_sanitized_filename(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_filename",
-	 sanitized_filename );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 0 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_filename_size",
-	 sanitized_filename_size,
-	 expected_filename_size );
+	 "directory_name_index",
+	 directory_name_index,
+	 0 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          sanitized_filename,
-	          expected_filename,
-	          expected_filename_size );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
+	result = libcpath_path_get_volume_name(
+	          "\\",
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-	memory_free(
-	 sanitized_filename );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "volume_name",
+	 volume_name );
 
-	sanitized_filename      = NULL;
-	sanitized_filename_size = 0;
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 0 );
 
-	/* Test libcpath_path_get_sanitized_filename with replacement characters
-	 */
-#if defined( WINAPI )
-	test_filename          = "t\x00sT!.t^|";
-	test_filename_length   = 9;
-	expected_filename      = "t^x00sT^x21.t^^^x7c";
-	expected_filename_size = 20;
-#else
-	test_filename          = "t\x00sT!.t\\|";
-	test_filename_length   = 9;
-	expected_filename      = "t\\x00sT\\x21.t\\\\\\x7c";
-	expected_filename_size = 20;
-#endif
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 0 );
 
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_volume_name(
+	          "c:",
+	          2,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2607,242 +2497,285 @@ int cpath_test_path_get_sanitized_filename(
 	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_filename",
-	 sanitized_filename );
+	 "volume_name",
+	 volume_name );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_filename_size",
-	 sanitized_filename_size,
-	 expected_filename_size );
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 2 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = narrow_string_compare(
-	          sanitized_filename,
-	          expected_filename,
-	          expected_filename_size );
+	          volume_name,
+	          "c:",
+	          2 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	memory_free(
-	 sanitized_filename );
-
-	sanitized_filename      = NULL;
-	sanitized_filename_size = 0;
-
-	/* Test error cases
-	 */
-	test_filename          = "test.txt";
-	test_filename_length   = 8;
-	expected_filename      = "test.txt";
-	expected_filename_size = 9;
-
-	result = libcpath_path_get_sanitized_filename(
-	          NULL,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	result = libcpath_path_get_volume_name(
+	          "C:\\Windows",
+	          10,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 3 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = narrow_string_compare(
+	          volume_name,
+	          "C:",
+	          2 );
 
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          (size_t) -1,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name(
+	          "\\\\server\\share\\directory",
+	          24,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 15 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = narrow_string_compare(
+	          volume_name,
+	          "server\\share",
+	          12 );
 
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          test_filename_length,
-	          NULL,
-	          &sanitized_filename_size,
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name(
+	          "\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
+	          48,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 44 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 48 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = narrow_string_compare(
+	          volume_name,
+	          "Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
+	          44 );
 
-	sanitized_filename = (char *) 0x12345678UL;
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	result = libcpath_path_get_volume_name(
+	          "\\\\.\\PhysicalDrive0",
+	          18,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
-	sanitized_filename = NULL;
-
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 14 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 18 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = narrow_string_compare(
+	          volume_name,
+	          "PhysicalDrive0",
+	          14 );
 
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          NULL,
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name(
+	          "\\\\.\\C:",
+	          6,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-#if defined( HAVE_CPATH_TEST_MEMORY )
+	 "volume_name",
+	 volume_name );
 
-	/* Test libcpath_path_get_sanitized_filename with malloc failing
-	 */
-	cpath_test_malloc_attempts_before_fail = 0;
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 2 );
 
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
-	          &error );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 6 );
 
-	if( cpath_test_malloc_attempts_before_fail != -1 )
-	{
-		cpath_test_malloc_attempts_before_fail = -1;
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		if( sanitized_filename != NULL )
-		{
-			memory_free(
-			 sanitized_filename );
+	result = narrow_string_compare(
+	          volume_name,
+	          "C:",
+	          2 );
 
-			sanitized_filename = NULL;
-		}
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "sanitized_filename",
-		 sanitized_filename );
+	result = libcpath_path_get_volume_name(
+	          "\\\\.\\C:\\",
+	          7,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "sanitized_filename_size",
-		 sanitized_filename_size,
-		 (size_t) 0 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 2 );
 
-	return( 1 );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 7 );
 
-on_error:
-	if( sanitized_filename != NULL )
-	{
-		memory_free(
-		 sanitized_filename );
-	}
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libcpath_path_get_sanitized_path function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_sanitized_path(
-     void )
-{
-	libcerror_error_t *error   = NULL;
-	char *expected_path        = NULL;
-	char *sanitized_path       = NULL;
-	char *test_path            = NULL;
-	size_t expected_path_size  = 0;
-	size_t sanitized_path_size = 0;
-	size_t test_path_length    = 0;
-	int result                 = 0;
+	result = narrow_string_compare(
+	          volume_name,
+	          "C:",
+	          2 );
 
-	/* Test regular cases
-	 */
-	/* Test libcpath_path_get_sanitized_path without replacement characters
-	 */
-#if defined( WINAPI )
-	test_path          = "test\\test.txt";
-	test_path_length   = 13;
-	expected_path      = "test\\test.txt";
-	expected_path_size = 14;
-#else
-	test_path          = "test/test.txt";
-	test_path_length   = 13;
-	expected_path      = "test/test.txt";
-	expected_path_size = 14;
-#endif
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_get_volume_name(
+	          "\\\\?\\C:\\Windows",
+	          14,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2851,53 +2784,39 @@ int cpath_test_path_get_sanitized_path(
 	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_path",
-	 sanitized_path );
+	 "volume_name",
+	 volume_name );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_size",
-	 sanitized_path_size,
-	 expected_path_size );
+	 "volume_name_length",
+	 volume_name_length,
+	 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 7 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_path,
-	          expected_path_size );
+	          volume_name,
+	          "C:",
+	          2 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	memory_free(
-	 sanitized_path );
-
-	sanitized_path      = NULL;
-	sanitized_path_size = 0;
-
-	/* Test libcpath_path_get_sanitized_path with replacement characters
-	 */
-#if defined( WINAPI )
-	test_path          = "test\\t\x00sT!.t^|";
-	test_path_length   = 14;
-	expected_path      = "test\\t^x00sT^x21.t^^^x7c";
-	expected_path_size = 25;
-#else
-	test_path          = "test/t\x00sT!.t\\|";
-	test_path_length   = 14;
-	expected_path      = "test/t\\x00sT\\x21.t\\\\\\x7c";
-	expected_path_size = 25;
-#endif
-
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_get_volume_name(
+	          "\\\\?\\UNC\\server\\share\\directory",
+	          30,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2906,53 +2825,41 @@ int cpath_test_path_get_sanitized_path(
 	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_path",
-	 sanitized_path );
+	 "volume_name",
+	 volume_name );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_size",
-	 sanitized_path_size,
-	 expected_path_size );
+	 "volume_name_length",
+	 volume_name_length,
+	 12 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 21 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_path,
-	          expected_path_size );
+	          volume_name,
+	          "server\\share",
+	          12 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	memory_free(
-	 sanitized_path );
-
-	sanitized_path      = NULL;
-	sanitized_path_size = 0;
-
 	/* Test error cases
 	 */
-#if defined( WINAPI )
-	test_path          = "test\\test.txt";
-	test_path_length   = 13;
-	expected_path      = "test\\test.txt";
-	expected_path_size = 14;
-#else
-	test_path          = "test/test.txt";
-	test_path_length   = 13;
-	expected_path      = "test/test.txt";
-	expected_path_size = 14;
-#endif
-
-	result = libcpath_path_get_sanitized_path(
+	result = libcpath_path_get_volume_name(
 	          NULL,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2967,11 +2874,12 @@ int cpath_test_path_get_sanitized_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          (size_t) -1,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_get_volume_name(
+	          ".",
+	          0,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2986,11 +2894,12 @@ int cpath_test_path_get_sanitized_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          test_path_length,
-	          NULL,
-	          &sanitized_path_size,
+	result = libcpath_path_get_volume_name(
+	          ".",
+	          (size_t) SSIZE_MAX + 1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3005,17 +2914,14 @@ int cpath_test_path_get_sanitized_path(
 	libcerror_error_free(
 	 &error );
 
-	sanitized_path = (char *) 0x12345678UL;
-
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_get_volume_name(
+	          ".",
+	          1,
+	          NULL,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
-	sanitized_path = NULL;
-
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -3028,11 +2934,12 @@ int cpath_test_path_get_sanitized_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
+	result = libcpath_path_get_volume_name(
+	          ".",
+	          1,
+	          &volume_name,
 	          NULL,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3047,64 +2954,29 @@ int cpath_test_path_get_sanitized_path(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CPATH_TEST_MEMORY )
-
-	/* Test libcpath_path_get_sanitized_path with malloc failing
-	 */
-	cpath_test_malloc_attempts_before_fail = 0;
-
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_get_volume_name(
+	          ".",
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          NULL,
 	          &error );
 
-	if( cpath_test_malloc_attempts_before_fail != -1 )
-	{
-		cpath_test_malloc_attempts_before_fail = -1;
-
-		if( sanitized_path != NULL )
-		{
-			memory_free(
-			 sanitized_path );
-
-			sanitized_path = NULL;
-		}
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "sanitized_path",
-		 sanitized_path );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "sanitized_path_size",
-		 sanitized_path_size,
-		 (size_t) 0 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+	libcerror_error_free(
+	 &error );
 
 	return( 1 );
 
 on_error:
-	if( sanitized_path != NULL )
-	{
-		memory_free(
-		 sanitized_path );
-	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -3113,45 +2985,24 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcpath_path_join function
+/* Tests the libcpath_path_get_current_working_directory_by_volume function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_join(
+int cpath_test_path_get_current_working_directory_by_volume(
      void )
 {
-	libcerror_error_t *error  = NULL;
-	const char *expected_path = NULL;
-	const char *test_path1    = NULL;
-	const char *test_path2    = NULL;
-	const char *test_path3    = NULL;
-	const char *test_path4    = NULL;
-	char *path                = NULL;
-	size_t path_size          = 0;
-	int result                = 0;
+	libcerror_error_t *error              = NULL;
+	char *current_working_directory       = NULL;
+	size_t current_working_directory_size = 0;
+	int result                            = 0;
 
 	/* Test regular cases
 	 */
-#if defined( WINAPI )
-	test_path1    = "\\first\\second";
-	test_path2    = "third\\fourth";
-	test_path3    = "\\first\\second\\";
-	test_path4    = "\\third\\fourth";
-	expected_path = "\\first\\second\\third\\fourth";
-#else
-	test_path1    = "/first/second";
-	test_path2    = "third/fourth";
-	test_path3    = "/first/second/";
-	test_path4    = "/third/fourth";
-	expected_path = "/first/second/third/fourth";
-#endif
-
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
+	result = libcpath_path_get_current_working_directory_by_volume(
+	          "C:",
+	          2,
+	          &current_working_directory,
+	          &current_working_directory_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3163,178 +3014,240 @@ int cpath_test_path_join(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          path,
-	          expected_path,
-	          26 );
+	/* Test error cases
+	 */
+	result = libcpath_path_get_current_working_directory_by_volume(
+	          "C:",
+	          (size_t) SSIZE_MAX + 1,
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	memory_free(
-	 path );
+	 -1 );
 
-	path = NULL;
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "path_size",
-	 path_size,
-	 (size_t) 27 );
+	libcerror_error_free(
+	 &error );
 
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path3,
-	          14,
-	          test_path2,
-	          12,
+	result = libcpath_path_get_current_working_directory_by_volume(
+	          "C:",
+	          2,
+	          NULL,
+	          &current_working_directory_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          path,
-	          expected_path,
-	          26 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	memory_free(
-	 path );
-
-	path = NULL;
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "path_size",
-	 path_size,
-	 (size_t) 27 );
+	libcerror_error_free(
+	 &error );
 
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path4,
-	          13,
+	result = libcpath_path_get_current_working_directory_by_volume(
+	          "C:",
+	          2,
+	          &current_working_directory,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          path,
-	          expected_path,
-	          26 );
+	libcerror_error_free(
+	 &error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	return( 1 );
 
-	memory_free(
-	 path );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-	path = NULL;
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) */
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "path_size",
-	 path_size,
-	 (size_t) 27 );
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI )
 
-	/* Test error cases
+/* Tests the libcpath_path_normalize_with_base function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_normalize_with_base(
+     void )
+{
+	char *test_paths[] = {
+		"/home/user/test.txt",
+		"/home/user//test.txt",
+		"/home/user/./test.txt",
+		"/home/username/../user/test.txt",
+		"/../../home/user/test.txt",
+		"user/test.txt",
+		"username/../user/test.txt",
+		"../../../../../home/user/test.txt",
+		"/",
+		"//",
+		"/home/user/..",
+		"a/./b//c/..",
+		"." };
+	char *expected_paths[] = {
+		"/home/user/test.txt",
+		"/home/user/test.txt",
+		"/home/user/test.txt",
+		"/home/user/test.txt",
+		"/home/user/test.txt",
+		"/base/directory/user/test.txt",
+		"/base/directory/user/test.txt",
+		"/home/user/test.txt",
+		"/",
+		"/",
+		"/home",
+		"/base/directory/a/b",
+		"/base/directory" };
+
+	char normalized_path[ 64 ];
+
+	libcerror_error_t *error             = NULL;
+	size_t expected_path_length          = 0;
+	size_t required_normalized_path_size = 0;
+	int path_index                       = 0;
+	int result                           = 0;
+
+	/* Test regular cases
 	 */
-	result = libcpath_path_join(
-	          NULL,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
-	          &error );
+	for( path_index = 0;
+	     path_index < 13;
+	     path_index++ )
+	{
+		expected_path_length = narrow_string_length(
+		                        expected_paths[ path_index ] );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		/* Determine the size only
+		 */
+		result = libcpath_path_normalize_with_base(
+		          "/base//directory/",
+		          17,
+		          test_paths[ path_index ],
+		          narrow_string_length(
+		           test_paths[ path_index ] ),
+		          NULL,
+		          0,
+		          &required_normalized_path_size,
+		          &error );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	libcerror_error_free(
-	 &error );
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "required_normalized_path_size",
+		 required_normalized_path_size,
+		 expected_path_length + 1 );
 
-	path = (char *) 0x12345678UL;
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
-	          &error );
+		result = libcpath_path_normalize_with_base(
+		          "/base//directory/",
+		          17,
+		          test_paths[ path_index ],
+		          narrow_string_length(
+		           test_paths[ path_index ] ),
+		          normalized_path,
+		          64,
+		          &required_normalized_path_size,
+		          &error );
 
-	path = NULL;
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "required_normalized_path_size",
+		 required_normalized_path_size,
+		 expected_path_length + 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	libcerror_error_free(
-	 &error );
+		result = narrow_string_compare(
+		          normalized_path,
+		          expected_paths[ path_index ],
+		          expected_path_length + 1 );
 
-	result = libcpath_path_join(
-	          &path,
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test without a base path
+	 */
+	result = libcpath_path_normalize_with_base(
 	          NULL,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
+	          0,
+	          "../user/test.txt",
+	          16,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_normalized_path_size",
+	 required_normalized_path_size,
+	 (size_t) 15 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = narrow_string_compare(
+	          normalized_path,
+	          "/user/test.txt",
+	          15 );
 
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_normalize_with_base(
+	          "/base",
+	          5,
 	          NULL,
-	          13,
-	          test_path2,
-	          12,
+	          0,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3349,13 +3262,14 @@ int cpath_test_path_join(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          (size_t) SSIZE_MAX + 1,
-	          test_path2,
-	          12,
+	result = libcpath_path_normalize_with_base(
+	          "/base",
+	          5,
+	          "user",
+	          (size_t) SSIZE_MAX,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3370,13 +3284,14 @@ int cpath_test_path_join(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
+	result = libcpath_path_normalize_with_base(
+	          "/base",
+	          5,
+	          "user",
+	          4,
+	          normalized_path,
+	          64,
 	          NULL,
-	          12,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3391,27 +3306,30 @@ int cpath_test_path_join(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          (size_t) SSIZE_MAX + 1,
+	result = libcpath_path_normalize_with_base(
+	          "/base",
+	          5,
+	          "user",
+	          4,
+	          normalized_path,
+	          5,
+	          &required_normalized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_normalized_path_size",
+	 required_normalized_path_size,
+	 (size_t) 11 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -3420,71 +3338,176 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( path != NULL )
-	{
-		memory_free(
-		 path );
-	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
-
-/* Tests the libcpath_CreateDirectoryA function
+/* Tests the libcpath_path_normalize_with_normalized_base function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_CreateDirectoryA(
+int cpath_test_path_normalize_with_normalized_base(
      void )
 {
-	BOOL result = FALSE;
+	char *test_paths[] = {
+		"user/test.txt",
+		"username/../user/test.txt",
+		"../user//test.txt",
+		"../../../user/test.txt",
+		"/home/user/../test.txt",
+		".",
+		"..",
+		"./" };
+	char *expected_paths[] = {
+		"/base/directory/user/test.txt",
+		"/base/directory/user/test.txt",
+		"/base/user/test.txt",
+		"/user/test.txt",
+		"/home/test.txt",
+		"/base/directory",
+		"/base",
+		"/base/directory" };
+
+	char normalized_path[ 64 ];
+
+	libcerror_error_t *error             = NULL;
+	size_t expected_path_length          = 0;
+	size_t required_normalized_path_size = 0;
+	int path_index                       = 0;
+	int result                           = 0;
 
 	/* Test regular cases
 	 */
+	for( path_index = 0;
+	     path_index < 8;
+	     path_index++ )
+	{
+		expected_path_length = narrow_string_length(
+		                        expected_paths[ path_index ] );
 
-	/* Test error cases
+		/* Determine the size only
+		 */
+		result = libcpath_path_normalize_with_normalized_base(
+		          "/base/directory",
+		          15,
+		          test_paths[ path_index ],
+		          narrow_string_length(
+		           test_paths[ path_index ] ),
+		          NULL,
+		          0,
+		          &required_normalized_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "required_normalized_path_size",
+		 required_normalized_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcpath_path_normalize_with_normalized_base(
+		          "/base/directory",
+		          15,
+		          test_paths[ path_index ],
+		          narrow_string_length(
+		           test_paths[ path_index ] ),
+		          normalized_path,
+		          64,
+		          &required_normalized_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare(
+		          normalized_path,
+		          expected_paths[ path_index ],
+		          expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test with the root directory as base path
 	 */
-	result = libcpath_CreateDirectoryA(
+	result = libcpath_path_normalize_with_normalized_base(
 	          NULL,
-	          NULL );
+	          0,
+	          "user/..",
+	          7,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 FALSE );
+	 1 );
 
-	result = libcpath_CreateDirectoryA(
-	          ".",
-	          NULL );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_normalized_path_size",
+	 required_normalized_path_size,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          normalized_path,
+	          "/",
+	          2 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 FALSE );
-
-	return( 1 );
+	 0 );
 
-on_error:
-	return( 0 );
-}
+	/* Test error cases
+	 */
+	result = libcpath_path_normalize_with_normalized_base(
+	          NULL,
+	          5,
+	          "user",
+	          4,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
+	          &error );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-/* Tests the libcpath_path_make_directory function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_make_directory(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_make_directory(
+	result = libcpath_path_normalize_with_normalized_base(
+	          "/base",
+	          5,
 	          NULL,
+	          0,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3499,107 +3522,52 @@ int cpath_test_path_make_directory(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
-
-/* Tests the libcpath_SetCurrentDirectoryW function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_SetCurrentDirectoryW(
-     void )
-{
-	BOOL result = FALSE;
-
-	/* Test regular cases
-	 */
-	result = libcpath_SetCurrentDirectoryW(
-	          L"." );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 TRUE );
-
-	/* Test error cases
-	 */
-	result = libcpath_SetCurrentDirectoryW(
-	          NULL );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 FALSE );
-
-	result = libcpath_SetCurrentDirectoryW(
-	          L"bogus" );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 FALSE );
-
-	return( 1 );
-
-on_error:
-	return( 0 );
-}
-
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
-
-/* Tests the libcpath_path_change_directory_wide function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_change_directory_wide(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libcpath_path_change_directory_wide(
-	          L".",
+	result = libcpath_path_normalize_with_normalized_base(
+	          "/base",
+	          5,
+	          "user",
+	          4,
+	          normalized_path,
+	          64,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_change_directory_wide(
-	          NULL,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_normalize_with_normalized_base(
+	          "/base",
+	          5,
+	          "user",
+	          4,
+	          normalized_path,
+	          5,
+	          &required_normalized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_normalized_path_size",
+	 required_normalized_path_size,
+	 (size_t) 11 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -3611,63 +3579,70 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI ) */
 
-/* Tests the libcpath_GetCurrentDirectoryW function
+/* Tests the libcpath_path_get_full_path function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_GetCurrentDirectoryW(
+int cpath_test_path_get_full_path(
      void )
 {
-	wchar_t buffer[ 256 ];
-
-	DWORD result = 0;
-
-	/* Test regular cases
-	 */
-	result = libcpath_GetCurrentDirectoryW(
-	          256,
-	          buffer );
-
-	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	result = libcpath_GetCurrentDirectoryW(
-	          0,
-	          NULL );
-
-	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	/* Test error cases
-	 */
-
-	return( 1 );
-
-on_error:
-	return( 0 );
-}
+#if defined( WINAPI )
+	char *absolute_paths[] = {
+		"\\home\\user\\test.txt",
+		"c:\\home\\user\\test.txt",
+		"c:\\home\\user\\\\test.txt",
+		"c:\\home\\username\\..\\user\\test.txt",
+		"c:\\..\\home\\user\\test.txt",
+		"c:\\..\\home\\username\\..\\user\\test.txt",
+	};
+	char *relative_paths[] = {
+		"user\\test.txt",
+		"username\\..\\user\\test.txt",
+	};
+	char *special_paths[] = {
+		"\\\\.\\PhysicalDrive0",
+		"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}"
+	};
+	char *unc_paths[] = {
+		"\\\\172.0.0.1\\C$\\test.txt",
+		"\\\\?\\UNC\\172.0.0.1\\C$\\test.txt",
+	};
+#else
+	char *absolute_paths[] = {
+		"/home/user/test.txt",
+		"/home/user//test.txt",
+		"/../home/user/test.txt",
+		"/../home/username/../user/test.txt",
+	};
+	char *relative_paths[] = {
+		"user/test.txt",
+		"username/../user/test.txt",
+	};
+#endif /* defined( WINAPI ) */
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+	char parent_directories_path[ 2048 ];
 
-/* Tests the libcpath_path_get_current_working_directory_wide function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_current_working_directory_wide(
-     void )
-{
-	libcerror_error_t *error              = NULL;
-	wchar_t *current_working_directory    = NULL;
-	size_t current_working_directory_size = 0;
-	int result                            = 0;
+	libcerror_error_t *error                = NULL;
+	char *current_working_directory         = NULL;
+	char *expected_path                     = NULL;
+	char *full_path                         = NULL;
+	char *path                              = NULL;
+	size_t current_working_directory_length = 0;
+	size_t current_working_directory_size   = 0;
+	size_t expected_full_path_length        = 0;
+	size_t expected_path_length             = 0;
+	size_t full_path_length                 = 0;
+	size_t full_path_size                   = 0;
+	size_t path_length                      = 0;
+	int depth                               = 0;
+	int path_index                          = 0;
+	int result                              = 0;
+	int string_index                        = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libcpath_path_get_current_working_directory_wide(
+	result = libcpath_path_get_current_working_directory(
 	          &current_working_directory,
 	          &current_working_directory_size,
 	          &error );
@@ -3681,188 +3656,233 @@ int cpath_test_path_get_current_working_directory_wide(
 	 "current_working_directory",
 	 current_working_directory );
 
-	memory_free(
-	 current_working_directory );
-
-	current_working_directory = NULL;
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	current_working_directory_length = narrow_string_length(
+	                                    current_working_directory );
+
+	/* Test regular cases
 	 */
-	result = libcpath_path_get_current_working_directory_wide(
-	          NULL,
-	          &current_working_directory_size,
-	          &error );
+#if defined( WINAPI )
+	expected_path = "\\\\?\\C:\\home\\user\\test.txt";
+#else
+	expected_path = "/home/user/test.txt";
+#endif
+	expected_path_length = narrow_string_length(
+	                        expected_path );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	for( path_index = 0;
+	     path_index < 4;
+	     path_index++ )
+	{
+		path = absolute_paths[ path_index ];
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		path_length = narrow_string_length(
+		               path );
 
-	libcerror_error_free(
-	 &error );
+		result = libcpath_path_get_full_path(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
 
-	current_working_directory = (wchar_t *) 0x12345678UL;
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	result = libcpath_path_get_current_working_directory_wide(
-	          &current_working_directory,
-	          &current_working_directory_size,
-	          &error );
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
 
-	current_working_directory = NULL;
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_path_length + 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	libcerror_error_free(
-	 &error );
+#if defined( WINAPI )
+		result = narrow_string_compare_no_case(
+		          full_path,
+		          expected_path,
+		          expected_path_length );
+#else
+		result = narrow_string_compare(
+		          full_path,
+		          expected_path,
+		          expected_path_length );
+#endif
 
-	result = libcpath_path_get_current_working_directory_wide(
-	          &current_working_directory,
-	          NULL,
-	          &error );
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		full_path_length = narrow_string_length(
+		                    full_path );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 full_path_length + 1 );
 
-	libcerror_error_free(
-	 &error );
+		memory_free(
+		 full_path );
 
-#if defined( HAVE_CPATH_TEST_MEMORY )
+		full_path = NULL;
+	}
+#if defined( WINAPI )
+	expected_path = "\\user\\test.txt";
+#else
+	expected_path = "/user/test.txt";
+#endif
+	expected_path_length = narrow_string_length(
+	                        expected_path );
 
-	/* Test libcpath_path_get_current_working_directory_wide with malloc failing
-	 */
-	cpath_test_malloc_attempts_before_fail = 0;
+	expected_full_path_length = current_working_directory_length + expected_path_length;
 
-	result = libcpath_path_get_current_working_directory_wide(
-	          &current_working_directory,
-	          &current_working_directory_size,
-	          &error );
+#if defined( WINAPI )
+	expected_full_path_length += 4;
+#endif
 
-	if( cpath_test_malloc_attempts_before_fail != -1 )
+	for( path_index = 0;
+	     path_index < 2;
+	     path_index++ )
 	{
-		cpath_test_malloc_attempts_before_fail = -1;
+		path = relative_paths[ path_index ];
 
-		if( current_working_directory != NULL )
-		{
-			memory_free(
-			 current_working_directory );
+		path_length = narrow_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
 
-			current_working_directory = NULL;
-		}
-	}
-	else
-	{
 		CPATH_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "current_working_directory",
-		 current_working_directory );
+		 1 );
 
 		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_full_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcpath_path_get_current_working_directory_wide with memset failing
-	 */
-	cpath_test_memset_attempts_before_fail = 0;
+#if defined( WINAPI )
+		/* A full path on Windows is prefixed with \\?\ while
+		 * the current working directory is not.
+		 */
+		result = narrow_string_compare_no_case(
+		          full_path,
+		          "\\\\?\\",
+		          4 );
 
-	result = libcpath_path_get_current_working_directory_wide(
-	          &current_working_directory,
-	          &current_working_directory_size,
-	          &error );
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-	if( cpath_test_memset_attempts_before_fail != -1 )
-	{
-		cpath_test_memset_attempts_before_fail = -1;
+		string_index = 4;
+#else
+		string_index = 0;
+#endif
+#if defined( WINAPI )
+		result = narrow_string_compare_no_case(
+		          &( full_path[ string_index ] ),
+		          current_working_directory,
+		          current_working_directory_length );
+#else
+		result = narrow_string_compare(
+		          &( full_path[ string_index ] ),
+		          current_working_directory,
+		          current_working_directory_length );
+#endif
 
-		if( current_working_directory != NULL )
-		{
-			memory_free(
-			 current_working_directory );
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+#if defined( WINAPI )
+		result = narrow_string_compare_no_case(
+		          &( full_path[ string_index + current_working_directory_length ] ),
+		          expected_path,
+		          expected_path_length );
+#else
+		result = narrow_string_compare(
+		          &( full_path[ string_index + current_working_directory_length ] ),
+		          expected_path,
+		          expected_path_length );
+#endif
 
-			current_working_directory = NULL;
-		}
-	}
-	else
-	{
 		CPATH_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 0 );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "current_working_directory",
-		 current_working_directory );
+		full_path_length = narrow_string_length(
+		                    full_path );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_length",
+		 full_path_length,
+		 expected_full_path_length );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+		memory_free(
+		 full_path );
 
-	return( 1 );
+		full_path = NULL;
+	}
+	/* Test a relative path of 256 nested directories followed by as many parent directories
+	 */
+	path_length = 0;
 
-on_error:
-	if( error != NULL )
+	for( depth = 0;
+	     depth < 256;
+	     depth++ )
 	{
-		libcerror_error_free(
-		 &error );
+		parent_directories_path[ path_length++ ] = 'd';
+		parent_directories_path[ path_length++ ] = LIBCPATH_SEPARATOR;
 	}
-	if( current_working_directory != NULL )
+	for( depth = 0;
+	     depth < 256;
+	     depth++ )
 	{
-		memory_free(
-		 current_working_directory );
+		parent_directories_path[ path_length++ ] = '.';
+		parent_directories_path[ path_length++ ] = '.';
+		parent_directories_path[ path_length++ ] = LIBCPATH_SEPARATOR;
 	}
-	return( 0 );
-}
-
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI )
-
-/* Tests the libcpath_path_get_path_type_wide function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_path_type_wide(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	uint8_t path_type        = 0;
-	int result               = 0;
+	if( narrow_string_copy(
+	     &( parent_directories_path[ path_length ] ),
+	     relative_paths[ 0 ],
+	     14 ) == NULL )
+	{
+		goto on_error;
+	}
+	path_length += 13;
 
-	/* Test regular cases
-	 */
-	result = libcpath_path_get_path_type_wide(
-	          L".",
-	          1,
-	          &path_type,
+	result = libcpath_path_get_full_path(
+	          parent_directories_path,
+	          path_length,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3870,159 +3890,374 @@ int cpath_test_path_get_path_type_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_RELATIVE );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path",
+	 full_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_size",
+	 full_path_size,
+	 expected_full_path_length + 1 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\",
-	          1,
-	          &path_type,
-	          &error );
+	full_path_length = narrow_string_length(
+	                    full_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_length",
+	 full_path_length,
+	 expected_full_path_length );
+
+#if defined( WINAPI )
+	result = narrow_string_compare_no_case(
+	          &( full_path[ full_path_length - expected_path_length ] ),
+	          expected_path,
+	          expected_path_length );
+#else
+	result = narrow_string_compare(
+	          &( full_path[ full_path_length - expected_path_length ] ),
+	          expected_path,
+	          expected_path_length );
+#endif
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_ABSOLUTE );
+	memory_free(
+	 full_path );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	full_path = NULL;
 
-	result = libcpath_path_get_path_type_wide(
-	          L"c:",
-	          2,
-	          &path_type,
+#if defined( WINAPI )
+/* TODO make changes to have test pass
+	for( path_index = 0;
+	     path_index < 2;
+	     path_index++ )
+	{
+		path = special_paths[ path_index ];
+
+		path_length = narrow_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare_no_case(
+		          full_path,
+		          expected_path,
+		          expected_path_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		full_path_length = narrow_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_length",
+		 full_path_length,
+		 path_length );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+*/
+	expected_path = "\\\\?\\UNC\\172.0.0.1\\C$\\test.txt";
+
+	expected_path_length = narrow_string_length(
+	                        expected_path );
+
+	for( path_index = 0;
+	     path_index < 2;
+	     path_index++ )
+	{
+		path = unc_paths[ path_index ];
+
+		path_length = narrow_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare_no_case(
+		          full_path,
+		          expected_path,
+		          expected_path_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		full_path_length = narrow_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_length",
+		 full_path_length,
+		 expected_path_length );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+#endif /* defined( WINAPI ) */
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_path(
+	          NULL,
+	          8,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_RELATIVE );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"C:\\Windows",
-	          10,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          0,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_ABSOLUTE );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\server\\share\\directory",
-	          24,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          (size_t) -1,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_UNC );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
-	          48,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          8,
+	          NULL,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_EXTENDED_LENGTH );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\.\\PhysicalDrive0",
-	          18,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	full_path = (char *) 0x12345678UL;
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
+	full_path = NULL;
+
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_DEVICE );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\.\\C:",
-	          6,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          8,
+	          &full_path,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_DEVICE );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\.\\C:\\",
-	          7,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
+
+	/* Test libcpath_path_change_directory with getcwd failing
+	 */
+	cpath_test_getcwd_attempts_before_fail = 0;
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	if( cpath_test_getcwd_attempts_before_fail != -1 )
+	{
+		cpath_test_getcwd_attempts_before_fail = -1;
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+
+	/* Clean up
+	 */
+	memory_free(
+	 current_working_directory );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
+
+#if !defined( WINAPI )
+
+/* Tests the libcpath_path_get_full_path_context function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_path_context(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libcpath_context_t *context = NULL;
+	char *full_path             = NULL;
+	size_t full_path_size       = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_context_initialize(
+	          &context,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4030,19 +4265,19 @@ int cpath_test_path_get_path_type_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_DEVICE );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\?\\C:\\Windows",
-	          14,
-	          &path_type,
+	result = libcpath_context_set_working_directory(
+	          context,
+	          "/nonexistent/base",
+	          17,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4050,19 +4285,18 @@ int cpath_test_path_get_path_type_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_EXTENDED_LENGTH );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\?\\UNC\\server\\share\\directory",
-	          30,
-	          &path_type,
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_full_path_context(
+	          context,
+	          "user/../test.txt",
+	          16,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4070,57 +4304,80 @@ int cpath_test_path_get_path_type_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_EXTENDED_LENGTH_UNC );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path",
+	 full_path );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_get_path_type_wide(
-	          NULL,
-	          1,
-	          &path_type,
-	          &error );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_size",
+	 full_path_size,
+	 (size_t) 27 );
+
+	result = memory_compare(
+	          full_path,
+	          "/nonexistent/base/test.txt",
+	          27 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	memory_free(
+	 full_path );
 
-	libcerror_error_free(
-	 &error );
+	full_path = NULL;
 
-	result = libcpath_path_get_path_type_wide(
-	          L".",
-	          0,
-	          &path_type,
+	/* An absolute path is not affected by the working directory of the context
+	 */
+	result = libcpath_path_get_full_path_context(
+	          context,
+	          "/home/user/test.txt",
+	          19,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path",
+	 full_path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = memory_compare(
+	          full_path,
+	          "/home/user/test.txt",
+	          20 );
 
-	result = libcpath_path_get_path_type_wide(
-	          L".",
-	          (size_t) SSIZE_MAX + 1,
-	          &path_type,
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_path_context(
+	          NULL,
+	          "user/../test.txt",
+	          16,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4135,24 +4392,21 @@ int cpath_test_path_get_path_type_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L".",
-	          1,
-	          NULL,
+	/* Clean up
+	 */
+	result = libcpath_context_free(
+	          &context,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -4161,29 +4415,43 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( context != NULL )
+	{
+		libcpath_context_free(
+		 &context,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libcpath_path_get_volume_name_wide function
+#endif /* !defined( WINAPI ) */
+
+/* Tests the libcpath_path_get_full_path_to_buffer function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_volume_name_wide(
+int cpath_test_path_get_full_path_to_buffer(
      void )
 {
-	libcerror_error_t *error    = NULL;
-	wchar_t *volume_name        = NULL;
-	size_t directory_name_index = 0;
-	size_t volume_name_length   = 0;
-	int result                  = 0;
+	char buffer[ 1024 ];
 
-	/* Test regular cases
+	libcerror_error_t *error = NULL;
+	char *expected           = NULL;
+	size_t expected_size     = 0;
+	size_t required_size     = 0;
+	int result               = 0;
+
+	/* Initialize test
 	 */
-	result = libcpath_path_get_volume_name_wide(
-	          L".",
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          8,
+	          &expected,
+	          &expected_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4191,26 +4459,18 @@ int cpath_test_path_get_volume_name_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 0 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 0 );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\",
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_full_path_to_buffer(
+	          "test.txt",
+	          8,
+	          buffer,
+	          1024,
+	          &required_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4218,194 +4478,171 @@ int cpath_test_path_get_volume_name_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "volume_name",
-	 volume_name );
-
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 0 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 0 );
+	 "required_size",
+	 required_size,
+	 expected_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"c:",
-	          2,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
-	          &error );
+	result = narrow_string_compare(
+	          buffer,
+	          expected,
+	          expected_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
+	result = libcpath_path_get_full_path_to_buffer(
+	          "test.txt",
+	          8,
+	          buffer,
+	          expected_size - 1,
+	          &required_size,
+	          &error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 2 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 2 );
+	 "required_size",
+	 required_size,
+	 expected_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"c:",
-	          2 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	result = libcpath_path_get_volume_name_wide(
-	          L"C:\\Windows",
-	          10,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_full_path_to_buffer(
+	          "test.txt",
+	          8,
+	          NULL,
+	          0,
+	          &required_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 2 );
+	 0 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 3 );
+	 "required_size",
+	 required_size,
+	 expected_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"C:",
-	          2 );
+	/* Clean up
+	 */
+	memory_free(
+	 expected );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	expected = NULL;
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\server\\share\\directory",
-	          24,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_path_to_buffer(
+	          "test.txt",
+	          8,
+	          NULL,
+	          1024,
+	          &required_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 12 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 15 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"server\\share",
-	          12 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	libcerror_error_free(
+	 &error );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
-	          48,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_full_path_to_buffer(
+	          "test.txt",
+	          8,
+	          buffer,
+	          1024,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
+	 "error",
+	 error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 44 );
+	libcerror_error_free(
+	 &error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 48 );
+	return( 1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	return( 0 );
+}
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
-	          44 );
+/* Tests the libcpath_path_get_full_path_arena function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_path_arena(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libcpath_arena_t *arena               = NULL;
+	char *current_working_directory       = NULL;
+	char *expected                        = NULL;
+	char *full_path                       = NULL;
+	size_t current_working_directory_size = 0;
+	size_t expected_size                  = 0;
+	size_t full_path_size                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\.\\PhysicalDrive0",
-	          18,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_full_path(
+	          "test_file.txt",
+	          13,
+	          &expected,
+	          &expected_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4413,40 +4650,35 @@ int cpath_test_path_get_volume_name_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 14 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 18 );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"PhysicalDrive0",
-	          14 );
+	/* Use a chunk size smaller than the full path to test growth of the arena
+	 */
+	result = libcpath_arena_initialize(
+	          &arena,
+	          8,
+	          LIBCPATH_ARENA_FLAG_ALLOW_GROWTH,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\.\\C:",
-	          6,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_full_path_arena(
+	          arena,
+	          "test_file.txt",
+	          13,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4455,204 +4687,105 @@ int cpath_test_path_get_volume_name_wide(
 	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 2 );
+	 "full_path",
+	 full_path );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 6 );
+	 "full_path_size",
+	 full_path_size,
+	 expected_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"C:",
-	          2 );
+	result = narrow_string_compare(
+	          full_path,
+	          expected,
+	          expected_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\.\\C:\\",
-	          7,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && !defined( WINAPI )
+
+	/* Test if a change of directory to a longer directory, while the full path
+	 * is determined, results in the full path of the new directory
+	 */
+	result = chdir(
+	          "/" );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	cpath_test_getcwd_change_directory = current_working_directory;
+
+	full_path = NULL;
+
+	result = libcpath_path_get_full_path_arena(
+	          arena,
+	          "test_file.txt",
+	          13,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
+	cpath_test_getcwd_change_directory = NULL;
+
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 2 );
+	 "full_path",
+	 full_path );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 7 );
+	 "full_path_size",
+	 full_path_size,
+	 expected_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"C:",
-	          2 );
+	result = narrow_string_compare(
+	          full_path,
+	          expected,
+	          expected_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\?\\C:\\Windows",
-	          14,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
-	          &error );
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && !defined( WINAPI ) */
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 2 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 7 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = wide_string_compare(
-	          volume_name,
-	          L"C:",
-	          2 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\?\\UNC\\server\\share\\directory",
-	          30,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 12 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 21 );
+	/* Clean up
+	 */
+	memory_free(
+	 expected );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	expected = NULL;
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"server\\share",
-	          12 );
+	memory_free(
+	 current_working_directory );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	current_working_directory = NULL;
 
 	/* Test error cases
 	 */
-	result = libcpath_path_get_volume_name_wide(
+	result = libcpath_path_get_full_path_arena(
 	          NULL,
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_volume_name_wide(
-	          L".",
-	          0,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_volume_name_wide(
-	          L".",
-	          (size_t) SSIZE_MAX + 1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	          "test_file.txt",
+	          13,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4667,12 +4800,12 @@ int cpath_test_path_get_volume_name_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L".",
-	          1,
+	result = libcpath_path_get_full_path_arena(
+	          arena,
+	          "test_file.txt",
+	          13,
 	          NULL,
-	          &volume_name_length,
-	          &directory_name_index,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4687,12 +4820,12 @@ int cpath_test_path_get_volume_name_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L".",
-	          1,
-	          &volume_name,
+	result = libcpath_path_get_full_path_arena(
+	          arena,
+	          "test_file.txt",
+	          13,
+	          &full_path,
 	          NULL,
-	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4707,26 +4840,25 @@ int cpath_test_path_get_volume_name_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L".",
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          NULL,
+	/* Clean up
+	 */
+	result = libcpath_arena_free(
+	          &arena,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -4735,25 +4867,65 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	if( current_working_directory != NULL )
+	{
+		chdir(
+		 current_working_directory );
+
+		memory_free(
+		 current_working_directory );
+	}
 	return( 0 );
 }
 
-/* Tests the libcpath_path_get_current_working_directory_by_volume_wide function
+#if !defined( WINAPI )
+
+/* Tests the libcpath_path_get_full_path functions with a current working directory that exceeds PATH_MAX
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_current_working_directory_by_volume_wide(
+int cpath_test_path_get_full_path_with_deep_directory(
      void )
 {
-	libcerror_error_t *error              = NULL;
-	wchar_t *current_working_directory    = NULL;
-	size_t current_working_directory_size = 0;
-	int result                            = 0;
+	char deep_directory_name[ 32 ]          = "cpath_test_XXXXXX";
+	const char *paths[ 2 ]                  = { "test.txt", "/test.txt" };
+	size_t path_lengths[ 2 ]                = { 8, 9 };
 
-	/* Test regular cases
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	const wchar_t *wide_paths[ 2 ]          = { L"test.txt", L"/test.txt" };
+	wchar_t *expected_wide                  = NULL;
+	wchar_t *full_path_wide                 = NULL;
+	wchar_t *full_paths_wide                = NULL;
+#endif
+
+	libcerror_error_t *error                = NULL;
+	libcpath_arena_t *arena                 = NULL;
+	char *current_working_directory         = NULL;
+	char *expected                          = NULL;
+	char *full_path                         = NULL;
+	char *full_paths                        = NULL;
+	size_t *full_path_offsets               = NULL;
+	size_t current_working_directory_size   = 0;
+	size_t expected_size                    = 0;
+	size_t full_path_size                   = 0;
+	size_t full_paths_size                  = 0;
+	size_t required_size                    = 0;
+	int deep_directory_created              = 0;
+	int result                              = 0;
+
+	/* Initialize test
 	 */
-	result = libcpath_path_get_current_working_directory_by_volume_wide(
-	          L"C:",
-	          2,
+	result = libcpath_path_get_current_working_directory(
 	          &current_working_directory,
 	          &current_working_directory_size,
 	          &error );
@@ -4767,139 +4939,114 @@ int cpath_test_path_get_current_working_directory_by_volume_wide(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_get_current_working_directory_by_volume_wide(
-	          L"C:",
-	          (size_t) SSIZE_MAX + 1,
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_arena_initialize(
+	          &arena,
+	          8,
+	          LIBCPATH_ARENA_FLAG_ALLOW_GROWTH,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	deep_directory_created = 1;
 
-	result = libcpath_path_get_current_working_directory_by_volume_wide(
-	          L"C:",
-	          2,
-	          NULL,
-	          &current_working_directory_size,
+	result = cpath_test_path_enter_deep_directory(
+	          deep_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          8,
+	          &expected,
+	          &expected_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_current_working_directory_by_volume_wide(
-	          L"C:",
-	          2,
-	          &current_working_directory,
+	/* Test libcpath_path_get_full_path_to_buffer
+	 */
+	result = libcpath_path_get_full_path_to_buffer(
+	          "test.txt",
+	          8,
 	          NULL,
+	          0,
+	          &required_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* Test libcpath_path_get_full_path_arena
+	 */
+	result = libcpath_path_get_full_path_arena(
+	          arena,
+	          "test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
 
-	return( 1 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_size",
+	 full_path_size,
+	 expected_size );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) */
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libcpath_path_get_full_path_wide function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_full_path_wide(
-     void )
-{
-#if defined( WINAPI )
-	wchar_t *absolute_paths[] = {
-		L"\\home\\user\\test.txt",
-		L"c:\\home\\user\\test.txt",
-		L"c:\\home\\user\\\\test.txt",
-		L"c:\\home\\username\\..\\user\\test.txt",
-		L"c:\\..\\home\\user\\test.txt",
-		L"c:\\..\\home\\username\\..\\user\\test.txt",
-	};
-	wchar_t *relative_paths[] = {
-		L"user\\test.txt",
-		L"username\\..\\user\\test.txt",
-	};
-	wchar_t *special_paths[] = {
-		L"\\\\.\\PhysicalDrive0",
-		L"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}"
-	};
-	wchar_t *unc_paths[] = {
-		L"\\\\172.0.0.1\\C$\\test.txt",
-		L"\\\\?\\UNC\\172.0.0.1\\C$\\test.txt",
-	};
-#else
-	wchar_t *absolute_paths[] = {
-		L"/home/user/test.txt",
-		L"/home/user//test.txt",
-		L"/../home/user/test.txt",
-		L"/../home/username/../user/test.txt",
-	};
-	wchar_t *relative_paths[] = {
-		L"user/test.txt",
-		L"username/../user/test.txt",
-	};
-#endif /* defined( WINAPI ) */
+	result = narrow_string_compare(
+	          full_path,
+	          expected,
+	          expected_size );
 
-	libcerror_error_t *error                = NULL;
-	wchar_t *current_working_directory      = NULL;
-	wchar_t *expected_path                  = NULL;
-	wchar_t *full_path                      = NULL;
-	wchar_t *path                           = NULL;
-	size_t current_working_directory_length = 0;
-	size_t current_working_directory_size   = 0;
-	size_t expected_full_path_length        = 0;
-	size_t expected_path_length             = 0;
-	size_t full_path_length                 = 0;
-	size_t full_path_size                   = 0;
-	size_t path_length                      = 0;
-	int path_index                          = 0;
-	int result                              = 0;
-	int string_index                        = 0;
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	/* Initialize test
+	/* Test libcpath_path_get_full_paths
 	 */
-	result = libcpath_path_get_current_working_directory_wide(
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_path_get_full_paths(
+	          paths,
+	          path_lengths,
+	          2,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4907,283 +5054,324 @@ int cpath_test_path_get_full_path_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "current_working_directory",
-	 current_working_directory );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_paths_size",
+	 full_paths_size,
+	 expected_size + 10 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	current_working_directory_length = wide_string_length(
-	                                    current_working_directory );
+	result = narrow_string_compare(
+	          full_paths,
+	          expected,
+	          expected_size );
 
-	/* Test regular cases
-	 */
-#if defined( WINAPI )
-	expected_path = L"\\\\?\\C:\\home\\user\\test.txt";
-#else
-	expected_path = L"/home/user/test.txt";
-#endif
-	expected_path_length = wide_string_length(
-	                        expected_path );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	for( path_index = 0;
-	     path_index < 4;
-	     path_index++ )
-	{
-		path = absolute_paths[ path_index ];
+	memory_free(
+	 full_paths );
 
-		path_length = wide_string_length(
-		               path );
+	full_paths = NULL;
 
-		result = libcpath_path_get_full_path_wide(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+	memory_free(
+	 full_path_offsets );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	full_path_offsets = NULL;
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 expected_path_length + 1 );
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          8,
+	          &expected_wide,
+	          &expected_size,
+	          &error );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		full_path_length = wide_string_length(
-		                    full_path );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 full_path_length + 1 );
+	/* Test libcpath_path_get_full_path_to_buffer_wide
+	 */
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          L"test.txt",
+	          8,
+	          NULL,
+	          0,
+	          &required_size,
+	          &error );
 
-#if defined( WINAPI )
-		result = wide_string_compare_no_case(
-		          full_path,
-		          expected_path,
-		          expected_path_length );
-#else
-		result = wide_string_compare(
-		          full_path,
-		          expected_path,
-		          expected_path_length );
-#endif
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
 
-		memory_free(
-		 full_path );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		full_path = NULL;
-	}
-#if defined( WINAPI )
-	expected_path = L"\\user\\test.txt";
-#else
-	expected_path = L"/user/test.txt";
-#endif
-	expected_path_length = wide_string_length(
-	                        expected_path );
+	/* Test libcpath_path_get_full_path_arena_wide
+	 */
+	result = libcpath_path_get_full_path_arena_wide(
+	          arena,
+	          L"test.txt",
+	          8,
+	          &full_path_wide,
+	          &full_path_size,
+	          &error );
 
-	expected_full_path_length = current_working_directory_length + expected_path_length;
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#if defined( WINAPI )
-	expected_full_path_length += 4;
-#endif
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_size",
+	 full_path_size,
+	 expected_size );
 
-	for( path_index = 0;
-	     path_index < 2;
-	     path_index++ )
-	{
-		path = relative_paths[ path_index ];
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		path_length = wide_string_length(
-		               path );
+	result = wide_string_compare(
+	          full_path_wide,
+	          expected_wide,
+	          expected_size );
 
-		result = libcpath_path_get_full_path_wide(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	/* Test libcpath_path_get_full_paths_wide
+	 */
+	result = libcpath_path_get_full_paths_wide(
+	          wide_paths,
+	          path_lengths,
+	          2,
+	          &full_paths_wide,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 expected_full_path_length + 1 );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_paths_size",
+	 full_paths_size,
+	 expected_size + 10 );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-#if defined( WINAPI )
-		/* A full path on Windows is prefixed with \\?\ while
-		 * the current working directory is not.
-		 */
-		result = wide_string_compare_no_case(
-		          full_path,
-		          L"\\\\?\\",
-		          4 );
+	result = wide_string_compare(
+	          full_paths_wide,
+	          expected_wide,
+	          expected_size );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		string_index = 4;
-#else
-		string_index = 0;
-#endif
-#if defined( WINAPI )
-		result = wide_string_compare_no_case(
-		          &( full_path[ string_index ] ),
-		          current_working_directory,
-		          current_working_directory_length );
-#else
-		result = wide_string_compare(
-		          &( full_path[ string_index ] ),
-		          current_working_directory,
-		          current_working_directory_length );
-#endif
-
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	memory_free(
+	 full_paths_wide );
 
-#if defined( WINAPI )
-		result = wide_string_compare_no_case(
-		          &( full_path[ string_index + current_working_directory_length ] ),
-		          expected_path,
-		          expected_path_length );
-#else
-		result = wide_string_compare(
-		          &( full_path[ string_index + current_working_directory_length ] ),
-		          expected_path,
-		          expected_path_length );
-#endif
+	full_paths_wide = NULL;
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	memory_free(
+	 full_path_offsets );
 
-		full_path_length = wide_string_length(
-		                    full_path );
+	full_path_offsets = NULL;
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_length",
-		 full_path_length,
-		 expected_full_path_length );
+	memory_free(
+	 expected_wide );
 
-		memory_free(
-		 full_path );
+	expected_wide = NULL;
 
-		full_path = NULL;
-	}
-#if defined( WINAPI )
-/* TODO make changes to have test pass
-	for( path_index = 0;
-	     path_index < 2;
-	     path_index++ )
-	{
-		path = special_paths[ path_index ];
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-		path_length = wide_string_length(
-		               path );
+	/* Clean up
+	 */
+	memory_free(
+	 expected );
 
-		result = libcpath_path_get_full_path_wide(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+	expected = NULL;
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	result = cpath_test_path_leave_deep_directory(
+	          deep_directory_name,
+	          current_working_directory );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
+	deep_directory_created = 0;
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 path_length + 1 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
 
-		result = wide_string_compare_no_case(
-		          full_path,
-		          expected_path,
-		          expected_path_length );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		full_path_length = wide_string_length(
-		                    full_path );
+	memory_free(
+	 current_working_directory );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_length",
-		 full_path_length,
-		 path_length );
+	return( 1 );
 
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( full_paths_wide != NULL )
+	{
 		memory_free(
-		 full_path );
-
-		full_path = NULL;
+		 full_paths_wide );
 	}
-*/
-	expected_path = L"\\\\?\\UNC\\172.0.0.1\\C$\\test.txt";
+	if( expected_wide != NULL )
+	{
+		memory_free(
+		 expected_wide );
+	}
+#endif
+	if( full_path_offsets != NULL )
+	{
+		memory_free(
+		 full_path_offsets );
+	}
+	if( full_paths != NULL )
+	{
+		memory_free(
+		 full_paths );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	if( current_working_directory != NULL )
+	{
+		if( deep_directory_created != 0 )
+		{
+			cpath_test_path_leave_deep_directory(
+			 deep_directory_name,
+			 current_working_directory );
+		}
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
 
-	expected_path_length = wide_string_length(
-	                        expected_path );
+#endif /* !defined( WINAPI ) */
+
+/* Tests the libcpath_path_get_full_paths function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_paths(
+     void )
+{
+	const char *test_paths[] = {
+		"test.txt",
+		"../test.txt",
+		"/home/user/../test.txt",
+		"directory/./test.txt" };
+
+	size_t path_lengths[ 4 ];
 
+	libcerror_error_t *error  = NULL;
+	char *expected            = NULL;
+	char *full_paths          = NULL;
+	size_t *full_path_offsets = NULL;
+	size_t expected_offset    = 0;
+	size_t expected_size      = 0;
+	size_t full_paths_size    = 0;
+	int path_index            = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
 	for( path_index = 0;
-	     path_index < 2;
+	     path_index < 4;
 	     path_index++ )
 	{
-		path = unc_paths[ path_index ];
+		path_lengths[ path_index ] = narrow_string_length(
+		                              test_paths[ path_index ] );
+	}
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_full_paths(
+	          test_paths,
+	          path_lengths,
+	          4,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
 
-		path_length = wide_string_length(
-		               path );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		result = libcpath_path_get_full_path_wide(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_paths",
+	 full_paths );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path_offsets",
+	 full_path_offsets );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( path_index = 0;
+	     path_index < 4;
+	     path_index++ )
+	{
+		result = libcpath_path_get_full_path(
+		          test_paths[ path_index ],
+		          path_lengths[ path_index ],
+		          &expected,
+		          &expected_size,
 		          &error );
 
 		CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5191,51 +5379,10358 @@ int cpath_test_path_get_full_path_wide(
 		 result,
 		 1 );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 expected_path_length + 1 );
-
 		CPATH_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		result = wide_string_compare_no_case(
-		          full_path,
-		          expected_path,
-		          expected_path_length );
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_offsets[ path_index ]",
+		 full_path_offsets[ path_index ],
+		 expected_offset );
+
+		result = narrow_string_compare(
+		          &( full_paths[ full_path_offsets[ path_index ] ] ),
+		          expected,
+		          expected_size );
 
 		CPATH_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
 		 0 );
 
-		full_path_length = wide_string_length(
-		                    full_path );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_length",
-		 full_path_length,
-		 expected_path_length );
+		expected_offset += expected_size;
 
 		memory_free(
-		 full_path );
+		 expected );
 
-		full_path = NULL;
+		expected = NULL;
 	}
-#endif /* defined( WINAPI ) */
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_paths_size",
+	 full_paths_size,
+	 expected_offset );
+
+	memory_free(
+	 full_paths );
+
+	full_paths = NULL;
+
+	memory_free(
+	 full_path_offsets );
+
+	full_path_offsets = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_paths(
+	          NULL,
+	          path_lengths,
+	          4,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths(
+	          test_paths,
+	          NULL,
+	          4,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths(
+	          test_paths,
+	          path_lengths,
+	          0,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths(
+	          test_paths,
+	          path_lengths,
+	          4,
+	          NULL,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths(
+	          test_paths,
+	          path_lengths,
+	          4,
+	          &full_paths,
+	          NULL,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths(
+	          test_paths,
+	          path_lengths,
+	          4,
+	          &full_paths,
+	          &full_paths_size,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_lengths[ 1 ] = 0;
+
+	result = libcpath_path_get_full_paths(
+	          test_paths,
+	          path_lengths,
+	          4,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "full_paths",
+	 full_paths );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "full_path_offsets",
+	 full_path_offsets );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	if( full_paths != NULL )
+	{
+		memory_free(
+		 full_paths );
+	}
+	if( full_path_offsets != NULL )
+	{
+		memory_free(
+		 full_path_offsets );
+	}
+	return( 0 );
+}
+
+#if !defined( WINAPI )
+
+/* Tests the libcpath_path_get_full_path_with_base function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_path_with_base(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	char *full_path          = NULL;
+	size_t full_path_size    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_full_path_with_base(
+	          "/nonexistent/base",
+	          17,
+	          "user/../test.txt",
+	          16,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path",
+	 full_path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_size",
+	 full_path_size,
+	 (size_t) 27 );
+
+	result = memory_compare(
+	          full_path,
+	          "/nonexistent/base/test.txt",
+	          27 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	/* A parent directory segment can refer to a directory outside the base path
+	 */
+	result = libcpath_path_get_full_path_with_base(
+	          "/nonexistent/base",
+	          17,
+	          "../test.txt",
+	          11,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path",
+	 full_path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          full_path,
+	          "/nonexistent/test.txt",
+	          22 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	/* An absolute path is not affected by the base path
+	 */
+	result = libcpath_path_get_full_path_with_base(
+	          "/nonexistent/base",
+	          17,
+	          "/home/user/test.txt",
+	          19,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path",
+	 full_path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          full_path,
+	          "/home/user/test.txt",
+	          20 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_path_with_base(
+	          NULL,
+	          17,
+	          "user/../test.txt",
+	          16,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_with_base(
+	          "nonexistent/base",
+	          16,
+	          "user/../test.txt",
+	          16,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_with_base(
+	          "/nonexistent/base",
+	          17,
+	          NULL,
+	          16,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_with_base(
+	          "/nonexistent/base",
+	          17,
+	          "user/../test.txt",
+	          16,
+	          NULL,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_normalize_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_normalize_to_buffer(
+     void )
+{
+	char *test_paths[] = {
+		"/home/user/test.txt",
+		"//home/./user//test.txt/",
+		"/../home/user/test.txt",
+		"/home/..",
+		"a/../b",
+		"a/..",
+		".",
+		"../a",
+		"../../a/../b/./c",
+		"a/b/../../..",
+		"./a/" };
+	char *expected_paths[] = {
+		"/home/user/test.txt",
+		"/home/user/test.txt",
+		"/home/user/test.txt",
+		"/",
+		"b",
+		".",
+		".",
+		"../a",
+		"../../b/c",
+		"..",
+		"a" };
+
+	char normalized_path[ 64 ];
+
+	libcerror_error_t *error             = NULL;
+	size_t expected_path_length          = 0;
+	size_t required_normalized_path_size = 0;
+	int path_index                       = 0;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	for( path_index = 0;
+	     path_index < 11;
+	     path_index++ )
+	{
+		expected_path_length = narrow_string_length(
+		                        expected_paths[ path_index ] );
+
+		/* Determine the size only
+		 */
+		result = libcpath_path_normalize_to_buffer(
+		          test_paths[ path_index ],
+		          narrow_string_length(
+		           test_paths[ path_index ] ),
+		          NULL,
+		          0,
+		          &required_normalized_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "required_normalized_path_size",
+		 required_normalized_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcpath_path_normalize_to_buffer(
+		          test_paths[ path_index ],
+		          narrow_string_length(
+		           test_paths[ path_index ] ),
+		          normalized_path,
+		          64,
+		          &required_normalized_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "required_normalized_path_size",
+		 required_normalized_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare(
+		          normalized_path,
+		          expected_paths[ path_index ],
+		          expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libcpath_path_normalize_to_buffer(
+	          NULL,
+	          6,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_normalize_to_buffer(
+	          "a/../b",
+	          0,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_normalize_to_buffer(
+	          "a/../b",
+	          6,
+	          NULL,
+	          64,
+	          &required_normalized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_normalize_to_buffer(
+	          "a/../b",
+	          6,
+	          normalized_path,
+	          64,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_normalize function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_normalize(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	char *normalized_path       = NULL;
+	size_t normalized_path_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_normalize(
+	          "../a/./b/../c",
+	          13,
+	          &normalized_path,
+	          &normalized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "normalized_path",
+	 normalized_path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "normalized_path_size",
+	 normalized_path_size,
+	 (size_t) 7 );
+
+	result = memory_compare(
+	          normalized_path,
+	          "../a/c",
+	          7 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 normalized_path );
+
+	normalized_path = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_normalize(
+	          "../a/./b/../c",
+	          13,
+	          NULL,
+	          &normalized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_normalize(
+	          "../a/./b/../c",
+	          13,
+	          &normalized_path,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( normalized_path != NULL )
+	{
+		memory_free(
+		 normalized_path );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) */
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+/* Tests the libcpath_path_get_sanitized_character_size function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_character_size(
+     void )
+{
+	char test_characters[ 6 ] = {
+		'|', ':', 0x7f, '/', (char) 0xe4, '~' };
+
+	size_t expected_sizes[ 6 ] = {
+#if defined( WINAPI )
+		4, 4, 4, 4, 1, 1 };
+#else
+		4, 4, 4, 1, 1, 1 };
+#endif
+
+	libcerror_error_t *error        = NULL;
+	size_t sanitized_character_size = 0;
+	int character_index             = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_sanitized_character_size(
+	          (char) 0,
+	          &sanitized_character_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_character_size(
+	          LIBCPATH_ESCAPE_CHARACTER,
+	          &sanitized_character_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_character_size(
+	          '!',
+	          &sanitized_character_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_character_size(
+	          'A',
+	          &sanitized_character_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( character_index = 0;
+	     character_index < 6;
+	     character_index++ )
+	{
+		result = libcpath_path_get_sanitized_character_size(
+		          test_characters[ character_index ],
+		          &sanitized_character_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "sanitized_character_size",
+		 sanitized_character_size,
+		 expected_sizes[ character_index ] );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_character_size(
+	          'A',
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_character function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_character(
+     void )
+{
+	char sanitized_path[ 32 ];
+
+	libcerror_error_t *error      = NULL;
+	char *expected_sanitized_path = NULL;
+	size_t sanitized_path_index   = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character(
+	          (char) 0,
+	          4,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI )
+	expected_sanitized_path = "^x00";
+#else
+	expected_sanitized_path = "\\x00";
+#endif
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_sanitized_path,
+	          4 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character(
+	          LIBCPATH_ESCAPE_CHARACTER,
+	          2,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI )
+	expected_sanitized_path = "^^";
+#else
+	expected_sanitized_path = "\\\\";
+#endif
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_sanitized_path,
+	          2 );
+
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character(
+	          'A',
+	          1,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          "A",
+	          1 );
+
+	/* Test error cases
+	 */
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character(
+	          'A',
+	          8,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_character(
+	          'A',
+	          1,
+	          NULL,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_character(
+	          'A',
+	          1,
+	          sanitized_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_character(
+	          'A',
+	          1,
+	          sanitized_path,
+	          32,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sanitized_path_index = 32;
+
+	result = libcpath_path_get_sanitized_character(
+	          'A',
+	          1,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 32 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+/* Tests the libcpath_path_get_sanitized_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_filename(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	char *expected_filename        = NULL;
+	char *sanitized_filename       = NULL;
+	char *test_filename            = NULL;
+	size_t expected_filename_size  = 0;
+	size_t sanitized_filename_size = 0;
+	size_t test_filename_length    = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	/* Test libcpath_path_get_sanitized_filename without replacement characters
+	 */
+	test_filename          = "test.txt";
+	test_filename_length   = 8;
+	expected_filename      = "test.txt";
+	expected_filename_size = 9;
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_filename",
+	 sanitized_filename );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_filename_size",
+	 sanitized_filename_size,
+	 expected_filename_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_filename,
+	          expected_filename,
+	          expected_filename_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_filename );
+
+	sanitized_filename      = NULL;
+	sanitized_filename_size = 0;
+
+	/* Test libcpath_path_get_sanitized_filename with replacement characters
+	 */
+#if defined( WINAPI )
+	test_filename          = "t\x00sT!.t^|";
+	test_filename_length   = 9;
+	expected_filename      = "t^x00sT^x21.t^^^x7c";
+	expected_filename_size = 20;
+#else
+	test_filename          = "t\x00sT!.t\\|";
+	test_filename_length   = 9;
+	expected_filename      = "t\\x00sT\\x21.t\\\\\\x7c";
+	expected_filename_size = 20;
+#endif
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_filename",
+	 sanitized_filename );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_filename_size",
+	 sanitized_filename_size,
+	 expected_filename_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_filename,
+	          expected_filename,
+	          expected_filename_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_filename );
+
+	sanitized_filename      = NULL;
+	sanitized_filename_size = 0;
+
+	/* Test error cases
+	 */
+	test_filename          = "test.txt";
+	test_filename_length   = 8;
+	expected_filename      = "test.txt";
+	expected_filename_size = 9;
+
+	result = libcpath_path_get_sanitized_filename(
+	          NULL,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          (size_t) -1,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          test_filename_length,
+	          NULL,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sanitized_filename = (char *) 0x12345678UL;
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	sanitized_filename = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	/* Test libcpath_path_get_sanitized_filename with malloc failing
+	 */
+	cpath_test_malloc_attempts_before_fail = 0;
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	if( cpath_test_malloc_attempts_before_fail != -1 )
+	{
+		cpath_test_malloc_attempts_before_fail = -1;
+
+		if( sanitized_filename != NULL )
+		{
+			memory_free(
+			 sanitized_filename );
+
+			sanitized_filename = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "sanitized_filename",
+		 sanitized_filename );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "sanitized_filename_size",
+		 sanitized_filename_size,
+		 (size_t) 0 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( sanitized_filename != NULL )
+	{
+		memory_free(
+		 sanitized_filename );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_filename_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_filename_to_buffer(
+     void )
+{
+	char buffer[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	char *expected           = NULL;
+	size_t expected_size     = 0;
+	size_t required_size     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_sanitized_filename(
+	          "te:st/name",
+	          10,
+	          &expected,
+	          &expected_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          "te:st/name",
+	          10,
+	          buffer,
+	          256,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          buffer,
+	          expected,
+	          expected_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          "te:st/name",
+	          10,
+	          buffer,
+	          expected_size - 1,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          "te:st/name",
+	          10,
+	          NULL,
+	          0,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 expected );
+
+	expected = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          "te:st/name",
+	          10,
+	          NULL,
+	          256,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          "te:st/name",
+	          10,
+	          buffer,
+	          256,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_path function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_path(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	char *expected_path        = NULL;
+	char *sanitized_path       = NULL;
+	char *test_path            = NULL;
+	size_t expected_path_size  = 0;
+	size_t sanitized_path_size = 0;
+	size_t test_path_length    = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	/* Test libcpath_path_get_sanitized_path without replacement characters
+	 */
+#if defined( WINAPI )
+	test_path          = "test\\test.txt";
+	test_path_length   = 13;
+	expected_path      = "test\\test.txt";
+	expected_path_size = 14;
+#else
+	test_path          = "test/test.txt";
+	test_path_length   = 13;
+	expected_path      = "test/test.txt";
+	expected_path_size = 14;
+#endif
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_path",
+	 sanitized_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_size",
+	 sanitized_path_size,
+	 expected_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_path,
+	          expected_path_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_path );
+
+	sanitized_path      = NULL;
+	sanitized_path_size = 0;
+
+	/* Test libcpath_path_get_sanitized_path with replacement characters
+	 */
+#if defined( WINAPI )
+	test_path          = "test\\t\x00sT!.t^|";
+	test_path_length   = 14;
+	expected_path      = "test\\t^x00sT^x21.t^^^x7c";
+	expected_path_size = 25;
+#else
+	test_path          = "test/t\x00sT!.t\\|";
+	test_path_length   = 14;
+	expected_path      = "test/t\\x00sT\\x21.t\\\\\\x7c";
+	expected_path_size = 25;
+#endif
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_path",
+	 sanitized_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_size",
+	 sanitized_path_size,
+	 expected_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_path,
+	          expected_path_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_path );
+
+	sanitized_path      = NULL;
+	sanitized_path_size = 0;
+
+	/* Test error cases
+	 */
+#if defined( WINAPI )
+	test_path          = "test\\test.txt";
+	test_path_length   = 13;
+	expected_path      = "test\\test.txt";
+	expected_path_size = 14;
+#else
+	test_path          = "test/test.txt";
+	test_path_length   = 13;
+	expected_path      = "test/test.txt";
+	expected_path_size = 14;
+#endif
+
+	result = libcpath_path_get_sanitized_path(
+	          NULL,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          (size_t) -1,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          test_path_length,
+	          NULL,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sanitized_path = (char *) 0x12345678UL;
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	sanitized_path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	/* Test libcpath_path_get_sanitized_path with malloc failing
+	 */
+	cpath_test_malloc_attempts_before_fail = 0;
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	if( cpath_test_malloc_attempts_before_fail != -1 )
+	{
+		cpath_test_malloc_attempts_before_fail = -1;
+
+		if( sanitized_path != NULL )
+		{
+			memory_free(
+			 sanitized_path );
+
+			sanitized_path = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "sanitized_path",
+		 sanitized_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "sanitized_path_size",
+		 sanitized_path_size,
+		 (size_t) 0 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( sanitized_path != NULL )
+	{
+		memory_free(
+		 sanitized_path );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_path_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_path_to_buffer(
+     void )
+{
+	char buffer[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	char *expected           = NULL;
+	size_t expected_size     = 0;
+	size_t required_size     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_sanitized_path(
+	          "first/se:cond",
+	          13,
+	          &expected,
+	          &expected_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          "first/se:cond",
+	          13,
+	          buffer,
+	          256,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          buffer,
+	          expected,
+	          expected_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          "first/se:cond",
+	          13,
+	          buffer,
+	          expected_size - 1,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          "first/se:cond",
+	          13,
+	          NULL,
+	          0,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 expected );
+
+	expected = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          "first/se:cond",
+	          13,
+	          NULL,
+	          256,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          "first/se:cond",
+	          13,
+	          buffer,
+	          256,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_join function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	const char *expected_path = NULL;
+	const char *test_path1    = NULL;
+	const char *test_path2    = NULL;
+	const char *test_path3    = NULL;
+	const char *test_path4    = NULL;
+	char *path                = NULL;
+	size_t path_size          = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	test_path1    = "\\first\\second";
+	test_path2    = "third\\fourth";
+	test_path3    = "\\first\\second\\";
+	test_path4    = "\\third\\fourth";
+	expected_path = "\\first\\second\\third\\fourth";
+#else
+	test_path1    = "/first/second";
+	test_path2    = "third/fourth";
+	test_path3    = "/first/second/";
+	test_path4    = "/third/fourth";
+	expected_path = "/first/second/third/fourth";
+#endif
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          26 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path3,
+	          14,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          26 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path4,
+	          13,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          26 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_join(
+	          NULL,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path = (char *) 0x12345678UL;
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join(
+	          &path,
+	          NULL,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          NULL,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          (size_t) SSIZE_MAX + 1,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          NULL,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_join_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join_to_buffer(
+     void )
+{
+	char buffer[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	char *expected           = NULL;
+	size_t expected_size     = 0;
+	size_t required_size     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_join(
+	          &expected,
+	          &expected_size,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_join_to_buffer(
+	          buffer,
+	          256,
+	          &required_size,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          buffer,
+	          expected,
+	          expected_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_join_to_buffer(
+	          buffer,
+	          expected_size - 1,
+	          &required_size,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_join_to_buffer(
+	          NULL,
+	          0,
+	          &required_size,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 expected );
+
+	expected = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_join_to_buffer(
+	          NULL,
+	          256,
+	          &required_size,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_to_buffer(
+	          buffer,
+	          256,
+	          NULL,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_join_arena function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join_arena(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libcpath_arena_t *arena  = NULL;
+	char *expected           = NULL;
+	char *path               = NULL;
+	size_t expected_size     = 0;
+	size_t path_size         = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_join(
+	          &expected,
+	          &expected_size,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use a chunk size smaller than the path to test growth of the arena
+	 */
+	result = libcpath_arena_initialize(
+	          &arena,
+	          8,
+	          LIBCPATH_ARENA_FLAG_ALLOW_GROWTH,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_join_arena(
+	          arena,
+	          &path,
+	          &path_size,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "path",
+	 path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected,
+	          expected_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The second path fits in the space left in the grown chunk
+	 */
+	path = NULL;
+
+	result = libcpath_path_join_arena(
+	          arena,
+	          &path,
+	          &path_size,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected,
+	          expected_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	memory_free(
+	 expected );
+
+	expected = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_join_arena(
+	          NULL,
+	          &path,
+	          &path_size,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_arena(
+	          arena,
+	          NULL,
+	          &path_size,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_arena(
+	          arena,
+	          &path,
+	          NULL,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test join when the arena cannot grow
+	 */
+	result = libcpath_arena_initialize(
+	          &arena,
+	          8,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_join_arena(
+	          arena,
+	          &path,
+	          &path_size,
+	          "/first/second",
+	          13,
+	          "third",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	return( 0 );
+}
+
+/* The pairs of components, and the expected path, used to test that
+ * libcpath_path_join_components combines separators as libcpath_path_join does
+ */
+#if defined( WINAPI )
+const char *cpath_test_path_join_components_pairs[ 6 ][ 3 ] = {
+	{ "\\", "", "\\" },
+	{ "\\", "\\", "\\" },
+	{ "", "a", "\\a" },
+	{ "a", "\\", "a\\" },
+	{ "a", "", "a\\" },
+	{ "\\", "a", "\\a" } };
+#else
+const char *cpath_test_path_join_components_pairs[ 6 ][ 3 ] = {
+	{ "/", "", "/" },
+	{ "/", "/", "/" },
+	{ "", "a", "/a" },
+	{ "a", "/", "a/" },
+	{ "a", "", "a/" },
+	{ "/", "a", "/a" } };
+#endif
+
+/* Tests the libcpath_path_join_components function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join_components(
+     void )
+{
+	const char *components[ 4 ];
+	size_t component_lengths[ 4 ];
+
+	libcerror_error_t *error  = NULL;
+	const char *expected_path = NULL;
+	char *joined_path         = NULL;
+	char *path                = NULL;
+	size_t joined_path_size   = 0;
+	size_t path_size          = 0;
+	int pair_index            = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	components[ 0 ] = "\\first\\";
+	components[ 1 ] = "\\\\second";
+	components[ 2 ] = "\\";
+	components[ 3 ] = "third\\fourth";
+	expected_path   = "\\first\\second\\third\\fourth";
+#else
+	components[ 0 ] = "/first/";
+	components[ 1 ] = "//second";
+	components[ 2 ] = "/";
+	components[ 3 ] = "third/fourth";
+	expected_path   = "/first/second/third/fourth";
+#endif
+	component_lengths[ 0 ] = 7;
+	component_lengths[ 1 ] = 8;
+	component_lengths[ 2 ] = 1;
+	component_lengths[ 3 ] = 12;
+
+	result = libcpath_path_join_components(
+	          &path,
+	          &path_size,
+	          components,
+	          component_lengths,
+	          4,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "path",
+	 path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          27 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	/* Test that a root separator is retained and that the separators of the last
+	 * component are combined as libcpath_path_join does
+	 */
+	for( pair_index = 0;
+	     pair_index < 6;
+	     pair_index++ )
+	{
+		components[ 0 ]        = cpath_test_path_join_components_pairs[ pair_index ][ 0 ];
+		components[ 1 ]        = cpath_test_path_join_components_pairs[ pair_index ][ 1 ];
+		expected_path          = cpath_test_path_join_components_pairs[ pair_index ][ 2 ];
+		component_lengths[ 0 ] = narrow_string_length( components[ 0 ] );
+		component_lengths[ 1 ] = narrow_string_length( components[ 1 ] );
+
+		result = libcpath_path_join_components(
+		          &path,
+		          &path_size,
+		          components,
+		          component_lengths,
+		          2,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "path",
+		 path );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "path_size",
+		 path_size,
+		 narrow_string_length( expected_path ) + 1 );
+
+		result = narrow_string_compare(
+		          path,
+		          expected_path,
+		          path_size );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libcpath_path_join(
+		          &joined_path,
+		          &joined_path_size,
+		          components[ 0 ],
+		          component_lengths[ 0 ],
+		          components[ 1 ],
+		          component_lengths[ 1 ],
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "joined_path_size",
+		 joined_path_size,
+		 path_size );
+
+		result = narrow_string_compare(
+		          joined_path,
+		          path,
+		          path_size );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 joined_path );
+
+		joined_path = NULL;
+
+		memory_free(
+		 path );
+
+		path = NULL;
+	}
+	/* Test that components, other than the first and the last, that consist
+	 * of separators only are ignored
+	 */
+#if defined( WINAPI )
+	components[ 0 ] = "\\";
+	components[ 1 ] = "\\";
+	components[ 2 ] = "";
+	components[ 3 ] = "a";
+	expected_path   = "\\a";
+#else
+	components[ 0 ] = "/";
+	components[ 1 ] = "/";
+	components[ 2 ] = "";
+	components[ 3 ] = "a";
+	expected_path   = "/a";
+#endif
+	component_lengths[ 0 ] = 1;
+	component_lengths[ 1 ] = 1;
+	component_lengths[ 2 ] = 0;
+	component_lengths[ 3 ] = 1;
+
+	result = libcpath_path_join_components(
+	          &path,
+	          &path_size,
+	          components,
+	          component_lengths,
+	          4,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "path",
+	 path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 3 );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          3 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_join_components(
+	          NULL,
+	          &path_size,
+	          components,
+	          component_lengths,
+	          4,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_components(
+	          &path,
+	          NULL,
+	          components,
+	          component_lengths,
+	          4,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_components(
+	          &path,
+	          &path_size,
+	          NULL,
+	          component_lengths,
+	          4,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( joined_path != NULL )
+	{
+		memory_free(
+		 joined_path );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_join_components_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join_components_to_buffer(
+     void )
+{
+	const char *components[ 3 ];
+	size_t component_lengths[ 3 ];
+	char path[ 32 ];
+
+	libcerror_error_t *error  = NULL;
+	const char *expected_path = NULL;
+	size_t required_path_size = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	components[ 0 ] = "\\";
+	components[ 1 ] = "first\\";
+	components[ 2 ] = "second\\";
+	expected_path   = "\\first\\second\\";
+#else
+	components[ 0 ] = "/";
+	components[ 1 ] = "first/";
+	components[ 2 ] = "second/";
+	expected_path   = "/first/second/";
+#endif
+	component_lengths[ 0 ] = 1;
+	component_lengths[ 1 ] = 6;
+	component_lengths[ 2 ] = 7;
+
+	/* Determine the size only
+	 */
+	result = libcpath_path_join_components_to_buffer(
+	          NULL,
+	          0,
+	          &required_path_size,
+	          components,
+	          component_lengths,
+	          3,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_path_size",
+	 required_path_size,
+	 (size_t) 15 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_join_components_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          components,
+	          component_lengths,
+	          3,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_path_size",
+	 required_path_size,
+	 (size_t) 15 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          15 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a single component
+	 */
+	result = libcpath_path_join_components_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          components,
+	          component_lengths,
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_path_size",
+	 required_path_size,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_join_components_to_buffer(
+	          path,
+	          32,
+	          NULL,
+	          components,
+	          component_lengths,
+	          3,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_components_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          components,
+	          NULL,
+	          3,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_components_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          components,
+	          component_lengths,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	components[ 1 ] = NULL;
+
+	result = libcpath_path_join_components_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          components,
+	          component_lengths,
+	          3,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_join_sanitized function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join_sanitized(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	const char *expected_path = NULL;
+	const char *test_filename = NULL;
+	const char *test_path     = NULL;
+	char *path                = NULL;
+	size_t path_size          = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	test_path     = "\\output\\";
+	test_filename = "t\x00sT!.t^|";
+	expected_path = "\\output\\t^x00sT^x21.t^^^x7c";
+#else
+	test_path     = "/output/";
+	test_filename = "t\x00sT!.t\\|";
+	expected_path = "/output/t\\x00sT\\x21.t\\\\\\x7c";
+#endif
+
+	result = libcpath_path_join_sanitized(
+	          &path,
+	          &path_size,
+	          test_path,
+	          8,
+	          test_filename,
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "path",
+	 path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 28 );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          28 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_join_sanitized(
+	          NULL,
+	          &path_size,
+	          test_path,
+	          8,
+	          test_filename,
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_sanitized(
+	          &path,
+	          NULL,
+	          test_path,
+	          8,
+	          test_filename,
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_sanitized(
+	          &path,
+	          &path_size,
+	          test_path,
+	          8,
+	          test_filename,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_join_sanitized_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join_sanitized_to_buffer(
+     void )
+{
+	char path[ 32 ];
+
+	libcerror_error_t *error  = NULL;
+	const char *expected_path = NULL;
+	const char *test_filename = NULL;
+	const char *test_path     = NULL;
+	size_t required_path_size = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	test_path     = "\\output";
+	test_filename = "t\x00sT!.t^|";
+	expected_path = "\\output\\t^x00sT^x21.t^^^x7c";
+#else
+	test_path     = "/output";
+	test_filename = "t\x00sT!.t\\|";
+	expected_path = "/output/t\\x00sT\\x21.t\\\\\\x7c";
+#endif
+
+	/* Determine the size only
+	 */
+	result = libcpath_path_join_sanitized_to_buffer(
+	          NULL,
+	          0,
+	          &required_path_size,
+	          test_path,
+	          7,
+	          test_filename,
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_path_size",
+	 required_path_size,
+	 (size_t) 28 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A buffer that only fits the directory name
+	 */
+	result = libcpath_path_join_sanitized_to_buffer(
+	          path,
+	          10,
+	          &required_path_size,
+	          test_path,
+	          7,
+	          test_filename,
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_path_size",
+	 required_path_size,
+	 (size_t) 28 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_join_sanitized_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          test_path,
+	          7,
+	          test_filename,
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_path_size",
+	 required_path_size,
+	 (size_t) 28 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          28 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_join_sanitized_to_buffer(
+	          path,
+	          32,
+	          NULL,
+	          test_path,
+	          7,
+	          test_filename,
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_sanitized_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          NULL,
+	          7,
+	          test_filename,
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_sanitized_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          test_path,
+	          7,
+	          NULL,
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Tests the libcpath_CreateDirectoryA function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_CreateDirectoryA(
+     void )
+{
+	BOOL result = FALSE;
+
+	/* Test regular cases
+	 */
+
+	/* Test error cases
+	 */
+	result = libcpath_CreateDirectoryA(
+	          NULL,
+	          NULL );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 FALSE );
+
+	result = libcpath_CreateDirectoryA(
+	          ".",
+	          NULL );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 FALSE );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+/* Tests the libcpath_path_make_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if !defined( WINAPI )
+
+/* Tests the libcpath_path_make_directory_recursive function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_recursive(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_make_directory_recursive(
+	          ".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_make_directory_recursive(
+	          "/",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory_recursive(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directory_recursive(
+	          "",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an existing file in the path
+	 */
+	result = libcpath_path_make_directory_recursive(
+	          "/dev/null/directory",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directory_recursive(
+	          "/dev/null",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_make_directory_recursive function with multiple missing directories
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_recursive_missing(
+     void )
+{
+	struct stat file_statistics;
+
+	char temporary_directory_name[ 32 ]   = "cpath_test_XXXXXX";
+
+	libcerror_error_t *error              = NULL;
+	char *current_working_directory       = NULL;
+	size_t current_working_directory_size = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "temporary_directory_name",
+	 mkdtemp( temporary_directory_name ) );
+
+	result = chdir(
+	          temporary_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_make_directory_recursive(
+	          "first//second/third/",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = stat(
+	          "first/second/third",
+	          &file_statistics );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+	 "S_ISDIR( file_statistics.st_mode )",
+	 S_ISDIR( file_statistics.st_mode ),
+	 0 );
+
+	result = libcpath_path_make_directory_recursive(
+	          "first/second/third",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && defined( HAVE_MKDIRAT )
+
+	/* Test with a file that is created in place of the last directory in the meantime
+	 */
+	cpath_test_mkdirat_create_file = "file";
+
+	result = libcpath_path_make_directory_recursive(
+	          "first/second/fourth/file",
+	          &error );
+
+	if( cpath_test_mkdirat_create_file != NULL )
+	{
+		/* mkdirat is not used
+		 */
+		cpath_test_mkdirat_create_file = NULL;
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		rmdir(
+		 "first/second/fourth/file" );
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		unlink(
+		 "first/second/fourth/file" );
+	}
+	rmdir(
+	 "first/second/fourth" );
+
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && defined( HAVE_MKDIRAT ) */
+
+	/* Clean up
+	 */
+	rmdir(
+	 "first/second/third" );
+	rmdir(
+	 "first/second" );
+	rmdir(
+	 "first" );
+
+	result = chdir(
+	          current_working_directory );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = rmdir(
+	          temporary_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 current_working_directory );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( current_working_directory != NULL )
+	{
+		if( chdir(
+		     current_working_directory ) == 0 )
+		{
+			rmdir(
+			 temporary_directory_name );
+		}
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) */
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+/* Tests the libcpath_path_has_parent_directory_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_has_parent_directory_segment(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_has_parent_directory_segment(
+	          "link/../directory",
+	          17 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcpath_path_has_parent_directory_segment(
+	          "..",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcpath_path_has_parent_directory_segment(
+	          "/first/..",
+	          9 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcpath_path_has_parent_directory_segment(
+	          "/first/..second/third../.",
+	          25 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_has_parent_directory_segment(
+	          "/first/..",
+	          8 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_has_parent_directory_segment(
+	          NULL,
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+#if !defined( WINAPI )
+
+/* Tests the libcpath_path_make_directory_with_cache and libcpath_path_make_directory_recursive_with_cache functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_with_cache(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libcpath_directory_cache_t *directory_cache = NULL;
+	int number_of_entries                       = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_directory_cache_initialize(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_cache",
+	 directory_cache );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_make_directory_with_cache(
+	          directory_cache,
+	          "./",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_make_directory_recursive_with_cache(
+	          directory_cache,
+	          ".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_get_number_of_entries(
+	          directory_cache,
+	          &number_of_entries,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory_with_cache(
+	          NULL,
+	          ".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directory_with_cache(
+	          directory_cache,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directory_with_cache(
+	          directory_cache,
+	          "/dev/null",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directory_recursive_with_cache(
+	          NULL,
+	          ".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directory_recursive_with_cache(
+	          directory_cache,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directory_recursive_with_cache(
+	          directory_cache,
+	          "/dev/null/directory",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that failed directories are not added to the cache
+	 */
+	result = libcpath_directory_cache_get_number_of_entries(
+	          directory_cache,
+	          &number_of_entries,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcpath_directory_cache_free(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_cache != NULL )
+	{
+		libcpath_directory_cache_free(
+		 &directory_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Removes the directories made by cpath_test_path_make_directory_with_cache_relative
+ * and changes into the working directory
+ */
+void cpath_test_path_remove_relative_cache_directories(
+      const char *temporary_directory_name,
+      const char *working_directory )
+{
+	const char *directory_names[ 11 ] = {
+		"first/directory", "first/parent/directory", "first/parent",
+		"first/made", "first/made_recursive", "first/inner", "first",
+		"second/directory", "second/parent/directory", "second/parent",
+		"second" };
+
+	int directory_index = 0;
+
+	if( chdir(
+	     working_directory ) != 0 )
+	{
+		return;
+	}
+	if( chdir(
+	     temporary_directory_name ) == 0 )
+	{
+		unlink(
+		 "link" );
+
+		for( directory_index = 0;
+		     directory_index < 11;
+		     directory_index++ )
+		{
+			rmdir(
+			 directory_names[ directory_index ] );
+		}
+		chdir(
+		 working_directory );
+	}
+	rmdir(
+	 temporary_directory_name );
+}
+
+/* Tests the libcpath_path_make_directory_with_cache and libcpath_path_make_directory_recursive_with_cache functions
+ * with relative directory names and a change of the current working directory
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_with_cache_relative(
+     void )
+{
+	struct stat file_statistics;
+
+	char temporary_directory_name[ 32 ]         = "cpath_test_XXXXXX";
+
+	libcerror_error_t *error                    = NULL;
+	libcpath_directory_cache_t *directory_cache = NULL;
+	char *current_working_directory             = NULL;
+	size_t current_working_directory_size       = 0;
+	int expected_number_of_entries              = 0;
+	int number_of_entries                       = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "temporary_directory_name",
+	 mkdtemp( temporary_directory_name ) );
+
+	result = chdir(
+	          temporary_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = mkdir(
+	          "first",
+	          0755 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = mkdir(
+	          "second",
+	          0755 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = mkdir(
+	          "first/inner",
+	          0755 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = symlink(
+	          "first/inner",
+	          "link" );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_directory_cache_initialize(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a relative directory is made again after a change of directory
+	 */
+	result = chdir(
+	          "first" );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_make_directory_with_cache(
+	          directory_cache,
+	          "directory",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_make_directory_recursive_with_cache(
+	          directory_cache,
+	          "parent/directory",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = chdir(
+	          "../second" );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_make_directory_with_cache(
+	          directory_cache,
+	          "directory",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = stat(
+	          "directory",
+	          &file_statistics );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_make_directory_recursive_with_cache(
+	          directory_cache,
+	          "parent/directory",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = stat(
+	          "parent/directory",
+	          &file_statistics );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_directory_cache_get_number_of_entries(
+	          directory_cache,
+	          &number_of_entries,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_number_of_entries = number_of_entries;
+
+	/* Test if a directory name with a parent directory segment is made
+	 * relative to the target of a symbolic link and is not cached
+	 */
+	result = chdir(
+	          ".." );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_make_directory_with_cache(
+	          directory_cache,
+	          "link/../made",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = stat(
+	          "first/made",
+	          &file_statistics );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = stat(
+	          "made",
+	          &file_statistics );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libcpath_path_make_directory_recursive_with_cache(
+	          directory_cache,
+	          "link/../made_recursive",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = stat(
+	          "first/made_recursive",
+	          &file_statistics );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_directory_cache_get_number_of_entries(
+	          directory_cache,
+	          &number_of_entries,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 expected_number_of_entries );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcpath_directory_cache_free(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cpath_test_path_remove_relative_cache_directories(
+	 temporary_directory_name,
+	 current_working_directory );
+
+	memory_free(
+	 current_working_directory );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_cache != NULL )
+	{
+		libcpath_directory_cache_free(
+		 &directory_cache,
+		 NULL );
+	}
+	if( current_working_directory != NULL )
+	{
+		cpath_test_path_remove_relative_cache_directories(
+		 temporary_directory_name,
+		 current_working_directory );
+
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) */
+
+#if !defined( WINAPI )
+
+/* Tests the libcpath_path_make_directory_with_status and libcpath_path_make_directory_recursive_with_status functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_with_status(
+     void )
+{
+	libcpath_status_t status;
+
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	status.error_domain      = LIBCERROR_ERROR_DOMAIN_RUNTIME;
+	status.error_code        = LIBCERROR_RUNTIME_ERROR_SET_FAILED;
+	status.system_error_code = EEXIST;
+
+	result = libcpath_path_make_directory_recursive_with_status(
+	          ".",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 0 );
+
+	result = libcpath_path_make_directory_recursive_with_status(
+	          ".",
+	          NULL );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory_with_status(
+	          ".",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_code",
+	 status.error_code,
+	 LIBCERROR_RUNTIME_ERROR_SET_FAILED );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) EEXIST );
+
+	result = libcpath_path_make_directory_with_status(
+	          ".",
+	          NULL );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libcpath_path_make_directory_with_status(
+	          NULL,
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_code",
+	 status.error_code,
+	 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE );
+
+	result = libcpath_path_make_directory_recursive_with_status(
+	          NULL,
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS );
+
+	result = libcpath_path_make_directory_recursive_with_status(
+	          "/dev/null",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) EEXIST );
+
+	result = libcpath_path_make_directory_recursive_with_status(
+	          "/dev/null/directory",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) ENOTDIR );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) */
+
+#if !defined( WINAPI )
+
+/* Tests the libcpath_path_make_directory_context_with_status function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_context_with_status(
+     void )
+{
+	libcpath_status_t status;
+
+	libcerror_error_t *error    = NULL;
+	libcpath_context_t *context = NULL;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_context_initialize(
+	          &context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_context_set_working_directory(
+	          context,
+	          "/",
+	          1,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory_context_with_status(
+	          context,
+	          "dev",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_code",
+	 status.error_code,
+	 LIBCERROR_RUNTIME_ERROR_SET_FAILED );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) EEXIST );
+
+	result = libcpath_path_make_directory_context_with_status(
+	          context,
+	          "/dev/null/directory",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) ENOTDIR );
+
+	result = libcpath_path_make_directory_context_with_status(
+	          context,
+	          "dev",
+	          NULL );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libcpath_path_make_directory_context_with_status(
+	          NULL,
+	          "dev",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_code",
+	 status.error_code,
+	 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE );
+
+	result = libcpath_path_make_directory_context_with_status(
+	          context,
+	          NULL,
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS );
+
+	/* Clean up
+	 */
+	result = libcpath_context_free(
+	          &context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libcpath_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_make_directory_with_cache_with_status and libcpath_path_make_directory_recursive_with_cache_with_status functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_with_cache_with_status(
+     void )
+{
+	libcpath_status_t status;
+
+	libcerror_error_t *error                    = NULL;
+	libcpath_directory_cache_t *directory_cache = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_directory_cache_initialize(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_cache",
+	 directory_cache );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	status.error_domain      = LIBCERROR_ERROR_DOMAIN_RUNTIME;
+	status.error_code        = LIBCERROR_RUNTIME_ERROR_SET_FAILED;
+	status.system_error_code = EEXIST;
+
+	result = libcpath_path_make_directory_with_cache_with_status(
+	          directory_cache,
+	          ".",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 0 );
+
+	result = libcpath_path_make_directory_recursive_with_cache_with_status(
+	          directory_cache,
+	          ".",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory_with_cache_with_status(
+	          directory_cache,
+	          "/dev/null",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_code",
+	 status.error_code,
+	 LIBCERROR_RUNTIME_ERROR_SET_FAILED );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) EEXIST );
+
+	result = libcpath_path_make_directory_with_cache_with_status(
+	          directory_cache,
+	          "/dev/null/directory",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) ENOTDIR );
+
+	result = libcpath_path_make_directory_recursive_with_cache_with_status(
+	          directory_cache,
+	          "/dev/null/directory",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) ENOTDIR );
+
+	result = libcpath_path_make_directory_with_cache_with_status(
+	          NULL,
+	          ".",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS );
+
+	result = libcpath_path_make_directory_recursive_with_cache_with_status(
+	          directory_cache,
+	          NULL,
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS );
+
+	/* Clean up
+	 */
+	result = libcpath_directory_cache_free(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_cache != NULL )
+	{
+		libcpath_directory_cache_free(
+		 &directory_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) */
+
+#if !defined( WINAPI )
+
+/* The paths used to test the batch directory functions, none of which can be made
+ */
+const char *cpath_test_path_batch_directory_names[ 4 ] = {
+	".", "/", "/dev/null", "/nonexistent_directory/directory" };
+
+/* The expected error codes of making the batch directory names
+ */
+const int cpath_test_path_batch_make_error_codes[ 4 ] = {
+	EEXIST, EEXIST, EEXIST, ENOENT };
+
+/* The expected error codes of probing the batch directory names
+ */
+const int cpath_test_path_batch_probe_error_codes[ 4 ] = {
+	0, 0, ENOTDIR, ENOENT };
+
+/* Tests the libcpath_path_make_directories and libcpath_path_probe_directories functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directories(
+     void )
+{
+	const char *directory_names[ 32 ];
+	int error_codes[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int directory_index      = 0;
+	int number_of_names      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( number_of_names = 4;
+	     number_of_names <= 32;
+	     number_of_names += 28 )
+	{
+		for( directory_index = 0;
+		     directory_index < number_of_names;
+		     directory_index++ )
+		{
+			directory_names[ directory_index ] = cpath_test_path_batch_directory_names[ directory_index % 4 ];
+			error_codes[ directory_index ]     = -1;
+		}
+		result = libcpath_path_make_directories(
+		          directory_names,
+		          number_of_names,
+		          error_codes,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( directory_index = 0;
+		     directory_index < number_of_names;
+		     directory_index++ )
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "error_codes[ directory_index ]",
+			 error_codes[ directory_index ],
+			 cpath_test_path_batch_make_error_codes[ directory_index % 4 ] );
+		}
+		result = libcpath_path_probe_directories(
+		          directory_names,
+		          number_of_names,
+		          error_codes,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( directory_index = 0;
+		     directory_index < number_of_names;
+		     directory_index++ )
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "error_codes[ directory_index ]",
+			 error_codes[ directory_index ],
+			 cpath_test_path_batch_probe_error_codes[ directory_index % 4 ] );
+		}
+	}
+	result = libcpath_path_make_directories(
+	          directory_names,
+	          0,
+	          error_codes,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directories(
+	          NULL,
+	          4,
+	          error_codes,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directories(
+	          directory_names,
+	          -1,
+	          error_codes,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directories(
+	          directory_names,
+	          4,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_names[ 1 ] = NULL;
+
+	result = libcpath_path_make_directories(
+	          directory_names,
+	          4,
+	          error_codes,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_probe_directories(
+	          directory_names,
+	          4,
+	          error_codes,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && defined( HAVE_LIBCPATH_IO_URING )
+
+	/* Test libcpath_path_probe_directories with io_uring_enter failing after
+	 * the operations were submitted, in which case these are waited for
+	 */
+	for( directory_index = 0;
+	     directory_index < 32;
+	     directory_index++ )
+	{
+		directory_names[ directory_index ] = cpath_test_path_batch_directory_names[ directory_index % 4 ];
+		error_codes[ directory_index ]     = -1;
+	}
+	cpath_test_io_uring_enter_fail_after_submit = 1;
+
+	result = libcpath_path_probe_directories(
+	          directory_names,
+	          32,
+	          error_codes,
+	          &error );
+
+	if( cpath_test_io_uring_enter_fail_after_submit != 0 )
+	{
+		/* io_uring is not supported by the kernel
+		 */
+		cpath_test_io_uring_enter_fail_after_submit = 0;
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	for( directory_index = 0;
+	     directory_index < 32;
+	     directory_index++ )
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "error_codes[ directory_index ]",
+		 error_codes[ directory_index ],
+		 cpath_test_path_batch_probe_error_codes[ directory_index % 4 ] );
+	}
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && defined( HAVE_LIBCPATH_IO_URING ) */
+
+	result = libcpath_path_probe_directories(
+	          NULL,
+	          4,
+	          error_codes,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_probe_directories(
+	          cpath_test_path_batch_directory_names,
+	          -1,
+	          error_codes,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_probe_directories(
+	          cpath_test_path_batch_directory_names,
+	          4,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The relative paths used to test the batch directory context functions, none of which can be made
+ */
+const char *cpath_test_path_batch_context_directory_names[ 4 ] = {
+	"dev", "tmp", "dev/null", "nonexistent_directory/directory" };
+
+/* The expected error codes of making the batch context directory names
+ */
+const int cpath_test_path_batch_context_make_error_codes[ 4 ] = {
+	EEXIST, EEXIST, EEXIST, ENOENT };
+
+/* The expected error codes of probing the batch context directory names
+ */
+const int cpath_test_path_batch_context_probe_error_codes[ 4 ] = {
+	0, 0, ENOTDIR, ENOENT };
+
+/* Tests the libcpath_path_make_directories_context and libcpath_path_probe_directories_context functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directories_context(
+     void )
+{
+	const char *directory_names[ 32 ];
+	int error_codes[ 32 ];
+
+	libcerror_error_t *error    = NULL;
+	libcpath_context_t *context = NULL;
+	int directory_index         = 0;
+	int iterator                = 0;
+	int result                  = 0;
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && defined( HAVE_LIBCPATH_IO_URING )
+	int io_uring_setup_count    = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcpath_context_initialize(
+	          &context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_context_set_working_directory(
+	          context,
+	          "/",
+	          1,
+	          LIBCPATH_WORKING_DIRECTORY_FLAG_OPEN,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( directory_index = 0;
+	     directory_index < 32;
+	     directory_index++ )
+	{
+		directory_names[ directory_index ] = cpath_test_path_batch_context_directory_names[ directory_index % 4 ];
+	}
+	/* Test regular cases, where the second iteration reuses the io_uring of the context
+	 */
+	for( iterator = 0;
+	     iterator < 2;
+	     iterator++ )
+	{
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && defined( HAVE_LIBCPATH_IO_URING )
+		if( iterator == 1 )
+		{
+			io_uring_setup_count = cpath_test_io_uring_setup_count;
+		}
+#endif
+		for( directory_index = 0;
+		     directory_index < 32;
+		     directory_index++ )
+		{
+			error_codes[ directory_index ] = -1;
+		}
+		result = libcpath_path_make_directories_context(
+		          context,
+		          directory_names,
+		          32,
+		          error_codes,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( directory_index = 0;
+		     directory_index < 32;
+		     directory_index++ )
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "error_codes[ directory_index ]",
+			 error_codes[ directory_index ],
+			 cpath_test_path_batch_context_make_error_codes[ directory_index % 4 ] );
+		}
+		result = libcpath_path_probe_directories_context(
+		          context,
+		          directory_names,
+		          32,
+		          error_codes,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( directory_index = 0;
+		     directory_index < 32;
+		     directory_index++ )
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "error_codes[ directory_index ]",
+			 error_codes[ directory_index ],
+			 cpath_test_path_batch_context_probe_error_codes[ directory_index % 4 ] );
+		}
+	}
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && defined( HAVE_LIBCPATH_IO_URING )
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "cpath_test_io_uring_setup_count",
+	 cpath_test_io_uring_setup_count,
+	 io_uring_setup_count );
+#endif
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directories_context(
+	          NULL,
+	          directory_names,
+	          4,
+	          error_codes,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_probe_directories_context(
+	          NULL,
+	          directory_names,
+	          4,
+	          error_codes,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_context_free(
+	          &context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libcpath_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) */
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Tests the libcpath_SetCurrentDirectoryW function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_SetCurrentDirectoryW(
+     void )
+{
+	BOOL result = FALSE;
+
+	/* Test regular cases
+	 */
+	result = libcpath_SetCurrentDirectoryW(
+	          L"." );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 TRUE );
+
+	/* Test error cases
+	 */
+	result = libcpath_SetCurrentDirectoryW(
+	          NULL );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 FALSE );
+
+	result = libcpath_SetCurrentDirectoryW(
+	          L"bogus" );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 FALSE );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+/* Tests the libcpath_path_change_directory_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_change_directory_wide(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_change_directory_wide(
+	          L".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_change_directory_wide(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Tests the libcpath_GetCurrentDirectoryW function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_GetCurrentDirectoryW(
+     void )
+{
+	wchar_t buffer[ 256 ];
+
+	DWORD result = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_GetCurrentDirectoryW(
+	          256,
+	          buffer );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_GetCurrentDirectoryW(
+	          0,
+	          NULL );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+/* Tests the libcpath_path_get_current_working_directory_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_current_working_directory_wide(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	wchar_t *current_working_directory    = NULL;
+	size_t current_working_directory_size = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	memory_free(
+	 current_working_directory );
+
+	current_working_directory = NULL;
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_current_working_directory_wide(
+	          NULL,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	current_working_directory = (wchar_t *) 0x12345678UL;
+
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	current_working_directory = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	/* Test libcpath_path_get_current_working_directory_wide with malloc failing
+	 */
+	cpath_test_malloc_attempts_before_fail = 0;
+
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	if( cpath_test_malloc_attempts_before_fail != -1 )
+	{
+		cpath_test_malloc_attempts_before_fail = -1;
+
+		if( current_working_directory != NULL )
+		{
+			memory_free(
+			 current_working_directory );
+
+			current_working_directory = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "current_working_directory",
+		 current_working_directory );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcpath_path_get_current_working_directory_wide with memset failing
+	 */
+	cpath_test_memset_attempts_before_fail = 0;
+
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	if( cpath_test_memset_attempts_before_fail != -1 )
+	{
+		cpath_test_memset_attempts_before_fail = -1;
+
+		if( current_working_directory != NULL )
+		{
+			memory_free(
+			 current_working_directory );
+
+			current_working_directory = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "current_working_directory",
+		 current_working_directory );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI )
+
+/* Tests the libcpath_path_get_path_type_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_path_type_wide(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t path_type        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_path_type_wide(
+	          L".",
+	          1,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_RELATIVE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\",
+	          1,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_ABSOLUTE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"c:",
+	          2,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_RELATIVE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"C:\\Windows",
+	          10,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_ABSOLUTE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\server\\share\\directory",
+	          24,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_UNC );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
+	          48,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_EXTENDED_LENGTH );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\.\\PhysicalDrive0",
+	          18,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_DEVICE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\.\\C:",
+	          6,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_DEVICE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\.\\C:\\",
+	          7,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_DEVICE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\?\\C:\\Windows",
+	          14,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_EXTENDED_LENGTH );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\?\\UNC\\server\\share\\directory",
+	          30,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_EXTENDED_LENGTH_UNC );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_path_type_wide(
+	          NULL,
+	          1,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L".",
+	          0,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L".",
+	          (size_t) SSIZE_MAX + 1,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L".",
+	          1,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_volume_name_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_volume_name_wide(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	wchar_t *volume_name        = NULL;
+	size_t directory_name_index = 0;
+	size_t volume_name_length   = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_volume_name_wide(
+	          L".",
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\",
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"c:",
+	          2,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"c:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"C:\\Windows",
+	          10,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 3 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"C:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\server\\share\\directory",
+	          24,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 15 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"server\\share",
+	          12 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
+	          48,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 44 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 48 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
+	          44 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\.\\PhysicalDrive0",
+	          18,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 14 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 18 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"PhysicalDrive0",
+	          14 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\.\\C:",
+	          6,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 6 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"C:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\.\\C:\\",
+	          7,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 7 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"C:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\?\\C:\\Windows",
+	          14,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 7 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"C:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\?\\UNC\\server\\share\\directory",
+	          30,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 12 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 21 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"server\\share",
+	          12 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_volume_name_wide(
+	          NULL,
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L".",
+	          0,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L".",
+	          (size_t) SSIZE_MAX + 1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L".",
+	          1,
+	          NULL,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L".",
+	          1,
+	          &volume_name,
+	          NULL,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L".",
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_current_working_directory_by_volume_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_current_working_directory_by_volume_wide(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	wchar_t *current_working_directory    = NULL;
+	size_t current_working_directory_size = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_current_working_directory_by_volume_wide(
+	          L"C:",
+	          2,
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_current_working_directory_by_volume_wide(
+	          L"C:",
+	          (size_t) SSIZE_MAX + 1,
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_current_working_directory_by_volume_wide(
+	          L"C:",
+	          2,
+	          NULL,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_current_working_directory_by_volume_wide(
+	          L"C:",
+	          2,
+	          &current_working_directory,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) */
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI )
+
+/* Tests the libcpath_path_normalize_with_normalized_narrow_base_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_normalize_with_normalized_narrow_base_wide(
+     void )
+{
+	wchar_t *test_paths[] = {
+		L"user/test.txt",
+		L"username/../user/test.txt",
+		L"../user//test.txt",
+		L"../../../user/test.txt",
+		L"/home/user/../test.txt",
+		L".",
+		L"..",
+		L"./" };
+	wchar_t *expected_paths[] = {
+		L"/base/directory/user/test.txt",
+		L"/base/directory/user/test.txt",
+		L"/base/user/test.txt",
+		L"/user/test.txt",
+		L"/home/test.txt",
+		L"/base/directory",
+		L"/base",
+		L"/base/directory" };
+
+	wchar_t normalized_path[ 64 ];
+
+	libcerror_error_t *error             = NULL;
+	size_t expected_path_length          = 0;
+	size_t required_normalized_path_size = 0;
+	int path_index                       = 0;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	for( path_index = 0;
+	     path_index < 8;
+	     path_index++ )
+	{
+		expected_path_length = wide_string_length(
+		                        expected_paths[ path_index ] );
+
+		/* Determine the size only
+		 */
+		result = libcpath_path_normalize_with_normalized_narrow_base_wide(
+		          "/base/directory",
+		          15,
+		          test_paths[ path_index ],
+		          wide_string_length(
+		           test_paths[ path_index ] ),
+		          NULL,
+		          0,
+		          &required_normalized_path_size,
+		          0,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "required_normalized_path_size",
+		 required_normalized_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcpath_path_normalize_with_normalized_narrow_base_wide(
+		          "/base/directory",
+		          15,
+		          test_paths[ path_index ],
+		          wide_string_length(
+		           test_paths[ path_index ] ),
+		          normalized_path,
+		          64,
+		          &required_normalized_path_size,
+		          0,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = wide_string_compare(
+		          normalized_path,
+		          expected_paths[ path_index ],
+		          expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test with a base path that contains UTF-8 encoded characters
+	 */
+	result = libcpath_path_normalize_with_normalized_narrow_base_wide(
+	          "/b\xc3\xa4se/\xe6\x96\x87",
+	          11,
+	          L"../test.txt",
+	          11,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_normalized_path_size",
+	 required_normalized_path_size,
+	 (size_t) 15 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          normalized_path,
+	          L"/b\x00e4se/test.txt",
+	          15 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with the root directory as base path
+	 */
+	result = libcpath_path_normalize_with_normalized_narrow_base_wide(
+	          "/",
+	          1,
+	          L"user",
+	          4,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_normalized_path_size",
+	 required_normalized_path_size,
+	 (size_t) 6 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          normalized_path,
+	          L"/user",
+	          6 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_normalize_with_normalized_narrow_base_wide(
+	          "/",
+	          1,
+	          L"user/..",
+	          7,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_normalized_path_size",
+	 required_normalized_path_size,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          normalized_path,
+	          L"/",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_normalize_with_normalized_narrow_base_wide(
+	          NULL,
+	          5,
+	          L"user",
+	          4,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_normalize_with_normalized_narrow_base_wide(
+	          "/base",
+	          5,
+	          NULL,
+	          0,
+	          normalized_path,
+	          64,
+	          &required_normalized_path_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_normalize_with_normalized_narrow_base_wide(
+	          "/base",
+	          5,
+	          L"user",
+	          4,
+	          normalized_path,
+	          64,
+	          NULL,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_normalize_with_normalized_narrow_base_wide(
+	          "/base",
+	          5,
+	          L"user",
+	          4,
+	          normalized_path,
+	          5,
+	          &required_normalized_path_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_normalized_path_size",
+	 required_normalized_path_size,
+	 (size_t) 11 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI ) */
+
+/* Tests the libcpath_path_get_full_path_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_path_wide(
+     void )
+{
+#if defined( WINAPI )
+	wchar_t *absolute_paths[] = {
+		L"\\home\\user\\test.txt",
+		L"c:\\home\\user\\test.txt",
+		L"c:\\home\\user\\\\test.txt",
+		L"c:\\home\\username\\..\\user\\test.txt",
+		L"c:\\..\\home\\user\\test.txt",
+		L"c:\\..\\home\\username\\..\\user\\test.txt",
+	};
+	wchar_t *relative_paths[] = {
+		L"user\\test.txt",
+		L"username\\..\\user\\test.txt",
+	};
+	wchar_t *special_paths[] = {
+		L"\\\\.\\PhysicalDrive0",
+		L"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}"
+	};
+	wchar_t *unc_paths[] = {
+		L"\\\\172.0.0.1\\C$\\test.txt",
+		L"\\\\?\\UNC\\172.0.0.1\\C$\\test.txt",
+	};
+#else
+	wchar_t *absolute_paths[] = {
+		L"/home/user/test.txt",
+		L"/home/user//test.txt",
+		L"/../home/user/test.txt",
+		L"/../home/username/../user/test.txt",
+	};
+	wchar_t *relative_paths[] = {
+		L"user/test.txt",
+		L"username/../user/test.txt",
+	};
+#endif /* defined( WINAPI ) */
+
+	libcerror_error_t *error                = NULL;
+	wchar_t *current_working_directory      = NULL;
+	wchar_t *expected_path                  = NULL;
+	wchar_t *full_path                      = NULL;
+	wchar_t *path                           = NULL;
+	size_t current_working_directory_length = 0;
+	size_t current_working_directory_size   = 0;
+	size_t expected_full_path_length        = 0;
+	size_t expected_path_length             = 0;
+	size_t full_path_length                 = 0;
+	size_t full_path_size                   = 0;
+	size_t path_length                      = 0;
+	int path_index                          = 0;
+	int result                              = 0;
+	int string_index                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	current_working_directory_length = wide_string_length(
+	                                    current_working_directory );
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	expected_path = L"\\\\?\\C:\\home\\user\\test.txt";
+#else
+	expected_path = L"/home/user/test.txt";
+#endif
+	expected_path_length = wide_string_length(
+	                        expected_path );
+
+	for( path_index = 0;
+	     path_index < 4;
+	     path_index++ )
+	{
+		path = absolute_paths[ path_index ];
+
+		path_length = wide_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path_wide(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		full_path_length = wide_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 full_path_length + 1 );
+
+#if defined( WINAPI )
+		result = wide_string_compare_no_case(
+		          full_path,
+		          expected_path,
+		          expected_path_length );
+#else
+		result = wide_string_compare(
+		          full_path,
+		          expected_path,
+		          expected_path_length );
+#endif
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+#if defined( WINAPI )
+	expected_path = L"\\user\\test.txt";
+#else
+	expected_path = L"/user/test.txt";
+#endif
+	expected_path_length = wide_string_length(
+	                        expected_path );
+
+	expected_full_path_length = current_working_directory_length + expected_path_length;
+
+#if defined( WINAPI )
+	expected_full_path_length += 4;
+#endif
+
+	for( path_index = 0;
+	     path_index < 2;
+	     path_index++ )
+	{
+		path = relative_paths[ path_index ];
+
+		path_length = wide_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path_wide(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_full_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( WINAPI )
+		/* A full path on Windows is prefixed with \\?\ while
+		 * the current working directory is not.
+		 */
+		result = wide_string_compare_no_case(
+		          full_path,
+		          L"\\\\?\\",
+		          4 );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		string_index = 4;
+#else
+		string_index = 0;
+#endif
+#if defined( WINAPI )
+		result = wide_string_compare_no_case(
+		          &( full_path[ string_index ] ),
+		          current_working_directory,
+		          current_working_directory_length );
+#else
+		result = wide_string_compare(
+		          &( full_path[ string_index ] ),
+		          current_working_directory,
+		          current_working_directory_length );
+#endif
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+#if defined( WINAPI )
+		result = wide_string_compare_no_case(
+		          &( full_path[ string_index + current_working_directory_length ] ),
+		          expected_path,
+		          expected_path_length );
+#else
+		result = wide_string_compare(
+		          &( full_path[ string_index + current_working_directory_length ] ),
+		          expected_path,
+		          expected_path_length );
+#endif
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		full_path_length = wide_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_length",
+		 full_path_length,
+		 expected_full_path_length );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+#if defined( WINAPI )
+/* TODO make changes to have test pass
+	for( path_index = 0;
+	     path_index < 2;
+	     path_index++ )
+	{
+		path = special_paths[ path_index ];
+
+		path_length = wide_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path_wide(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = wide_string_compare_no_case(
+		          full_path,
+		          expected_path,
+		          expected_path_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		full_path_length = wide_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_length",
+		 full_path_length,
+		 path_length );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+*/
+	expected_path = L"\\\\?\\UNC\\172.0.0.1\\C$\\test.txt";
+
+	expected_path_length = wide_string_length(
+	                        expected_path );
+
+	for( path_index = 0;
+	     path_index < 2;
+	     path_index++ )
+	{
+		path = unc_paths[ path_index ];
+
+		path_length = wide_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path_wide(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = wide_string_compare_no_case(
+		          full_path,
+		          expected_path,
+		          expected_path_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		full_path_length = wide_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_length",
+		 full_path_length,
+		 expected_path_length );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+#endif /* defined( WINAPI ) */
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_path_wide(
+	          NULL,
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          0,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          (size_t) -1,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          8,
+	          NULL,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	full_path = (wchar_t *) 0x12345678UL;
+
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	full_path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          8,
+	          &full_path,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
+
+	/* Test libcpath_path_change_directory with getcwd failing
+	 */
+	cpath_test_getcwd_attempts_before_fail = 0;
+
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	if( cpath_test_getcwd_attempts_before_fail != -1 )
+	{
+		cpath_test_getcwd_attempts_before_fail = -1;
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+
+	/* Clean up
+	 */
+	memory_free(
+	 current_working_directory );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_full_path_context_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_path_context_wide(
+     void )
+{
+#if defined( WINAPI )
+	wchar_t *path                   = L"username\\..\\user\\test.txt";
+#else
+	wchar_t *path                   = L"username/../user/test.txt";
+#endif
+	libcerror_error_t *error        = NULL;
+	libcpath_context_t *context     = NULL;
+	wchar_t *context_full_path      = NULL;
+	wchar_t *full_path              = NULL;
+	size_t context_full_path_size   = 0;
+	size_t full_path_size           = 0;
+	size_t path_length              = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	path_length = wide_string_length(
+	               path );
+
+	result = libcpath_context_initialize(
+	          &context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_full_path_wide(
+	          path,
+	          path_length,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path",
+	 full_path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_full_path_context_wide(
+	          context,
+	          path,
+	          path_length,
+	          &context_full_path,
+	          &context_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "context_full_path",
+	 context_full_path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "context_full_path_size",
+	 context_full_path_size,
+	 full_path_size );
+
+	result = memory_compare(
+	          context_full_path,
+	          full_path,
+	          sizeof( wchar_t ) * full_path_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 context_full_path );
+
+	context_full_path = NULL;
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_path_context_wide(
+	          NULL,
+	          path,
+	          path_length,
+	          &context_full_path,
+	          &context_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_context_free(
+	          &context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context_full_path != NULL )
+	{
+		memory_free(
+		 context_full_path );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( context != NULL )
+	{
+		libcpath_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_full_path_to_buffer_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_path_to_buffer_wide(
+     void )
+{
+	wchar_t buffer[ 1024 ];
+
+	libcerror_error_t *error = NULL;
+	wchar_t *expected        = NULL;
+	size_t expected_size     = 0;
+	size_t required_size     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          8,
+	          &expected,
+	          &expected_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          L"test.txt",
+	          8,
+	          buffer,
+	          1024,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          buffer,
+	          expected,
+	          expected_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          L"test.txt",
+	          8,
+	          buffer,
+	          expected_size - 1,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          L"test.txt",
+	          8,
+	          NULL,
+	          0,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 expected );
+
+	expected = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          L"test.txt",
+	          8,
+	          NULL,
+	          1024,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          L"test.txt",
+	          8,
+	          buffer,
+	          1024,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_full_paths_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_paths_wide(
+     void )
+{
+	const wchar_t *test_paths[] = {
+		L"test.txt",
+		L"../test.txt",
+		L"/home/user/../test.txt",
+		L"directory/./test.txt" };
+
+	size_t path_lengths[ 4 ];
+
+	libcerror_error_t *error  = NULL;
+	wchar_t *expected         = NULL;
+	wchar_t *full_paths       = NULL;
+	size_t *full_path_offsets = NULL;
+	size_t expected_offset    = 0;
+	size_t expected_size      = 0;
+	size_t full_paths_size    = 0;
+	int path_index            = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	for( path_index = 0;
+	     path_index < 4;
+	     path_index++ )
+	{
+		path_lengths[ path_index ] = wide_string_length(
+		                              test_paths[ path_index ] );
+	}
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_full_paths_wide(
+	          test_paths,
+	          path_lengths,
+	          4,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_paths",
+	 full_paths );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path_offsets",
+	 full_path_offsets );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( path_index = 0;
+	     path_index < 4;
+	     path_index++ )
+	{
+		result = libcpath_path_get_full_path_wide(
+		          test_paths[ path_index ],
+		          path_lengths[ path_index ],
+		          &expected,
+		          &expected_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_offsets[ path_index ]",
+		 full_path_offsets[ path_index ],
+		 expected_offset );
+
+		result = wide_string_compare(
+		          &( full_paths[ full_path_offsets[ path_index ] ] ),
+		          expected,
+		          expected_size );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		expected_offset += expected_size;
+
+		memory_free(
+		 expected );
+
+		expected = NULL;
+	}
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_paths_size",
+	 full_paths_size,
+	 expected_offset );
+
+	memory_free(
+	 full_paths );
+
+	full_paths = NULL;
+
+	memory_free(
+	 full_path_offsets );
+
+	full_path_offsets = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_paths_wide(
+	          NULL,
+	          path_lengths,
+	          4,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths_wide(
+	          test_paths,
+	          NULL,
+	          4,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths_wide(
+	          test_paths,
+	          path_lengths,
+	          0,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths_wide(
+	          test_paths,
+	          path_lengths,
+	          4,
+	          NULL,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths_wide(
+	          test_paths,
+	          path_lengths,
+	          4,
+	          &full_paths,
+	          NULL,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths_wide(
+	          test_paths,
+	          path_lengths,
+	          4,
+	          &full_paths,
+	          &full_paths_size,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_lengths[ 1 ] = 0;
+
+	result = libcpath_path_get_full_paths_wide(
+	          test_paths,
+	          path_lengths,
+	          4,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "full_paths",
+	 full_paths );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "full_path_offsets",
+	 full_path_offsets );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	if( full_paths != NULL )
+	{
+		memory_free(
+		 full_paths );
+	}
+	if( full_path_offsets != NULL )
+	{
+		memory_free(
+		 full_path_offsets );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+/* Tests the libcpath_path_get_sanitized_character_size_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_character_size_wide(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	size_t sanitized_character_size = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_sanitized_character_size_wide(
+	          (wchar_t) 0,
+	          &sanitized_character_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_character_size_wide(
+	          (wchar_t) LIBCPATH_ESCAPE_CHARACTER,
+	          &sanitized_character_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_character_size_wide(
+	          (wchar_t) '!',
+	          &sanitized_character_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_character_size_wide(
+	          (wchar_t) 'A',
+	          &sanitized_character_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_character_size_wide(
+	          (wchar_t) 'A',
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_character_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_character_wide(
+     void )
+{
+	wchar_t sanitized_path[ 32 ];
+
+	libcerror_error_t *error         = NULL;
+	wchar_t *expected_sanitized_path = NULL;
+	size_t sanitized_path_index      = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 0,
+	          4,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI )
+	expected_sanitized_path = L"^x00";
+#else
+	expected_sanitized_path = L"\\x00";
+#endif
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_sanitized_path,
+	          4 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) LIBCPATH_ESCAPE_CHARACTER,
+	          2,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI )
+	expected_sanitized_path = L"^^";
+#else
+	expected_sanitized_path = L"\\\\";
+#endif
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_sanitized_path,
+	          2 );
+
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 'A',
+	          1,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          L"A",
+	          1 );
+
+	/* Test error cases
+	 */
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 'A',
+	          8,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 'A',
+	          1,
+	          NULL,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 'A',
+	          1,
+	          sanitized_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 'A',
+	          1,
+	          sanitized_path,
+	          32,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sanitized_path_index = 32;
+
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 'A',
+	          1,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 32 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+/* Tests the libcpath_path_get_sanitized_filename_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_filename_wide(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	wchar_t *expected_filename     = NULL;
+	wchar_t *sanitized_filename    = NULL;
+	wchar_t *test_filename         = NULL;
+	size_t expected_filename_size  = 0;
+	size_t sanitized_filename_size = 0;
+	size_t test_filename_length    = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	/* Test libcpath_path_get_sanitized_filename without replacement characters
+	 */
+	test_filename          = L"test.txt";
+	test_filename_length   = 8;
+	expected_filename      = L"test.txt";
+	expected_filename_size = 9;
+
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_filename",
+	 sanitized_filename );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_filename_size",
+	 sanitized_filename_size,
+	 expected_filename_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_filename,
+	          expected_filename,
+	          expected_filename_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_filename );
+
+	sanitized_filename      = NULL;
+	sanitized_filename_size = 0;
+
+	/* Test libcpath_path_get_sanitized_filename with replacement characters
+	 */
+#if defined( WINAPI )
+	test_filename          = L"t\x00sT!.t^|";
+	test_filename_length   = 9;
+	expected_filename      = L"t^x00sT^x21.t^^^x7c";
+	expected_filename_size = 20;
+#else
+	test_filename          = L"t\x00sT!.t\\|";
+	test_filename_length   = 9;
+	expected_filename      = L"t\\x00sT\\x21.t\\\\\\x7c";
+	expected_filename_size = 20;
+#endif
+
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_filename",
+	 sanitized_filename );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_filename_size",
+	 sanitized_filename_size,
+	 expected_filename_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_filename,
+	          expected_filename,
+	          expected_filename_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_filename );
+
+	sanitized_filename      = NULL;
+	sanitized_filename_size = 0;
+
+	/* Test error cases
+	 */
+	test_filename          = L"test.txt";
+	test_filename_length   = 8;
+	expected_filename      = L"test.txt";
+	expected_filename_size = 9;
+
+	result = libcpath_path_get_sanitized_filename_wide(
+	          NULL,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          (size_t) -1,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          test_filename_length,
+	          NULL,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sanitized_filename = (wchar_t *) 0x12345678UL;
+
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	sanitized_filename = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	/* Test libcpath_path_get_sanitized_filename with malloc failing
+	 */
+	cpath_test_malloc_attempts_before_fail = 0;
+
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	if( cpath_test_malloc_attempts_before_fail != -1 )
+	{
+		cpath_test_malloc_attempts_before_fail = -1;
+
+		if( sanitized_filename != NULL )
+		{
+			memory_free(
+			 sanitized_filename );
+
+			sanitized_filename = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "sanitized_filename",
+		 sanitized_filename );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "sanitized_filename_size",
+		 sanitized_filename_size,
+		 (size_t) 0 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( sanitized_filename != NULL )
+	{
+		memory_free(
+		 sanitized_filename );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_filename_to_buffer_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_filename_to_buffer_wide(
+     void )
+{
+	wchar_t buffer[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	wchar_t *expected        = NULL;
+	size_t expected_size     = 0;
+	size_t required_size     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_sanitized_filename_wide(
+	          L"te:st/name",
+	          10,
+	          &expected,
+	          &expected_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          L"te:st/name",
+	          10,
+	          buffer,
+	          256,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          buffer,
+	          expected,
+	          expected_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          L"te:st/name",
+	          10,
+	          buffer,
+	          expected_size - 1,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          L"te:st/name",
+	          10,
+	          NULL,
+	          0,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 expected );
+
+	expected = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          L"te:st/name",
+	          10,
+	          NULL,
+	          256,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          L"te:st/name",
+	          10,
+	          buffer,
+	          256,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_path function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_path_wide(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	wchar_t *expected_path     = NULL;
+	wchar_t *sanitized_path    = NULL;
+	wchar_t *test_path         = NULL;
+	size_t expected_path_size  = 0;
+	size_t sanitized_path_size = 0;
+	size_t test_path_length    = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	/* Test libcpath_path_get_sanitized_path without replacement characters
+	 */
+#if defined( WINAPI )
+	test_path          = L"test\\test.txt";
+	test_path_length   = 13;
+	expected_path      = L"test\\test.txt";
+	expected_path_size = 14;
+#else
+	test_path          = L"test/test.txt";
+	test_path_length   = 13;
+	expected_path      = L"test/test.txt";
+	expected_path_size = 14;
+#endif
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_path",
+	 sanitized_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_size",
+	 sanitized_path_size,
+	 expected_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_path,
+	          expected_path_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_path );
+
+	sanitized_path      = NULL;
+	sanitized_path_size = 0;
+
+	/* Test libcpath_path_get_sanitized_path with replacement characters
+	 */
+#if defined( WINAPI )
+	test_path          = L"test\\t\x00sT!.t^|";
+	test_path_length   = 14;
+	expected_path      = L"test\\t^x00sT^x21.t^^^x7c";
+	expected_path_size = 25;
+#else
+	test_path          = L"test/t\x00sT!.t\\|";
+	test_path_length   = 14;
+	expected_path      = L"test/t\\x00sT\\x21.t\\\\\\x7c";
+	expected_path_size = 25;
+#endif
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_path",
+	 sanitized_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_size",
+	 sanitized_path_size,
+	 expected_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_path,
+	          expected_path_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_path );
+
+	sanitized_path      = NULL;
+	sanitized_path_size = 0;
+
+	/* Test error cases
+	 */
+#if defined( WINAPI )
+	test_path          = L"test\\test.txt";
+	test_path_length   = 13;
+	expected_path      = L"test\\test.txt";
+	expected_path_size = 14;
+#else
+	test_path          = L"test/test.txt";
+	test_path_length   = 13;
+	expected_path      = L"test/test.txt";
+	expected_path_size = 14;
+#endif
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          NULL,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          (size_t) -1,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          test_path_length,
+	          NULL,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sanitized_path = (wchar_t *) 0x12345678UL;
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	sanitized_path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	/* Test libcpath_path_get_sanitized_path with malloc failing
+	 */
+	cpath_test_malloc_attempts_before_fail = 0;
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	if( cpath_test_malloc_attempts_before_fail != -1 )
+	{
+		cpath_test_malloc_attempts_before_fail = -1;
+
+		if( sanitized_path != NULL )
+		{
+			memory_free(
+			 sanitized_path );
+
+			sanitized_path = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "sanitized_path",
+		 sanitized_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "sanitized_path_size",
+		 sanitized_path_size,
+		 (size_t) 0 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( sanitized_path != NULL )
+	{
+		memory_free(
+		 sanitized_path );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_path_to_buffer_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_path_to_buffer_wide(
+     void )
+{
+	wchar_t buffer[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	wchar_t *expected        = NULL;
+	size_t expected_size     = 0;
+	size_t required_size     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_sanitized_path_wide(
+	          L"first/se:cond",
+	          13,
+	          &expected,
+	          &expected_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          L"first/se:cond",
+	          13,
+	          buffer,
+	          256,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          buffer,
+	          expected,
+	          expected_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          L"first/se:cond",
+	          13,
+	          buffer,
+	          expected_size - 1,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          L"first/se:cond",
+	          13,
+	          NULL,
+	          0,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_size",
+	 required_size,
+	 expected_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 expected );
+
+	expected = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          L"first/se:cond",
+	          13,
+	          NULL,
+	          256,
+	          &required_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          L"first/se:cond",
+	          13,
+	          buffer,
+	          256,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_join_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join_wide(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	const wchar_t *expected_path = NULL;
+	wchar_t *path                = NULL;
+	const wchar_t *test_path1    = NULL;
+	const wchar_t *test_path2    = NULL;
+	const wchar_t *test_path3    = NULL;
+	const wchar_t *test_path4    = NULL;
+	size_t path_size             = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	test_path1    = L"\\first\\second";
+	test_path2    = L"third\\fourth";
+	test_path3    = L"\\first\\second\\";
+	test_path4    = L"\\third\\fourth";
+	expected_path = L"\\first\\second\\third\\fourth";
+#else
+	test_path1    = L"/first/second";
+	test_path2    = L"third/fourth";
+	test_path3    = L"/first/second/";
+	test_path4    = L"/third/fourth";
+	expected_path = L"/first/second/third/fourth";
+#endif
+
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          26 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
+
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path3,
+	          14,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          26 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
+
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path4,
+	          13,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          26 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
 
 	/* Test error cases
 	 */
-	result = libcpath_path_get_full_path_wide(
+	result = libcpath_path_join_wide(
 	          NULL,
-	          8,
-	          &full_path,
-	          &full_path_size,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5250,13 +15745,19 @@ int cpath_test_path_get_full_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path_wide(
-	          L"test.txt",
-	          0,
-	          &full_path,
-	          &full_path_size,
+	path = (wchar_t *) 0x12345678UL;
+
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
 	          &error );
 
+	path = NULL;
+
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -5269,11 +15770,13 @@ int cpath_test_path_get_full_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path_wide(
-	          L"test.txt",
-	          (size_t) -1,
-	          &full_path,
-	          &full_path_size,
+	result = libcpath_path_join_wide(
+	          &path,
+	          NULL,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5288,11 +15791,13 @@ int cpath_test_path_get_full_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path_wide(
-	          L"test.txt",
-	          8,
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
 	          NULL,
-	          &full_path_size,
+	          13,
+	          test_path2,
+	          12,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5307,17 +15812,15 @@ int cpath_test_path_get_full_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	full_path = (wchar_t *) 0x12345678UL;
-
-	result = libcpath_path_get_full_path_wide(
-	          L"test.txt",
-	          8,
-	          &full_path,
-	          &full_path_size,
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          (size_t) SSIZE_MAX + 1,
+	          test_path2,
+	          12,
 	          &error );
 
-	full_path = NULL;
-
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -5330,11 +15833,13 @@ int cpath_test_path_get_full_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path_wide(
-	          L"test.txt",
-	          8,
-	          &full_path,
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
 	          NULL,
+	          12,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5349,47 +15854,26 @@ int cpath_test_path_get_full_path_wide(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
-
-	/* Test libcpath_path_change_directory with getcwd failing
-	 */
-	cpath_test_getcwd_attempts_before_fail = 0;
-
-	result = libcpath_path_get_full_path_wide(
-	          L"test.txt",
-	          8,
-	          &full_path,
-	          &full_path_size,
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
-	if( cpath_test_getcwd_attempts_before_fail != -1 )
-	{
-		cpath_test_getcwd_attempts_before_fail = -1;
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "full_path",
-		 full_path );
-
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Clean up
-	 */
-	memory_free(
-	 current_working_directory );
+	libcerror_error_free(
+	 &error );
 
 	return( 1 );
 
@@ -5399,162 +15883,58 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( full_path != NULL )
-	{
-		memory_free(
-		 full_path );
-	}
-	if( current_working_directory != NULL )
+	if( path != NULL )
 	{
 		memory_free(
-		 current_working_directory );
+		 path );
 	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
-
-/* Tests the libcpath_path_get_sanitized_character_size_wide function
+/* Tests the libcpath_path_join_to_buffer_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_sanitized_character_size_wide(
+int cpath_test_path_join_to_buffer_wide(
      void )
 {
-	libcerror_error_t *error        = NULL;
-	size_t sanitized_character_size = 0;
-	int result                      = 0;
-
-	/* Test regular cases
-	 */
-	result = libcpath_path_get_sanitized_character_size_wide(
-	          (wchar_t) 0,
-	          &sanitized_character_size,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 4 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libcpath_path_get_sanitized_character_size_wide(
-	          (wchar_t) LIBCPATH_ESCAPE_CHARACTER,
-	          &sanitized_character_size,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 2 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libcpath_path_get_sanitized_character_size_wide(
-	          (wchar_t) '!',
-	          &sanitized_character_size,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 4 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libcpath_path_get_sanitized_character_size_wide(
-	          (wchar_t) 'A',
-	          &sanitized_character_size,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 1 );
+	wchar_t buffer[ 256 ];
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	libcerror_error_t *error = NULL;
+	wchar_t *expected        = NULL;
+	size_t expected_size     = 0;
+	size_t required_size     = 0;
+	int result               = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libcpath_path_get_sanitized_character_size_wide(
-	          (wchar_t) 'A',
-	          NULL,
+	result = libcpath_path_join_wide(
+	          &expected,
+	          &expected_size,
+	          L"/first/second",
+	          13,
+	          L"third",
+	          5,
 	          &error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libcpath_path_get_sanitized_character_wide function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_sanitized_character_wide(
-     void )
-{
-	wchar_t sanitized_path[ 32 ];
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	libcerror_error_t *error         = NULL;
-	wchar_t *expected_sanitized_path = NULL;
-	size_t sanitized_path_index      = 0;
-	int result                       = 0;
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	sanitized_path_index = 0;
-
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 0,
-	          4,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	result = libcpath_path_join_to_buffer_wide(
+	          buffer,
+	          256,
+	          &required_size,
+	          L"/first/second",
+	          13,
+	          L"third",
+	          5,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5563,104 +15943,89 @@ int cpath_test_path_get_sanitized_character_wide(
 	 1 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 4 );
+	 "required_size",
+	 required_size,
+	 expected_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-#if defined( WINAPI )
-	expected_sanitized_path = L"^x00";
-#else
-	expected_sanitized_path = L"\\x00";
-#endif
-
-	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_sanitized_path,
-	          4 );
+	result = wide_string_compare(
+	          buffer,
+	          expected,
+	          expected_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	sanitized_path_index = 0;
-
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) LIBCPATH_ESCAPE_CHARACTER,
-	          2,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	result = libcpath_path_join_to_buffer_wide(
+	          buffer,
+	          expected_size - 1,
+	          &required_size,
+	          L"/first/second",
+	          13,
+	          L"third",
+	          5,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 2 );
+	 "required_size",
+	 required_size,
+	 expected_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-#if defined( WINAPI )
-	expected_sanitized_path = L"^^";
-#else
-	expected_sanitized_path = L"\\\\";
-#endif
-
-	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_sanitized_path,
-	          2 );
-
-	sanitized_path_index = 0;
-
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 'A',
-	          1,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	result = libcpath_path_join_to_buffer_wide(
+	          NULL,
+	          0,
+	          &required_size,
+	          L"/first/second",
+	          13,
+	          L"third",
+	          5,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 1 );
+	 "required_size",
+	 required_size,
+	 expected_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          sanitized_path,
-	          L"A",
-	          1 );
+	/* Clean up
+	 */
+	memory_free(
+	 expected );
+
+	expected = NULL;
 
 	/* Test error cases
 	 */
-	sanitized_path_index = 0;
-
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 'A',
-	          8,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	result = libcpath_path_join_to_buffer_wide(
+	          NULL,
+	          256,
+	          &required_size,
+	          L"/first/second",
+	          13,
+	          L"third",
+	          5,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5668,11 +16033,6 @@ int cpath_test_path_get_sanitized_character_wide(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -5680,12 +16040,14 @@ int cpath_test_path_get_sanitized_character_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 'A',
-	          1,
+	result = libcpath_path_join_to_buffer_wide(
+	          buffer,
+	          256,
 	          NULL,
-	          32,
-	          &sanitized_path_index,
+	          L"/first/second",
+	          13,
+	          L"third",
+	          5,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5693,11 +16055,6 @@ int cpath_test_path_get_sanitized_character_wide(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -5705,37 +16062,106 @@ int cpath_test_path_get_sanitized_character_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 'A',
-	          1,
-	          sanitized_path,
-	          (size_t) SSIZE_MAX + 1,
-	          &sanitized_path_index,
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected != NULL )
+	{
+		memory_free(
+		 expected );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_join_components_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join_components_wide(
+     void )
+{
+	const wchar_t *components[ 4 ];
+	size_t component_lengths[ 4 ];
+
+	libcerror_error_t *error     = NULL;
+	const wchar_t *expected_path = NULL;
+	wchar_t *path                = NULL;
+	size_t path_size             = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	components[ 0 ] = L"\\first\\";
+	components[ 1 ] = L"\\\\second";
+	components[ 2 ] = L"\\";
+	components[ 3 ] = L"third\\fourth";
+	expected_path   = L"\\first\\second\\third\\fourth";
+#else
+	components[ 0 ] = L"/first/";
+	components[ 1 ] = L"//second";
+	components[ 2 ] = L"/";
+	components[ 3 ] = L"third/fourth";
+	expected_path   = L"/first/second/third/fourth";
+#endif
+	component_lengths[ 0 ] = 7;
+	component_lengths[ 1 ] = 8;
+	component_lengths[ 2 ] = 1;
+	component_lengths[ 3 ] = 12;
+
+	result = libcpath_path_join_components_wide(
+	          &path,
+	          &path_size,
+	          components,
+	          component_lengths,
+	          4,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
+	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "path",
+	 path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
 
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 'A',
-	          1,
-	          sanitized_path,
-	          32,
+	result = wide_string_compare(
+	          path,
+	          expected_path,
+	          27 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_join_components_wide(
 	          NULL,
+	          &path_size,
+	          components,
+	          component_lengths,
+	          4,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5743,11 +16169,6 @@ int cpath_test_path_get_sanitized_character_wide(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -5755,14 +16176,12 @@ int cpath_test_path_get_sanitized_character_wide(
 	libcerror_error_free(
 	 &error );
 
-	sanitized_path_index = 32;
-
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 'A',
-	          1,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	result = libcpath_path_join_components_wide(
+	          &path,
+	          NULL,
+	          components,
+	          component_lengths,
+	          4,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5770,11 +16189,6 @@ int cpath_test_path_get_sanitized_character_wide(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 32 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -5782,103 +16196,75 @@ int cpath_test_path_get_sanitized_character_wide(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
-
-/* Tests the libcpath_path_get_sanitized_filename_wide function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_sanitized_filename_wide(
-     void )
-{
-	libcerror_error_t *error       = NULL;
-	wchar_t *expected_filename     = NULL;
-	wchar_t *sanitized_filename    = NULL;
-	wchar_t *test_filename         = NULL;
-	size_t expected_filename_size  = 0;
-	size_t sanitized_filename_size = 0;
-	size_t test_filename_length    = 0;
-	int result                     = 0;
-
-	/* Test regular cases
-	 */
-	/* Test libcpath_path_get_sanitized_filename without replacement characters
-	 */
-	test_filename          = L"test.txt";
-	test_filename_length   = 8;
-	expected_filename      = L"test.txt";
-	expected_filename_size = 9;
-
-	result = libcpath_path_get_sanitized_filename_wide(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	result = libcpath_path_join_components_wide(
+	          &path,
+	          &path_size,
+	          NULL,
+	          component_lengths,
+	          4,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_filename",
-	 sanitized_filename );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_filename_size",
-	 sanitized_filename_size,
-	 expected_filename_size );
-
-	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          sanitized_filename,
-	          expected_filename,
-	          expected_filename_size );
+	libcerror_error_free(
+	 &error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	return( 1 );
 
-	memory_free(
-	 sanitized_filename );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( 0 );
+}
 
-	sanitized_filename      = NULL;
-	sanitized_filename_size = 0;
+/* Tests the libcpath_path_join_sanitized_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join_sanitized_wide(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	const wchar_t *expected_path = NULL;
+	const wchar_t *test_filename = NULL;
+	const wchar_t *test_path     = NULL;
+	wchar_t *path                = NULL;
+	size_t path_size             = 0;
+	int result                   = 0;
 
-	/* Test libcpath_path_get_sanitized_filename with replacement characters
+	/* Test regular cases
 	 */
 #if defined( WINAPI )
-	test_filename          = L"t\x00sT!.t^|";
-	test_filename_length   = 9;
-	expected_filename      = L"t^x00sT^x21.t^^^x7c";
-	expected_filename_size = 20;
+	test_path     = L"\\output\\";
+	test_filename = L"t\x00sT!.t^|";
+	expected_path = L"\\output\\t^x00sT^x21.t^^^x7c";
 #else
-	test_filename          = L"t\x00sT!.t\\|";
-	test_filename_length   = 9;
-	expected_filename      = L"t\\x00sT\\x21.t\\\\\\x7c";
-	expected_filename_size = 20;
+	test_path     = L"/output/";
+	test_filename = L"t\x00sT!.t\\|";
+	expected_path = L"/output/t\\x00sT\\x21.t\\\\\\x7c";
 #endif
 
-	result = libcpath_path_get_sanitized_filename_wide(
+	result = libcpath_path_join_sanitized_wide(
+	          &path,
+	          &path_size,
+	          test_path,
+	          8,
 	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	          9,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5887,22 +16273,22 @@ int cpath_test_path_get_sanitized_filename_wide(
 	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_filename",
-	 sanitized_filename );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_filename_size",
-	 sanitized_filename_size,
-	 expected_filename_size );
+	 "path",
+	 path );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          sanitized_filename,
-	          expected_filename,
-	          expected_filename_size );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 28 );
+
+	result = wide_string_compare(
+	          path,
+	          expected_path,
+	          28 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -5910,23 +16296,19 @@ int cpath_test_path_get_sanitized_filename_wide(
 	 0 );
 
 	memory_free(
-	 sanitized_filename );
+	 path );
 
-	sanitized_filename      = NULL;
-	sanitized_filename_size = 0;
+	path = NULL;
 
 	/* Test error cases
 	 */
-	test_filename          = L"test.txt";
-	test_filename_length   = 8;
-	expected_filename      = L"test.txt";
-	expected_filename_size = 9;
-
-	result = libcpath_path_get_sanitized_filename_wide(
+	result = libcpath_path_join_sanitized_wide(
 	          NULL,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	          &path_size,
+	          test_path,
+	          8,
+	          test_filename,
+	          9,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5941,11 +16323,13 @@ int cpath_test_path_get_sanitized_filename_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_filename_wide(
+	result = libcpath_path_join_sanitized_wide(
+	          &path,
+	          NULL,
+	          test_path,
+	          8,
 	          test_filename,
-	          (size_t) -1,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	          9,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5960,11 +16344,13 @@ int cpath_test_path_get_sanitized_filename_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_filename_wide(
+	result = libcpath_path_join_sanitized_wide(
+	          &path,
+	          &path_size,
+	          test_path,
+	          8,
 	          test_filename,
-	          test_filename_length,
-	          NULL,
-	          &sanitized_filename_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5979,106 +16365,96 @@ int cpath_test_path_get_sanitized_filename_wide(
 	libcerror_error_free(
 	 &error );
 
-	sanitized_filename = (wchar_t *) 0x12345678UL;
-
-	result = libcpath_path_get_sanitized_filename_wide(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
-	          &error );
+	return( 1 );
 
-	sanitized_filename = NULL;
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( 0 );
+}
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+/* Tests the libcpath_CreateDirectoryW function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_CreateDirectoryW(
+     void )
+{
+	BOOL result = FALSE;
 
-	libcerror_error_free(
-	 &error );
+	/* Test regular cases
+	 */
 
-	result = libcpath_path_get_sanitized_filename_wide(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
+	/* Test error cases
+	 */
+	result = libcpath_CreateDirectoryW(
 	          NULL,
-	          &error );
+	          NULL );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	 FALSE );
 
-	libcerror_error_free(
-	 &error );
+	result = libcpath_CreateDirectoryW(
+	          L".",
+	          NULL );
 
-#if defined( HAVE_CPATH_TEST_MEMORY )
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 FALSE );
 
-	/* Test libcpath_path_get_sanitized_filename with malloc failing
-	 */
-	cpath_test_malloc_attempts_before_fail = 0;
+	return( 1 );
 
-	result = libcpath_path_get_sanitized_filename_wide(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
-	          &error );
+on_error:
+	return( 0 );
+}
 
-	if( cpath_test_malloc_attempts_before_fail != -1 )
-	{
-		cpath_test_malloc_attempts_before_fail = -1;
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
 
-		if( sanitized_filename != NULL )
-		{
-			memory_free(
-			 sanitized_filename );
+/* Tests the libcpath_path_make_directory_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_wide(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
-			sanitized_filename = NULL;
-		}
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	/* Test regular cases
+	 */
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "sanitized_filename",
-		 sanitized_filename );
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory_wide(
+	          NULL,
+	          &error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "sanitized_filename_size",
-		 sanitized_filename_size,
-		 (size_t) 0 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+	libcerror_error_free(
+	 &error );
 
 	return( 1 );
 
 on_error:
-	if( sanitized_filename != NULL )
-	{
-		memory_free(
-		 sanitized_filename );
-	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -6087,42 +16463,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcpath_path_get_sanitized_path function
+#if !defined( WINAPI )
+
+/* Tests the libcpath_path_make_directory_recursive_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_sanitized_path_wide(
+int cpath_test_path_make_directory_recursive_wide(
      void )
 {
-	libcerror_error_t *error   = NULL;
-	wchar_t *expected_path     = NULL;
-	wchar_t *sanitized_path    = NULL;
-	wchar_t *test_path         = NULL;
-	size_t expected_path_size  = 0;
-	size_t sanitized_path_size = 0;
-	size_t test_path_length    = 0;
-	int result                 = 0;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	/* Test libcpath_path_get_sanitized_path without replacement characters
-	 */
-#if defined( WINAPI )
-	test_path          = L"test\\test.txt";
-	test_path_length   = 13;
-	expected_path      = L"test\\test.txt";
-	expected_path_size = 14;
-#else
-	test_path          = L"test/test.txt";
-	test_path_length   = 13;
-	expected_path      = L"test/test.txt";
-	expected_path_size = 14;
-#endif
-
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_make_directory_recursive_wide(
+	          L".",
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6130,54 +16485,12 @@ int cpath_test_path_get_sanitized_path_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_path",
-	 sanitized_path );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_size",
-	 sanitized_path_size,
-	 expected_path_size );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_path,
-	          expected_path_size );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	memory_free(
-	 sanitized_path );
-
-	sanitized_path      = NULL;
-	sanitized_path_size = 0;
-
-	/* Test libcpath_path_get_sanitized_path with replacement characters
-	 */
-#if defined( WINAPI )
-	test_path          = L"test\\t\x00sT!.t^|";
-	test_path_length   = 14;
-	expected_path      = L"test\\t^x00sT^x21.t^^^x7c";
-	expected_path_size = 25;
-#else
-	test_path          = L"test/t\x00sT!.t\\|";
-	test_path_length   = 14;
-	expected_path      = L"test/t\\x00sT\\x21.t\\\\\\x7c";
-	expected_path_size = 25;
-#endif
-
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_make_directory_recursive_wide(
+	          L"/",
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6185,73 +16498,14 @@ int cpath_test_path_get_sanitized_path_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_path",
-	 sanitized_path );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_size",
-	 sanitized_path_size,
-	 expected_path_size );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_path,
-	          expected_path_size );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	memory_free(
-	 sanitized_path );
-
-	sanitized_path      = NULL;
-	sanitized_path_size = 0;
-
 	/* Test error cases
 	 */
-#if defined( WINAPI )
-	test_path          = L"test\\test.txt";
-	test_path_length   = 13;
-	expected_path      = L"test\\test.txt";
-	expected_path_size = 14;
-#else
-	test_path          = L"test/test.txt";
-	test_path_length   = 13;
-	expected_path      = L"test/test.txt";
-	expected_path_size = 14;
-#endif
-
-	result = libcpath_path_get_sanitized_path_wide(
+	result = libcpath_path_make_directory_recursive_wide(
 	          NULL,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          (size_t) -1,
-	          &sanitized_path,
-	          &sanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6266,11 +16520,8 @@ int cpath_test_path_get_sanitized_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          test_path_length,
-	          NULL,
-	          &sanitized_path_size,
+	result = libcpath_path_make_directory_recursive_wide(
+	          L"",
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6285,17 +16536,12 @@ int cpath_test_path_get_sanitized_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	sanitized_path = (wchar_t *) 0x12345678UL;
-
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	/* Test with an existing file in the path
+	 */
+	result = libcpath_path_make_directory_recursive_wide(
+	          L"/dev/null/directory",
 	          &error );
 
-	sanitized_path = NULL;
-
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -6308,11 +16554,8 @@ int cpath_test_path_get_sanitized_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          NULL,
+	result = libcpath_path_make_directory_recursive_wide(
+	          L"/dev/null",
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6327,64 +16570,9 @@ int cpath_test_path_get_sanitized_path_wide(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CPATH_TEST_MEMORY )
-
-	/* Test libcpath_path_get_sanitized_path with malloc failing
-	 */
-	cpath_test_malloc_attempts_before_fail = 0;
-
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
-	          &error );
-
-	if( cpath_test_malloc_attempts_before_fail != -1 )
-	{
-		cpath_test_malloc_attempts_before_fail = -1;
-
-		if( sanitized_path != NULL )
-		{
-			memory_free(
-			 sanitized_path );
-
-			sanitized_path = NULL;
-		}
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "sanitized_path",
-		 sanitized_path );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "sanitized_path_size",
-		 sanitized_path_size,
-		 (size_t) 0 );
-
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
-
 	return( 1 );
 
 on_error:
-	if( sanitized_path != NULL )
-	{
-		memory_free(
-		 sanitized_path );
-	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -6393,45 +16581,25 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcpath_path_join_wide function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_join_wide(
-     void )
-{
-	libcerror_error_t *error     = NULL;
-	const wchar_t *expected_path = NULL;
-	wchar_t *path                = NULL;
-	const wchar_t *test_path1    = NULL;
-	const wchar_t *test_path2    = NULL;
-	const wchar_t *test_path3    = NULL;
-	const wchar_t *test_path4    = NULL;
-	size_t path_size             = 0;
-	int result                   = 0;
+#endif /* !defined( WINAPI ) */
 
-	/* Test regular cases
-	 */
-#if defined( WINAPI )
-	test_path1    = L"\\first\\second";
-	test_path2    = L"third\\fourth";
-	test_path3    = L"\\first\\second\\";
-	test_path4    = L"\\third\\fourth";
-	expected_path = L"\\first\\second\\third\\fourth";
-#else
-	test_path1    = L"/first/second";
-	test_path2    = L"third/fourth";
-	test_path3    = L"/first/second/";
-	test_path4    = L"/third/fourth";
-	expected_path = L"/first/second/third/fourth";
-#endif
+#if !defined( WINAPI )
+
+/* Tests the libcpath_path_make_directory_with_cache_wide and libcpath_path_make_directory_recursive_with_cache_wide functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_with_cache_wide(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libcpath_directory_cache_t *directory_cache = NULL;
+	int number_of_entries                       = 0;
+	int result                                  = 0;
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
+	/* Initialize test
+	 */
+	result = libcpath_directory_cache_initialize(
+	          &directory_cache,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6439,37 +16607,47 @@ int cpath_test_path_join_wide(
 	 result,
 	 1 );
 
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_cache",
+	 directory_cache );
+
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          path,
-	          expected_path,
-	          26 );
+	/* Test regular cases
+	 */
+	result = libcpath_path_make_directory_with_cache_wide(
+	          directory_cache,
+	          L"./",
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-	memory_free(
-	 path );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	path = NULL;
+	result = libcpath_path_make_directory_recursive_with_cache_wide(
+	          directory_cache,
+	          L".",
+	          &error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "path_size",
-	 path_size,
-	 (size_t) 27 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path3,
-	          14,
-	          test_path2,
-	          12,
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_get_number_of_entries(
+	          directory_cache,
+	          &number_of_entries,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6477,77 +16655,71 @@ int cpath_test_path_join_wide(
 	 result,
 	 1 );
 
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          path,
-	          expected_path,
-	          26 );
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory_with_cache_wide(
+	          NULL,
+	          L".",
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	memory_free(
-	 path );
+	 -1 );
 
-	path = NULL;
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "path_size",
-	 path_size,
-	 (size_t) 27 );
+	libcerror_error_free(
+	 &error );
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path4,
-	          13,
+	result = libcpath_path_make_directory_with_cache_wide(
+	          directory_cache,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          path,
-	          expected_path,
-	          26 );
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directory_with_cache_wide(
+	          directory_cache,
+	          L"/dev/null",
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	memory_free(
-	 path );
+	 -1 );
 
-	path = NULL;
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "path_size",
-	 path_size,
-	 (size_t) 27 );
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_join_wide(
+	result = libcpath_path_make_directory_recursive_with_cache_wide(
 	          NULL,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
+	          L".",
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6562,19 +16734,11 @@ int cpath_test_path_join_wide(
 	libcerror_error_free(
 	 &error );
 
-	path = (wchar_t *) 0x12345678UL;
-
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
+	result = libcpath_path_make_directory_recursive_with_cache_wide(
+	          directory_cache,
+	          NULL,
 	          &error );
 
-	path = NULL;
-
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -6587,13 +16751,9 @@ int cpath_test_path_join_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          NULL,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
+	result = libcpath_path_make_directory_recursive_with_cache_wide(
+	          directory_cache,
+	          L"/dev/null/directory",
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6608,177 +16768,295 @@ int cpath_test_path_join_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          NULL,
-	          13,
-	          test_path2,
-	          12,
+	/* Test that failed directories are not added to the cache
+	 */
+	result = libcpath_directory_cache_get_number_of_entries(
+	          directory_cache,
+	          &number_of_entries,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcpath_directory_cache_free(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_cache != NULL )
+	{
+		libcpath_directory_cache_free(
+		 &directory_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) */
+
+#if !defined( WINAPI )
+
+/* Tests the wide character make directory functions that take a status
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_with_status_wide(
+     void )
+{
+	libcpath_status_t status;
+
+	libcerror_error_t *error                    = NULL;
+	libcpath_context_t *context                 = NULL;
+	libcpath_directory_cache_t *directory_cache = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_context_initialize(
+	          &context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_initialize(
+	          &directory_cache,
 	          &error );
 
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	status.error_domain      = LIBCERROR_ERROR_DOMAIN_RUNTIME;
+	status.error_code        = LIBCERROR_RUNTIME_ERROR_SET_FAILED;
+	status.system_error_code = EEXIST;
+
+	result = libcpath_path_make_directory_recursive_with_status_wide(
+	          L".",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 0 );
+
+	status.error_domain = LIBCERROR_ERROR_DOMAIN_RUNTIME;
+
+	result = libcpath_path_make_directory_with_cache_with_status_wide(
+	          directory_cache,
+	          L".",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 0 );
+
+	status.error_domain = LIBCERROR_ERROR_DOMAIN_RUNTIME;
+
+	result = libcpath_path_make_directory_recursive_with_cache_with_status_wide(
+	          directory_cache,
+	          L".",
+	          &status );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory_with_status_wide(
+	          L".",
+	          &status );
+
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME );
 
-	libcerror_error_free(
-	 &error );
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) EEXIST );
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          (size_t) SSIZE_MAX + 1,
-	          test_path2,
-	          12,
-	          &error );
+	result = libcpath_path_make_directory_context_with_status_wide(
+	          context,
+	          L".",
+	          &status );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) EEXIST );
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          NULL,
-	          12,
-	          &error );
+	result = libcpath_path_make_directory_with_cache_with_status_wide(
+	          directory_cache,
+	          L"/dev/null",
+	          &status );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) EEXIST );
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          (size_t) SSIZE_MAX + 1,
-	          &error );
+	result = libcpath_path_make_directory_recursive_with_status_wide(
+	          L"/dev/null/directory",
+	          &status );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( path != NULL )
-	{
-		memory_free(
-		 path );
-	}
-	return( 0 );
-}
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) ENOTDIR );
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+	result = libcpath_path_make_directory_recursive_with_cache_with_status_wide(
+	          directory_cache,
+	          L"/dev/null/directory",
+	          &status );
 
-/* Tests the libcpath_CreateDirectoryW function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_CreateDirectoryW(
-     void )
-{
-	BOOL result = FALSE;
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	/* Test regular cases
-	 */
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "status.system_error_code",
+	 status.system_error_code,
+	 (uint32_t) ENOTDIR );
 
-	/* Test error cases
-	 */
-	result = libcpath_CreateDirectoryW(
+	result = libcpath_path_make_directory_with_status_wide(
 	          NULL,
-	          NULL );
+	          &status );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 FALSE );
+	 -1 );
 
-	result = libcpath_CreateDirectoryW(
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS );
+
+	result = libcpath_path_make_directory_context_with_status_wide(
+	          NULL,
 	          L".",
-	          NULL );
+	          &status );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 FALSE );
-
-	return( 1 );
+	 -1 );
 
-on_error:
-	return( 0 );
-}
+	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+	 "status.error_domain",
+	 status.error_domain,
+	 0 );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+	/* Clean up
+	 */
+	result = libcpath_directory_cache_free(
+	          &directory_cache,
+	          &error );
 
-/* Tests the libcpath_path_make_directory_wide function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_make_directory_wide(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* Test regular cases
-	 */
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_make_directory_wide(
-	          NULL,
+	result = libcpath_context_free(
+	          &context,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -6787,9 +17065,23 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( directory_cache != NULL )
+	{
+		libcpath_directory_cache_free(
+		 &directory_cache,
+		 NULL );
+	}
+	if( context != NULL )
+	{
+		libcpath_context_free(
+		 &context,
+		 NULL );
+	}
 	return( 0 );
 }
 
+#endif /* !defined( WINAPI ) */
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 /* The main program
@@ -6823,6 +17115,14 @@ int main(
 	 "libcpath_path_change_directory",
 	 cpath_test_path_change_directory );
 
+#if !defined( WINAPI )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_change_directory_context",
+	 cpath_test_path_change_directory_context );
+
+#endif /* !defined( WINAPI ) */
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 	CPATH_TEST_RUN(
@@ -6835,6 +17135,38 @@ int main(
 	 "libcpath_path_get_current_working_directory",
 	 cpath_test_path_get_current_working_directory );
 
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI ) && defined( HAVE_GETCWD )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_getcwd",
+	 cpath_test_path_getcwd );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI ) && defined( HAVE_GETCWD ) */
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_normalized_working_directory",
+	 cpath_test_path_get_normalized_working_directory );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI ) */
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_current_working_directory_cache_mode",
+	 cpath_test_path_get_current_working_directory_cache_mode );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_set_current_working_directory_cache_mode",
+	 cpath_test_path_set_current_working_directory_cache_mode );
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_cached_current_working_directory",
+	 cpath_test_path_get_cached_current_working_directory );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( HAVE_LIBCPATH_CURRENT_WORKING_DIRECTORY_CACHE ) */
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI )
 
 	CPATH_TEST_RUN(
@@ -6851,10 +17183,66 @@ int main(
 
 #endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) */
 
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_normalize_with_base",
+	 cpath_test_path_normalize_with_base );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_normalize_with_normalized_base",
+	 cpath_test_path_normalize_with_normalized_base );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI ) */
+
 	CPATH_TEST_RUN(
 	 "libcpath_path_get_full_path",
 	 cpath_test_path_get_full_path );
 
+#if !defined( WINAPI )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_path_context",
+	 cpath_test_path_get_full_path_context );
+
+#endif /* !defined( WINAPI ) */
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_path_to_buffer",
+	 cpath_test_path_get_full_path_to_buffer );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_path_arena",
+	 cpath_test_path_get_full_path_arena );
+
+#if !defined( WINAPI )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_path_with_deep_directory",
+	 cpath_test_path_get_full_path_with_deep_directory );
+
+#endif /* !defined( WINAPI ) */
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_paths",
+	 cpath_test_path_get_full_paths );
+
+#if !defined( WINAPI )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_path_with_base",
+	 cpath_test_path_get_full_path_with_base );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_normalize_to_buffer",
+	 cpath_test_path_normalize_to_buffer );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_normalize",
+	 cpath_test_path_normalize );
+
+#endif /* !defined( WINAPI ) */
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
 
 	CPATH_TEST_RUN(
@@ -6871,14 +17259,46 @@ int main(
 	 "libcpath_path_get_sanitized_filename",
 	 cpath_test_path_get_sanitized_filename );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_sanitized_filename_to_buffer",
+	 cpath_test_path_get_sanitized_filename_to_buffer );
+
 	CPATH_TEST_RUN(
 	 "libcpath_path_get_sanitized_path",
 	 cpath_test_path_get_sanitized_path );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_sanitized_path_to_buffer",
+	 cpath_test_path_get_sanitized_path_to_buffer );
+
 	CPATH_TEST_RUN(
 	 "libcpath_path_join",
 	 cpath_test_path_join );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_to_buffer",
+	 cpath_test_path_join_to_buffer );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_arena",
+	 cpath_test_path_join_arena );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_components",
+	 cpath_test_path_join_components );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_components_to_buffer",
+	 cpath_test_path_join_components_to_buffer );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_sanitized",
+	 cpath_test_path_join_sanitized );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_sanitized_to_buffer",
+	 cpath_test_path_join_sanitized_to_buffer );
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 	CPATH_TEST_RUN(
@@ -6891,6 +17311,54 @@ int main(
 	 "libcpath_path_make_directory",
 	 cpath_test_path_make_directory );
 
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_has_parent_directory_segment",
+	 cpath_test_path_has_parent_directory_segment );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+#if !defined( WINAPI )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_recursive",
+	 cpath_test_path_make_directory_recursive );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_recursive_missing",
+	 cpath_test_path_make_directory_recursive_missing );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_with_status",
+	 cpath_test_path_make_directory_with_status );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_context_with_status",
+	 cpath_test_path_make_directory_context_with_status );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_with_cache_with_status",
+	 cpath_test_path_make_directory_with_cache_with_status );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_with_cache",
+	 cpath_test_path_make_directory_with_cache );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_with_cache_relative",
+	 cpath_test_path_make_directory_with_cache_relative );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directories",
+	 cpath_test_path_make_directories );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directories_context",
+	 cpath_test_path_make_directories_context );
+
+#endif /* !defined( WINAPI ) */
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
@@ -6933,10 +17401,30 @@ int main(
 
 #endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) */
 
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_normalize_with_normalized_narrow_base_wide",
+	 cpath_test_path_normalize_with_normalized_narrow_base_wide );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( WINAPI ) */
+
 	CPATH_TEST_RUN(
 	 "libcpath_path_get_full_path_wide",
 	 cpath_test_path_get_full_path_wide );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_path_context_wide",
+	 cpath_test_path_get_full_path_context_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_path_to_buffer_wide",
+	 cpath_test_path_get_full_path_to_buffer_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_paths_wide",
+	 cpath_test_path_get_full_paths_wide );
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
 
 	CPATH_TEST_RUN(
@@ -6953,14 +17441,34 @@ int main(
 	 "libcpath_path_get_sanitized_filename_wide",
 	 cpath_test_path_get_sanitized_filename_wide );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_sanitized_filename_to_buffer_wide",
+	 cpath_test_path_get_sanitized_filename_to_buffer_wide );
+
 	CPATH_TEST_RUN(
 	 "libcpath_path_get_sanitized_path_wide",
 	 cpath_test_path_get_sanitized_path_wide );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_sanitized_path_to_buffer_wide",
+	 cpath_test_path_get_sanitized_path_to_buffer_wide );
+
 	CPATH_TEST_RUN(
 	 "libcpath_path_join_wide",
 	 cpath_test_path_join_wide );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_to_buffer_wide",
+	 cpath_test_path_join_to_buffer_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_components_wide",
+	 cpath_test_path_join_components_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_sanitized_wide",
+	 cpath_test_path_join_sanitized_wide );
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 	CPATH_TEST_RUN(
@@ -6973,6 +17481,22 @@ int main(
 	 "libcpath_path_make_directory_wide",
 	 cpath_test_path_make_directory_wide );
 
+#if !defined( WINAPI )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_recursive_wide",
+	 cpath_test_path_make_directory_recursive_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_with_cache_wide",
+	 cpath_test_path_make_directory_with_cache_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_with_status_wide",
+	 cpath_test_path_make_directory_with_status_wide );
+
+#endif /* !defined( WINAPI ) */
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,730 @@
+/*
+ * Library path builder functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_macros.h"
+#include "cpath_test_unused.h"
+
+/* Tests the libcpath_path_builder_initialize and libcpath_path_builder_free functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_builder_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libcpath_path_builder_t *path_builder = NULL;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_builder_initialize(
+	          &path_builder,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "path_builder",
+	 path_builder );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_free(
+	          &path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "path_builder",
+	 path_builder );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_builder_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_builder = (libcpath_path_builder_t *) 0x12345678UL;
+
+	result = libcpath_path_builder_initialize(
+	          &path_builder,
+	          0,
+	          &error );
+
+	path_builder = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_initialize(
+	          &path_builder,
+	          0xff,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_free(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_builder != NULL )
+	{
+		libcpath_path_builder_free(
+		 &path_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_builder_push_component and libcpath_path_builder_pop_component functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_builder_push_component(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libcpath_path_builder_t *path_builder = NULL;
+	const char *expected_path             = NULL;
+	const char *path                      = NULL;
+	size_t path_length                    = 0;
+	int component_index                   = 0;
+	int number_of_components              = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_builder_initialize(
+	          &path_builder,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "path_builder",
+	 path_builder );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI )
+	result = libcpath_path_builder_set_base_path(
+	          path_builder,
+	          "C:\\",
+	          3,
+	          &error );
+
+	expected_path = "C:\\first\\second";
+#else
+	result = libcpath_path_builder_set_base_path(
+	          path_builder,
+	          "/",
+	          1,
+	          &error );
+
+	expected_path = "/first/second";
+#endif
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_builder_push_component(
+	          path_builder,
+	          "first",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_push_component(
+	          path_builder,
+	          "second",
+	          6,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_get_path(
+	          path_builder,
+	          &path,
+	          &path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_length",
+	 path_length,
+	 narrow_string_length(
+	  expected_path ) );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          path_length + 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_builder_pop_component(
+	          path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_get_path(
+	          path_builder,
+	          &path,
+	          &path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_length",
+	 path_length,
+	 narrow_string_length(
+	  expected_path ) - 7 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path[ path_length ]",
+	 (int) path[ path_length ],
+	 0 );
+
+	/* Test growth of the path and component offsets beyond their initial size
+	 */
+	for( component_index = 0;
+	     component_index < 1000;
+	     component_index++ )
+	{
+		result = libcpath_path_builder_push_component(
+		          path_builder,
+		          "directory",
+		          9,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcpath_path_builder_get_number_of_components(
+	          path_builder,
+	          &number_of_components,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "number_of_components",
+	 number_of_components,
+	 1001 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_get_path(
+	          path_builder,
+	          &path,
+	          &path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_length",
+	 path_length,
+	 narrow_string_length(
+	  expected_path ) - 7 + ( 1000 * 10 ) );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( component_index = 0;
+	     component_index < 1001;
+	     component_index++ )
+	{
+		result = libcpath_path_builder_pop_component(
+		          path_builder,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The base path remains after all the components are popped
+	 */
+	result = libcpath_path_builder_pop_component(
+	          path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_get_path(
+	          path_builder,
+	          &path,
+	          &path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_length",
+	 path_length,
+	 narrow_string_length(
+	  expected_path ) - 12 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_builder_push_component(
+	          NULL,
+	          "first",
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_push_component(
+	          path_builder,
+	          NULL,
+	          5,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_push_component(
+	          path_builder,
+	          "first",
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_pop_component(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_get_path(
+	          path_builder,
+	          NULL,
+	          &path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_path_builder_free(
+	          &path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_builder != NULL )
+	{
+		libcpath_path_builder_free(
+		 &path_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_builder_push_component function with sanitization
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_builder_push_component_sanitize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libcpath_path_builder_t *path_builder = NULL;
+	const char *expected_path             = NULL;
+	const char *path                      = NULL;
+	size_t path_length                    = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_builder_initialize(
+	          &path_builder,
+	          LIBCPATH_PATH_BUILDER_FLAG_SANITIZE,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "path_builder",
+	 path_builder );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	result = libcpath_path_builder_push_component(
+	          path_builder,
+	          "t\x00sT!.t^|",
+	          9,
+	          &error );
+
+	expected_path = "t^x00sT^x21.t^^^x7c";
+#else
+	result = libcpath_path_builder_push_component(
+	          path_builder,
+	          "t\x00sT!.t\\|",
+	          9,
+	          &error );
+
+	expected_path = "t\\x00sT\\x21.t\\\\\\x7c";
+#endif
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_get_path(
+	          path_builder,
+	          &path,
+	          &path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_length",
+	 path_length,
+	 (size_t) 19 );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          20 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libcpath_path_builder_free(
+	          &path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_builder != NULL )
+	{
+		libcpath_path_builder_free(
+		 &path_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( argc )
+	CPATH_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_builder_initialize",
+	 cpath_test_path_builder_initialize );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_builder_push_component",
+	 cpath_test_path_builder_push_component );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_builder_push_component_sanitize",
+	 cpath_test_path_builder_push_component_sanitize );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
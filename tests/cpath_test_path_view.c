@@ -0,0 +1,1086 @@
+/*
+ * Library path view functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_macros.h"
+#include "cpath_test_unused.h"
+
+/* The test paths are specified with / as separator, which is replaced
+ * by the platform specific separator before testing
+ */
+typedef struct cpath_test_path_view_test_value cpath_test_path_view_test_value_t;
+
+struct cpath_test_path_view_test_value
+{
+	/* The path
+	 */
+	const char *path;
+
+	/* The expected directory name
+	 */
+	const char *directory_name;
+
+	/* The expected base name
+	 */
+	const char *base_name;
+
+	/* The expected extension or NULL if none
+	 */
+	const char *extension;
+};
+
+cpath_test_path_view_test_value_t cpath_test_path_view_test_values[] = {
+	{ "/usr/lib/", "/usr", "lib", NULL },
+	{ "/usr/lib", "/usr", "lib", NULL },
+	{ "/usr", "/", "usr", NULL },
+	{ "/", "/", "/", NULL },
+	{ "usr", ".", "usr", NULL },
+	{ "", ".", "", NULL },
+	{ "//usr//lib//", "//usr", "lib", NULL },
+	{ "a/b.txt", "a", "b.txt", "txt" },
+	{ "a/archive.tar.gz", "a", "archive.tar.gz", "gz" },
+	{ "a/.profile", "a", ".profile", NULL },
+	{ "a/file.", "a", "file.", NULL },
+	{ "a/..", "a", "..", NULL },
+	{ "a.d/b", "a.d", "b", NULL },
+	{ NULL, NULL, NULL, NULL } };
+
+/* Copies a test path and replaces / by the platform specific separator
+ */
+void cpath_test_path_view_copy_path(
+      const char *path,
+      char *buffer,
+      size_t buffer_size )
+{
+	size_t path_index = 0;
+
+	for( path_index = 0;
+	     ( path[ path_index ] != 0 ) && ( path_index < ( buffer_size - 1 ) );
+	     path_index++ )
+	{
+		if( path[ path_index ] == '/' )
+		{
+			buffer[ path_index ] = LIBCPATH_SEPARATOR;
+		}
+		else
+		{
+			buffer[ path_index ] = path[ path_index ];
+		}
+	}
+	buffer[ path_index ] = 0;
+}
+
+/* Tests the libcpath_path_view_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_view_initialize(
+     void )
+{
+	libcpath_path_view_t path_view;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_view_initialize(
+	          &path_view,
+	          "test",
+	          4,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_view.path_length",
+	 path_view.path_length,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_view.front_index",
+	 path_view.front_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_view.back_index",
+	 path_view.back_index,
+	 (size_t) 4 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_view_initialize(
+	          NULL,
+	          "test",
+	          4,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_view_initialize(
+	          &path_view,
+	          NULL,
+	          4,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_view_initialize(
+	          &path_view,
+	          "test",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_view_get_next_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_view_get_next_segment(
+     void )
+{
+	char path[ 32 ];
+
+	const char *expected_segments[ 3 ] = { "usr", "lib", "x86_64" };
+	libcpath_path_view_t path_view;
+
+	libcerror_error_t *error           = NULL;
+	const char *segment                = NULL;
+	size_t segment_length              = 0;
+	int result                         = 0;
+	int segment_index                  = 0;
+
+	cpath_test_path_view_copy_path(
+	 "/usr//lib/x86_64/",
+	 path,
+	 32 );
+
+	result = libcpath_path_view_initialize(
+	          &path_view,
+	          path,
+	          17,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( segment_index = 0;
+	     segment_index < 3;
+	     segment_index++ )
+	{
+		result = libcpath_path_view_get_next_segment(
+		          &path_view,
+		          &segment,
+		          &segment_length,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "segment_length",
+		 segment_length,
+		 narrow_string_length( expected_segments[ segment_index ] ) );
+
+		result = narrow_string_compare(
+		          segment,
+		          expected_segments[ segment_index ],
+		          segment_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcpath_path_view_get_next_segment(
+	          &path_view,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_view_get_next_segment(
+	          NULL,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_view_get_next_segment(
+	          &path_view,
+	          NULL,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_view_get_next_segment(
+	          &path_view,
+	          &segment,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_view_get_previous_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_view_get_previous_segment(
+     void )
+{
+	char path[ 32 ];
+
+	const char *expected_segments[ 3 ] = { "x86_64", "lib", "usr" };
+	libcpath_path_view_t path_view;
+
+	libcerror_error_t *error           = NULL;
+	const char *segment                = NULL;
+	size_t segment_length              = 0;
+	int result                         = 0;
+	int segment_index                  = 0;
+
+	cpath_test_path_view_copy_path(
+	 "/usr//lib/x86_64/",
+	 path,
+	 32 );
+
+	result = libcpath_path_view_initialize(
+	          &path_view,
+	          path,
+	          17,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( segment_index = 0;
+	     segment_index < 3;
+	     segment_index++ )
+	{
+		result = libcpath_path_view_get_previous_segment(
+		          &path_view,
+		          &segment,
+		          &segment_length,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "segment_length",
+		 segment_length,
+		 narrow_string_length( expected_segments[ segment_index ] ) );
+
+		result = narrow_string_compare(
+		          segment,
+		          expected_segments[ segment_index ],
+		          segment_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcpath_path_view_get_previous_segment(
+	          &path_view,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test forward and backward iteration meet in the middle
+	 */
+	result = libcpath_path_view_initialize(
+	          &path_view,
+	          path,
+	          17,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcpath_path_view_get_next_segment(
+	          &path_view,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcpath_path_view_get_previous_segment(
+	          &path_view,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcpath_path_view_get_previous_segment(
+	          &path_view,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_length",
+	 segment_length,
+	 (size_t) 3 );
+
+	result = narrow_string_compare(
+	          segment,
+	          "lib",
+	          3 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_view_get_next_segment(
+	          &path_view,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_view_get_previous_segment(
+	          NULL,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_view_get_previous_segment(
+	          &path_view,
+	          NULL,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_view_get_dirname, libcpath_path_view_get_basename
+ * and libcpath_path_view_get_extension functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_view_get_dirname_basename_extension(
+     void )
+{
+	char expected_directory_name[ 32 ];
+	char path[ 32 ];
+
+	libcpath_path_view_t path_view;
+
+	cpath_test_path_view_test_value_t *test_value = NULL;
+	libcerror_error_t *error                      = NULL;
+	const char *base_name                         = NULL;
+	const char *directory_name                    = NULL;
+	const char *extension                         = NULL;
+	size_t base_name_length                       = 0;
+	size_t directory_name_length                  = 0;
+	size_t extension_length                       = 0;
+	int result                                    = 0;
+	int test_value_index                          = 0;
+
+	/* Test regular cases
+	 */
+	for( test_value_index = 0;
+	     cpath_test_path_view_test_values[ test_value_index ].path != NULL;
+	     test_value_index++ )
+	{
+		test_value = &( cpath_test_path_view_test_values[ test_value_index ] );
+
+		cpath_test_path_view_copy_path(
+		 test_value->path,
+		 path,
+		 32 );
+
+		cpath_test_path_view_copy_path(
+		 test_value->directory_name,
+		 expected_directory_name,
+		 32 );
+
+		result = libcpath_path_view_initialize(
+		          &path_view,
+		          path,
+		          narrow_string_length( path ),
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libcpath_path_view_get_dirname(
+		          &path_view,
+		          &directory_name,
+		          &directory_name_length,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "directory_name_length",
+		 directory_name_length,
+		 narrow_string_length( expected_directory_name ) );
+
+		result = narrow_string_compare(
+		          directory_name,
+		          expected_directory_name,
+		          directory_name_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libcpath_path_view_get_basename(
+		          &path_view,
+		          &base_name,
+		          &base_name_length,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "base_name_length",
+		 base_name_length,
+		 narrow_string_length( test_value->base_name ) );
+
+		if( base_name_length == 1 )
+		{
+			/* The base name of the root is the separator
+			 */
+			result = ( base_name[ 0 ] == test_value->base_name[ 0 ] )
+			      || ( ( test_value->base_name[ 0 ] == '/' )
+			       &&  ( base_name[ 0 ] == LIBCPATH_SEPARATOR ) ) ? 0 : 1;
+		}
+		else
+		{
+			result = narrow_string_compare(
+			          base_name,
+			          test_value->base_name,
+			          base_name_length );
+		}
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libcpath_path_view_get_extension(
+		          &path_view,
+		          &extension,
+		          &extension_length,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 ( test_value->extension != NULL ) ? 1 : 0 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( test_value->extension != NULL )
+		{
+			CPATH_TEST_ASSERT_EQUAL_SIZE(
+			 "extension_length",
+			 extension_length,
+			 narrow_string_length( test_value->extension ) );
+
+			result = narrow_string_compare(
+			          extension,
+			          test_value->extension,
+			          extension_length );
+
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libcpath_path_view_get_dirname(
+	          NULL,
+	          &directory_name,
+	          &directory_name_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_view_get_dirname(
+	          &path_view,
+	          NULL,
+	          &directory_name_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_view_get_basename(
+	          NULL,
+	          &base_name,
+	          &base_name_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_view_get_basename(
+	          &path_view,
+	          &base_name,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_view_get_extension(
+	          NULL,
+	          &extension,
+	          &extension_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_view_get_extension(
+	          &path_view,
+	          NULL,
+	          &extension_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libcpath_path_view wide functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_view_wide(
+     void )
+{
+	wchar_t path[ 32 ];
+
+	libcpath_path_view_wide_t path_view;
+
+	libcerror_error_t *error = NULL;
+	const wchar_t *segment   = NULL;
+	size_t path_index        = 0;
+	size_t segment_length    = 0;
+	int result               = 0;
+
+	for( path_index = 0;
+	     path_index < 17;
+	     path_index++ )
+	{
+		if( "/usr//lib/file.so"[ path_index ] == '/' )
+		{
+			path[ path_index ] = (wchar_t) LIBCPATH_SEPARATOR;
+		}
+		else
+		{
+			path[ path_index ] = (wchar_t) "/usr//lib/file.so"[ path_index ];
+		}
+	}
+	path[ 17 ] = 0;
+
+	result = libcpath_path_view_initialize_wide(
+	          &path_view,
+	          path,
+	          17,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_view_get_next_segment_wide(
+	          &path_view,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = wide_string_compare(
+	          segment,
+	          L"usr",
+	          3 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_view_get_previous_segment_wide(
+	          &path_view,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_length",
+	 segment_length,
+	 (size_t) 7 );
+
+	result = libcpath_path_view_get_dirname_wide(
+	          &path_view,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_length",
+	 segment_length,
+	 (size_t) 9 );
+
+	result = libcpath_path_view_get_basename_wide(
+	          &path_view,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = wide_string_compare(
+	          segment,
+	          L"file.so",
+	          7 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_view_get_extension_wide(
+	          &path_view,
+	          &segment,
+	          &segment_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_length",
+	 segment_length,
+	 (size_t) 2 );
+
+	result = wide_string_compare(
+	          segment,
+	          L"so",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_view_initialize_wide(
+	          NULL,
+	          path,
+	          17,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( argc )
+	CPATH_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_view_initialize",
+	 cpath_test_path_view_initialize );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_view_get_next_segment",
+	 cpath_test_path_view_get_next_segment );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_view_get_previous_segment",
+	 cpath_test_path_view_get_previous_segment );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_view_get_dirname_basename_extension",
+	 cpath_test_path_view_get_dirname_basename_extension );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_view_wide",
+	 cpath_test_path_view_wide );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
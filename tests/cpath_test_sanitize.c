@@ -0,0 +1,604 @@
+/*
+ * Library sanitize functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_macros.h"
+#include "cpath_test_unused.h"
+
+#include "../libcpath/libcpath_definitions.h"
+#include "../libcpath/libcpath_path.h"
+#include "../libcpath/libcpath_sanitize.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+/* Fills a buffer with pseudo random characters
+ * Every character is replaced by a character that does not need to be escaped
+ * unless the pseudo random value is below the escape threshold
+ */
+void cpath_test_sanitize_fill_buffer(
+      uint8_t *buffer,
+      size_t buffer_size,
+      uint32_t *seed,
+      uint8_t escape_threshold )
+{
+	size_t buffer_index = 0;
+	uint32_t value      = 0;
+
+	for( buffer_index = 0;
+	     buffer_index < buffer_size;
+	     buffer_index++ )
+	{
+		*seed = ( *seed * 1103515245UL ) + 12345;
+		value = ( *seed >> 16 ) & 0xffff;
+
+		if( (uint8_t) ( value >> 8 ) < escape_threshold )
+		{
+			buffer[ buffer_index ] = (uint8_t) value;
+		}
+		else
+		{
+			buffer[ buffer_index ] = (uint8_t) 'a' + (uint8_t) ( value % 26 );
+		}
+	}
+}
+
+/* Determines the sanitized version of a string using the per character functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_sanitize_get_reference(
+     const char *string,
+     size_t string_length,
+     int is_filename,
+     char *sanitized_string,
+     size_t sanitized_string_size,
+     size_t *sanitized_string_length )
+{
+	size_t sanitized_character_size = 0;
+	size_t sanitized_string_index   = 0;
+	size_t string_index             = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( is_filename != 0 )
+		 && ( string[ string_index ] == LIBCPATH_SEPARATOR ) )
+		{
+			sanitized_character_size = 4;
+		}
+		else if( libcpath_path_get_sanitized_character_size(
+		          string[ string_index ],
+		          &sanitized_character_size,
+		          NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		if( libcpath_path_get_sanitized_character(
+		     string[ string_index ],
+		     sanitized_character_size,
+		     sanitized_string,
+		     sanitized_string_size,
+		     &sanitized_string_index,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	*sanitized_string_length = sanitized_string_index;
+
+	return( 1 );
+}
+
+/* Tests the libcpath_sanitize_get_unescaped_length function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_sanitize_get_unescaped_length(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t unescaped_length  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_sanitize_get_unescaped_length(
+	          "Program Files (x86)|test",
+	          24,
+	          0,
+	          &unescaped_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "unescaped_length",
+	 unescaped_length,
+	 (size_t) 19 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_sanitize_get_unescaped_length(
+	          "directory/subdirectory/filename.txt",
+	          35,
+	          '/',
+	          &unescaped_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "unescaped_length",
+	 unescaped_length,
+	 (size_t) 9 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_sanitize_get_unescaped_length(
+	          "",
+	          0,
+	          0,
+	          &unescaped_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "unescaped_length",
+	 unescaped_length,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_sanitize_get_unescaped_length(
+	          NULL,
+	          24,
+	          0,
+	          &unescaped_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_sanitize_get_unescaped_length(
+	          "test",
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &unescaped_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_sanitize_get_unescaped_length(
+	          "test",
+	          4,
+	          0,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_sanitize_get_unescaped_length_scalar function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_sanitize_get_unescaped_length_scalar(
+     void )
+{
+	uint8_t string[ 4 ];
+
+	size_t expected_length  = 0;
+	size_t unescaped_length = 0;
+	int character           = 0;
+
+	string[ 0 ] = 'a';
+	string[ 1 ] = 'b';
+	string[ 3 ] = 'c';
+
+	for( character = 0;
+	     character < 256;
+	     character++ )
+	{
+		string[ 2 ] = (uint8_t) character;
+
+		if( ( libcpath_sanitize_character_sizes[ character ] == 1 )
+		 && ( character != LIBCPATH_SEPARATOR ) )
+		{
+			expected_length = 4;
+		}
+		else
+		{
+			expected_length = 2;
+		}
+		unescaped_length = libcpath_sanitize_get_unescaped_length_scalar(
+		                    string,
+		                    4,
+		                    (uint8_t) LIBCPATH_SEPARATOR );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "unescaped_length",
+		 unescaped_length,
+		 expected_length );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#if defined( HAVE_LIBCPATH_SANITIZE_SSE2 )
+
+/* Tests a vectorized classifier function against libcpath_sanitize_get_unescaped_length_scalar
+ * Every character value is tested at every position of strings of 0 to 96 characters
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_sanitize_compare_classifier(
+     size_t (*get_unescaped_length_function)(
+             const uint8_t *string,
+             size_t string_length,
+             uint8_t escaped_character ) )
+{
+	uint8_t string[ 96 ];
+
+	size_t expected_length  = 0;
+	size_t string_index     = 0;
+	size_t string_length    = 0;
+	size_t unescaped_length = 0;
+	int character           = 0;
+	int escaped_character   = 0;
+
+	for( escaped_character = 0;
+	     escaped_character < 2;
+	     escaped_character++ )
+	{
+		for( string_length = 0;
+		     string_length <= 96;
+		     string_length++ )
+		{
+			for( string_index = 0;
+			     string_index < string_length;
+			     string_index++ )
+			{
+				for( character = 0;
+				     character < 256;
+				     character++ )
+				{
+					if( memory_set(
+					     string,
+					     'a',
+					     96 ) == NULL )
+					{
+						goto on_error;
+					}
+					string[ string_index ] = (uint8_t) character;
+
+					expected_length = libcpath_sanitize_get_unescaped_length_scalar(
+					                   string,
+					                   string_length,
+					                   ( escaped_character != 0 ) ? (uint8_t) LIBCPATH_SEPARATOR : 0 );
+
+					unescaped_length = get_unescaped_length_function(
+					                    string,
+					                    string_length,
+					                    ( escaped_character != 0 ) ? (uint8_t) LIBCPATH_SEPARATOR : 0 );
+
+					CPATH_TEST_ASSERT_EQUAL_SIZE(
+					 "unescaped_length",
+					 unescaped_length,
+					 expected_length );
+				}
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcpath_sanitize_get_unescaped_length_sse2 function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_sanitize_get_unescaped_length_sse2(
+     void )
+{
+	int result = 0;
+
+	result = cpath_test_sanitize_compare_classifier(
+	          &libcpath_sanitize_get_unescaped_length_sse2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBCPATH_SANITIZE_SSE2 ) */
+
+#if defined( HAVE_LIBCPATH_SANITIZE_AVX2 )
+
+/* Tests the libcpath_sanitize_get_unescaped_length_avx2 function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_sanitize_get_unescaped_length_avx2(
+     void )
+{
+	int result = 0;
+
+	if( libcpath_sanitize_has_avx2_support() == 0 )
+	{
+		return( 1 );
+	}
+	result = cpath_test_sanitize_compare_classifier(
+	          &libcpath_sanitize_get_unescaped_length_avx2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBCPATH_SANITIZE_AVX2 ) */
+
+/* Tests if the sanitized filename and path are equivalent to the output
+ * of the per character sanitize functions for sparse and dense escapes
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_sanitize_equivalence(
+     void )
+{
+	uint8_t string[ 256 ];
+	char expected_string[ 1025 ];
+	char sanitized_string[ 1025 ];
+
+	libcerror_error_t *error       = NULL;
+	size_t expected_string_length  = 0;
+	size_t sanitized_string_size   = 0;
+	uint32_t seed                  = 0x5eed;
+	int escape_threshold_index     = 0;
+	int is_filename                = 0;
+	int iteration                  = 0;
+	int result                     = 0;
+	uint8_t escape_thresholds[ 4 ] = { 0, 4, 64, 255 };
+
+	for( escape_threshold_index = 0;
+	     escape_threshold_index < 4;
+	     escape_threshold_index++ )
+	{
+		for( iteration = 0;
+		     iteration < 256;
+		     iteration++ )
+		{
+			cpath_test_sanitize_fill_buffer(
+			 string,
+			 (size_t) iteration + 1,
+			 &seed,
+			 escape_thresholds[ escape_threshold_index ] );
+
+			for( is_filename = 0;
+			     is_filename < 2;
+			     is_filename++ )
+			{
+				result = cpath_test_sanitize_get_reference(
+				          (char *) string,
+				          (size_t) iteration + 1,
+				          is_filename,
+				          expected_string,
+				          1025,
+				          &expected_string_length );
+
+				CPATH_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				if( is_filename != 0 )
+				{
+					result = libcpath_path_get_sanitized_filename_to_buffer(
+					          (char *) string,
+					          (size_t) iteration + 1,
+					          sanitized_string,
+					          1025,
+					          &sanitized_string_size,
+					          &error );
+				}
+				else
+				{
+					result = libcpath_path_get_sanitized_path_to_buffer(
+					          (char *) string,
+					          (size_t) iteration + 1,
+					          sanitized_string,
+					          1025,
+					          &sanitized_string_size,
+					          &error );
+				}
+				CPATH_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				CPATH_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				CPATH_TEST_ASSERT_EQUAL_SIZE(
+				 "sanitized_string_size",
+				 sanitized_string_size,
+				 expected_string_length + 1 );
+
+				result = memory_compare(
+				          sanitized_string,
+				          expected_string,
+				          expected_string_length );
+
+				CPATH_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( argc )
+	CPATH_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+	CPATH_TEST_RUN(
+	 "libcpath_sanitize_get_unescaped_length",
+	 cpath_test_sanitize_get_unescaped_length );
+
+	CPATH_TEST_RUN(
+	 "libcpath_sanitize_get_unescaped_length_scalar",
+	 cpath_test_sanitize_get_unescaped_length_scalar );
+
+#if defined( HAVE_LIBCPATH_SANITIZE_SSE2 )
+
+	CPATH_TEST_RUN(
+	 "libcpath_sanitize_get_unescaped_length_sse2",
+	 cpath_test_sanitize_get_unescaped_length_sse2 );
+
+#endif /* defined( HAVE_LIBCPATH_SANITIZE_SSE2 ) */
+
+#if defined( HAVE_LIBCPATH_SANITIZE_AVX2 )
+
+	CPATH_TEST_RUN(
+	 "libcpath_sanitize_get_unescaped_length_avx2",
+	 cpath_test_sanitize_get_unescaped_length_avx2 );
+
+#endif /* defined( HAVE_LIBCPATH_SANITIZE_AVX2 ) */
+
+	CPATH_TEST_RUN(
+	 "libcpath_sanitize_equivalence",
+	 cpath_test_sanitize_equivalence );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+}
+
@@ -39,6 +39,399 @@
 
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libcpath_system_string_get_ascii_length function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_system_string_get_ascii_length(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t ascii_length      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_system_string_get_ascii_length(
+	          "test string",
+	          12,
+	          &ascii_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 11 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_system_string_get_ascii_length(
+	          "/home/user/documents/test.txt",
+	          29,
+	          &ascii_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 29 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_system_string_get_ascii_length(
+	          "/home/user\0/documents",
+	          22,
+	          &ascii_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 10 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_system_string_get_ascii_length(
+	          "/home/user/b\xc3\xa4r",
+	          16,
+	          &ascii_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_system_string_get_ascii_length(
+	          NULL,
+	          12,
+	          &ascii_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_get_ascii_length(
+	          "test string",
+	          (size_t) -1,
+	          &ascii_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_get_ascii_length(
+	          "test string",
+	          12,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_system_string_decode_narrow_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_system_string_decode_narrow_string(
+     void )
+{
+	wchar_t wide_string[ 32 ];
+
+	libcerror_error_t *error         = NULL;
+	size_t required_wide_string_size = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_system_string_decode_narrow_string(
+	          "test string",
+	          12,
+	          NULL,
+	          0,
+	          &required_wide_string_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_wide_string_size",
+	 required_wide_string_size,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_system_string_decode_narrow_string(
+	          "test string",
+	          12,
+	          wide_string,
+	          32,
+	          &required_wide_string_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_wide_string_size",
+	 required_wide_string_size,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          wide_string,
+	          L"test string",
+	          12 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#if SIZEOF_WCHAR_T == 4
+
+	/* Test a string with non-ASCII characters decoded into a wide string
+	 * of the upper bound size
+	 */
+	result = libcpath_system_string_decode_narrow_string(
+	          "/home/user/b\xc3\xa4r",
+	          16,
+	          NULL,
+	          0,
+	          &required_wide_string_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_wide_string_size",
+	 required_wide_string_size,
+	 (size_t) 15 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_system_string_decode_narrow_string(
+	          "/home/user/b\xc3\xa4r",
+	          16,
+	          wide_string,
+	          17,
+	          &required_wide_string_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_wide_string_size",
+	 required_wide_string_size,
+	 (size_t) 15 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          wide_string,
+	          L"/home/user/b\x00e4r",
+	          15 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#endif /* SIZEOF_WCHAR_T == 4 */
+
+	/* Test error cases
+	 */
+	result = libcpath_system_string_decode_narrow_string(
+	          NULL,
+	          12,
+	          wide_string,
+	          32,
+	          &required_wide_string_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_decode_narrow_string(
+	          "test string",
+	          12,
+	          wide_string,
+	          (size_t) -1,
+	          &required_wide_string_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_decode_narrow_string(
+	          "test string",
+	          12,
+	          wide_string,
+	          32,
+	          NULL,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_decode_narrow_string(
+	          "test string",
+	          12,
+	          wide_string,
+	          8,
+	          &required_wide_string_size,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 /* Tests the libcpath_system_string_size_to_narrow_string function
  * Returns 1 if successful or 0 if not
  */
@@ -53,6 +446,7 @@ int cpath_test_system_string_size_to_narrow_string(
 	          _SYSTEM_STRING( "test string" ),
 	          12,
 	          &narrow_string_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -75,6 +469,7 @@ int cpath_test_system_string_size_to_narrow_string(
 	          NULL,
 	          12,
 	          &narrow_string_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -93,6 +488,7 @@ int cpath_test_system_string_size_to_narrow_string(
 	          _SYSTEM_STRING( "test string" ),
 	          (size_t) -1,
 	          &narrow_string_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -111,6 +507,7 @@ int cpath_test_system_string_size_to_narrow_string(
 	          _SYSTEM_STRING( "test string" ),
 	          12,
 	          NULL,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -152,6 +549,7 @@ int cpath_test_system_string_copy_to_narrow_string(
 	          12,
 	          narrow_string,
 	          32,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -170,6 +568,7 @@ int cpath_test_system_string_copy_to_narrow_string(
 	          12,
 	          narrow_string,
 	          32,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -189,6 +588,7 @@ int cpath_test_system_string_copy_to_narrow_string(
 	          (size_t) -1,
 	          narrow_string,
 	          32,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -208,6 +608,7 @@ int cpath_test_system_string_copy_to_narrow_string(
 	          12,
 	          NULL,
 	          32,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -227,6 +628,7 @@ int cpath_test_system_string_copy_to_narrow_string(
 	          12,
 	          narrow_string,
 	          (size_t) -1,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -246,6 +648,7 @@ int cpath_test_system_string_copy_to_narrow_string(
 	          12,
 	          narrow_string,
 	          8,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -287,6 +690,7 @@ int cpath_test_system_string_size_from_narrow_string(
 	          "test string",
 	          12,
 	          &system_string_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -309,6 +713,7 @@ int cpath_test_system_string_size_from_narrow_string(
 	          NULL,
 	          12,
 	          &system_string_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -327,6 +732,7 @@ int cpath_test_system_string_size_from_narrow_string(
 	          "test string",
 	          (size_t) -1,
 	          &system_string_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -345,6 +751,7 @@ int cpath_test_system_string_size_from_narrow_string(
 	          "test string",
 	          12,
 	          NULL,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -386,6 +793,7 @@ int cpath_test_system_string_copy_from_narrow_string(
 	          32,
 	          "test string",
 	          12,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -404,6 +812,7 @@ int cpath_test_system_string_copy_from_narrow_string(
 	          32,
 	          "test string",
 	          12,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -423,6 +832,7 @@ int cpath_test_system_string_copy_from_narrow_string(
 	          (size_t) -1,
 	          "test string",
 	          12,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -442,6 +852,7 @@ int cpath_test_system_string_copy_from_narrow_string(
 	          32,
 	          NULL,
 	          12,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -461,6 +872,7 @@ int cpath_test_system_string_copy_from_narrow_string(
 	          32,
 	          "test string",
 	          (size_t) -1,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -480,6 +892,7 @@ int cpath_test_system_string_copy_from_narrow_string(
 	          8,
 	          "test string",
 	          12,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -523,6 +936,7 @@ int cpath_test_system_string_size_to_wide_string(
 	          _SYSTEM_STRING( "test string" ),
 	          12,
 	          &wide_string_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -545,6 +959,7 @@ int cpath_test_system_string_size_to_wide_string(
 	          NULL,
 	          12,
 	          &wide_string_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -563,6 +978,7 @@ int cpath_test_system_string_size_to_wide_string(
 	          _SYSTEM_STRING( "test string" ),
 	          (size_t) -1,
 	          &wide_string_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -581,6 +997,7 @@ int cpath_test_system_string_size_to_wide_string(
 	          _SYSTEM_STRING( "test string" ),
 	          12,
 	          NULL,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -622,6 +1039,7 @@ int cpath_test_system_string_copy_to_wide_string(
 	          12,
 	          wide_string,
 	          32,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -640,6 +1058,7 @@ int cpath_test_system_string_copy_to_wide_string(
 	          12,
 	          wide_string,
 	          32,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -659,6 +1078,7 @@ int cpath_test_system_string_copy_to_wide_string(
 	          (size_t) -1,
 	          wide_string,
 	          32,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -678,6 +1098,7 @@ int cpath_test_system_string_copy_to_wide_string(
 	          12,
 	          NULL,
 	          32,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -697,6 +1118,7 @@ int cpath_test_system_string_copy_to_wide_string(
 	          12,
 	          wide_string,
 	          (size_t) -1,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -716,6 +1138,7 @@ int cpath_test_system_string_copy_to_wide_string(
 	          12,
 	          wide_string,
 	          8,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -757,6 +1180,7 @@ int cpath_test_system_string_size_from_wide_string(
 	          L"test string",
 	          12,
 	          &system_string_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -779,6 +1203,7 @@ int cpath_test_system_string_size_from_wide_string(
 	          NULL,
 	          12,
 	          &system_string_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -797,6 +1222,7 @@ int cpath_test_system_string_size_from_wide_string(
 	          L"test string",
 	          (size_t) -1,
 	          &system_string_size,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -815,6 +1241,7 @@ int cpath_test_system_string_size_from_wide_string(
 	          L"test string",
 	          12,
 	          NULL,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -856,6 +1283,7 @@ int cpath_test_system_string_copy_from_wide_string(
 	          32,
 	          L"test string",
 	          12,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -874,6 +1302,7 @@ int cpath_test_system_string_copy_from_wide_string(
 	          32,
 	          L"test string",
 	          12,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -893,6 +1322,7 @@ int cpath_test_system_string_copy_from_wide_string(
 	          (size_t) -1,
 	          L"test string",
 	          12,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -912,6 +1342,7 @@ int cpath_test_system_string_copy_from_wide_string(
 	          32,
 	          NULL,
 	          12,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -931,6 +1362,7 @@ int cpath_test_system_string_copy_from_wide_string(
 	          32,
 	          L"test string",
 	          (size_t) -1,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -950,6 +1382,7 @@ int cpath_test_system_string_copy_from_wide_string(
 	          8,
 	          L"test string",
 	          12,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -998,6 +1431,18 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	CPATH_TEST_RUN(
+	 "libcpath_system_string_get_ascii_length",
+	 cpath_test_system_string_get_ascii_length );
+
+	CPATH_TEST_RUN(
+	 "libcpath_system_string_decode_narrow_string",
+	 cpath_test_system_string_decode_narrow_string );
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 	CPATH_TEST_RUN(
 	 "libcpath_system_string_size_to_narrow_string",
 	 cpath_test_system_string_size_to_narrow_string );
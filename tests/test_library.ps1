@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "error path support system_string"
+$LibraryTests = "allocator arena context directory_cache directory_plan error path path_builder path_view sanitize support system_string"
 $LibraryTestsWithInput = ""
 $OptionSets = ""
 
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="error path support system_string";
+LIBRARY_TESTS="allocator arena context directory_cache directory_plan error path path_builder path_view sanitize support system_string";
 LIBRARY_TESTS_WITH_INPUT="";
 OPTION_SETS=();
 